@@ -46,6 +46,12 @@ namespace BinRenderer
 		float fpsUpdateInterval = 0.1f;
 		float gpuTimeUpdateInterval = 0.1f;
 
+		// JobSystem 워커 스레드 수 (0이면 하드웨어 스레드 수 - 1)
+		uint32_t workerThreadCount = 0;
+
+		// RenderGraph 패스를 여러 스레드에서 기록 (패스 execute()가 스레드 안전해야 함)
+		bool enableParallelCommandRecording = false;
+
 		// ========================================
 		// Helper Methods
 		// ========================================
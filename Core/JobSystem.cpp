@@ -0,0 +1,265 @@
+﻿#include "JobSystem.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		// 현재 스레드의 워커 인덱스 (0: 메인 스레드, UINT32_MAX: 워커가 아닌 스레드)
+		thread_local uint32_t tlsWorkerIndex = UINT32_MAX;
+	}
+
+	JobSystem& JobSystem::getInstance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	JobSystem::~JobSystem()
+	{
+		shutdown();
+	}
+
+	void JobSystem::initialize(uint32_t workerThreadCount)
+	{
+		if (running_) {
+			return;
+		}
+
+		if (workerThreadCount == 0) {
+			workerThreadCount = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+		}
+
+		queues_.clear();
+		for (uint32_t i = 0; i <= workerThreadCount; ++i) {
+			queues_.push_back(std::make_unique<WorkQueue>());
+		}
+
+		tlsWorkerIndex = 0;
+		running_ = true;
+
+		workers_.reserve(workerThreadCount);
+		for (uint32_t i = 1; i <= workerThreadCount; ++i) {
+			workers_.emplace_back(&JobSystem::workerLoop, this, i);
+		}
+
+		printLog(" JobSystem initialized ({} worker threads + main thread)", workerThreadCount);
+	}
+
+	void JobSystem::shutdown()
+	{
+		if (!running_) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex_);
+			running_ = false;
+		}
+		wakeCondition_.notify_all();
+
+		for (auto& worker : workers_) {
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+		workers_.clear();
+
+		// 워커가 종료되기 전에 남은 작업은 호출 스레드에서 마저 실행
+		Job job;
+		while (tryPop(tlsWorkerIndex, job)) {
+			execute(job);
+		}
+
+		queues_.clear();
+		tlsWorkerIndex = UINT32_MAX;
+	}
+
+	// ========================================
+	// 작업 제출
+	// ========================================
+
+	void JobSystem::run(std::function<void()> job, JobCounter* counter, JobCounter* dependency)
+	{
+		Job entry{ std::move(job), counter };
+		if (counter) {
+			counter->pending_.fetch_add(1, std::memory_order_acq_rel);
+		}
+
+		if (dependency) {
+			std::lock_guard<std::mutex> lock(dependency->continuationMutex_);
+			if (!dependency->isDone()) {
+				dependency->continuations_.push_back(std::move(entry));
+				return;
+			}
+		}
+
+		push(std::move(entry));
+	}
+
+	void JobSystem::parallelFor(uint32_t count, uint32_t minBatchSize, const RangeFunction& function)
+	{
+		if (count == 0) {
+			return;
+		}
+
+		// 스레드당 몇 개의 구간을 만들어 작업 크기가 고르지 않아도 훔쳐 가며 균형을 맞춤
+		const uint32_t threadCount = std::max(getThreadCount(), 1u);
+		const uint32_t batchSize = std::max(minBatchSize, 1u);
+		const uint32_t batchCount = std::min((count + batchSize - 1) / batchSize, threadCount * 4);
+
+		if (batchCount <= 1 || threadCount <= 1) {
+			function(0, count);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t batch = 1; batch < batchCount; ++batch) {
+			const uint32_t begin = static_cast<uint32_t>(uint64_t(count) * batch / batchCount);
+			const uint32_t end = static_cast<uint32_t>(uint64_t(count) * (batch + 1) / batchCount);
+			run([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		// 첫 구간은 호출 스레드가 직접 실행
+		function(0, static_cast<uint32_t>(uint64_t(count) / batchCount));
+
+		wait(counter);
+	}
+
+	void JobSystem::wait(JobCounter& counter)
+	{
+		while (!counter.isDone()) {
+			Job job;
+			if (tryPop(tlsWorkerIndex, job)) {
+				execute(job);
+			} else {
+				std::this_thread::yield();
+			}
+		}
+
+		// 마지막 작업의 finish()가 카운터를 놓을 때까지 기다려야 호출자가 카운터를 해제해도 안전
+		std::lock_guard<std::mutex> lock(counter.continuationMutex_);
+	}
+
+	// ========================================
+	// 내부 구현
+	// ========================================
+
+	void JobSystem::workerLoop(uint32_t workerIndex)
+	{
+		tlsWorkerIndex = workerIndex;
+
+		while (true) {
+			Job job;
+			if (tryPop(workerIndex, job)) {
+				execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleepMutex_);
+			wakeCondition_.wait(lock, [this]() { return !running_ || queuedJobs_.load() > 0; });
+			if (!running_) {
+				break;
+			}
+		}
+	}
+
+	void JobSystem::push(Job job)
+	{
+		// 초기화 전에는 호출 스레드에서 즉시 실행
+		if (queues_.empty()) {
+			execute(job);
+			return;
+		}
+
+		const uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+		uint32_t index = tlsWorkerIndex;
+		if (index >= queueCount) {
+			index = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queueCount;
+		}
+
+		// 덱에 넣기 전에 증가시켜 queuedJobs_가 실제 개수보다 작아지지 않게 함
+		queuedJobs_.fetch_add(1, std::memory_order_acq_rel);
+		{
+			std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+			queues_[index]->jobs.push_back(std::move(job));
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex_);
+		}
+		wakeCondition_.notify_one();
+	}
+
+	bool JobSystem::tryPop(uint32_t workerIndex, Job& job)
+	{
+		if (queuedJobs_.load(std::memory_order_acquire) == 0) {
+			return false;
+		}
+
+		const uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+
+		// 자기 덱: 가장 최근 작업 (LIFO)
+		if (workerIndex < queueCount) {
+			WorkQueue& own = *queues_[workerIndex];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if (!own.jobs.empty()) {
+				job = std::move(own.jobs.back());
+				own.jobs.pop_back();
+				queuedJobs_.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+
+		// 다른 덱에서 훔치기: 가장 오래된 작업 (FIFO)
+		const uint32_t start = workerIndex < queueCount ? workerIndex + 1 : 0;
+		for (uint32_t i = 0; i < queueCount; ++i) {
+			const uint32_t victim = (start + i) % queueCount;
+			if (victim == workerIndex) {
+				continue;
+			}
+
+			WorkQueue& queue = *queues_[victim];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				job = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+				queuedJobs_.fetch_sub(1, std::memory_order_acq_rel);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void JobSystem::execute(Job& job)
+	{
+		if (job.function) {
+			job.function();
+		}
+		finish(job.counter);
+	}
+
+	void JobSystem::finish(JobCounter* counter)
+	{
+		if (!counter) {
+			return;
+		}
+
+		// 감소와 후속 작업 수거를 같은 잠금 안에서 해야 run()의 의존성 등록과 경쟁하지 않음
+		std::vector<Job> ready;
+		{
+			std::lock_guard<std::mutex> lock(counter->continuationMutex_);
+			if (counter->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				ready.swap(counter->continuations_);
+			}
+		}
+
+		for (auto& job : ready) {
+			push(std::move(job));
+		}
+	}
+
+} // namespace BinRenderer
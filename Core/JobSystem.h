@@ -0,0 +1,128 @@
+﻿#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BinRenderer
+{
+	class JobSystem;
+
+	/**
+	 * @brief 작업 완료 카운터
+	 *
+	 * run()에 넘기면 작업 하나당 1 증가하고 작업이 끝나면 1 감소
+	 * 다른 작업의 선행 조건(dependency)으로 쓰면 0이 되는 순간 대기 중인 작업이 큐에 들어감
+	 */
+	class JobCounter
+	{
+	public:
+		bool isDone() const { return pending_.load(std::memory_order_acquire) == 0; }
+		uint32_t getPending() const { return pending_.load(std::memory_order_acquire); }
+
+	private:
+		friend class JobSystem;
+
+		struct Job
+		{
+			std::function<void()> function;
+			JobCounter* counter = nullptr;
+		};
+
+		std::atomic<uint32_t> pending_{ 0 };
+		std::mutex continuationMutex_;
+		std::vector<Job> continuations_;  // 이 카운터가 0이 되기를 기다리는 작업
+	};
+
+	/**
+	 * @brief Work-Stealing 작업 스케줄러
+	 *
+	 * - 워커마다 작업 덱: 자기 덱은 뒤에서(LIFO, 캐시 친화), 다른 워커 덱은 앞에서(FIFO) 훔쳐 옴
+	 * - 메인 스레드는 0번 워커로 취급되며 wait()에서 대기하는 동안 작업을 직접 실행
+	 * - initialize() 전이나 워커가 0개면 모든 작업을 호출 스레드에서 즉시 실행
+	 *
+	 * @example
+	 * JobSystem::getInstance().parallelFor(nodeCount, 64, [&](uint32_t begin, uint32_t end) {
+	 *     for (uint32_t i = begin; i < end; ++i) updateNode(i);
+	 * });
+	 */
+	class JobSystem
+	{
+	public:
+		using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+		static JobSystem& getInstance();
+
+		~JobSystem();
+
+		/**
+		 * @brief 워커 스레드 시작 (호출한 스레드가 메인/0번 워커가 됨)
+		 * @param workerThreadCount 추가로 만들 워커 수 (0이면 하드웨어 스레드 수 - 1)
+		 */
+		void initialize(uint32_t workerThreadCount = 0);
+
+		/**
+		 * @brief 남은 작업을 모두 실행한 뒤 워커 스레드 종료
+		 */
+		void shutdown();
+
+		/**
+		 * @brief 작업을 실행할 수 있는 스레드 수 (메인 스레드 포함)
+		 */
+		uint32_t getThreadCount() const { return static_cast<uint32_t>(queues_.size()); }
+
+		/**
+		 * @brief 작업 제출
+		 * @param job 실행할 함수
+		 * @param counter 완료를 추적할 카운터 (nullptr 가능)
+		 * @param dependency 이 카운터가 0이 된 뒤에 실행 (nullptr이면 즉시 실행 가능)
+		 */
+		void run(std::function<void()> job, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+		/**
+		 * @brief [0, count)를 minBatchSize 이상의 구간으로 나누어 병렬 실행하고 모두 끝날 때까지 대기
+		 */
+		void parallelFor(uint32_t count, uint32_t minBatchSize, const RangeFunction& function);
+
+		/**
+		 * @brief 카운터가 0이 될 때까지 대기 (대기하는 동안 큐의 작업을 실행)
+		 */
+		void wait(JobCounter& counter);
+
+	private:
+		using Job = JobCounter::Job;
+
+		// 워커별 작업 덱
+		struct WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		JobSystem() = default;
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		void workerLoop(uint32_t workerIndex);
+		void push(Job job);
+		bool tryPop(uint32_t workerIndex, Job& job);
+		void execute(Job& job);
+		void finish(JobCounter* counter);
+
+		std::vector<std::unique_ptr<WorkQueue>> queues_;  // [0]: 메인 스레드
+		std::vector<std::thread> workers_;
+		std::atomic<uint32_t> queuedJobs_{ 0 };
+		std::atomic<uint32_t> nextQueue_{ 0 };  // 워커가 아닌 스레드의 제출 분산용
+		std::atomic<bool> running_{ false };
+
+		std::mutex sleepMutex_;
+		std::condition_variable wakeCondition_;
+	};
+
+} // namespace BinRenderer
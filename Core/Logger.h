@@ -7,6 +7,7 @@
 #include <cassert>
 #include <string>
 #include <format>
+#include <mutex>
 
 namespace BinRenderer
 {
@@ -25,6 +26,7 @@ namespace BinRenderer
 
 		ofstream logFile;
 		size_t messagesProcessed;
+		mutex logMutex; // 작업 스레드(병렬 커맨드 기록 등)에서도 호출되므로 출력 직렬화
 
 		// 싱글톤 생성자
 		Logger() : messagesProcessed(0)
@@ -76,6 +78,7 @@ namespace BinRenderer
 		static void printLog(string message)
 		{
 			auto& logger = getInstance();
+			lock_guard<mutex> lock(logger.logMutex);
 
 			cout << message << endl;
 
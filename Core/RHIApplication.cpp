@@ -1,8 +1,13 @@
 #include "RHIApplication.h"
 #include "RHIScene.h"
+#include "JobSystem.h"
 #include "Logger.h"
 #include "../Platform/WindowFactory.h"
 #include "../RenderPass/ForwardPassRG.h"
+#include "../RenderPass/GpuCullingPassRG.h"
+#include "../RenderPass/DepthPrepassRG.h"
+#include "../RenderPass/HiZPassRG.h"
+#include "../RenderPass/SkinningPassRG.h"
 #include <chrono>
 #include <memory>
 
@@ -41,6 +46,60 @@ namespace BinRenderer
 			auto forwardPass = std::make_unique<ForwardPassRG>(rhi_.get(), scene_.get(), renderer_.get());
 			if (forwardPass->initialize())
 			{
+				// 스킨드 노드는 컴퓨트로 프레임당 한 번만 스키닝하고 이후 패스는 캐시된 정점을 읽음
+				if (renderer_->getSkinningCache() && forwardPass->usesBonePalettes())
+				{
+					auto skinning = std::make_unique<SkinningPassRG>(rhi_.get(), renderer_.get());
+					SkinningPassRG* skinningPass = skinning.get();
+					renderGraph_->addPass(std::move(skinning));
+					forwardPass->setSkinnedVerticesHandle(skinningPass->getSkinnedVerticesHandle());
+					renderer_->setPreSkinningEnabled(true);
+					printLog("    Compute pre-skinning enabled (SkinningPassRG + skinned vertex cache)");
+				}
+
+				// GPU 컬링을 쓸 수 있으면 컬링 패스를 먼저 두고 Forward는 Indirect로 드로우
+				if (forwardPass->hasIndirectPipeline())
+				{
+					auto prepass = std::make_unique<DepthPrepassRG>(rhi_.get(), renderer_.get());
+					if (renderer_->getHiZPyramid() && prepass->initialize())
+					{
+						// 2단계 가림막 컬링: Early → Depth 프리패스 → Hi-Z → Late → Forward
+						using Phase = RHIGpuCuller::Phase;
+						auto early = std::make_unique<GpuCullingPassRG>(rhi_.get(), renderer_.get(), Phase::Early);
+						GpuCullingPassRG* earlyPass = early.get();
+						renderGraph_->addPass(std::move(early));
+
+						prepass->setDrawCommandHandles(earlyPass->getCommandsHandle(), earlyPass->getDrawCountHandle());
+						DepthPrepassRG* prepassPtr = prepass.get();
+						renderGraph_->addPass(std::move(prepass));
+
+						auto hiZ = std::make_unique<HiZPassRG>(rhi_.get(), renderer_.get());
+						hiZ->setDepthHandle(prepassPtr->getDepthHandle());
+						hiZ->setHiZHandle(earlyPass->getHiZHandle());
+						HiZPassRG* hiZPass = hiZ.get();
+						renderGraph_->addPass(std::move(hiZ));
+
+						auto late = std::make_unique<GpuCullingPassRG>(rhi_.get(), renderer_.get(), Phase::Late);
+						late->setHiZHandle(hiZPass->getHiZHandle());
+						late->setVisibilityHandle(earlyPass->getVisibilityHandle());
+						GpuCullingPassRG* latePass = late.get();
+						renderGraph_->addPass(std::move(late));
+						forwardPass->setDrawCommandHandles(latePass->getCommandsHandle(), latePass->getDrawCountHandle(),
+							latePass->getClusterIndicesHandle());
+						printLog("    GPU-driven culling enabled (two-phase Hi-Z occlusion + indirect draw)");
+					}
+					else
+					{
+						auto cull = std::make_unique<GpuCullingPassRG>(rhi_.get(), renderer_.get());
+						GpuCullingPassRG* cullPass = cull.get();
+						renderGraph_->addPass(std::move(cull));
+						forwardPass->setDrawCommandHandles(cullPass->getCommandsHandle(), cullPass->getDrawCountHandle(),
+							cullPass->getClusterIndicesHandle());
+						printLog("    GPU-driven culling enabled (GpuCullingPassRG + indirect draw)");
+					}
+					renderer_->setGpuDrivenRendering(true);
+				}
+
 				renderGraph_->addPass(std::move(forwardPass));
 				printLog("    Default ForwardPassRG added (with Scene and Renderer)");
 			}
@@ -84,6 +143,9 @@ namespace BinRenderer
 		printLog("Window: {}x{}", config_.windowWidth, config_.windowHeight);
 		printLog("Title: {}", config_.windowTitle);
 
+		// 0. JobSystem 시작 (이 스레드가 메인 워커)
+		JobSystem::getInstance().initialize(config_.workerThreadCount);
+
 		// 1. Window 생성 (플랫폼 독립적)
 		window_ = WindowFactory::create(WindowBackend::Auto);
 		if (!window_)
@@ -168,6 +230,20 @@ namespace BinRenderer
 
 		// 7. RenderGraph 생성
 		renderGraph_ = std::make_unique<RenderGraph>(rhi_.get());
+		if (config_.enableParallelCommandRecording)
+		{
+			renderGraph_->setParallelRecording(JobSystem::getInstance().getThreadCount(),
+				[](uint32_t taskCount, const std::function<void(uint32_t)>& task)
+				{
+					JobSystem::getInstance().parallelFor(taskCount, 1, [&task](uint32_t begin, uint32_t end)
+						{
+							for (uint32_t i = begin; i < end; ++i)
+							{
+								task(i);
+							}
+						});
+				});
+		}
 		setupDefaultRenderGraph();
 		printLog(" RenderGraph created");
 
@@ -238,7 +314,7 @@ namespace BinRenderer
 			rhi_.reset();
 		}
 
-		// 7. Window 정리 (마지막)
+		// 7. Window 정리
 		if (window_)
 		{
 			printLog("   Destroying Window...");
@@ -246,6 +322,9 @@ namespace BinRenderer
 			window_.reset();
 		}
 
+		// 8. JobSystem 종료
+		JobSystem::getInstance().shutdown();
+
 		initialized_ = false;
 		printLog(" RHIApplication shutdown complete");
 	}
@@ -269,6 +348,7 @@ namespace BinRenderer
 		printLog("=== Starting main loop ===");
 
 		lastFrameTime_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+		fpsWindowStart_ = lastFrameTime_;
 
 		// 플랫폼 독립적 이벤트 루프
 		while (!window_->shouldClose() && running_)
@@ -294,10 +374,35 @@ namespace BinRenderer
 
 			frameIndex_++;
 
-			// 60 프레임마다 로그
+			// 60 프레임마다 로그 (FPS는 마지막 한 프레임이 아닌 60 프레임 평균)
 			if (frameIndex_ % 60 == 0)
 			{
-				printLog("⏱️  Frame {}: {:.2f} FPS", frameIndex_, 1.0f / deltaTime_);
+				const double windowSeconds = lastFrameTime_ - fpsWindowStart_;
+				fpsWindowStart_ = lastFrameTime_;
+				printLog("⏱️  Frame {}: {:.2f} FPS", frameIndex_, windowSeconds > 0.0 ? 60.0 / windowSeconds : 0.0);
+
+				if (renderer_)
+				{
+					const CullingStats& culling = renderer_->getCullingStats();
+					if (culling.gpuDriven)
+					{
+						printLog("   Culling: {} / {} meshes rendered ({} culled on GPU, indirect draw)",
+							culling.renderedMeshes, culling.totalMeshes, culling.culledMeshes);
+					}
+					else
+					{
+						printLog("   Culling: {} / {} meshes rendered ({} culled, {} occluded by {} occluders)",
+							culling.renderedMeshes, culling.totalMeshes, culling.culledMeshes,
+							culling.occludedMeshes, culling.occluderCount);
+					}
+				}
+
+				// 최근 60 프레임의 바인딩 수 (같은 상태 재바인딩은 커맨드 버퍼가 생략)
+				const RHIBindStats bindStats = rhi_->getBindStats();
+				printLog("   Binds: {} pipeline, {} descriptor set, {} vertex, {} index ({} redundant skipped)",
+					bindStats.pipelineBinds, bindStats.descriptorSetBinds,
+					bindStats.vertexBufferBinds, bindStats.indexBufferBinds, bindStats.getSkippedCount());
+				rhi_->resetBindStats();
 			}
 		}
 
@@ -323,6 +428,10 @@ namespace BinRenderer
 		{
 			uint32_t currentFrame = frameIndex_ % config_.maxFramesInFlight;
 			renderer_->updateUniforms(camera_, *scene_, currentFrame, lastFrameTime_);
+
+			// 셰이더와 같은 카메라로 메시 단위 Frustum Culling
+			renderer_->updateViewFrustum(camera_.getViewProjectionMatrix());
+			renderer_->performFrustumCulling(*scene_);
 		}
 
 		// 리스너 업데이트
@@ -334,6 +443,18 @@ namespace BinRenderer
 
 	void RHIApplication::renderFrame(uint32_t frameIndex)
 	{
+		// 본 팔레트 + 스키닝 작업 기록 (패스 기록 전, 슬롯의 이전 프레임은 beginFrame에서 끝난 상태)
+		if (renderer_)
+		{
+			renderer_->updateBoneData();
+		}
+
+		// GPU 컬링 레코드 버퍼 갱신 (패스 기록 전, 슬롯의 이전 프레임은 beginFrame에서 끝난 상태)
+		if (renderer_ && renderer_->isGpuDrivenRendering())
+		{
+			renderer_->getGpuCuller()->prepareFrame();
+		}
+
 		// RenderGraph 실행
 		if (renderGraph_)
 		{
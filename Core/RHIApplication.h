@@ -135,6 +135,7 @@ namespace BinRenderer
 		// 프레임 정보
 		float deltaTime_ = 0.0f;
 		double lastFrameTime_ = 0.0;
+		double fpsWindowStart_ = 0.0;  // 60 프레임 FPS 평균 구간 시작
 		uint32_t frameIndex_ = 0;
 		bool initialized_ = false;
 		bool running_ = false;
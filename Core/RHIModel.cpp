@@ -1,11 +1,21 @@
 ﻿#include "RHIModel.h"
 #include "Logger.h"
+#include "../RHI/Resources/RHIUploadManager.h"
+#include "../Rendering/RHIMeshOptimizer.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <algorithm>
+#include <cfloat>
 
 namespace BinRenderer
 {
+	namespace
+	{
+		constexpr uint32_t kMinInstanceCapacity = 16;
+		constexpr uint32_t kInstanceBufferRetireFrames = 4;  // 프레임 슬롯 수(maxFramesInFlight)보다 넉넉하게
+	}
+
 	RHIModel::RHIModel(RHI* rhi)
 		: rhi_(rhi)
 	{
@@ -48,15 +58,19 @@ namespace BinRenderer
 			// 정점 데이터
 			std::vector<RHIVertex> vertices;
 			vertices.resize(aiMesh->mNumVertices);
+			AABB bounds(glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX));
 			for (uint32_t j = 0; j < aiMesh->mNumVertices; ++j)
 			{
 				RHIVertex& vertex = vertices[j];
 				
-				vertex.setPosition(glm::vec3(
+				const glm::vec3 position(
 					aiMesh->mVertices[j].x,
 					aiMesh->mVertices[j].y,
 					aiMesh->mVertices[j].z
-				));
+				);
+				vertex.setPosition(position);
+				bounds.min = glm::min(bounds.min, position);
+				bounds.max = glm::max(bounds.max, position);
 
 				if (aiMesh->HasNormals())
 				{
@@ -90,21 +104,28 @@ namespace BinRenderer
 				}
 			}
 
-			// 인덱스 데이터
+			// 인덱스 데이터 (aiProcess_Triangulate 이후라 면당 3개, 점/선 프리미티브만 예외)
 			std::vector<uint32_t> indices;
+			indices.reserve(static_cast<size_t>(aiMesh->mNumFaces) * 3);
 			for (uint32_t j = 0; j < aiMesh->mNumFaces; ++j)
 			{
 				const aiFace& face = aiMesh->mFaces[j];
-				for (uint32_t k = 0; k < face.mNumIndices; ++k)
-				{
-					indices.push_back(face.mIndices[k]);
-				}
+				indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
 			}
 
+			// 임포트 시 최적화: 정점 캐시 → 오버드로우 → 정점 fetch 순서
+			// (본 가중치는 aiMesh 정점 번호를 참조하므로 본이 있는 메시는 정점 순서 유지)
+			const RHIMeshOptimizer::Result optimized = RHIMeshOptimizer::optimize(vertices, indices, !aiMesh->HasBones());
+			printLog("  Mesh '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}",
+				aiMesh->mName.C_Str(), optimized.before.acmr, optimized.after.acmr,
+				optimized.before.atvr, optimized.after.atvr, optimized.vertexCountBefore, optimized.vertexCountAfter);
+
 			mesh->setVertices(vertices);
 			mesh->setIndices(indices);
 			mesh->setMaterialIndex(aiMesh->mMaterialIndex);
+			mesh->setBounds(bounds);
 			mesh->setName(aiMesh->mName.C_Str());
+			mesh->buildMeshlets();
 
 			// GPU 버퍼 생성
 			if (!mesh->createBuffers())
@@ -116,6 +137,12 @@ namespace BinRenderer
 			meshes_.push_back(std::move(mesh));
 		}
 
+		// 메시 버퍼 업로드를 한 번에 제출 (대기하지 않음, 같은 Graphics 큐의 이후 프레임이 순서대로 소비)
+		if (RHIUploadManager* uploadManager = rhi_->getUploadManager())
+		{
+			uploadManager->flush();
+		}
+
 		// 머티리얼 로드
 		materials_.resize(scene->mNumMaterials);
 		for (uint32_t i = 0; i < scene->mNumMaterials; ++i)
@@ -148,11 +175,16 @@ namespace BinRenderer
 		
 		//  GPU Instancing: instance buffer 정리
 		destroyInstanceBuffer();
+		releaseRetiredInstanceBuffers(true);
 	}
 
 	void RHIModel::draw(RHI* rhi, uint32_t instanceCount)
 	{
-		//  GPU Instancing: instance buffer가 있으면 바인딩
+		//  GPU Instancing: 밀린 인스턴스 변경을 반영하고 instance buffer 바인딩
+		if (isInstanced())
+		{
+			updateInstanceBuffer();
+		}
 		if (isInstanced() && instanceBuffer_.isValid())
 		{
 			rhi->cmdBindVertexBuffer(instanceBuffer_, 0);
@@ -180,14 +212,7 @@ namespace BinRenderer
 	void RHIModel::addInstance(const InstanceData& instanceData)
 	{
 		instances_.push_back(instanceData);
-		
-		// Instance buffer 재생성 (크기 변경)
-		if (instanceBuffer_.isValid())
-		{
-			destroyInstanceBuffer();
-		}
-		createInstanceBuffer();
-		updateInstanceBuffer();
+		markInstancesDirty(static_cast<uint32_t>(instances_.size() - 1), 1);
 	}
 
 	void RHIModel::updateInstance(uint32_t index, const InstanceData& instanceData)
@@ -199,7 +224,7 @@ namespace BinRenderer
 		}
 
 		instances_[index] = instanceData;
-		updateInstanceBuffer();
+		markInstancesDirty(index, 1);
 	}
 
 	void RHIModel::removeInstance(uint32_t index)
@@ -210,72 +235,143 @@ namespace BinRenderer
 			return;
 		}
 
-		instances_.erase(instances_.begin() + index);
-
-		if (instances_.empty())
+		// Swap-and-pop: 마지막 인스턴스를 빈 자리로 옮기고 그 자리만 다시 복사
+		if (index + 1 < instances_.size())
 		{
-			destroyInstanceBuffer();
+			instances_[index] = instances_.back();
+			markInstancesDirty(index, 1);
 		}
-		else
+		instances_.pop_back();
+
+		if (instances_.empty())
 		{
-			// Buffer 재생성
-			destroyInstanceBuffer();
-			createInstanceBuffer();
-			updateInstanceBuffer();
+			clearInstances();
 		}
 	}
 
 	void RHIModel::clearInstances()
 	{
 		instances_.clear();
+		dirtyBegin_ = UINT32_MAX;
+		dirtyEnd_ = 0;
 		destroyInstanceBuffer();
 	}
 
+	void RHIModel::markInstancesDirty(uint32_t first, uint32_t count)
+	{
+		dirtyBegin_ = std::min(dirtyBegin_, first);
+		dirtyEnd_ = std::max(dirtyEnd_, first + count);
+	}
+
 	void RHIModel::updateInstanceBuffer()
 	{
-		if (!instanceBuffer_.isValid() || instances_.empty())
+		const uint32_t instanceCount = static_cast<uint32_t>(instances_.size());
+		if (instanceCount == 0)
 		{
 			return;
 		}
 
-		// GPU로 데이터 전송
-		void* data = rhi_->mapBuffer(instanceBuffer_);
-		if (data)
+		if (instanceCount > instanceCapacity_ && !growInstanceBuffer(instanceCount))
 		{
-			memcpy(data, instances_.data(), instances_.size() * sizeof(InstanceData));
-			rhi_->unmapBuffer(instanceBuffer_);
+			return;
 		}
+
+		// 제거로 줄어든 끝부분은 드로우하지 않으므로 복사할 필요 없음
+		const uint32_t dirtyEnd = std::min(dirtyEnd_, instanceCount);
+		if (dirtyBegin_ < dirtyEnd)
+		{
+			const RHIDeviceSize offset = static_cast<RHIDeviceSize>(dirtyBegin_) * sizeof(InstanceData);
+			const RHIDeviceSize size = static_cast<RHIDeviceSize>(dirtyEnd - dirtyBegin_) * sizeof(InstanceData);
+			memcpy(mappedInstances_ + dirtyBegin_, instances_.data() + dirtyBegin_, size);
+			rhi_->flushBuffer(instanceBuffer_, offset, size);
+		}
+
+		dirtyBegin_ = UINT32_MAX;
+		dirtyEnd_ = 0;
 	}
 
-	void RHIModel::createInstanceBuffer()
+	bool RHIModel::growInstanceBuffer(uint32_t instanceCount)
 	{
-		if (instances_.empty())
+		uint32_t capacity = std::max(instanceCapacity_, kMinInstanceCapacity);
+		while (capacity < instanceCount)
 		{
-			return;
+			capacity *= 2;
 		}
 
+		// Coherent를 요구하지 않으므로 변경 구간은 flushBuffer로 명시적으로 반영
 		RHIBufferCreateInfo bufferInfo{};
-		bufferInfo.size = instances_.size() * sizeof(InstanceData);
+		bufferInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(InstanceData);
 		bufferInfo.usage = RHI_BUFFER_USAGE_VERTEX_BUFFER_BIT;
-		bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
 
-		instanceBuffer_ = rhi_->createBuffer(bufferInfo);
-		if (!instanceBuffer_.isValid())
+		RHIBufferHandle buffer = rhi_->createBuffer(bufferInfo);
+		InstanceData* mapped = buffer.isValid() ? static_cast<InstanceData*>(rhi_->mapBuffer(buffer)) : nullptr;
+		if (!mapped)
 		{
-			printLog("ERROR: Failed to create instance buffer");
-			return;
+			printLog("ERROR: Failed to create instance buffer ({} instances)", capacity);
+			if (buffer.isValid())
+			{
+				rhi_->destroyBuffer(buffer);
+			}
+			return false;
 		}
 
-		printLog(" Instance buffer created: {} instances", instances_.size());
+		destroyInstanceBuffer();
+		instanceBuffer_ = buffer;
+		mappedInstances_ = mapped;
+		instanceCapacity_ = capacity;
+
+		// 새 버퍼에는 아무것도 없으므로 전체가 변경 구간
+		markInstancesDirty(0, instanceCount);
+
+		printLog(" Instance buffer created: {} / {} instances", instanceCount, capacity);
+		return true;
 	}
 
 	void RHIModel::destroyInstanceBuffer()
 	{
 		if (instanceBuffer_.isValid())
 		{
-			rhi_->destroyBuffer(instanceBuffer_);
+			// 이전 프레임들이 아직 이 버퍼로 드로우 중일 수 있으므로 몇 프레임 뒤에 해제
+			rhi_->unmapBuffer(instanceBuffer_);
+			retiredInstanceBuffers_.push_back({ instanceBuffer_, kInstanceBufferRetireFrames });
 			instanceBuffer_ = {};
 		}
+
+		mappedInstances_ = nullptr;
+		instanceCapacity_ = 0;
+	}
+
+	void RHIModel::beginFrame(uint64_t frame)
+	{
+		if (frame == lastFrame_)
+		{
+			return;
+		}
+		lastFrame_ = frame;
+
+		if (!retiredInstanceBuffers_.empty())
+		{
+			releaseRetiredInstanceBuffers(false);
+		}
+	}
+
+	void RHIModel::releaseRetiredInstanceBuffers(bool force)
+	{
+		// force가 아니면 호출(프레임)마다 한 프레임씩 차감
+		auto it = retiredInstanceBuffers_.begin();
+		while (it != retiredInstanceBuffers_.end())
+		{
+			if (force || --it->framesLeft == 0)
+			{
+				rhi_->destroyBuffer(it->buffer);
+				it = retiredInstanceBuffers_.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
 	}
 
 } // namespace BinRenderer
@@ -52,6 +52,9 @@ namespace BinRenderer
 		/**
 		 * @brief 인스턴스 추가
 		 * @param instanceData Per-instance data (transform, material offset)
+		 *
+		 * 인스턴스 추가/수정/제거는 CPU 배열과 변경 구간만 기록하고,
+		 * GPU 버퍼는 updateInstanceBuffer()(draw()가 호출)에서 한 번에 반영
 		 */
 		void addInstance(const InstanceData& instanceData);
 
@@ -63,7 +66,7 @@ namespace BinRenderer
 		void updateInstance(uint32_t index, const InstanceData& instanceData);
 
 		/**
-		 * @brief 인스턴스 제거
+		 * @brief 인스턴스 제거 (O(1): 마지막 인스턴스가 index 자리로 옮겨지므로 순서는 유지되지 않음)
 		 */
 		void removeInstance(uint32_t index);
 
@@ -88,20 +91,32 @@ namespace BinRenderer
 		bool isInstanced() const { return instances_.size() >= 1; }
 
 		/**
-		 * @brief Instance buffer 반환
+		 * @brief Instance buffer 반환 (updateInstanceBuffer() 이후 유효)
 		 */
 		RHIBufferHandle getInstanceBuffer() const { return instanceBuffer_; }
 
 		/**
-		 * @brief Instance buffer 업데이트 (GPU로 전송)
+		 * @brief 변경된 인스턴스 구간만 GPU 버퍼에 복사하고 그 범위만 flush
+		 *
+		 * 용량이 모자라면 두 배로 키운 버퍼를 새로 만들고 전체 복사
 		 */
 		void updateInstanceBuffer();
 
+		/**
+		 * @brief 프레임 시작 처리 (RHIScene::update가 노드 모델마다 호출)
+		 *
+		 * 교체/제거한 instance buffer의 해제 대기를 한 프레임 줄임 (인스턴싱을 그만둔 모델도 계속 진행)
+		 * 같은 frame으로 다시 호출하면 무시하므로 노드끼리 공유하는 모델도 한 번만 처리
+		 */
+		void beginFrame(uint64_t frame);
+
 	private:
 		void createBuffers();
 		void destroyBuffers();
-		void createInstanceBuffer();
+		bool growInstanceBuffer(uint32_t instanceCount);
 		void destroyInstanceBuffer();
+		void markInstancesDirty(uint32_t first, uint32_t count);
+		void releaseRetiredInstanceBuffers(bool force);
 
 		RHI* rhi_;
 		std::string filePath_;
@@ -116,6 +131,19 @@ namespace BinRenderer
 		//  GPU Instancing
 		std::vector<InstanceData> instances_;
 		RHIBufferHandle instanceBuffer_;
+		InstanceData* mappedInstances_ = nullptr;  // 영구 매핑
+		uint32_t instanceCapacity_ = 0;
+		uint32_t dirtyBegin_ = UINT32_MAX;         // GPU에 반영 안 된 인스턴스 구간 [dirtyBegin_, dirtyEnd_)
+		uint32_t dirtyEnd_ = 0;
+
+		// 키우기 전 버퍼 (드로우 중인 프레임이 끝날 때까지 유지)
+		struct RetiredInstanceBuffer
+		{
+			RHIBufferHandle buffer;
+			uint32_t framesLeft = 0;
+		};
+		std::vector<RetiredInstanceBuffer> retiredInstanceBuffers_;
+		uint64_t lastFrame_ = UINT64_MAX;
 	};
 
 } // namespace BinRenderer
@@ -1,8 +1,36 @@
 #include "RHIScene.h"
+#include "JobSystem.h"
 #include "Logger.h"
 
+#include <unordered_set>
+
 namespace BinRenderer
 {
+	bool RHISceneNode::updateWorldBounds()
+	{
+		if (!model)
+		{
+			meshWorldBounds.clear();
+			return false;
+		}
+
+		const glm::mat4 world = transform * model->getTransform();
+		const auto& meshes = model->getMeshes();
+		if (meshWorldBounds.size() == meshes.size() && world == boundsTransform)
+		{
+			return false;
+		}
+
+		boundsTransform = world;
+		boundsVersion++;
+		meshWorldBounds.resize(meshes.size());
+		for (size_t i = 0; i < meshes.size(); ++i)
+		{
+			meshWorldBounds[i] = meshes[i]->getBounds().transform(world);
+		}
+		return true;
+	}
+
 	RHIScene::RHIScene(RHI* rhi)
 		: rhi_(rhi)
 	{
@@ -126,27 +154,172 @@ namespace BinRenderer
 	void RHIScene::clear()
 	{
 		nodes_.clear();
+		spatialIndex_.clear();
+		spatialIndexStale_ = true;
 		// modelCache_는 shared_ptr이므로 자동 정리됨
 		printLog("🗑️ RHIScene cleared");
 	}
 
+	// ========================================
+	// 공간 쿼리
+	// ========================================
+
+	void RHIScene::updateSpatialIndex()
+	{
+		spatialIndex_.update(nodes_);
+		spatialIndexStale_ = false;
+	}
+
+	const RHISceneBVH& RHIScene::getSpatialIndex()
+	{
+		if (spatialIndexStale_)
+		{
+			updateSpatialIndex();
+		}
+		return spatialIndex_;
+	}
+
 	// ========================================
 	// 업데이트
 	// ========================================
 
 	void RHIScene::update(float deltaTime)
 	{
+		// 노드가 바뀌었을 수 있으므로 BVH는 다음 쿼리에서 갱신
+		spatialIndexStale_ = true;
+		++updateFrame_;
+
 		// 카메라 업데이트
 		camera_.update(deltaTime);
 
-		// 모든 노드의 애니메이션 업데이트
-		for (auto& node : nodes_)
+		// 애니메이션이 있는 모델 수집 (인스턴스 노드들이 공유하는 모델은 한 번만 갱신)
+		// 전용 플레이어가 있는 노드는 따로 모아 LOD 적용
+		animatedModels_.clear();
+		animatedNodes_.clear();
+		std::unordered_set<RHIModel*> seen;
+		for (size_t i = 0; i < nodes_.size(); ++i)
+		{
+			auto& node = nodes_[i];
+
+			// 교체한 instance buffer 해제는 드로우/인스턴싱 여부와 무관하게 프레임마다 진행 (공유 모델은 한 번만)
+			if (node.model)
+			{
+				node.model->beginFrame(updateFrame_);
+			}
+
+			if (node.animation)
+			{
+				animatedNodes_.push_back(static_cast<uint32_t>(i));
+			}
+			else if (node.model && node.model->hasAnimation() && seen.insert(node.model.get()).second)
+			{
+				animatedModels_.push_back(node.model.get());
+			}
+		}
+
+		// 모델별 애니메이션 상태는 서로 독립이므로 병렬 갱신
+		JobSystem::getInstance().parallelFor(static_cast<uint32_t>(animatedModels_.size()), 1,
+			[this, deltaTime](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					animatedModels_[i]->getAnimation()->updateAnimation(deltaTime);
+				}
+			});
+
+		if (animatedNodes_.empty())
+		{
+			return;
+		}
+
+		// 노드 플레이어: 시간은 매 프레임 진행, 평가는 LOD 간격마다
+		// (같은 간격의 노드가 한 프레임에 몰리지 않도록 노드별 위상으로 시작 프레임을 분산)
+		++animationFrame_;
+		poseCache_.beginFrame();
+		RHIViewFrustum frustum;
+		frustum.extractFromViewProjection(camera_.getViewProjectionMatrix());
+		AnimationPoseCache* cache = animationLod_.usePoseCache ? &poseCache_ : nullptr;
+
+		// 화면 안 노드는 BVH 절두체 쿼리 한 번으로 찾음 (노드마다 메시 AABB를 테스트하지 않음)
+		if (animationLod_.skipOffscreen)
+		{
+			onScreenItems_.clear();
+			getSpatialIndex().queryFrustum(frustum, onScreenItems_);
+			onScreenNodes_.assign(nodes_.size(), 0);
+			for (const RHISpatialItem& item : onScreenItems_)
+			{
+				onScreenNodes_[item.nodeIndex] = 1;
+			}
+		}
+
+		JobSystem::getInstance().parallelFor(static_cast<uint32_t>(animatedNodes_.size()), 8,
+			[this, deltaTime, cache](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					const uint32_t nodeIndex = animatedNodes_[i];
+					RHISceneNode& node = nodes_[nodeIndex];
+					Animation* animation = node.animation.get();
+					animation->advance(deltaTime);
+					if (!animation->isPoseDirty())
+					{
+						continue;
+					}
+
+					// 화면 밖/숨김에서 다시 보이게 된 노드는 위상을 기다리지 않고 바로 평가
+					// 메시가 없는 노드는 BVH에 없으므로 화면 안으로 취급
+					const bool onScreen = !animationLod_.skipOffscreen || node.meshWorldBounds.empty() ||
+						onScreenNodes_[nodeIndex] != 0;
+					const uint32_t interval = getAnimationUpdateInterval(node, onScreen);
+					if (interval == 0)
+					{
+						node.animationStale = true;
+					}
+					else if (node.animationStale || (animationFrame_ + node.animationPhase) % interval == 0)
+					{
+						animation->evaluate(cache);
+						node.animationStale = false;
+					}
+				}
+			});
+	}
+
+	uint32_t RHIScene::getAnimationUpdateInterval(const RHISceneNode& node, bool onScreen) const
+	{
+		if (!node.visible || !onScreen)
+		{
+			return 0;
+		}
+
+		const float distance = glm::length(glm::vec3(node.transform[3]) - camera_.getPosition());
+		if (distance >= animationLod_.quarterRateDistance)
+		{
+			return 4;
+		}
+		return distance >= animationLod_.halfRateDistance ? 2 : 1;
+	}
+
+	Animation* RHIScene::createNodeAnimation(size_t index)
+	{
+		if (index >= nodes_.size())
+		{
+			return nullptr;
+		}
+
+		RHISceneNode& node = nodes_[index];
+		if (!node.animation)
 		{
-			if (node.model && node.model->hasAnimation())
+			Animation* source = node.model ? node.model->getAnimation() : nullptr;
+			if (!source)
 			{
-				node.model->getAnimation()->updateAnimation(deltaTime);
+				return nullptr;
 			}
+			// 복사본은 스켈레톤/클립 데이터를 공유하고 재생 상태만 가짐
+			node.animation = std::make_shared<Animation>(*source);
+			node.animationPhase = nextAnimationPhase_++;
+			node.animationStale = true;
 		}
+		return node.animation.get();
 	}
 
 } // namespace BinRenderer
@@ -4,6 +4,8 @@
 #include "RHIModel.h"
 #include "../Scene/RHICamera.h"
 #include "../Scene/Animation.h"
+#include "../Scene/AnimationPoseCache.h"
+#include "../Rendering/RHISceneBVH.h"
 #include <glm/glm.hpp>
 #include <memory>
 #include <string>
@@ -22,11 +24,50 @@ namespace BinRenderer
 		glm::mat4 transform = glm::mat4(1.0f);
 		bool visible = true;
 
+		// 컬링용 메시별 World AABB 캐시 (boundsTransform과 월드 행렬이 다를 때만 재계산)
+		std::vector<AABB> meshWorldBounds;
+		glm::mat4 boundsTransform = glm::mat4(0.0f);
+		uint32_t boundsVersion = 0;  // 재계산할 때마다 증가 (여러 소비자가 각자 변경을 감지)
+
+		// 노드 전용 애니메이션 플레이어 (nullptr이면 같은 모델의 노드끼리 모델 애니메이션 공유)
+		std::shared_ptr<Animation> animation = nullptr;
+
+		// 애니메이션 LOD 상태 (전용 플레이어 노드만 사용)
+		uint32_t animationPhase = 0;   // LOD 간격 안에서 평가할 프레임 오프셋 (플레이어 생성 때 배정, 노드 순서와 무관)
+		bool animationStale = true;    // 건너뛴 평가가 있음 → 다음에 평가 대상이 되면 간격과 관계없이 즉시 평가
+
 		RHISceneNode() = default;
 		RHISceneNode(std::shared_ptr<RHIModel> m, const std::string& n = "Unnamed")
 			: model(std::move(m)), name(n)
 		{
 		}
+
+		/**
+		 * @brief transform이 바뀌었으면 메시 World AABB 재계산
+		 * @return 재계산했으면 true
+		 */
+		bool updateWorldBounds();
+
+		/**
+		 * @brief 이 노드의 본 행렬을 제공하는 애니메이션 (전용 플레이어 우선)
+		 */
+		Animation* getAnimation() const
+		{
+			return animation ? animation.get() : (model ? model->getAnimation() : nullptr);
+		}
+	};
+
+	/**
+	 * @brief 노드별 애니메이션 갱신 빈도 LOD (전용 플레이어가 있는 노드에만 적용)
+	 *
+	 * 시간은 매 프레임 진행하고, 본 행렬 평가만 거리/가시성에 따라 건너뜀
+	 */
+	struct RHIAnimationLodSettings
+	{
+		float halfRateDistance = 30.0f;     // 이 거리부터 2프레임마다 평가
+		float quarterRateDistance = 60.0f;  // 이 거리부터 4프레임마다 평가
+		bool skipOffscreen = true;          // 절두체 밖이면 다시 보일 때까지 평가하지 않음
+		bool usePoseCache = true;           // 단일 클립 재생은 (클립, 양자화 시간) 포즈 공유
 	};
 
 	/**
@@ -92,6 +133,32 @@ namespace BinRenderer
 		 */
 		size_t getNodeCount() const { return nodes_.size(); }
 
+		/**
+		 * @brief 노드 전용 애니메이션 플레이어 생성 (스켈레톤/클립 데이터는 모델과 공유)
+		 * @return 플레이어 (애니메이션이 없는 모델이면 nullptr)
+		 */
+		Animation* createNodeAnimation(size_t index);
+
+		// ========================================
+		// 공간 쿼리
+		// ========================================
+
+		/**
+		 * @brief BVH를 노드 변경분에 맞춰 갱신
+		 *
+		 * 노드 구성이 바뀌면 다시 빌드, transform/가시성만 바뀌면 Refit
+		 * 보통은 getSpatialIndex()가 대신 호출하므로 update() 이후 노드를 바꾸고 바로 쿼리할 때만 직접 호출
+		 */
+		void updateSpatialIndex();
+
+		/**
+		 * @brief 메시 World AABB BVH (절두체/박스/구 쿼리, 레이 피킹)
+		 *
+		 * update() 이후 첫 호출에서 갱신하므로 쿼리하지 않는 프레임은 비용이 없음
+		 * 갱신은 스레드 안전하지 않으므로 여러 스레드에서 쿼리하려면 먼저 한 번 얻어 둘 것
+		 */
+		const RHISceneBVH& getSpatialIndex();
+
 		/**
 		 * @brief 모든 노드 제거
 		 */
@@ -114,14 +181,36 @@ namespace BinRenderer
 
 		/**
 		 * @brief 씬 업데이트 (애니메이션 등)
+		 * 
+		 * 애니메이션 모델은 JobSystem으로 병렬 갱신 (공유 모델은 한 번만)
 		 */
 		void update(float deltaTime);
 
+		void setAnimationLodSettings(const RHIAnimationLodSettings& settings) { animationLod_ = settings; }
+		const RHIAnimationLodSettings& getAnimationLodSettings() const { return animationLod_; }
+		AnimationPoseCache& getAnimationPoseCache() { return poseCache_; }
+
 	private:
+		/**
+		 * @brief 노드 애니메이션 평가 간격 (0이면 이번 프레임에 평가하지 않음)
+		 */
+		uint32_t getAnimationUpdateInterval(const RHISceneNode& node, bool onScreen) const;
+
 		RHI* rhi_;
 		std::vector<RHISceneNode> nodes_;
 		std::unordered_map<std::string, std::shared_ptr<RHIModel>> modelCache_;
 		RHICamera camera_;
+		RHISceneBVH spatialIndex_;
+		bool spatialIndexStale_ = true;  // update() 이후 아직 갱신하지 않음
+		std::vector<RHISpatialItem> onScreenItems_;  // 애니메이션 LOD용 절두체 쿼리 결과 (프레임마다 재사용)
+		std::vector<uint8_t> onScreenNodes_;
+		std::vector<RHIModel*> animatedModels_;  // update()에서 갱신할 모델 (프레임마다 재사용)
+		std::vector<uint32_t> animatedNodes_;    // update()에서 갱신할 전용 플레이어 노드
+		RHIAnimationLodSettings animationLod_;
+		AnimationPoseCache poseCache_;
+		uint64_t animationFrame_ = 0;
+		uint64_t updateFrame_ = 0;  // update() 호출 수 (모델 beginFrame 중복 방지)
+		uint32_t nextAnimationPhase_ = 0;  // 새 노드 플레이어에 배정할 LOD 위상
 	};
 
 } // namespace BinRenderer
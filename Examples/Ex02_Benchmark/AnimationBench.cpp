@@ -0,0 +1,598 @@
+#include "Scene/Animation.h"
+#include "Scene/AnimationKernels.h"
+#include "Scene/AnimationPoseCache.h"
+#include "Rendering/RHISkinningCache.h"
+
+#include <assimp/scene.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace BinRenderer;
+
+namespace
+{
+	constexpr uint32_t kBoneCount = 64;
+	constexpr uint32_t kKeyCount = 31;          // 1초, 30 ticks/s
+	constexpr double kTicksPerSecond = 30.0;
+	constexpr uint32_t kFrames = 240;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+
+	double elapsedMs(std::chrono::high_resolution_clock::time_point t0, std::chrono::high_resolution_clock::time_point t1)
+	{
+		return std::chrono::duration<double, std::milli>(t1 - t0).count();
+	}
+
+	/**
+	 * @brief 합성 스켈레톤: 루트(본 아님) 아래에 가지가 있는 본 체인, 채널 순서는 노드 순서와 무관하게 섞음
+	 */
+	struct Skeleton
+	{
+		std::vector<std::string> names;     // [0] = 루트
+		std::vector<int> parents;
+		std::vector<glm::mat4> bindLocal;
+		std::vector<glm::mat4> offsets;     // 본 i = 노드 i + 1
+		std::vector<AnimationChannel> channels;
+	};
+
+	Skeleton makeSkeleton(uint32_t seed)
+	{
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+		Skeleton skeleton;
+		skeleton.names.push_back("Root");
+		skeleton.parents.push_back(-1);
+		skeleton.bindLocal.push_back(glm::mat4(1.0f));
+
+		for (uint32_t i = 0; i < kBoneCount; ++i) {
+			const int node = static_cast<int>(i) + 1;
+			const int nearest = std::max(0, node - 4);
+			skeleton.names.push_back("Bone_" + std::to_string(i));
+			skeleton.parents.push_back(nearest + static_cast<int>(rng() % static_cast<uint32_t>(node - nearest)));
+			skeleton.bindLocal.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.2f, 0.0f)));
+			skeleton.offsets.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(unit(rng), unit(rng), unit(rng))));
+
+			AnimationChannel channel;
+			channel.nodeName = skeleton.names.back();
+			for (uint32_t k = 0; k < kKeyCount; ++k) {
+				const double time = static_cast<double>(k);
+				const glm::vec3 axis = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng)) + glm::vec3(0.0f, 0.0f, 2.0f));
+				channel.positionKeys.emplace_back(time, glm::vec3(unit(rng), 1.0f + unit(rng), unit(rng)) * 0.1f);
+				channel.rotationKeys.emplace_back(time, glm::angleAxis(unit(rng), axis));
+				channel.scaleKeys.emplace_back(time, glm::vec3(1.0f + 0.05f * unit(rng)));
+			}
+			skeleton.channels.push_back(std::move(channel));
+		}
+
+		std::shuffle(skeleton.channels.begin(), skeleton.channels.end(), rng);
+		return skeleton;
+	}
+
+	void setMatrix(aiMatrix4x4& target, const glm::mat4& value)
+	{
+		// assimp는 행 우선이므로 Animation의 transpose(make_mat4(...))와 반대로 저장
+		const glm::mat4 transposed = glm::transpose(value);
+		std::memcpy(&target.a1, glm::value_ptr(transposed), sizeof(float) * 16);
+	}
+
+	std::unique_ptr<aiScene> makeScene(const Skeleton& skeleton)
+	{
+		auto scene = std::make_unique<aiScene>();
+
+		std::vector<aiNode*> nodes(skeleton.names.size());
+		std::vector<std::vector<aiNode*>> children(skeleton.names.size());
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			nodes[i] = new aiNode(skeleton.names[i]);
+			setMatrix(nodes[i]->mTransformation, skeleton.bindLocal[i]);
+			if (skeleton.parents[i] >= 0) {
+				children[skeleton.parents[i]].push_back(nodes[i]);
+				nodes[i]->mParent = nodes[skeleton.parents[i]];
+			}
+		}
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			if (!children[i].empty()) {
+				nodes[i]->mNumChildren = static_cast<unsigned int>(children[i].size());
+				nodes[i]->mChildren = new aiNode*[children[i].size()];
+				std::copy(children[i].begin(), children[i].end(), nodes[i]->mChildren);
+			}
+		}
+		scene->mRootNode = nodes[0];
+
+		aiMesh* mesh = new aiMesh();
+		mesh->mNumBones = kBoneCount;
+		mesh->mBones = new aiBone*[kBoneCount];
+		for (uint32_t i = 0; i < kBoneCount; ++i) {
+			mesh->mBones[i] = new aiBone();
+			mesh->mBones[i]->mName = aiString(skeleton.names[i + 1]);
+			setMatrix(mesh->mBones[i]->mOffsetMatrix, skeleton.offsets[i]);
+		}
+		scene->mNumMeshes = 1;
+		scene->mMeshes = new aiMesh*[1]{ mesh };
+
+		aiAnimation* animation = new aiAnimation();
+		animation->mName = aiString("Synthetic");
+		animation->mDuration = static_cast<double>(kKeyCount - 1);
+		animation->mTicksPerSecond = kTicksPerSecond;
+		animation->mNumChannels = static_cast<unsigned int>(skeleton.channels.size());
+		animation->mChannels = new aiNodeAnim*[skeleton.channels.size()];
+		for (size_t c = 0; c < skeleton.channels.size(); ++c) {
+			const AnimationChannel& source = skeleton.channels[c];
+			aiNodeAnim* channel = new aiNodeAnim();
+			channel->mNodeName = aiString(source.nodeName);
+			channel->mNumPositionKeys = channel->mNumRotationKeys = channel->mNumScalingKeys = kKeyCount;
+			channel->mPositionKeys = new aiVectorKey[kKeyCount];
+			channel->mRotationKeys = new aiQuatKey[kKeyCount];
+			channel->mScalingKeys = new aiVectorKey[kKeyCount];
+			for (uint32_t k = 0; k < kKeyCount; ++k) {
+				const glm::vec3& p = source.positionKeys[k].value;
+				const glm::quat& r = source.rotationKeys[k].value;
+				const glm::vec3& s = source.scaleKeys[k].value;
+				channel->mPositionKeys[k] = aiVectorKey(source.positionKeys[k].time, aiVector3D(p.x, p.y, p.z));
+				channel->mRotationKeys[k] = aiQuatKey(source.rotationKeys[k].time, aiQuaternion(r.w, r.x, r.y, r.z));
+				channel->mScalingKeys[k] = aiVectorKey(source.scaleKeys[k].time, aiVector3D(s.x, s.y, s.z));
+			}
+			animation->mChannels[c] = channel;
+		}
+		scene->mNumAnimations = 1;
+		scene->mAnimations = new aiAnimation*[1]{ animation };
+		return scene;
+	}
+
+	/**
+	 * @brief 기존 Animation::calculateBoneTransforms 방식 그대로 (이름 재귀 + 채널 선형 검색 + 키 0번부터 검색)
+	 *
+	 * 엔진에서처럼 캐릭터마다 데이터를 따로 가지므로 스켈레톤을 복사해 보관
+	 */
+	class LegacyEvaluator
+	{
+	public:
+		LegacyEvaluator(const Skeleton& skeleton, const Animation& animation)
+			: skeleton_(skeleton)
+		{
+			children_.resize(skeleton.names.size());
+			for (size_t i = 0; i < skeleton.names.size(); ++i) {
+				nodeMapping_[skeleton.names[i]] = static_cast<int>(i);
+				if (skeleton.parents[i] >= 0) {
+					children_[skeleton.parents[i]].push_back(static_cast<int>(i));
+				}
+			}
+			for (uint32_t i = 0; i < kBoneCount; ++i) {
+				boneMapping_[skeleton.names[i + 1]] = animation.getGlobalBoneIndex(skeleton.names[i + 1]);
+			}
+		}
+
+		void evaluate(std::vector<glm::mat4>& transforms, double time, const std::string& nodeName = "",
+			const glm::mat4& parentTransform = glm::mat4(1.0f))
+		{
+			const int nodeIdx = nodeName.empty() ? 0 : (nodeMapping_.count(nodeName) ? nodeMapping_[nodeName] : -1);
+			if (nodeIdx < 0) {
+				return;
+			}
+
+			glm::mat4 nodeTransform = skeleton_.bindLocal[nodeIdx];
+			for (const AnimationChannel& channel : skeleton_.channels) {
+				if (channel.nodeName == skeleton_.names[nodeIdx]) {
+					nodeTransform = glm::translate(glm::mat4(1.0f), interpolate(channel.positionKeys, time))
+						* glm::mat4_cast(interpolate(channel.rotationKeys, time))
+						* glm::scale(glm::mat4(1.0f), interpolate(channel.scaleKeys, time));
+					break;
+				}
+			}
+
+			const glm::mat4 globalTransform = parentTransform * nodeTransform;
+			if (boneMapping_.count(skeleton_.names[nodeIdx])) {
+				transforms[boneMapping_[skeleton_.names[nodeIdx]]] = globalTransform * skeleton_.offsets[nodeIdx - 1];
+			}
+
+			for (int child : children_[nodeIdx]) {
+				evaluate(transforms, time, skeleton_.names[child], globalTransform);
+			}
+		}
+
+	private:
+		template <typename T>
+		static T interpolate(const std::vector<AnimationKey<T>>& keys, double time)
+		{
+			uint32_t index = 0;
+			for (uint32_t i = 0; i < keys.size() - 1; ++i) {
+				if (time < keys[i + 1].time) {
+					index = i;
+					break;
+				}
+			}
+			const float factor = static_cast<float>((time - keys[index].time) / (keys[index + 1].time - keys[index].time));
+			if constexpr (std::is_same_v<T, glm::quat>) {
+				return glm::slerp(keys[index].value, keys[index + 1].value, factor);
+			} else {
+				return glm::mix(keys[index].value, keys[index + 1].value, factor);
+			}
+		}
+
+		Skeleton skeleton_;
+		std::vector<std::vector<int>> children_;
+		std::unordered_map<std::string, int> nodeMapping_;
+		std::unordered_map<std::string, int> boneMapping_;
+	};
+
+	float maxDifference(const std::vector<glm::mat4>& a, const std::vector<glm::mat4>& b)
+	{
+		float result = 0.0f;
+		for (size_t i = 0; i < a.size(); ++i) {
+			for (int c = 0; c < 4; ++c) {
+				for (int r = 0; r < 4; ++r) {
+					result = std::max(result, std::abs(a[i][c][r] - b[i][c][r]));
+				}
+			}
+		}
+		return result;
+	}
+
+	// 기존 glm 경로 (AnimationChannel::interpolate* + translate * mat4_cast * scale)
+	glm::mat4 referenceTransform(const AnimationChannel& channel, double time)
+	{
+		return glm::translate(glm::mat4(1.0f), channel.interpolatePosition(time))
+			* glm::mat4_cast(channel.interpolateRotation(time))
+			* glm::scale(glm::mat4(1.0f), channel.interpolateScale(time));
+	}
+
+	/**
+	 * @brief 샘플링 커널(SIMD/스칼라)을 glm 경로와 비교하고 스켈레톤 하나당 샘플링 시간 측정
+	 *
+	 * 검증용 채널은 회전을 구 전체에서 뽑아 큰 각 fallback과 부호 반전도 거치게 함
+	 */
+	void validateKernels(const Skeleton& skeleton, bool& passed)
+	{
+		std::mt19937 rng(99);
+		std::normal_distribution<float> gaussian(0.0f, 1.0f);
+		std::uniform_real_distribution<double> jump(-2.0, kKeyCount + 2.0);
+
+		std::vector<AnimationChannel> channels = skeleton.channels;
+		for (size_t c = 0; c < channels.size(); c += 3) {
+			for (RotationKey& key : channels[c].rotationKeys) {
+				key.value = glm::normalize(glm::quat(gaussian(rng), gaussian(rng), gaussian(rng), gaussian(rng)));
+			}
+		}
+		channels[1].scaleKeys.clear();       // 빈 트랙은 기본값
+		channels[2].positionKeys.resize(1);  // 키 하나
+
+		AnimationClipKeys keys;
+		keys.build(channels);
+		const uint32_t count = keys.getChannelCount();
+		std::vector<AnimationKeyCursor> simdCursors(count);
+		std::vector<AnimationKeyCursor> scalarCursors(count);
+		std::vector<glm::mat4> simd(count);
+		std::vector<glm::mat4> scalar(count);
+		std::vector<glm::mat4> reference(count);
+
+		float simdError = 0.0f;
+		float scalarError = 0.0f;
+		double time = 0.0;
+		for (uint32_t step = 0; step < 2000; ++step) {
+			// 대부분은 재생처럼 조금씩 전진, 가끔 범위 밖을 포함한 임의 위치로 이동
+			time = (step % 97 == 0) ? jump(rng) : time + kDeltaTime * kTicksPerSecond;
+			AnimationKernels::sampleLocalTransforms(keys, time, simdCursors.data(), simd.data());
+			AnimationKernels::sampleLocalTransformsScalar(keys, time, scalarCursors.data(), scalar.data());
+			for (uint32_t c = 0; c < count; ++c) {
+				reference[c] = referenceTransform(channels[c], time);
+			}
+			simdError = std::max(simdError, maxDifference(simd, reference));
+			scalarError = std::max(scalarError, maxDifference(scalar, reference));
+		}
+
+		// 샘플링 시간은 벤치마크 스켈레톤 기준
+		AnimationClipKeys benchKeys;
+		benchKeys.build(skeleton.channels);
+		std::fill(simdCursors.begin(), simdCursors.end(), AnimationKeyCursor{});
+		std::fill(scalarCursors.begin(), scalarCursors.end(), AnimationKeyCursor{});
+		constexpr uint32_t kIterations = 20000;
+
+		auto t0 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < kIterations; ++i) {
+			const double t = std::fmod(i * kDeltaTime * kTicksPerSecond, kKeyCount - 1.0);
+			for (uint32_t c = 0; c < count; ++c) {
+				reference[c] = referenceTransform(skeleton.channels[c], t);
+			}
+		}
+		auto t1 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < kIterations; ++i) {
+			const double t = std::fmod(i * kDeltaTime * kTicksPerSecond, kKeyCount - 1.0);
+			AnimationKernels::sampleLocalTransformsScalar(benchKeys, t, scalarCursors.data(), scalar.data());
+		}
+		auto t2 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < kIterations; ++i) {
+			const double t = std::fmod(i * kDeltaTime * kTicksPerSecond, kKeyCount - 1.0);
+			AnimationKernels::sampleLocalTransforms(benchKeys, t, simdCursors.data(), simd.data());
+		}
+		auto t3 = std::chrono::high_resolution_clock::now();
+
+		const bool ok = simdError < 1e-5f && scalarError < 1e-5f;
+		passed = passed && ok;
+		std::printf("  sampling %u channels: glm %.2f us, scalar kernel %.2f us, %s kernel %.2f us | max error vs glm: scalar %.2e, simd %.2e %s\n",
+			count, elapsedMs(t0, t1) * 1000.0 / kIterations, elapsedMs(t1, t2) * 1000.0 / kIterations,
+			AnimationKernels::isSimdEnabled() ? "SSE" : "(no SIMD)", elapsedMs(t2, t3) * 1000.0 / kIterations,
+			scalarError, simdError, ok ? "" : "MISMATCH");
+	}
+
+	void runBenchmark(const Skeleton& skeleton, const Animation& source, uint32_t characterCount, bool& passed)
+	{
+		// 캐릭터마다 위상이 다른 독립 인스턴스
+		std::mt19937 rng(characterCount);
+		std::uniform_real_distribution<float> phase(0.0f, source.getDuration());
+		std::vector<Animation> characters(characterCount, source);
+		for (Animation& character : characters) {
+			character.play();
+			character.updateAnimation(phase(rng));
+		}
+
+		std::vector<LegacyEvaluator> legacy;
+		legacy.reserve(characterCount);
+		for (uint32_t i = 0; i < characterCount; ++i) {
+			legacy.emplace_back(skeleton, source);
+		}
+		std::vector<glm::mat4> legacyMatrices(kBoneCount, glm::mat4(1.0f));
+
+		double indexedMs = 0.0;
+		double legacyMs = 0.0;
+		float maxError = 0.0f;
+		for (uint32_t frame = 0; frame < kFrames; ++frame) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			for (Animation& character : characters) {
+				character.updateAnimation(kDeltaTime);
+			}
+			auto t1 = std::chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < characterCount; ++i) {
+				legacy[i].evaluate(legacyMatrices, characters[i].getCurrentTime() * kTicksPerSecond);
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			indexedMs += elapsedMs(t0, t1);
+			legacyMs += elapsedMs(t1, t2);
+
+			// 마지막 캐릭터로 결과 비교 (레거시 루프가 마지막으로 평가한 캐릭터)
+			maxError = std::max(maxError, maxDifference(characters.back().getBoneMatrices(), legacyMatrices));
+		}
+
+		const bool ok = maxError < 1e-4f;
+		passed = passed && ok;
+		std::printf("  %5u characters: name lookup %8.3f ms/frame, indexed %7.3f ms/frame (%5.1fx, %.2f us/character), max error %.2e %s\n",
+			characterCount, legacyMs / kFrames, indexedMs / kFrames, legacyMs / std::max(indexedMs, 1e-6),
+			indexedMs * 1000.0 / (static_cast<double>(kFrames) * characterCount), maxError, ok ? "" : "MISMATCH");
+	}
+
+	Animation playAt(const Animation& source, float time)
+	{
+		Animation player = source;
+		player.play();
+		player.updateAnimation(time);
+		player.pause();
+		return player;
+	}
+
+	/**
+	 * @brief 블렌딩 경로를 단일 클립 경로와 비교 (결과가 같아야 하는 조합만 사용)
+	 */
+	void validateBlending(const Animation& source, bool& passed)
+	{
+		constexpr float kTime = 0.37f;
+		const Animation reference = playAt(source, kTime);
+		const Animation start = playAt(source, 0.0f);
+		float error = 0.0f;
+
+		// 가중치 0.5인 클립 하나: 레이어 안에서 정규화되므로 그대로
+		Animation weighted = playAt(source, kTime);
+		weighted.setBlendWeight(0, 0.5f);
+		weighted.evaluate();
+		error = std::max(error, maxDifference(weighted.getBoneMatrices(), reference.getBoneMatrices()));
+
+		// 첫 프레임에 멈춘 가산 레이어: 변화량이 없으므로 그대로
+		Animation additive = playAt(source, kTime);
+		additive.setBlendWeight(0, 1.0f, additive.addLayer(AnimationBlendMode::Additive));
+		additive.evaluate();
+		error = std::max(error, maxDifference(additive.getBoneMatrices(), reference.getBoneMatrices()));
+
+		// 루트 전체 마스크의 대체 레이어: 위 레이어(시간 0)로 완전히 대체
+		Animation masked = playAt(source, kTime);
+		const uint32_t layer = masked.addLayer(AnimationBlendMode::Override);
+		masked.setBlendWeight(0, 1.0f, layer);
+		masked.setLayerMask(layer, "Root", 1.0f);
+		masked.evaluate();
+		error = std::max(error, maxDifference(masked.getBoneMatrices(), start.getBoneMatrices()));
+
+		// 레이어 가중치 0이면 기본 레이어만
+		masked.setLayerWeight(layer, 0.0f);
+		masked.evaluate();
+		error = std::max(error, maxDifference(masked.getBoneMatrices(), reference.getBoneMatrices()));
+
+		const bool ok = error < 1e-4f;
+		passed = passed && ok;
+		std::printf("  blend graph (weighted / additive / masked layer) vs single clip: max error %.2e %s\n",
+			error, ok ? "" : "MISMATCH");
+	}
+
+	/**
+	 * @brief 같은 클립을 재생하는 군중에서 (클립, 양자화 시간) 포즈 캐시 효과 측정
+	 *
+	 * 캐시 결과는 양자화한 시간에서 직접 평가한 포즈와 같아야 함
+	 */
+	void runPoseCacheBenchmark(const Animation& source, uint32_t characterCount, bool& passed)
+	{
+		std::mt19937 rng(characterCount);
+		std::uniform_real_distribution<float> phase(0.0f, source.getDuration());
+		std::vector<Animation> uncached;
+		uncached.reserve(characterCount);
+		for (uint32_t i = 0; i < characterCount; ++i) {
+			uncached.push_back(playAt(source, phase(rng)));
+			uncached.back().play();
+		}
+		std::vector<Animation> cached = uncached;
+		AnimationPoseCache cache;
+
+		double uncachedMs = 0.0;
+		double cachedMs = 0.0;
+		float maxError = 0.0f;
+		float quantizationError = 0.0f;
+		for (uint32_t frame = 0; frame < kFrames; ++frame) {
+			auto t0 = std::chrono::high_resolution_clock::now();
+			for (Animation& character : uncached) {
+				character.advance(kDeltaTime);
+				character.evaluate();
+			}
+			auto t1 = std::chrono::high_resolution_clock::now();
+			cache.beginFrame();
+			for (Animation& character : cached) {
+				character.advance(kDeltaTime);
+				character.evaluate(&cache);
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			uncachedMs += elapsedMs(t0, t1);
+			cachedMs += elapsedMs(t1, t2);
+			const Animation& probe = cached.back();
+			const Animation quantized = playAt(source, cache.getTickTime(cache.quantize(probe.getCurrentTime())));
+			maxError = std::max(maxError, maxDifference(probe.getBoneMatrices(), quantized.getBoneMatrices()));
+			quantizationError = std::max(quantizationError, maxDifference(probe.getBoneMatrices(), uncached.back().getBoneMatrices()));
+		}
+
+		const bool ok = maxError < 1e-4f;
+		passed = passed && ok;
+		const double lookups = static_cast<double>(cache.getHitCount() + cache.getMissCount());
+		std::printf("  %5u characters: evaluate %7.3f ms/frame, pose cache %7.3f ms/frame (%5.1fx), hit rate %.1f%%, %u poses, error %.2e (vs exact time %.2e) %s\n",
+			characterCount, uncachedMs / kFrames, cachedMs / kFrames, uncachedMs / std::max(cachedMs, 1e-6),
+			100.0 * cache.getHitCount() / std::max(lookups, 1.0), cache.getEntryCount(), maxError, quantizationError, ok ? "" : "MISMATCH");
+	}
+
+	/**
+	 * @brief 프리스키닝 CPU 참조(skinning.comp와 같은 계산)를 본 행렬을 먼저 섞는 스키닝과 비교
+	 *
+	 * 위치는 float로 저장하므로 거의 같아야 하고, 법선/탄젠트/바이탄젠트는 half로 저장하므로 half 정밀도 안에서 같아야 함
+	 * 본이 없는 정점과 팔레트가 없는 작업은 원본 그대로여야 함
+	 */
+	void validatePreSkinning(const Animation& source, bool& passed)
+	{
+		constexpr uint32_t kVertexCount = 100000;
+		const Animation posed = playAt(source, 0.37f);
+		const std::vector<glm::mat4>& palette = posed.getBoneMatrices();
+
+		std::mt19937 rng(99);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> weight(0.05f, 1.0f);
+		std::uniform_int_distribution<int> bone(0, static_cast<int>(palette.size()) - 1);
+		auto randomDirection = [&]() {
+			const glm::vec3 v(unit(rng), unit(rng), unit(rng));
+			return glm::length(v) > 1e-3f ? glm::normalize(v) : glm::vec3(0.0f, 1.0f, 0.0f);
+		};
+
+		// 본 1~4개, 8개 중 하나는 본 없음
+		std::vector<RHIVertex> vertices(kVertexCount);
+		for (uint32_t i = 0; i < kVertexCount; ++i) {
+			RHIVertex& vertex = vertices[i];
+			vertex.setPosition(glm::vec3(unit(rng), unit(rng), unit(rng)) * 2.0f);
+			vertex.setNormal(randomDirection());
+			vertex.setTangent(randomDirection());
+			vertex.setBitangent(randomDirection());
+			if (i % 8 == 7) {
+				continue;
+			}
+
+			const int influences = 1 + static_cast<int>(i % 4);
+			float sum = 0.0f;
+			for (int k = 0; k < influences; ++k) {
+				vertex.boneIndices[k] = bone(rng);
+				vertex.boneWeights[k] = weight(rng);
+				sum += vertex.boneWeights[k];
+			}
+			vertex.boneWeights /= sum;
+		}
+
+		std::vector<SkinnedVertex> skinned(kVertexCount);
+		auto t0 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < kVertexCount; ++i) {
+			skinned[i] = RHISkinningCache::skinVertex(vertices[i], palette.data());
+		}
+		auto t1 = std::chrono::high_resolution_clock::now();
+
+		float positionError = 0.0f;
+		float frameError = 0.0f;
+		float copyError = 0.0f;
+		for (uint32_t i = 0; i < kVertexCount; ++i) {
+			const RHIVertex& vertex = vertices[i];
+			glm::mat4 blended(0.0f);
+			float total = 0.0f;
+			for (int k = 0; k < 4; ++k) {
+				if (vertex.boneIndices[k] >= 0 && vertex.boneWeights[k] > 0.0f) {
+					blended += palette[vertex.boneIndices[k]] * vertex.boneWeights[k];
+					total += vertex.boneWeights[k];
+				}
+			}
+
+			glm::vec3 position = vertex.getPosition();
+			glm::vec3 frames[3] = { vertex.getNormal(), vertex.getTangent(), vertex.getBitangent() };
+			if (total > 0.0f) {
+				position = glm::vec3(blended * glm::vec4(position, 1.0f));
+				for (glm::vec3& frame : frames) {
+					frame = glm::normalize(glm::mat3(blended) * frame);
+				}
+			}
+
+			const glm::vec3 result[3] = { skinned[i].getNormal(), skinned[i].getTangent(), skinned[i].getBitangent() };
+			positionError = std::max(positionError, glm::length(skinned[i].position - position));
+			for (int f = 0; f < 3; ++f) {
+				frameError = std::max(frameError, glm::length(result[f] - frames[f]));
+			}
+
+			// 팔레트 없는 작업: 원본 그대로
+			const SkinnedVertex copied = RHISkinningCache::skinVertex(vertex, nullptr);
+			copyError = std::max(copyError, glm::length(copied.position - vertex.getPosition()));
+			copyError = std::max(copyError, glm::length(copied.getNormal() - vertex.getNormal()));
+		}
+
+		const bool ok = positionError < 1e-4f && frameError < 2e-3f && copyError == 0.0f;
+		passed = passed && ok;
+		std::printf("  pre-skinning reference: %u vertices %7.3f ms, position error %.2e, frame error %.2e (half), copy error %.2e %s\n",
+			kVertexCount, elapsedMs(t0, t1), positionError, frameError, copyError, ok ? "" : "MISMATCH");
+	}
+}
+
+int main()
+{
+	std::printf("[Animation] %u-bone skeleton, %u keys per channel, %u frames\n", kBoneCount, kKeyCount, kFrames);
+
+	const Skeleton skeleton = makeSkeleton(1234);
+	const std::unique_ptr<aiScene> scene = makeScene(skeleton);
+
+	Animation source;
+	source.loadFromScene(scene.get());
+	if (source.getBoneCount() != kBoneCount || source.getNodeCount() != kBoneCount + 1) {
+		std::printf("  unexpected skeleton: %u bones, %u nodes\n", source.getBoneCount(), source.getNodeCount());
+		return 1;
+	}
+
+	bool passed = true;
+	validateKernels(skeleton, passed);
+	for (uint32_t count : { 100u, 250u, 500u, 1000u }) {
+		runBenchmark(skeleton, source, count, passed);
+	}
+
+	validateBlending(source, passed);
+	for (uint32_t count : { 100u, 1000u }) {
+		runPoseCacheBenchmark(source, count, passed);
+	}
+
+	validatePreSkinning(source, passed);
+
+	std::printf("  equivalence: %s\n", passed ? "passed" : "FAILED");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,340 @@
+#include "Core/RHIModel.h"
+#include "Core/RHIScene.h"
+#include "RHI/Resources/RHIUploadManager.h"
+#include "RHI/Util/RHIFactory.h"
+#include "Rendering/RHIGpuCuller.h"
+#include "Rendering/RHIMesh.h"
+#include "Rendering/RHIViewFrustum.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace BinRenderer;
+
+// GPU 절두체 컬링 검증 (헤드리스 Vulkan, lavapipe 같은 소프트웨어 디바이스로도 실행 가능)
+// - 헬멧 격자를 RHIGpuCuller로 컬링하고 Indirect 커맨드/드로우 수를 읽어 CPU 판정과 비교
+// - 압축 모드: 드로우 수만큼의 커맨드가 보이는 레코드를 한 번씩만 가리켜야 함
+// - 고정 개수 모드: 레코드 위치 그대로, 안 보이면 instanceCount = 0
+// - 다음 prepareFrame에서 읽은 getVisibleCount()가 같은 프레임의 GPU 드로우 수와 같아야 함
+// Vulkan 디바이스, 셰이더(.spv), 모델 중 하나라도 없으면 건너뜀 (종료 코드 0)
+
+namespace
+{
+	constexpr uint32_t kGridSize = 32;
+	constexpr float kGridSpacing = 6.0f;
+	constexpr uint32_t kHiddenStride = 7;  // 이 간격의 노드는 visible = false (항상 컬링)
+	constexpr float kPlaneEpsilon = 1e-3f;  // 평면에 걸친 레코드는 GPU/CPU 부동소수 차이로 어느 쪽이든 허용
+
+	enum class Expect
+	{
+		Visible,
+		Culled,
+		Either,
+	};
+
+	glm::mat4 makeViewProjection(const glm::vec3& eye, const glm::vec3& target)
+	{
+		glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		projection[1][1] *= -1.0f;  // RHICamera와 같은 Vulkan Y 반전
+		return projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+	}
+
+	/**
+	 * @brief gpuCull.comp와 같은 판정 (World AABB 중심/반경과 평면 6개)
+	 */
+	Expect classify(const RHIViewFrustum& frustum, const glm::mat4& model, const AABB& bounds, bool visible)
+	{
+		if (!visible)
+		{
+			return Expect::Culled;
+		}
+
+		const glm::vec3 center = glm::vec3(model * glm::vec4(bounds.getCenter(), 1.0f));
+		const glm::mat3 m(model);
+		const glm::vec3 localExtent = bounds.getExtents();
+		const glm::vec3 extent = glm::abs(m[0]) * localExtent.x + glm::abs(m[1]) * localExtent.y + glm::abs(m[2]) * localExtent.z;
+
+		Expect result = Expect::Visible;
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			const Plane& plane = frustum.getPlane(static_cast<RHIViewFrustum::PlaneIndex>(p));
+			const float d = glm::dot(plane.normal, center) + plane.distance;
+			const float r = glm::dot(glm::abs(plane.normal), extent);
+			if (d + r < -kPlaneEpsilon)
+			{
+				return Expect::Culled;
+			}
+			if (d + r < kPlaneEpsilon)
+			{
+				result = Expect::Either;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief 컬링 한 프레임 기록/제출 후 커맨드와 드로우 수를 readback 버퍼로 복사 (헤드리스 제출은 완료까지 대기)
+	 */
+	void runFrame(RHI* rhi, RHIGpuCuller& culler, const glm::mat4& viewProjection, RHIBufferHandle readback,
+		RHIDeviceSize commandBytes)
+	{
+		RHIViewFrustum frustum;
+		frustum.extractFromViewProjection(viewProjection);
+
+		culler.prepareFrame();
+
+		rhi->beginCommandRecording();
+		culler.recordCulling(frustum, viewProjection, true);
+
+		RHIBarrierBatch copyBarrier;
+		for (RHIBufferHandle buffer : { culler.getCommandBuffer(), culler.getCountBuffer() })
+		{
+			RHIBufferBarrier& barrier = copyBarrier.bufferBarriers.emplace_back();
+			barrier.buffer = buffer;
+			barrier.srcStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			barrier.srcAccessMask = RHI_ACCESS_SHADER_WRITE_BIT;
+			barrier.dstStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+			barrier.dstAccessMask = RHI_ACCESS_TRANSFER_READ_BIT;
+		}
+		rhi->cmdPipelineBarrier(copyBarrier);
+
+		const RHIBufferCopy commandRegion{ 0, 0, commandBytes };
+		const RHIBufferCopy countRegion{ 0, commandBytes, sizeof(uint32_t) };
+		rhi->cmdCopyBuffer(culler.getCommandBuffer(), readback, 1, &commandRegion);
+		rhi->cmdCopyBuffer(culler.getCountBuffer(), readback, 1, &countRegion);
+
+		RHIBarrierBatch hostBarrier;
+		RHIBufferBarrier& barrier = hostBarrier.bufferBarriers.emplace_back();
+		barrier.buffer = readback;
+		barrier.srcStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+		barrier.srcAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstStageMask = RHI_PIPELINE_STAGE_HOST_BIT;
+		barrier.dstAccessMask = RHI_ACCESS_HOST_READ_BIT;
+		rhi->cmdPipelineBarrier(hostBarrier);
+
+		rhi->endCommandRecording();
+		rhi->submitCommands(RHIQueueSubmitInfo{});
+	}
+
+	/**
+	 * @brief readback한 커맨드/드로우 수를 CPU 판정과 비교
+	 * @return GPU가 그리는 레코드 수 (검증 실패는 passed에 기록)
+	 */
+	uint32_t validate(const RHIGpuCuller& culler, const std::vector<RHISceneNode>& nodes, const glm::mat4& viewProjection,
+		const uint8_t* readback, RHIDeviceSize commandBytes, bool& passed)
+	{
+		RHIViewFrustum frustum;
+		frustum.extractFromViewProjection(viewProjection);
+
+		// 레코드 순서 = 노드 순서 x 모델 메시 순서
+		std::vector<Expect> expected;
+		std::vector<uint32_t> indexCounts;
+		for (const auto& node : nodes)
+		{
+			const glm::mat4 world = node.transform * node.model->getTransform();
+			for (const auto& mesh : node.model->getMeshes())
+			{
+				expected.push_back(classify(frustum, world, mesh->getBounds(), node.visible));
+				indexCounts.push_back(mesh->getIndexCount());
+			}
+		}
+
+		const uint32_t recordCount = culler.getRecordCount();
+		if (expected.size() != recordCount)
+		{
+			std::printf("  FAILED: %u records, expected %zu\n", recordCount, expected.size());
+			passed = false;
+			return 0;
+		}
+
+		std::vector<RHIDrawIndexedIndirectCommand> commands(recordCount);
+		std::memcpy(commands.data(), readback, recordCount * sizeof(RHIDrawIndexedIndirectCommand));
+		uint32_t drawCount = 0;
+		std::memcpy(&drawCount, readback + commandBytes, sizeof(uint32_t));
+
+		uint32_t errors = 0;
+		auto fail = [&](const char* what, uint32_t index) {
+			if (errors++ < 8)
+			{
+				std::printf("  FAILED: %s (command %u)\n", what, index);
+			}
+		};
+
+		std::vector<bool> drawn(recordCount, false);
+		uint32_t drawnCount = 0;
+		if (culler.usesDrawCount())
+		{
+			// 앞에서부터 drawCount개만 유효, 보이는 레코드를 한 번씩만 가리킴
+			if (drawCount > recordCount)
+			{
+				std::printf("  FAILED: draw count %u exceeds %u records\n", drawCount, recordCount);
+				passed = false;
+				return 0;
+			}
+			for (uint32_t i = 0; i < drawCount; ++i)
+			{
+				const RHIDrawIndexedIndirectCommand& command = commands[i];
+				const uint32_t record = command.firstInstance;
+				if (record >= recordCount || drawn[record])
+				{
+					fail("record index out of range or duplicated", i);
+					continue;
+				}
+				drawn[record] = true;
+				if (command.instanceCount != 1 || command.indexCount != indexCounts[record])
+				{
+					fail("command does not match its record", i);
+				}
+			}
+			drawnCount = drawCount;
+		}
+		else
+		{
+			// 레코드 위치 그대로, 안 보이면 instanceCount = 0 (drawCount는 통계용으로 센 보이는 수)
+			for (uint32_t i = 0; i < recordCount; ++i)
+			{
+				const RHIDrawIndexedIndirectCommand& command = commands[i];
+				if (command.firstInstance != i)
+				{
+					fail("command is not at its record position", i);
+					continue;
+				}
+				drawn[i] = command.instanceCount != 0;
+				drawnCount += drawn[i] ? 1 : 0;
+			}
+			if (drawCount != drawnCount)
+			{
+				std::printf("  FAILED: draw count %u, %u commands with instances\n", drawCount, drawnCount);
+				passed = false;
+			}
+		}
+
+		for (uint32_t record = 0; record < recordCount; ++record)
+		{
+			if ((expected[record] == Expect::Visible && !drawn[record]) ||
+				(expected[record] == Expect::Culled && drawn[record]))
+			{
+				fail(drawn[record] ? "culled record was drawn" : "visible record was culled", record);
+			}
+		}
+
+		if (errors > 0)
+		{
+			std::printf("  %u mismatches\n", errors);
+			passed = false;
+		}
+		return drawnCount;
+	}
+}
+
+int main()
+{
+	std::printf("[GpuCullingCheck] GPU frustum culling vs CPU reference (headless)\n");
+
+	std::unique_ptr<RHI> rhi = RHIFactory::createUnique(RHIApiType::Vulkan);
+	RHIInitInfo initInfo{};
+	initInfo.maxFramesInFlight = 1;
+	if (!rhi || !rhi->initialize(initInfo))
+	{
+		std::printf("  skipped: no Vulkan device\n");
+		return 0;
+	}
+
+	bool passed = true;
+	{
+		auto model = std::make_shared<RHIModel>(rhi.get());
+		RHIGpuCuller culler(rhi.get(), 1);
+		if (!model->loadFromFile("../../assets/models/DamagedHelmet.glb") || model->getMeshes().empty())
+		{
+			std::printf("  skipped: DamagedHelmet.glb not found\n");
+		}
+		else if (!culler.initialize())
+		{
+			std::printf("  skipped: GPU culler not available (see log)\n");
+		}
+		else
+		{
+			// 원점 중심 격자, 일부 노드는 숨김
+			std::vector<RHISceneNode> nodes;
+			const float half = (kGridSize - 1) * kGridSpacing * 0.5f;
+			for (uint32_t z = 0; z < kGridSize; ++z)
+			{
+				for (uint32_t x = 0; x < kGridSize; ++x)
+				{
+					RHISceneNode& node = nodes.emplace_back(model, "Helmet");
+					node.transform = glm::translate(glm::mat4(1.0f),
+						glm::vec3(x * kGridSpacing - half, 0.0f, z * kGridSpacing - half));
+					node.visible = nodes.size() % kHiddenStride != 0;
+				}
+			}
+
+			culler.gather(nodes);
+			rhi->getUploadManager()->flushAndWait();
+
+			const uint32_t recordCount = culler.getRecordCount();
+			const RHIDeviceSize commandBytes = static_cast<RHIDeviceSize>(recordCount) * sizeof(RHIDrawIndexedIndirectCommand);
+
+			RHIBufferCreateInfo readbackInfo{};
+			readbackInfo.size = commandBytes + sizeof(uint32_t);
+			readbackInfo.usage = RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+			readbackInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			RHIBufferHandle readback = rhi->createBuffer(readbackInfo);
+			const uint8_t* mapped = readback.isValid() ? static_cast<const uint8_t*>(rhi->mapBuffer(readback)) : nullptr;
+			if (!mapped)
+			{
+				std::printf("  FAILED: could not create readback buffer\n");
+				passed = false;
+			}
+
+			// 격자 밖에서 전체 / 격자 안에서 일부 / 격자를 등진 시점
+			const glm::vec3 views[][2] = {
+				{ glm::vec3(0.0f, 120.0f, 160.0f), glm::vec3(0.0f) },
+				{ glm::vec3(-20.0f, 4.0f, 10.0f), glm::vec3(30.0f, 0.0f, -40.0f) },
+				{ glm::vec3(0.0f, 2.0f, 150.0f), glm::vec3(0.0f, 2.0f, 300.0f) },
+			};
+
+			for (size_t v = 0; mapped && v < std::size(views); ++v)
+			{
+				const glm::mat4 viewProjection = makeViewProjection(views[v][0], views[v][1]);
+				runFrame(rhi.get(), culler, viewProjection, readback, commandBytes);
+				const uint32_t drawn = validate(culler, nodes, viewProjection, mapped, commandBytes, passed);
+
+				// 슬롯이 다시 돌아오면 이번 프레임의 드로우 수를 통계로 읽음
+				culler.prepareFrame();
+				if (!culler.hasVisibleCount() || culler.getVisibleCount() != drawn)
+				{
+					std::printf("  FAILED: stats readback %u, GPU drew %u\n",
+						culler.hasVisibleCount() ? culler.getVisibleCount() : 0u, drawn);
+					passed = false;
+				}
+
+				std::printf("  view %zu: %u / %u records drawn (%s)\n", v, drawn, recordCount,
+					culler.usesDrawCount() ? "compacted" : "fixed count");
+			}
+
+			if (readback.isValid())
+			{
+				if (mapped)
+				{
+					rhi->unmapBuffer(readback);
+				}
+				rhi->destroyBuffer(readback);
+			}
+		}
+
+		rhi->waitIdle();
+		culler.shutdown();
+	}
+
+	rhi->shutdown();
+
+	std::printf("  GPU culling matches CPU reference: %s\n", passed ? "passed" : "FAILED");
+	return passed ? 0 : 1;
+}
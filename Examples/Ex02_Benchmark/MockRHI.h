@@ -0,0 +1,203 @@
+#pragma once
+
+#include "RHI/Core/RHI.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief GPU 없이 동작하는 벤치마크용 RHI
+	 * 
+	 * 리소스 생성은 핸들만 발급하고 커맨드는 호출 횟수만 기록
+	 * 버퍼는 CPU 메모리로 만들어 map/unmap이 동작하도록 함
+	 */
+	class MockRHI : public RHI
+	{
+	public:
+		struct Counters
+		{
+			uint32_t imagesCreated = 0;
+			uint32_t imagesDestroyed = 0;
+			uint32_t buffersCreated = 0;
+			uint32_t buffersDestroyed = 0;
+			uint32_t barrierBatches = 0;
+			uint32_t imageBarriers = 0;
+			uint32_t bufferBarriers = 0;
+			uint32_t drawCalls = 0;
+			uint32_t indirectDrawCalls = 0;
+			uint32_t dispatches = 0;
+			uint32_t submits = 0;
+		};
+
+		const Counters& getCounters() const { return counters_; }
+		void resetCounters() { counters_ = {}; }
+
+		// 초기화 및 생명주기
+		bool initialize(const RHIInitInfo&) override { return true; }
+		void shutdown() override {}
+		void waitIdle() override {}
+
+		// 프레임 관리
+		bool beginFrame(uint32_t& imageIndex) override { imageIndex = 0; return true; }
+		void endFrame(uint32_t) override {}
+		uint32_t getCurrentFrameIndex() const override { return 0; }
+		uint32_t getCurrentImageIndex() const override { return 0; }
+
+		// 스왑체인 접근
+		RHISwapchain* getSwapchain() const override { return nullptr; }
+		RHIImageViewHandle getSwapchainImageView(uint32_t) const override { return {}; }
+
+		// 리소스 생성
+		RHIBufferHandle createBuffer(const RHIBufferCreateInfo& createInfo) override
+		{
+			counters_.buffersCreated++;
+			RHIBufferHandle handle(nextId(), 1);
+			bufferMemory_[handle.getIndex()].resize(static_cast<size_t>(createInfo.size));
+			return handle;
+		}
+
+		RHIImageHandle createImage(const RHIImageCreateInfo&) override
+		{
+			counters_.imagesCreated++;
+			return RHIImageHandle(nextId(), 1);
+		}
+
+		RHIShaderHandle createShader(const RHIShaderCreateInfo&) override { return RHIShaderHandle(nextId(), 1); }
+		RHIPipelineHandle createPipeline(const RHIPipelineCreateInfo&) override { return RHIPipelineHandle(nextId(), 1); }
+		RHIPipelineHandle createComputePipeline(const RHIComputePipelineCreateInfo&) override { return RHIPipelineHandle(nextId(), 1); }
+		RHIPipelineLayoutHandle createPipelineLayout(const RHIPipelineLayoutCreateInfo&) override { return RHIPipelineLayoutHandle(nextId(), 1); }
+		RHIImageViewHandle createImageView(RHIImageHandle, const RHIImageViewCreateInfo&) override { return RHIImageViewHandle(nextId(), 1); }
+		RHISamplerHandle createSampler(const RHISamplerCreateInfo&) override { return RHISamplerHandle(nextId(), 1); }
+
+		//  Descriptor Set 생성
+		RHIDescriptorSetLayoutHandle createDescriptorSetLayout(const RHIDescriptorSetLayoutCreateInfo&) override { return RHIDescriptorSetLayoutHandle(nextId(), 1); }
+		RHIDescriptorPoolHandle createDescriptorPool(const RHIDescriptorPoolCreateInfo&) override { return RHIDescriptorPoolHandle(nextId(), 1); }
+		RHIDescriptorSetHandle allocateDescriptorSet(RHIDescriptorPoolHandle, RHIDescriptorSetLayoutHandle) override { return RHIDescriptorSetHandle(nextId(), 1); }
+
+		void updateDescriptorSet(RHIDescriptorSetHandle, uint32_t, RHIBufferHandle, RHIDeviceSize, RHIDeviceSize) override {}
+		void updateDescriptorSet(RHIDescriptorSetHandle, uint32_t, RHIImageViewHandle, RHISamplerHandle) override {}
+
+		// 리소스 해제
+		void destroyBuffer(RHIBufferHandle buffer) override
+		{
+			counters_.buffersDestroyed++;
+			bufferMemory_.erase(buffer.getIndex());
+		}
+		void destroyImage(RHIImageHandle) override { counters_.imagesDestroyed++; }
+		void destroyShader(RHIShaderHandle) override {}
+		void destroyPipeline(RHIPipelineHandle) override {}
+		void destroyPipelineLayout(RHIPipelineLayoutHandle) override {}
+		void destroyImageView(RHIImageViewHandle) override {}
+		void destroySampler(RHISamplerHandle) override {}
+
+		//  Descriptor Set 해제
+		void destroyDescriptorSetLayout(RHIDescriptorSetLayoutHandle) override {}
+		void destroyDescriptorPool(RHIDescriptorPoolHandle) override {}
+
+		// 버퍼 매핑
+		void* mapBuffer(RHIBufferHandle buffer) override
+		{
+			auto it = bufferMemory_.find(buffer.getIndex());
+			return (it != bufferMemory_.end() && !it->second.empty()) ? it->second.data() : nullptr;
+		}
+		void unmapBuffer(RHIBufferHandle) override {}
+		void flushBuffer(RHIBufferHandle, RHIDeviceSize, RHIDeviceSize) override {}
+
+		// 커맨드 기록
+		void beginCommandRecording() override {}
+		void endCommandRecording() override {}
+		void submitCommands() override { counters_.submits++; }
+
+		// 멀티 큐 (전용 큐가 있는 것처럼 동작)
+		bool hasDedicatedQueue(RHIQueueType) const override { return true; }
+		void beginCommandRecording(RHIQueueType) override {}
+		uint64_t submitCommands(const RHIQueueSubmitInfo& submitInfo) override
+		{
+			counters_.submits++;
+			return ++queueValues_[static_cast<uint32_t>(submitInfo.queue)];
+		}
+		uint64_t getCompletedQueueValue(RHIQueueType queue) const override { return queueValues_[static_cast<uint32_t>(queue)]; }
+		void waitQueueValue(RHIQueueType, uint64_t) override {}
+		RHIUploadManager* getUploadManager() override { return nullptr; }
+		bool isMultiDrawIndirectSupported() const override { return true; }
+		bool isDrawIndirectCountSupported() const override { return true; }
+
+		// 병렬 커맨드 기록 (기록 대상이 없으므로 컨텍스트 전환만 흉내)
+		uint32_t getMaxRecordingContexts() const override { return 1; }
+		bool beginParallelRecording(uint32_t) override { return false; }
+		void beginRecordingContext(uint32_t) override {}
+		void endRecordingContext() override {}
+		void endParallelRecording() override {}
+		RHIBindStats getBindStats() const override { return {}; }
+		void resetBindStats() override {}
+
+		// 드로우 커맨드
+		void cmdBindPipeline(RHIPipelineHandle) override {}
+		void cmdBindVertexBuffer(RHIBufferHandle, RHIDeviceSize) override {}
+		void cmdBindIndexBuffer(RHIBufferHandle, RHIDeviceSize) override {}
+		void cmdBindDescriptorSets(RHIPipelineLayout*, const RHIDescriptorSetHandle*, uint32_t) override {}
+		void cmdPushConstants(RHIPipelineLayout*, RHIShaderStageFlags, uint32_t, uint32_t, const void*) override {}
+		void cmdSetViewport(const RHIViewport&) override {}
+		void cmdSetScissor(const RHIRect2D&) override {}
+		void cmdDraw(uint32_t, uint32_t, uint32_t, uint32_t) override { counters_.drawCalls++; }
+		void cmdDrawIndexed(uint32_t, uint32_t, uint32_t, int32_t, uint32_t) override { counters_.drawCalls++; }
+		void cmdDrawIndexedIndirect(RHIBufferHandle, RHIDeviceSize, uint32_t, uint32_t) override { counters_.indirectDrawCalls++; }
+		void cmdDrawIndexedIndirectCount(RHIBufferHandle, RHIDeviceSize, RHIBufferHandle, RHIDeviceSize, uint32_t, uint32_t) override { counters_.indirectDrawCalls++; }
+		void cmdDispatch(uint32_t, uint32_t, uint32_t) override { counters_.dispatches++; }
+		void cmdBindDescriptorSets(RHIPipelineHandle, uint32_t, const RHIDescriptorSetHandle*, uint32_t) override {}
+		void cmdPushConstants(RHIPipelineHandle, RHIShaderStageFlags, uint32_t, uint32_t, const void*) override {}
+
+		//  Dynamic Rendering
+		void cmdBeginRendering(uint32_t, uint32_t, RHIImageViewHandle, RHIImageViewHandle) override {}
+		void cmdEndRendering() override {}
+
+		//  Image Layout Transition
+		void cmdTransitionImageLayout(RHIImageHandle, RHIImageLayout, RHIImageLayout,
+			RHIImageAspectFlagBits, uint32_t, uint32_t, uint32_t, uint32_t) override {}
+
+		//  Pipeline Barrier (배치)
+		void cmdPipelineBarrier(const RHIBarrierBatch& batch) override
+		{
+			if (batch.empty()) {
+				return;
+			}
+			counters_.barrierBatches++;
+			counters_.imageBarriers += static_cast<uint32_t>(batch.imageBarriers.size());
+			counters_.bufferBarriers += static_cast<uint32_t>(batch.bufferBarriers.size());
+		}
+
+		//  Buffer to Buffer Copy
+		void cmdCopyBuffer(RHIBufferHandle, RHIBufferHandle, uint32_t, const RHIBufferCopy*) override {}
+		void cmdFillBuffer(RHIBufferHandle, RHIDeviceSize, RHIDeviceSize, uint32_t) override {}
+
+		//  Buffer to Image Copy
+		void cmdCopyBufferToImage(RHIBufferHandle, RHIImageHandle, RHIImageLayout, uint32_t, const RHIBufferImageCopy*) override {}
+
+		//  Texture 생성 (Image + View + Sampler)
+		RHITextureHandle createTexture(RHIImageHandle, RHIImageViewHandle, RHISamplerHandle) override { return RHITextureHandle(nextId(), 1); }
+		void destroyTexture(RHITextureHandle) override {}
+
+		// API 타입 (Vulkan 경로를 흉내냄)
+		RHIApiType getApiType() const override { return RHIApiType::Vulkan; }
+
+	private:
+		Counters counters_;
+		uint64_t queueValues_[RHI_QUEUE_TYPE_COUNT] = {};
+		uint32_t nextId_ = 1;
+		std::unordered_map<uint32_t, std::vector<uint8_t>> bufferMemory_;
+
+		uint32_t nextId()
+		{
+			// 20비트 인덱스 공간을 순환 (0은 무효 핸들)
+			uint32_t id = nextId_;
+			nextId_ = (nextId_ + 1) & RHIImageHandle::kIndexMask;
+			if (nextId_ == 0) {
+				nextId_ = 1;
+			}
+			return id;
+		}
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,198 @@
+#include "Rendering/RHIOcclusionBuffer.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace BinRenderer;
+
+namespace
+{
+	struct Box
+	{
+		glm::vec3 center;
+		glm::vec3 extent;
+	};
+
+	// 상자 하나의 정점 8개 / 삼각형 12개 (로컬 공간 -1 ~ 1)
+	const glm::vec3 kBoxVertices[8] = {
+		{ -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 },
+		{ -1, -1, 1 }, { 1, -1, 1 }, { 1, 1, 1 }, { -1, 1, 1 },
+	};
+	const uint32_t kBoxIndices[36] = {
+		0, 1, 2, 0, 2, 3,  4, 6, 5, 4, 7, 6,
+		0, 4, 5, 0, 5, 1,  3, 2, 6, 3, 6, 7,
+		0, 3, 7, 0, 7, 4,  1, 5, 6, 1, 6, 2,
+	};
+
+	glm::mat4 boxTransform(const Box& box)
+	{
+		return glm::scale(glm::translate(glm::mat4(1.0f), box.center), box.extent);
+	}
+
+	glm::mat4 makeViewProjection(const glm::vec3& eye, const glm::vec3& target, float aspect)
+	{
+		glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), aspect, 0.1f, 1000.0f);
+		projection[1][1] *= -1.0f;  // RHICamera와 같은 Vulkan Y 반전
+		return projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+	}
+
+	/**
+	 * @brief 도시 블록 합성 씬
+	 *
+	 * 격자에 놓인 건물(가림막)과 거리/건물 뒤에 흩어진 작은 물체(테스트 대상)
+	 */
+	void buildCity(uint32_t blocks, uint32_t objectCount, uint32_t seed, std::vector<Box>& buildings, std::vector<Box>& objects)
+	{
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> height(8.0f, 40.0f);
+		const float spacing = 30.0f;
+		const float half = spacing * blocks * 0.5f;
+
+		for (uint32_t z = 0; z < blocks; ++z) {
+			for (uint32_t x = 0; x < blocks; ++x) {
+				const float h = height(rng);
+				buildings.push_back({ glm::vec3(x * spacing - half, h, -(z * spacing) - 20.0f), glm::vec3(10.0f, h, 10.0f) });
+			}
+		}
+
+		std::uniform_real_distribution<float> px(-half, half);
+		std::uniform_real_distribution<float> pz(-(blocks * spacing) - 20.0f, -5.0f);
+		std::uniform_real_distribution<float> size(0.3f, 2.0f);
+		for (uint32_t i = 0; i < objectCount; ++i) {
+			const float s = size(rng);
+			objects.push_back({ glm::vec3(px(rng), s, pz(rng)), glm::vec3(s) });
+		}
+	}
+
+	double elapsedMs(std::chrono::high_resolution_clock::time_point t0, std::chrono::high_resolution_clock::time_point t1)
+	{
+		return std::chrono::duration<double, std::milli>(t1 - t0).count();
+	}
+
+	void runBenchmark(uint32_t width, uint32_t height, uint32_t blocks, uint32_t objectCount, uint32_t iterations)
+	{
+		std::vector<Box> buildings;
+		std::vector<Box> objects;
+		buildCity(blocks, objectCount, 42, buildings, objects);
+
+		RHIOcclusionBuffer buffer(width, height);
+		const glm::mat4 viewProjection = makeViewProjection(glm::vec3(5.0f, 2.0f, 10.0f), glm::vec3(5.0f, 2.0f, -100.0f), 16.0f / 9.0f);
+
+		double rasterMs = 0.0;
+		double hierarchyMs = 0.0;
+		double testMs = 0.0;
+		uint32_t triangles = 0;
+		uint32_t occluded = 0;
+
+		for (uint32_t it = 0; it < iterations; ++it) {
+			const auto t0 = std::chrono::high_resolution_clock::now();
+			buffer.clear(viewProjection);
+			triangles = 0;
+			for (const Box& building : buildings) {
+				triangles += buffer.rasterize(boxTransform(building), kBoxVertices, 8, kBoxIndices, 36);
+			}
+			const auto t1 = std::chrono::high_resolution_clock::now();
+			buffer.buildHierarchy();
+			const auto t2 = std::chrono::high_resolution_clock::now();
+			occluded = 0;
+			for (const Box& object : objects) {
+				occluded += buffer.isVisible(object.center, object.extent) ? 0 : 1;
+			}
+			const auto t3 = std::chrono::high_resolution_clock::now();
+
+			rasterMs += elapsedMs(t0, t1);
+			hierarchyMs += elapsedMs(t1, t2);
+			testMs += elapsedMs(t2, t3);
+		}
+
+		std::printf("%4ux%-4u %4zu occluders (%5u tris): raster %7.3f ms | hi-z %6.3f ms | test %6u boxes %7.3f ms | occluded %6u (%.1f%%)\n",
+			width, height, buildings.size(), triangles,
+			rasterMs / iterations, hierarchyMs / iterations, objectCount, testMs / iterations,
+			occluded, 100.0 * occluded / objectCount);
+	}
+
+	/**
+	 * @brief 결과 검증: 가림막 앞/옆 물체는 보이고, 벽 뒤 물체는 가려져야 함
+	 */
+	bool runSanityChecks()
+	{
+		RHIOcclusionBuffer buffer(256, 128);
+		const glm::mat4 viewProjection = makeViewProjection(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f), 2.0f);
+		buffer.clear(viewProjection);
+
+		// 카메라 앞 20m, 시야 중앙을 덮는 벽
+		const Box wall{ glm::vec3(0.0f, 0.0f, -20.0f), glm::vec3(10.0f, 6.0f, 0.5f) };
+		buffer.rasterize(boxTransform(wall), kBoxVertices, 8, kBoxIndices, 36);
+		buffer.buildHierarchy();
+
+		struct Case
+		{
+			const char* name;
+			Box box;
+			bool expectVisible;
+		};
+		const Case cases[] = {
+			{ "occluder itself", wall, true },
+			{ "in front of wall", { glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(1.0f) }, true },
+			{ "behind wall", { glm::vec3(0.0f, 0.0f, -40.0f), glm::vec3(1.0f) }, false },
+			{ "behind wall, large", { glm::vec3(2.0f, 1.0f, -60.0f), glm::vec3(8.0f, 6.0f, 1.0f) }, false },
+			{ "beside wall", { glm::vec3(30.0f, 0.0f, -40.0f), glm::vec3(1.0f) }, true },
+			{ "straddling wall edge", { glm::vec3(20.5f, 0.0f, -40.0f), glm::vec3(1.0f) }, true },
+			{ "touching near plane", { glm::vec3(0.0f, 0.0f, -0.05f), glm::vec3(1.0f) }, true },
+			{ "behind camera", { glm::vec3(0.0f, 0.0f, 10.0f), glm::vec3(1.0f) }, true },
+		};
+
+		bool passed = true;
+		for (const Case& c : cases) {
+			const bool visible = buffer.isVisible(c.box.center, c.box.extent);
+			if (visible != c.expectVisible) {
+				std::printf("  FAILED: %s (expected %s)\n", c.name, c.expectVisible ? "visible" : "occluded");
+				passed = false;
+			}
+		}
+
+		// 무작위 씬: 모든 가림막의 가장 가까운 깊이보다 앞에 있는 물체는 절대 가려지면 안 됨
+		std::vector<Box> buildings;
+		std::vector<Box> objects;
+		buildCity(8, 20000, 7, buildings, objects);
+		const glm::mat4 cityViewProjection = makeViewProjection(glm::vec3(5.0f, 2.0f, 10.0f), glm::vec3(5.0f, 2.0f, -100.0f), 16.0f / 9.0f);
+		buffer.clear(cityViewProjection);
+		for (const Box& building : buildings) {
+			buffer.rasterize(boxTransform(building), kBoxVertices, 8, kBoxIndices, 36);
+		}
+		buffer.buildHierarchy();
+
+		uint32_t falseOccluded = 0;
+		for (const Box& object : objects) {
+			// 첫 줄 건물(z = -10 앞면)보다 카메라 쪽에 있는 물체
+			if (object.center.z - object.extent.z > -9.0f && !buffer.isVisible(object.center, object.extent)) {
+				++falseOccluded;
+			}
+		}
+		if (falseOccluded > 0) {
+			std::printf("  FAILED: %u objects in front of every occluder were culled\n", falseOccluded);
+			passed = false;
+		}
+
+		return passed;
+	}
+}
+
+int main()
+{
+	std::printf("[Occlusion] Software occlusion buffer benchmark (averaged)\n");
+
+	const bool passed = runSanityChecks();
+	std::printf("  sanity checks: %s\n", passed ? "passed" : "FAILED");
+
+	runBenchmark(256, 128, 8, 20000, 50);
+	runBenchmark(256, 128, 16, 100000, 20);
+	runBenchmark(512, 256, 16, 100000, 20);
+
+	return passed ? 0 : 1;
+}
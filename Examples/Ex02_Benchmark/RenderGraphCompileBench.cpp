@@ -0,0 +1,170 @@
+#include "MockRHI.h"
+#include "RenderPass/RenderGraph/RGGraph.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace BinRenderer;
+
+namespace
+{
+	struct SyntheticPassData
+	{
+		RGTextureHandle output;
+	};
+
+	/**
+	 * @brief 합성 그래프 구성
+	 * 
+	 * 각 패스는 텍스처 하나를 만들어 쓰고, 이전 패스 출력 최대 readsPerPass개를 읽음
+	 * 모든 패스가 공유 버퍼 하나를 읽기/쓰기하여 WAR/WAW 체인도 함께 측정
+	 * asyncEvery > 0이면 그 간격마다 공유 버퍼를 쓰지 않는 Compute 큐 패스를 섞음
+	 */
+	void buildSyntheticGraph(RenderGraph& graph, uint32_t passCount, uint32_t readsPerPass, uint32_t seed,
+		uint32_t asyncEvery = 0)
+	{
+		std::mt19937 rng(seed);
+		std::vector<RGTextureHandle> outputs;
+		outputs.reserve(passCount);
+		RGBufferHandle sharedBuffer;
+
+		for (uint32_t i = 0; i < passCount; ++i) {
+			const bool isLast = (i + 1 == passCount);
+			const bool isAsync = asyncEvery > 0 && i > 0 && !isLast && (i % asyncEvery) == 0;
+
+			graph.addPass<SyntheticPassData>("Synthetic_" + std::to_string(i),
+				isAsync ? RHIQueueType::Compute : RHIQueueType::Graphics,
+				[&, i, isLast, isAsync](SyntheticPassData& data, RenderGraphBuilder& builder) {
+					if (i == 0) {
+						RGBufferDesc bufferDesc;
+						bufferDesc.name = "SharedCounters";
+						bufferDesc.size = 4096;
+						bufferDesc.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+						sharedBuffer = builder.createBuffer(bufferDesc);
+					}
+
+					for (uint32_t r = 0; r < readsPerPass && !outputs.empty(); ++r) {
+						std::uniform_int_distribution<size_t> pick(0, outputs.size() - 1);
+						builder.readTexture(outputs[pick(rng)], RGResourceUsage::ShaderRead);
+					}
+					if (!isAsync) {
+						builder.readWriteBuffer(sharedBuffer, RGResourceUsage::Storage);
+					}
+
+					RGTextureDesc desc;
+					desc.name = "Synthetic_Color_" + std::to_string(i);
+					desc.width = 1920;
+					desc.height = 1080;
+					desc.format = RHI_FORMAT_R8G8B8A8_UNORM;
+					desc.usage = (isAsync ? RHI_IMAGE_USAGE_STORAGE_BIT : RHI_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) | RHI_IMAGE_USAGE_SAMPLED_BIT;
+					data.output = builder.writeTexture(builder.createTexture(desc),
+						isAsync ? RGResourceUsage::Storage : RGResourceUsage::ColorAttachment);
+					outputs.push_back(data.output);
+
+					if (isLast) {
+						builder.setFinalOutput(data.output);
+					}
+				},
+				[](const SyntheticPassData&, RHI*, uint32_t) {});
+		}
+	}
+
+	void runBenchmark(MockRHI& rhi, uint32_t passCount, uint32_t readsPerPass, uint32_t iterations)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		double setupMs = 0.0;
+		double compileMs = 0.0;
+		double executeMs = 0.0;
+
+		for (uint32_t iter = 0; iter < iterations; ++iter) {
+			RenderGraph graph(&rhi);
+
+			auto t0 = Clock::now();
+			buildSyntheticGraph(graph, passCount, readsPerPass, 1234u + iter);
+			auto t1 = Clock::now();
+			graph.compile();
+			auto t2 = Clock::now();
+			graph.execute(0);
+			auto t3 = Clock::now();
+
+			setupMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+			compileMs += std::chrono::duration<double, std::milli>(t2 - t1).count();
+			executeMs += std::chrono::duration<double, std::milli>(t3 - t2).count();
+
+			graph.reset();
+		}
+
+		const double inv = 1.0 / iterations;
+		std::printf("%6u passes, %u reads/pass: setup %8.3f ms | compile %8.3f ms | execute %8.3f ms\n",
+			passCount, readsPerPass, setupMs * inv, compileMs * inv, executeMs * inv);
+
+		// 같은 RenderGraph를 reset 후 동일 구조로 재구성 (구조 해시 캐시 적중 경로)
+		RenderGraph graph(&rhi);
+		double cachedCompileMs = 0.0;
+		for (uint32_t iter = 0; iter <= iterations; ++iter) {
+			graph.reset();
+			buildSyntheticGraph(graph, passCount, readsPerPass, 1234u);
+
+			auto t0 = Clock::now();
+			graph.compile();
+			auto t1 = Clock::now();
+
+			// 첫 컴파일은 캐시가 비어 있으므로 제외
+			if (iter > 0) {
+				cachedCompileMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+			}
+		}
+
+		const RGCompileStats& stats = graph.getCompileStats();
+		std::printf("%6u passes, rebuilt graph: compile %8.3f ms (cache hits %u/%u)\n",
+			passCount, cachedCompileMs * inv, stats.cacheHitCount, stats.compileCount);
+	}
+
+	void runAsyncBenchmark(MockRHI& rhi, uint32_t passCount, uint32_t asyncEvery)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		RenderGraph graph(&rhi);
+		buildSyntheticGraph(graph, passCount, 2, 1234u, asyncEvery);
+
+		auto t0 = Clock::now();
+		graph.compile();
+		auto t1 = Clock::now();
+
+		const uint32_t submitsBefore = rhi.getCounters().submits;
+		graph.execute(0);
+		const uint32_t submits = rhi.getCounters().submits - submitsBefore;
+
+		std::printf("%6u passes, async every %u: compile %8.3f ms | queue batches %zu | submits %u\n",
+			passCount, asyncEvery, std::chrono::duration<double, std::milli>(t1 - t0).count(),
+			graph.getQueueBatchCount(), submits);
+	}
+}
+
+int main()
+{
+	MockRHI rhi;
+
+	std::printf("[RenderGraph] Compile benchmark (MockRHI, averaged)\n");
+
+	const uint32_t passCounts[] = { 10, 100, 1000 };
+	for (uint32_t passCount : passCounts) {
+		const uint32_t iterations = passCount >= 1000 ? 5 : 50;
+		runBenchmark(rhi, passCount, 4, iterations);
+	}
+
+	for (uint32_t passCount : passCounts) {
+		runAsyncBenchmark(rhi, passCount, 4);
+	}
+
+	const MockRHI::Counters& counters = rhi.getCounters();
+	std::printf("  images %u/%u, buffers %u/%u (created/destroyed), barrier batches %u\n",
+		counters.imagesCreated, counters.imagesDestroyed,
+		counters.buffersCreated, counters.buffersDestroyed,
+		counters.barrierBatches);
+
+	return 0;
+}
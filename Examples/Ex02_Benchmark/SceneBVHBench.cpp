@@ -0,0 +1,244 @@
+#include "Rendering/RHISceneBVH.h"
+#include "Rendering/RHIViewFrustum.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace BinRenderer;
+
+namespace
+{
+	double elapsedMs(std::chrono::high_resolution_clock::time_point t0, std::chrono::high_resolution_clock::time_point t1)
+	{
+		return std::chrono::duration<double, std::milli>(t1 - t0).count();
+	}
+
+	glm::mat4 makeViewProjection(const glm::vec3& eye, const glm::vec3& target)
+	{
+		glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		projection[1][1] *= -1.0f;  // RHICamera와 같은 Vulkan Y 반전
+		return projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+	}
+
+	/**
+	 * @brief 합성 인스턴스: 인스턴스 밀도가 일정하도록 넓이를 늘린 평지 위 상자들 (일부는 큰 건물)
+	 */
+	float makeInstances(uint32_t count, uint32_t seed, std::vector<AABB>& bounds)
+	{
+		std::mt19937 rng(seed);
+		const float half = std::sqrt(static_cast<float>(count)) * 4.0f;
+		std::uniform_real_distribution<float> position(-half, half);
+		std::uniform_real_distribution<float> size(0.25f, 2.0f);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+		bounds.resize(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			glm::vec3 extent(size(rng), size(rng), size(rng));
+			if (unit(rng) < 0.02f) {
+				extent = extent * 8.0f;
+			}
+			const glm::vec3 center(position(rng), extent.y, position(rng));
+			bounds[i] = AABB(center - extent, center + extent);
+		}
+		return half;
+	}
+
+	bool overlapsSphere(const AABB& box, const glm::vec3& center, float radius)
+	{
+		const glm::vec3 closest = glm::clamp(center, box.min, box.max);
+		const glm::vec3 d = closest - center;
+		return glm::dot(d, d) <= radius * radius;
+	}
+
+	bool rayDistance(const AABB& box, const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float& t)
+	{
+		float enter = 0.0f;
+		float exit = maxDistance;
+		for (int axis = 0; axis < 3; ++axis) {
+			const float inv = 1.0f / direction[axis];
+			float t0 = (box.min[axis] - origin[axis]) * inv;
+			float t1 = (box.max[axis] - origin[axis]) * inv;
+			if (t0 > t1) {
+				std::swap(t0, t1);
+			}
+			enter = std::max(enter, t0);
+			exit = std::min(exit, t1);
+		}
+		t = enter;
+		return enter <= exit;
+	}
+
+	// 쿼리 결과를 인덱스 비트맵으로 (순서 무관 비교)
+	std::vector<uint8_t> toMask(const std::vector<RHISpatialItem>& items, size_t count)
+	{
+		std::vector<uint8_t> mask(count, 0);
+		for (const RHISpatialItem& item : items) {
+			mask[item.nodeIndex] = 1;
+		}
+		return mask;
+	}
+
+	void runBenchmark(uint32_t count, uint32_t iterations, bool verify, bool& passed)
+	{
+		std::vector<AABB> bounds;
+		const float half = makeInstances(count, 42, bounds);
+
+		RHISceneBVH bvh;
+		auto t0 = std::chrono::high_resolution_clock::now();
+		bvh.build(bounds);
+		auto t1 = std::chrono::high_resolution_clock::now();
+		const double buildMs = elapsedMs(t0, t1);
+		const float buildCost = bvh.computeCost();
+
+		// 프레임마다 1% 이동 (Refit)
+		std::mt19937 rng(7);
+		std::uniform_int_distribution<uint32_t> pick(0, count - 1);
+		std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+		const uint32_t movedPerFrame = std::max(1u, count / 100);
+		std::vector<uint32_t> movedItems(movedPerFrame);
+		std::vector<AABB> movedBounds(movedPerFrame);
+
+		double refitMs = 0.0;
+		uint32_t rebuilds = 0;
+		for (uint32_t it = 0; it < iterations; ++it) {
+			for (uint32_t i = 0; i < movedPerFrame; ++i) {
+				const uint32_t item = pick(rng);
+				const glm::vec3 delta(offset(rng), 0.0f, offset(rng));
+				bounds[item] = AABB(bounds[item].min + delta, bounds[item].max + delta);
+				movedItems[i] = item;
+				movedBounds[i] = bounds[item];
+			}
+			t0 = std::chrono::high_resolution_clock::now();
+			rebuilds += bvh.updateBounds(movedItems, movedBounds) ? 1 : 0;
+			t1 = std::chrono::high_resolution_clock::now();
+			refitMs += elapsedMs(t0, t1);
+		}
+
+		// 지면 위에서 장면 한쪽을 바라보는 카메라
+		RHIViewFrustum frustum;
+		frustum.extractFromViewProjection(makeViewProjection(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(100.0f, 5.0f, -60.0f)));
+
+		std::vector<RHISpatialItem> result;
+		result.reserve(count);
+		double bvhFrustumMs = 0.0;
+		double linearFrustumMs = 0.0;
+		uint32_t visible = 0;
+		uint32_t linearVisible = 0;
+		for (uint32_t it = 0; it < iterations; ++it) {
+			result.clear();
+			t0 = std::chrono::high_resolution_clock::now();
+			visible = bvh.queryFrustum(frustum, result);
+			t1 = std::chrono::high_resolution_clock::now();
+			linearVisible = 0;
+			for (const AABB& box : bounds) {
+				linearVisible += frustum.intersects(box) ? 1 : 0;
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			bvhFrustumMs += elapsedMs(t0, t1);
+			linearFrustumMs += elapsedMs(t1, t2);
+		}
+
+		// 라이트 컬링 (구) / 피킹 (레이)
+		const uint32_t queryCount = 1000;
+		std::uniform_real_distribution<float> position(-half, half);
+		std::vector<glm::vec3> lightCenters(queryCount);
+		std::vector<glm::vec3> rayDirections(queryCount);
+		std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+		for (uint32_t i = 0; i < queryCount; ++i) {
+			lightCenters[i] = glm::vec3(position(rng), 2.0f, position(rng));
+			const float a = angle(rng);
+			rayDirections[i] = glm::vec3(std::cos(a), -0.05f, std::sin(a));
+		}
+		const glm::vec3 rayOrigin(0.0f, 3.0f, 0.0f);
+		const float lightRadius = 12.0f;
+		const float rayLength = 1000.0f;
+
+		uint32_t sphereHits = 0;
+		t0 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < queryCount; ++i) {
+			result.clear();
+			sphereHits += bvh.querySphere(lightCenters[i], lightRadius, result);
+		}
+		t1 = std::chrono::high_resolution_clock::now();
+		const double sphereMs = elapsedMs(t0, t1);
+
+		uint32_t rayHits = 0;
+		std::vector<float> rayDistances(queryCount, -1.0f);
+		t0 = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < queryCount; ++i) {
+			RHIRayHit hit;
+			if (bvh.raycast(rayOrigin, rayDirections[i], rayLength, hit)) {
+				rayDistances[i] = hit.distance;
+				++rayHits;
+			}
+		}
+		t1 = std::chrono::high_resolution_clock::now();
+		const double rayMs = elapsedMs(t0, t1);
+
+		std::printf("%8u instances: build %8.2f ms (cost %.1f -> %.1f, %u rebuilds) | refit %5u moved %6.3f ms\n",
+			count, buildMs, buildCost, bvh.computeCost(), rebuilds, movedPerFrame, refitMs / iterations);
+		std::printf("%8s frustum %7u visible: bvh %7.3f ms | linear %7.3f ms || %u spheres %7.3f ms (%u hits) | %u rays %7.3f ms (%u hits)\n",
+			"", visible, bvhFrustumMs / iterations, linearFrustumMs / iterations,
+			queryCount, sphereMs, sphereHits, queryCount, rayMs, rayHits);
+
+		if (!verify) {
+			return;
+		}
+
+		// 선형 탐색과 같은 결과인지 확인
+		result.clear();
+		bvh.queryFrustum(frustum, result);
+		const std::vector<uint8_t> frustumMask = toMask(result, count);
+		uint32_t frustumMismatch = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			frustumMismatch += frustumMask[i] != (frustum.intersects(bounds[i]) ? 1 : 0) ? 1 : 0;
+		}
+
+		uint32_t sphereMismatch = 0;
+		uint32_t rayMismatch = 0;
+		for (uint32_t q = 0; q < 50; ++q) {
+			result.clear();
+			bvh.querySphere(lightCenters[q], lightRadius, result);
+			const std::vector<uint8_t> sphereMask = toMask(result, count);
+
+			float nearest = -1.0f;
+			for (uint32_t i = 0; i < count; ++i) {
+				sphereMismatch += sphereMask[i] != (overlapsSphere(bounds[i], lightCenters[q], lightRadius) ? 1 : 0) ? 1 : 0;
+
+				float t = 0.0f;
+				if (rayDistance(bounds[i], rayOrigin, rayDirections[q], rayLength, t) && (nearest < 0.0f || t < nearest)) {
+					nearest = t;
+				}
+			}
+			if (std::fabs(nearest - rayDistances[q]) > 1e-3f) {
+				++rayMismatch;
+			}
+		}
+
+		if (frustumMismatch + sphereMismatch + rayMismatch > 0) {
+			std::printf("  FAILED: %u frustum / %u sphere / %u ray results differ from linear scan\n",
+				frustumMismatch, sphereMismatch, rayMismatch);
+			passed = false;
+		}
+	}
+}
+
+int main()
+{
+	std::printf("[SceneBVH] Binned SAH BVH over synthetic instances (per-frame averages)\n");
+
+	bool passed = true;
+	runBenchmark(10000, 50, true, passed);
+	runBenchmark(100000, 20, true, passed);
+	runBenchmark(1000000, 5, false, passed);
+
+	std::printf("  linear-scan equivalence: %s\n", passed ? "passed" : "FAILED");
+	return passed ? 0 : 1;
+}
@@ -15,6 +15,8 @@
 
 namespace BinRenderer
 {
+	class RHIUploadManager;
+
 	/**
 	 * @brief 메인 RHI 인터페이스
 	 */
@@ -43,6 +45,7 @@ namespace BinRenderer
 		virtual RHIImageHandle createImage(const RHIImageCreateInfo& createInfo) = 0;
 		virtual RHIShaderHandle createShader(const RHIShaderCreateInfo& createInfo) = 0;
 		virtual RHIPipelineHandle createPipeline(const RHIPipelineCreateInfo& createInfo) = 0;
+		virtual RHIPipelineHandle createComputePipeline(const RHIComputePipelineCreateInfo& createInfo) = 0;
 		virtual RHIPipelineLayoutHandle createPipelineLayout(const RHIPipelineLayoutCreateInfo& createInfo) = 0;
 		virtual RHIImageViewHandle createImageView(RHIImageHandle image, const RHIImageViewCreateInfo& createInfo) = 0;
 		virtual RHISamplerHandle createSampler(const RHISamplerCreateInfo& createInfo) = 0;
@@ -79,6 +82,89 @@ namespace BinRenderer
 		virtual void endCommandRecording() = 0;
 		virtual void submitCommands() = 0;
 
+		// 멀티 큐 (Async Compute / 전용 Transfer)
+		/**
+		 * @brief 해당 타입의 전용 큐 패밀리가 있는지 (없으면 Graphics 큐로 대체됨)
+		 */
+		virtual bool hasDedicatedQueue(RHIQueueType queue) const = 0;
+
+		/**
+		 * @brief 지정한 큐의 커맨드 버퍼에 기록 시작 (이후 cmd* 호출은 이 버퍼에 기록)
+		 * 
+		 * 한 프레임에 같은 큐로 여러 번 기록/제출할 수 있음
+		 */
+		virtual void beginCommandRecording(RHIQueueType queue) = 0;
+
+		/**
+		 * @brief 기록한 커맨드 버퍼를 지정한 큐에 제출
+		 * @return 이 제출이 완료되면 도달하는 큐의 Timeline 값 (다른 큐의 RHIQueueWait에 사용)
+		 */
+		virtual uint64_t submitCommands(const RHIQueueSubmitInfo& submitInfo) = 0;
+
+		/**
+		 * @brief GPU가 완료한 큐의 Timeline 값 (submitCommands() 반환값과 비교해 완료 여부 확인)
+		 */
+		virtual uint64_t getCompletedQueueValue(RHIQueueType queue) const = 0;
+
+		/**
+		 * @brief 큐의 Timeline 값이 value에 도달할 때까지 CPU에서 대기
+		 */
+		virtual void waitQueueValue(RHIQueueType queue, uint64_t value) = 0;
+
+		/**
+		 * @brief Device local 버퍼용 스테이징 업로드 관리자 (지원하지 않으면 nullptr)
+		 */
+		virtual RHIUploadManager* getUploadManager() = 0;
+
+		// 디바이스 기능
+		/**
+		 * @brief 한 번의 Indirect 호출로 여러 드로우 (multiDrawIndirect + drawIndirectFirstInstance)
+		 */
+		virtual bool isMultiDrawIndirectSupported() const = 0;
+
+		/**
+		 * @brief 드로우 개수를 GPU 버퍼에서 읽는 cmdDrawIndexedIndirectCount 지원 여부
+		 */
+		virtual bool isDrawIndirectCountSupported() const = 0;
+
+		// 병렬 커맨드 기록
+		/**
+		 * @brief 동시에 기록할 수 있는 최대 컨텍스트 수 (컨텍스트마다 전용 커맨드 풀 사용)
+		 */
+		virtual uint32_t getMaxRecordingContexts() const = 0;
+
+		/**
+		 * @brief 현재 기록 중인 커맨드 버퍼에 이어질 병렬 기록 컨텍스트 contextCount개 준비
+		 * 
+		 * beginCommandRecording() 이후, 렌더링(cmdBeginRendering) 밖에서 호출
+		 * 각 컨텍스트는 독립된 Secondary 커맨드 버퍼이므로 서로 다른 스레드에서 동시에 기록 가능
+		 * @return 준비에 실패하면 false (호출자는 주 커맨드 버퍼에 순차 기록해야 함)
+		 */
+		virtual bool beginParallelRecording(uint32_t contextCount) = 0;
+
+		/**
+		 * @brief 호출한 스레드의 cmd* 대상을 contextIndex번 컨텍스트로 전환
+		 * 
+		 * 한 컨텍스트는 한 번에 한 스레드에서만 기록해야 함
+		 */
+		virtual void beginRecordingContext(uint32_t contextIndex) = 0;
+
+		/**
+		 * @brief 호출한 스레드의 컨텍스트 기록 종료 (cmd* 대상이 주 커맨드 버퍼로 복귀)
+		 */
+		virtual void endRecordingContext() = 0;
+
+		/**
+		 * @brief 모든 컨텍스트 기록이 끝난 뒤 컨텍스트 인덱스 순서대로 주 커맨드 버퍼에서 실행
+		 */
+		virtual void endParallelRecording() = 0;
+
+		/**
+		 * @brief 같은 파이프라인/디스크립터 세트/버퍼를 다시 바인딩해 생략한 횟수 등 (마지막 resetBindStats 이후 끝난 기록 기준)
+		 */
+		virtual RHIBindStats getBindStats() const = 0;
+		virtual void resetBindStats() = 0;
+
 		// 드로우 커맨드
 		virtual void cmdBindPipeline(RHIPipelineHandle pipeline) = 0;
 		virtual void cmdBindVertexBuffer(RHIBufferHandle buffer, RHIDeviceSize offset = 0) = 0;
@@ -90,6 +176,18 @@ namespace BinRenderer
 		virtual void cmdDraw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) = 0;
 		virtual void cmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) = 0;
 
+		//  Indirect Draw (인자는 RHIDrawIndexedIndirectCommand 배열)
+		virtual void cmdDrawIndexedIndirect(RHIBufferHandle buffer, RHIDeviceSize offset, uint32_t drawCount, uint32_t stride) = 0;
+
+		/**
+		 * @brief 드로우 개수를 countBuffer의 uint32에서 읽음 (maxDrawCount로 상한, isDrawIndirectCountSupported() 필요)
+		 */
+		virtual void cmdDrawIndexedIndirectCount(RHIBufferHandle buffer, RHIDeviceSize offset,
+			RHIBufferHandle countBuffer, RHIDeviceSize countOffset, uint32_t maxDrawCount, uint32_t stride) = 0;
+
+		//  Compute
+		virtual void cmdDispatch(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1) = 0;
+
 		//  Descriptor Sets 바인딩 (Pipeline 사용)
 		virtual void cmdBindDescriptorSets(RHIPipelineHandle pipeline, uint32_t firstSet, const RHIDescriptorSetHandle* sets, uint32_t setCount) = 0;
 
@@ -97,6 +195,7 @@ namespace BinRenderer
 		virtual void cmdPushConstants(RHIPipelineHandle pipeline, RHIShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) = 0;
 
 		//  Dynamic Rendering
+		// colorAttachment가 비어 있으면 Depth-only (depth를 저장)
 		virtual void cmdBeginRendering(uint32_t width, uint32_t height, RHIImageViewHandle colorAttachment, RHIImageViewHandle depthAttachment = {}) = 0;
 		virtual void cmdEndRendering() = 0;
 
@@ -112,6 +211,23 @@ namespace BinRenderer
 			uint32_t layerCount = 1
 		) = 0;
 
+		//  Pipeline Barrier (배치)
+		/**
+		 * @brief 여러 이미지/버퍼 배리어를 한 번의 파이프라인 배리어로 기록
+		 */
+		virtual void cmdPipelineBarrier(const RHIBarrierBatch& batch) = 0;
+
+		//  Buffer to Buffer Copy
+		virtual void cmdCopyBuffer(
+			RHIBufferHandle srcBuffer,
+			RHIBufferHandle dstBuffer,
+			uint32_t regionCount,
+			const RHIBufferCopy* pRegions
+		) = 0;
+
+		//  Buffer Fill (size는 4의 배수, data는 uint32 패턴)
+		virtual void cmdFillBuffer(RHIBufferHandle buffer, RHIDeviceSize offset, RHIDeviceSize size, uint32_t data) = 0;
+
 		//  Buffer to Image Copy
 		virtual void cmdCopyBufferToImage(
 			RHIBufferHandle srcBuffer,
@@ -18,6 +18,17 @@ namespace BinRenderer
         OpenGL
     };
 
+    // 커맨드 큐 타입
+    enum class RHIQueueType : uint32_t
+    {
+        Graphics = 0,   // 그래픽스 + 컴퓨트 + 전송 (Present 포함)
+        Compute,        // Async Compute (전용 패밀리가 없으면 Graphics로 대체)
+        Transfer,       // 전용 전송 큐 (전용 패밀리가 없으면 Graphics로 대체)
+        Count
+    };
+
+    constexpr uint32_t RHI_QUEUE_TYPE_COUNT = static_cast<uint32_t>(RHIQueueType::Count);
+
     // 초기화 정보
     struct RHIInitInfo
     {
@@ -421,6 +421,7 @@ namespace BinRenderer
 		RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT = 0x00000020,
 		RHI_BUFFER_USAGE_TRANSFER_SRC_BIT = 0x00000040,
 		RHI_BUFFER_USAGE_TRANSFER_DST_BIT = 0x00000080,
+		RHI_BUFFER_USAGE_INDIRECT_BUFFER_BIT = 0x00000100,
 	};
 
 	enum RHIMemoryPropertyFlagBits : uint32_t
@@ -431,20 +432,32 @@ namespace BinRenderer
 		RHI_MEMORY_PROPERTY_HOST_CACHED_BIT = 0x00000008,
 	};
 
+	// 리소스 메모리 할당 방식 힌트 (기본: 메모리 타입별 큰 블록에서 서브 할당)
+	enum RHIAllocationFlagBits : uint32_t
+	{
+		RHI_ALLOCATION_DEDICATED_BIT = 0x00000001,        // 리소스 전용 VkDeviceMemory
+		RHI_ALLOCATION_FRAME_TRANSIENT_BIT = 0x00000002,  // 현재 프레임 선형 풀 (같은 프레임 슬롯이 다시 시작되면 재사용, 버퍼 전용)
+	};
+
 	enum RHIPipelineStageFlagBits : uint32_t
 	{
 		RHI_PIPELINE_STAGE_TOP_OF_PIPE_BIT = 0x00000001,
 		RHI_PIPELINE_STAGE_DRAW_INDIRECT_BIT = 0x00000002,
 		RHI_PIPELINE_STAGE_VERTEX_INPUT_BIT = 0x00000004,
 		RHI_PIPELINE_STAGE_VERTEX_SHADER_BIT = 0x00000008,
+		RHI_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT = 0x00000010,
+		RHI_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT = 0x00000020,
+		RHI_PIPELINE_STAGE_GEOMETRY_SHADER_BIT = 0x00000040,
 		RHI_PIPELINE_STAGE_FRAGMENT_SHADER_BIT = 0x00000080,
 		RHI_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT = 0x00000100,
 		RHI_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT = 0x00000200,
 		RHI_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT = 0x00000400,
-		RHI_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT = 0x00000800,
+		RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT = 0x00000800,
 		RHI_PIPELINE_STAGE_TRANSFER_BIT = 0x00001000,
-		RHI_PIPELINE_STAGE_ALL_GRAPHICS_BIT = 0x00004000,
-		RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT = 0x00008000,
+		RHI_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT = 0x00002000,
+		RHI_PIPELINE_STAGE_HOST_BIT = 0x00004000,
+		RHI_PIPELINE_STAGE_ALL_GRAPHICS_BIT = 0x00008000,
+		RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT = 0x00010000,
 	};
 
 	enum RHIAccessFlagBits : uint32_t
@@ -462,6 +475,10 @@ namespace BinRenderer
 		RHI_ACCESS_TRANSFER_WRITE_BIT = 0x00000400,
 		RHI_ACCESS_SHADER_READ_BIT = 0x00000800,
 		RHI_ACCESS_SHADER_WRITE_BIT = 0x00001000,
+		RHI_ACCESS_HOST_READ_BIT = 0x00002000,
+		RHI_ACCESS_HOST_WRITE_BIT = 0x00004000,
+		RHI_ACCESS_MEMORY_READ_BIT = 0x00008000,
+		RHI_ACCESS_MEMORY_WRITE_BIT = 0x00010000,
 	};
 
 	enum RHICullModeFlagBits : uint32_t
@@ -641,6 +658,7 @@ namespace BinRenderer
 	typedef uint32_t RHIPipelineStageFlags;
 	typedef uint32_t RHIBufferUsageFlags;
 	typedef uint32_t RHIMemoryPropertyFlags;
+	typedef uint32_t RHIAllocationFlags;
 	typedef uint32_t RHIImageUsageFlags;
 	typedef uint32_t RHIFenceCreateFlags;
 	typedef uint32_t RHICommandBufferUsageFlags;
@@ -0,0 +1,466 @@
+﻿#include "RHIUploadManager.h"
+#include "../../Core/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr RHIDeviceSize kStagingAlignment = 16;
+
+		// 한 번에 복사할 최대 크기 (큰 버퍼는 나눠서 링이 한 배치에 묶이지 않게 함)
+		constexpr RHIDeviceSize kMaxChunkDivisor = 4;
+	}
+
+	RHIUploadManager::RHIUploadManager(RHI* rhi)
+		: rhi_(rhi)
+	{
+	}
+
+	RHIUploadManager::~RHIUploadManager()
+	{
+		shutdown();
+	}
+
+	bool RHIUploadManager::initialize(RHIDeviceSize stagingSize)
+	{
+		stagingSize &= ~(kStagingAlignment - 1);
+
+		RHIBufferCreateInfo stagingInfo{};
+		stagingInfo.size = stagingSize;
+		stagingInfo.usage = RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		stagingInfo.allocationFlags = RHI_ALLOCATION_DEDICATED_BIT;
+
+		stagingBuffer_ = rhi_->createBuffer(stagingInfo);
+		if (!stagingBuffer_.isValid())
+		{
+			printLog("Failed to create staging buffer");
+			return false;
+		}
+
+		stagingData_ = static_cast<uint8_t*>(rhi_->mapBuffer(stagingBuffer_));
+		if (!stagingData_)
+		{
+			printLog("Failed to map staging buffer");
+			rhi_->destroyBuffer(stagingBuffer_);
+			stagingBuffer_ = {};
+			return false;
+		}
+
+		capacity_ = stagingSize;
+		head_ = 0;
+		tail_ = 0;
+
+		printLog(" Upload manager initialized (staging {} MB, {} queue)",
+			capacity_ / (1024 * 1024), rhi_->hasDedicatedQueue(RHIQueueType::Transfer) ? "transfer" : "graphics");
+		return true;
+	}
+
+	void RHIUploadManager::shutdown()
+	{
+		if (!stagingBuffer_.isValid())
+		{
+			return;
+		}
+
+		// 스테이징 버퍼를 읽는 복사가 끝난 뒤 해제
+		flushAndWait();
+		processDeferredDestroys(true);
+
+		rhi_->unmapBuffer(stagingBuffer_);
+		rhi_->destroyBuffer(stagingBuffer_);
+		stagingBuffer_ = {};
+		stagingData_ = nullptr;
+		capacity_ = 0;
+		inFlightBatches_.clear();
+	}
+
+	RHIUploadTicket RHIUploadManager::uploadBuffer(RHIBufferHandle dstBuffer, const void* data, RHIDeviceSize size, RHIDeviceSize dstOffset)
+	{
+		if (!stagingData_ || !dstBuffer.isValid() || !data)
+		{
+			return {};
+		}
+
+		const RHIDeviceSize maxChunk = std::max(capacity_ / kMaxChunkDivisor, kStagingAlignment);
+		const uint8_t* src = static_cast<const uint8_t*>(data);
+
+		while (size > 0)
+		{
+			const RHIDeviceSize chunk = std::min(size, maxChunk);
+
+			RHIDeviceSize stagingOffset = 0;
+			if (!allocateStaging(chunk, stagingOffset))
+			{
+				printLog("Failed to allocate {} bytes of staging memory", chunk);
+				return {};
+			}
+
+			memcpy(stagingData_ + stagingOffset, src, static_cast<size_t>(chunk));
+			rhi_->flushBuffer(stagingBuffer_, stagingOffset, chunk);
+
+			pendingBufferCopies_.push_back({ stagingBuffer_, dstBuffer, { stagingOffset, dstOffset, chunk } });
+			stats_.uploadedBytes += chunk;
+
+			src += chunk;
+			dstOffset += chunk;
+			size -= chunk;
+		}
+
+		// 링이 차서 중간에 제출됐더라도 배치는 순서대로 끝나므로 마지막 배치 티켓이 전체를 덮음
+		return { nextTicket_ };
+	}
+
+	RHIUploadTicket RHIUploadManager::uploadImage(RHIImageHandle dstImage, const void* data, RHIDeviceSize size,
+		const std::vector<RHIBufferImageCopy>& regions)
+	{
+		if (!stagingData_ || !dstImage.isValid() || !data || regions.empty())
+		{
+			return {};
+		}
+
+		RHIBufferHandle srcBuffer;
+		RHIDeviceSize srcOffset = 0;
+
+		if (size <= std::max(capacity_ / kMaxChunkDivisor, kStagingAlignment))
+		{
+			if (!allocateStaging(size, srcOffset))
+			{
+				printLog("Failed to allocate {} bytes of staging memory", size);
+				return {};
+			}
+
+			memcpy(stagingData_ + srcOffset, data, static_cast<size_t>(size));
+			rhi_->flushBuffer(stagingBuffer_, srcOffset, size);
+			srcBuffer = stagingBuffer_;
+		}
+		else
+		{
+			// 링보다 큰 이미지는 전용 스테이징 버퍼를 쓰고 이 배치가 끝나면 해제
+			RHIBufferCreateInfo stagingInfo{};
+			stagingInfo.size = size;
+			stagingInfo.usage = RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;
+			stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+			srcBuffer = rhi_->createBuffer(stagingInfo);
+			void* mapped = srcBuffer.isValid() ? rhi_->mapBuffer(srcBuffer) : nullptr;
+			if (!mapped)
+			{
+				printLog("Failed to create {} byte staging buffer for image upload", size);
+				if (srcBuffer.isValid())
+				{
+					rhi_->destroyBuffer(srcBuffer);
+				}
+				return {};
+			}
+
+			memcpy(mapped, data, static_cast<size_t>(size));
+			rhi_->flushBuffer(srcBuffer);
+			rhi_->unmapBuffer(srcBuffer);
+			deferDestroy(srcBuffer, { nextTicket_ });
+		}
+
+		PendingImageUpload upload{};
+		upload.srcBuffer = srcBuffer;
+		upload.dstImage = dstImage;
+		upload.firstRegion = static_cast<uint32_t>(pendingImageRegions_.size());
+		upload.regionCount = static_cast<uint32_t>(regions.size());
+		pendingImageUploads_.push_back(upload);
+
+		for (RHIBufferImageCopy region : regions)
+		{
+			region.bufferOffset += srcOffset;
+			pendingImageRegions_.push_back(region);
+		}
+
+		stats_.uploadedBytes += size;
+		return { nextTicket_ };
+	}
+
+	void RHIUploadManager::update()
+	{
+		flush();
+		retireCompletedBatches();
+		processDeferredDestroys(false);
+	}
+
+	RHIUploadTicket RHIUploadManager::flush()
+	{
+		if (!hasPendingUploads())
+		{
+			return { nextTicket_ - 1 };
+		}
+
+		const bool useTransferQueue = rhi_->hasDedicatedQueue(RHIQueueType::Transfer);
+		const RHIQueueType copyQueue = useTransferQueue ? RHIQueueType::Transfer : RHIQueueType::Graphics;
+
+		RHIBarrierBatch preCopyBarriers;
+		RHIBarrierBatch releaseBarriers;
+		RHIBarrierBatch acquireBarriers;
+
+		// 복사 결과를 이후 Graphics/Compute 작업에서 읽을 수 있게 함
+		// 전용 Transfer 큐: Release는 쓰기만 끝내고 넘겨주고, Acquire는 Timeline 대기로 쓰기를 보장받으므로 src 범위 없음
+		auto addReadBarrier = [&](auto barrier, auto& releaseList, auto& acquireList) {
+			barrier.srcQueue = copyQueue;
+			barrier.dstQueue = RHIQueueType::Graphics;
+			barrier.srcStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+			barrier.srcAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+			if (useTransferQueue)
+			{
+				releaseList.push_back(barrier);
+				barrier.srcStageMask = 0;
+				barrier.srcAccessMask = 0;
+			}
+			barrier.dstStageMask = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			barrier.dstAccessMask = RHI_ACCESS_MEMORY_READ_BIT;
+			(useTransferQueue ? acquireList : releaseList).push_back(barrier);
+		};
+
+		// 같은 (원본, 대상) 버퍼 쌍의 복사는 cmdCopyBuffer 한 번으로 묶음 (예약 순서는 쌍 안에서 유지)
+		std::stable_sort(pendingBufferCopies_.begin(), pendingBufferCopies_.end(),
+			[](const PendingBufferCopy& a, const PendingBufferCopy& b) {
+				return a.srcBuffer != b.srcBuffer ? a.srcBuffer < b.srcBuffer : a.dstBuffer < b.dstBuffer;
+			});
+
+		for (const auto& upload : pendingImageUploads_)
+		{
+			RHIImageBarrier barrier{};
+			barrier.image = upload.dstImage;
+			barrier.dstStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+			barrier.dstAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.oldLayout = RHI_IMAGE_LAYOUT_UNDEFINED;
+			barrier.newLayout = RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.srcQueue = copyQueue;
+			barrier.dstQueue = copyQueue;
+			preCopyBarriers.imageBarriers.push_back(barrier);
+		}
+
+		rhi_->beginCommandRecording(copyQueue);
+
+		if (!preCopyBarriers.empty())
+		{
+			rhi_->cmdPipelineBarrier(preCopyBarriers);
+		}
+
+		std::vector<RHIBufferCopy> regions;
+		for (size_t begin = 0; begin < pendingBufferCopies_.size();)
+		{
+			const PendingBufferCopy& first = pendingBufferCopies_[begin];
+
+			regions.clear();
+			size_t end = begin;
+			while (end < pendingBufferCopies_.size() &&
+				pendingBufferCopies_[end].srcBuffer == first.srcBuffer &&
+				pendingBufferCopies_[end].dstBuffer == first.dstBuffer)
+			{
+				regions.push_back(pendingBufferCopies_[end].region);
+				++end;
+			}
+
+			rhi_->cmdCopyBuffer(first.srcBuffer, first.dstBuffer, static_cast<uint32_t>(regions.size()), regions.data());
+			stats_.copyCount += static_cast<uint32_t>(regions.size());
+
+			// 대상 버퍼당 배리어 하나 (원본이 다른 묶음이 이어져도 중복 배리어는 무해)
+			RHIBufferBarrier barrier{};
+			barrier.buffer = first.dstBuffer;
+			addReadBarrier(barrier, releaseBarriers.bufferBarriers, acquireBarriers.bufferBarriers);
+
+			begin = end;
+		}
+
+		for (const auto& upload : pendingImageUploads_)
+		{
+			rhi_->cmdCopyBufferToImage(upload.srcBuffer, upload.dstImage, RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				upload.regionCount, pendingImageRegions_.data() + upload.firstRegion);
+			stats_.copyCount += upload.regionCount;
+
+			RHIImageBarrier barrier{};
+			barrier.image = upload.dstImage;
+			barrier.oldLayout = RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			addReadBarrier(barrier, releaseBarriers.imageBarriers, acquireBarriers.imageBarriers);
+		}
+
+		if (!releaseBarriers.empty())
+		{
+			rhi_->cmdPipelineBarrier(releaseBarriers);
+		}
+		rhi_->endCommandRecording();
+
+		RHIQueueSubmitInfo copySubmit{};
+		copySubmit.queue = copyQueue;
+		copySubmit.endOfFrame = false;
+		uint64_t graphicsValue = rhi_->submitCommands(copySubmit);
+
+		if (useTransferQueue)
+		{
+			rhi_->beginCommandRecording(RHIQueueType::Graphics);
+			rhi_->cmdPipelineBarrier(acquireBarriers);
+			rhi_->endCommandRecording();
+
+			RHIQueueSubmitInfo acquireSubmit{};
+			acquireSubmit.queue = RHIQueueType::Graphics;
+			acquireSubmit.waits.push_back({ RHIQueueType::Transfer, graphicsValue, RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT });
+			acquireSubmit.endOfFrame = false;
+			graphicsValue = rhi_->submitCommands(acquireSubmit);
+		}
+
+		// Graphics 큐 쪽 완료가 곧 복사 완료이므로 링 영역도 같은 값으로 회수
+		const RHIUploadTicket ticket{ nextTicket_++ };
+		inFlightBatches_.push_back({ ticket.value, head_, graphicsValue });
+
+		pendingBufferCopies_.clear();
+		pendingImageUploads_.clear();
+		pendingImageRegions_.clear();
+		stats_.submitCount++;
+
+		return ticket;
+	}
+
+	bool RHIUploadManager::isComplete(RHIUploadTicket ticket)
+	{
+		if (ticket.value > completedTicket_)
+		{
+			retireCompletedBatches();
+		}
+		return ticket.value <= completedTicket_;
+	}
+
+	void RHIUploadManager::wait(RHIUploadTicket ticket)
+	{
+		if (isComplete(ticket))
+		{
+			return;
+		}
+
+		if (ticket.value >= nextTicket_)
+		{
+			flush();
+		}
+
+		for (const auto& batch : inFlightBatches_)
+		{
+			if (batch.ticket >= ticket.value)
+			{
+				rhi_->waitQueueValue(RHIQueueType::Graphics, batch.value);
+				break;
+			}
+		}
+
+		retireCompletedBatches();
+	}
+
+	void RHIUploadManager::flushAndWait()
+	{
+		wait(flush());
+	}
+
+	void RHIUploadManager::deferDestroy(RHIBufferHandle buffer, RHIUploadTicket ticket)
+	{
+		if (buffer.isValid())
+		{
+			deferredDestroys_.push_back({ buffer, {}, ticket.value });
+		}
+	}
+
+	void RHIUploadManager::deferDestroy(RHIImageHandle image, RHIUploadTicket ticket)
+	{
+		if (image.isValid())
+		{
+			deferredDestroys_.push_back({ {}, image, ticket.value });
+		}
+	}
+
+	bool RHIUploadManager::allocateStaging(RHIDeviceSize size, RHIDeviceSize& outOffset)
+	{
+		if (size > capacity_)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			retireCompletedBatches();
+
+			// 링이 비었으면 처음부터 다시 사용 (큰 요청이 끝부분에서 잘리지 않게)
+			if (head_ == tail_)
+			{
+				head_ = tail_ = (head_ + capacity_ - 1) / capacity_ * capacity_;
+			}
+
+			const uint64_t ringBase = head_ - head_ % capacity_;
+			RHIDeviceSize offset = (head_ % capacity_ + kStagingAlignment - 1) & ~(kStagingAlignment - 1);
+			uint64_t start = ringBase + offset;
+
+			// 끝부분에 들어가지 않으면 남은 구간을 건너뛰고 링 처음에 배치
+			if (offset + size > capacity_)
+			{
+				start = ringBase + capacity_;
+				offset = 0;
+			}
+
+			if (start + size - tail_ <= capacity_)
+			{
+				head_ = start + size;
+				outOffset = offset;
+				return true;
+			}
+
+			// 공간 부족: 예약된 복사를 제출하고 가장 오래된 배치 완료 대기
+			if (hasPendingUploads())
+			{
+				flush();
+			}
+
+			if (inFlightBatches_.empty())
+			{
+				return false;
+			}
+
+			rhi_->waitQueueValue(RHIQueueType::Graphics, inFlightBatches_.front().value);
+			stats_.stallCount++;
+		}
+	}
+
+	void RHIUploadManager::retireCompletedBatches()
+	{
+		if (inFlightBatches_.empty())
+		{
+			return;
+		}
+
+		const uint64_t completedValue = rhi_->getCompletedQueueValue(RHIQueueType::Graphics);
+		while (!inFlightBatches_.empty() && inFlightBatches_.front().value <= completedValue)
+		{
+			tail_ = inFlightBatches_.front().ringEnd;
+			completedTicket_ = inFlightBatches_.front().ticket;
+			inFlightBatches_.pop_front();
+		}
+	}
+
+	void RHIUploadManager::processDeferredDestroys(bool force)
+	{
+		auto it = std::remove_if(deferredDestroys_.begin(), deferredDestroys_.end(), [&](const DeferredDestroy& entry) {
+			if (!force && entry.ticket > completedTicket_)
+			{
+				return false;
+			}
+
+			if (entry.buffer.isValid())
+			{
+				rhi_->destroyBuffer(entry.buffer);
+			}
+			if (entry.image.isValid())
+			{
+				rhi_->destroyImage(entry.image);
+			}
+			stats_.deferredDestroyCount++;
+			return true;
+		});
+		deferredDestroys_.erase(it, deferredDestroys_.end());
+	}
+
+} // namespace BinRenderer
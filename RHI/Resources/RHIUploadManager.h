@@ -0,0 +1,153 @@
+﻿#pragma once
+
+#include "../Core/RHI.h"
+#include <deque>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief 업로드 완료 추적용 티켓 (업로드 배치 번호, 0은 무효)
+	 */
+	struct RHIUploadTicket
+	{
+		uint64_t value = 0;
+
+		bool isValid() const { return value != 0; }
+	};
+
+	/**
+	 * @brief 스테이징 링 버퍼를 통한 비동기 업로드
+	 * 
+	 * - 데이터는 영구 매핑된 Host visible 링 버퍼에 복사해 두고, 프레임마다 update()에서 한 배치로 기록/제출
+	 * - 전용 Transfer 큐가 있으면 Transfer 큐에서 복사 후 Graphics 큐로 소유권 이전 (Release/Acquire)
+	 * - 업로드 호출은 배치 티켓을 반환하며 CPU 대기 없이 isComplete()로 확인 가능
+	 * - 업로드 대상은 deferDestroy()로 티켓이 끝난 뒤 해제
+	 * 
+	 * 업로드 배치는 Graphics 큐에서 프레임 제출보다 먼저 실행되므로 렌더링 전에 완료를 기다릴 필요 없음
+	 * flush()는 커맨드를 직접 기록/제출하므로 프레임 커맨드 기록 중(beginCommandRecording ~ submitCommands)에는 호출하지 말 것
+	 */
+	class RHIUploadManager
+	{
+	public:
+		static constexpr RHIDeviceSize kDefaultStagingSize = 32ull * 1024 * 1024;
+
+		explicit RHIUploadManager(RHI* rhi);
+		~RHIUploadManager();
+
+		bool initialize(RHIDeviceSize stagingSize = kDefaultStagingSize);
+		void shutdown();
+
+		/**
+		 * @brief 버퍼 업로드 예약
+		 * 
+		 * 데이터는 호출 중에 스테이징 링으로 복사되므로 반환 후 원본을 해제해도 됨
+		 * 링이 가득 차면 예약된 복사를 제출하고 가장 오래된 배치가 끝날 때까지 대기
+		 * @param dstBuffer TRANSFER_DST 용도로 생성된 버퍼
+		 * @return 실패 시 무효 티켓
+		 */
+		RHIUploadTicket uploadBuffer(RHIBufferHandle dstBuffer, const void* data, RHIDeviceSize size, RHIDeviceSize dstOffset = 0);
+
+		/**
+		 * @brief 이미지 업로드 예약 (전체 밉/레이어를 채운 뒤 SHADER_READ_ONLY 레이아웃으로 전환)
+		 * 
+		 * 링 한 번에 담기 어려운 큰 이미지는 임시 스테이징 버퍼를 만들고 티켓 완료 후 해제
+		 * @param dstImage TRANSFER_DST 용도로 생성된 이미지
+		 * @param regions bufferOffset은 data 기준
+		 */
+		RHIUploadTicket uploadImage(RHIImageHandle dstImage, const void* data, RHIDeviceSize size,
+			const std::vector<RHIBufferImageCopy>& regions);
+
+		/**
+		 * @brief 프레임 시작마다 호출: 예약된 업로드 제출, 완료된 배치 회수, 지연 해제 처리
+		 */
+		void update();
+
+		/**
+		 * @brief 예약된 업로드를 바로 기록/제출
+		 * @return 제출한 배치의 티켓 (제출할 것이 없으면 마지막으로 제출한 티켓)
+		 */
+		RHIUploadTicket flush();
+
+		bool isComplete(RHIUploadTicket ticket);
+		void wait(RHIUploadTicket ticket);
+		void flushAndWait();
+
+		/**
+		 * @brief 티켓이 끝난 뒤 리소스 해제 (업로드 중이거나 예약된 리소스를 바로 파괴하지 않도록)
+		 */
+		void deferDestroy(RHIBufferHandle buffer, RHIUploadTicket ticket);
+		void deferDestroy(RHIImageHandle image, RHIUploadTicket ticket);
+
+		bool hasPendingUploads() const { return !pendingBufferCopies_.empty() || !pendingImageUploads_.empty(); }
+
+		struct Stats
+		{
+			uint64_t uploadedBytes = 0;
+			uint32_t copyCount = 0;      // 복사 영역 수 (버퍼 + 이미지)
+			uint32_t submitCount = 0;    // 제출한 배치 수
+			uint32_t stallCount = 0;     // 링 공간이 없어 GPU 완료를 기다린 횟수
+			uint32_t deferredDestroyCount = 0;
+		};
+
+		const Stats& getStats() const { return stats_; }
+		void resetStats() { stats_ = {}; }
+
+	private:
+		struct PendingBufferCopy
+		{
+			RHIBufferHandle srcBuffer;
+			RHIBufferHandle dstBuffer;
+			RHIBufferCopy region;
+		};
+
+		struct PendingImageUpload
+		{
+			RHIBufferHandle srcBuffer;
+			RHIImageHandle dstImage;
+			uint32_t firstRegion = 0;  // pendingImageRegions_ 안의 범위
+			uint32_t regionCount = 0;
+		};
+
+		// 제출된 배치: Graphics 큐 Timeline이 value에 도달하면 티켓 완료, 링 위치 ringEnd까지 재사용 가능
+		struct InFlightBatch
+		{
+			uint64_t ticket = 0;
+			uint64_t ringEnd = 0;
+			uint64_t value = 0;
+		};
+
+		struct DeferredDestroy
+		{
+			RHIBufferHandle buffer;
+			RHIImageHandle image;
+			uint64_t ticket = 0;
+		};
+
+		bool allocateStaging(RHIDeviceSize size, RHIDeviceSize& outOffset);
+		void retireCompletedBatches();
+		void processDeferredDestroys(bool force);
+
+		RHI* rhi_ = nullptr;
+
+		RHIBufferHandle stagingBuffer_;
+		uint8_t* stagingData_ = nullptr;
+		RHIDeviceSize capacity_ = 0;
+
+		// 링 위치는 단조 증가 (실제 오프셋은 capacity_로 나눈 나머지)
+		uint64_t head_ = 0;  // 다음 쓰기 위치
+		uint64_t tail_ = 0;  // GPU가 아직 읽고 있을 수 있는 가장 오래된 위치
+
+		std::vector<PendingBufferCopy> pendingBufferCopies_;
+		std::vector<PendingImageUpload> pendingImageUploads_;
+		std::vector<RHIBufferImageCopy> pendingImageRegions_;
+		std::deque<InFlightBatch> inFlightBatches_;
+		std::vector<DeferredDestroy> deferredDestroys_;
+
+		uint64_t nextTicket_ = 1;       // 지금 모으고 있는 배치의 티켓
+		uint64_t completedTicket_ = 0;  // GPU가 끝낸 마지막 배치
+
+		Stats stats_;
+	};
+
+} // namespace BinRenderer
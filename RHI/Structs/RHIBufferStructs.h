@@ -13,6 +13,7 @@ namespace BinRenderer
 		RHIDeviceSize size = 0;
 		RHIBufferUsageFlags usage = 0;
 		RHIMemoryPropertyFlags memoryProperties = 0;
+		RHIAllocationFlags allocationFlags = 0;
 		const void* initialData = nullptr;
 	};
 
@@ -39,4 +40,16 @@ namespace BinRenderer
 		RHIExtent3D imageExtent;
 	};
 
+	/**
+	 * @brief Indexed Indirect Draw 인자 (VkDrawIndexedIndirectCommand와 같은 배치, 20 bytes)
+	 */
+	struct RHIDrawIndexedIndirectCommand
+	{
+		uint32_t indexCount = 0;
+		uint32_t instanceCount = 0;
+		uint32_t firstIndex = 0;
+		int32_t vertexOffset = 0;
+		uint32_t firstInstance = 0;
+	};
+
 } // namespace BinRenderer
@@ -35,4 +35,37 @@ namespace BinRenderer
         const RHICommandBufferInheritanceInfo* pInheritanceInfo;
     };
 
+	/**
+	 * @brief 커맨드 버퍼 바인딩 상태 캐시 통계 (*Skipped = 이미 같은 상태라 생략한 수)
+	 */
+	struct RHIBindStats
+    {
+        uint32_t pipelineBinds = 0;
+        uint32_t pipelineBindsSkipped = 0;
+        uint32_t descriptorSetBinds = 0;         // 세트 단위
+        uint32_t descriptorSetBindsSkipped = 0;
+        uint32_t vertexBufferBinds = 0;
+        uint32_t vertexBufferBindsSkipped = 0;
+        uint32_t indexBufferBinds = 0;
+        uint32_t indexBufferBindsSkipped = 0;
+
+        uint32_t getSkippedCount() const
+        {
+            return pipelineBindsSkipped + descriptorSetBindsSkipped + vertexBufferBindsSkipped + indexBufferBindsSkipped;
+        }
+
+        RHIBindStats& operator+=(const RHIBindStats& other)
+        {
+            pipelineBinds += other.pipelineBinds;
+            pipelineBindsSkipped += other.pipelineBindsSkipped;
+            descriptorSetBinds += other.descriptorSetBinds;
+            descriptorSetBindsSkipped += other.descriptorSetBindsSkipped;
+            vertexBufferBinds += other.vertexBufferBinds;
+            vertexBufferBindsSkipped += other.vertexBufferBindsSkipped;
+            indexBufferBinds += other.indexBufferBinds;
+            indexBufferBindsSkipped += other.indexBufferBindsSkipped;
+            return *this;
+        }
+    };
+
 } // namespace BinRenderer
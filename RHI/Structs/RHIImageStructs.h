@@ -20,6 +20,7 @@ namespace BinRenderer
 		RHISampleCountFlagBits samples = RHI_SAMPLE_COUNT_1_BIT;
 		RHIImageTiling tiling = RHI_IMAGE_TILING_OPTIMAL;
 		uint32_t flags = 0;  // RHI_IMAGE_CREATE_CUBE_COMPATIBLE_BIT 등
+		RHIAllocationFlags allocationFlags = 0;  // RHI_ALLOCATION_DEDICATED_BIT (큰 렌더 타겟은 자동 전용 할당)
 	};
 
 	struct RHIImageSubresourceRange
@@ -48,7 +49,7 @@ namespace BinRenderer
 		RHIFormat format = RHI_FORMAT_UNDEFINED;
 		RHIImageAspectFlagBits aspectMask = RHI_IMAGE_ASPECT_COLOR_BIT;
 		uint32_t baseMipLevel = 0;
-		uint32_t levelCount = 1;
+		uint32_t levelCount = UINT32_MAX;  // UINT32_MAX == baseMipLevel부터 모든 밉
 		uint32_t baseArrayLayer = 0;
 		uint32_t layerCount = 1;
 		RHIComponentMapping components = { RHI_COMPONENT_SWIZZLE_IDENTITY, RHI_COMPONENT_SWIZZLE_IDENTITY, RHI_COMPONENT_SWIZZLE_IDENTITY, RHI_COMPONENT_SWIZZLE_IDENTITY };
@@ -250,14 +250,15 @@ namespace BinRenderer
         const void* pData;
     };
 
+	/**
+	 * @brief 컴퓨트 파이프라인 생성 정보 (파이프라인 레이아웃은 파이프라인이 소유)
+	 */
 	struct RHIComputePipelineCreateInfo
-    {
-        RHIPipelineCreateFlags flags;
-        RHIPipelineShaderStageCreateInfo* stage;
-        RHIPipelineLayout* layout;
-        RHIPipelineHandle basePipelineHandle;
-        int32_t basePipelineIndex;
-    };
+	{
+		RHIShaderHandle computeShader;
+		std::vector<RHIDescriptorSetLayoutHandle> descriptorSetLayouts;
+		std::vector<RHIPushConstantRange> pushConstantRanges;
+	};
 
 	/**
 	 * @brief GPU Instancing용 Vertex Input 헬퍼
@@ -1,9 +1,11 @@
 ﻿#pragma once
 
 #include "../Core/RHIType.h"
+#include "../Core/RHIDefinitions.h"
 #include "../Core/RHIHandle.h"
 #include "RHICommonStructs.h"
 #include "RHIImageStructs.h"
+#include <vector>
 
 namespace BinRenderer
 {
@@ -57,4 +59,84 @@ namespace BinRenderer
         RHIImageSubresourceRange subresourceRange;
     };
 
+	/**
+	 * @brief 핸들 기반 이미지 배리어 (Synchronization2)
+	 * 
+	 * levelCount/layerCount가 UINT32_MAX이면 나머지 전체 (VK_REMAINING_*)
+	 */
+	struct RHIImageBarrier
+	{
+		RHIImageHandle image;
+		RHIPipelineStageFlags srcStageMask = 0;
+		RHIPipelineStageFlags dstStageMask = 0;
+		RHIAccessFlags srcAccessMask = 0;
+		RHIAccessFlags dstAccessMask = 0;
+		RHIImageLayout oldLayout = RHI_IMAGE_LAYOUT_UNDEFINED;
+		RHIImageLayout newLayout = RHI_IMAGE_LAYOUT_UNDEFINED;
+		uint32_t baseMipLevel = 0;
+		uint32_t levelCount = UINT32_MAX;
+		uint32_t baseArrayLayer = 0;
+		uint32_t layerCount = UINT32_MAX;
+		RHIQueueType srcQueue = RHIQueueType::Graphics; // src != dst 이면 큐 소유권 이전 (Release/Acquire 쌍)
+		RHIQueueType dstQueue = RHIQueueType::Graphics;
+	};
+
+	/**
+	 * @brief 핸들 기반 버퍼 배리어 (Synchronization2)
+	 * 
+	 * size가 최대값이면 버퍼 전체 (VK_WHOLE_SIZE)
+	 */
+	struct RHIBufferBarrier
+	{
+		RHIBufferHandle buffer;
+		RHIPipelineStageFlags srcStageMask = 0;
+		RHIPipelineStageFlags dstStageMask = 0;
+		RHIAccessFlags srcAccessMask = 0;
+		RHIAccessFlags dstAccessMask = 0;
+		RHIDeviceSize offset = 0;
+		RHIDeviceSize size = ~RHIDeviceSize(0);
+		RHIQueueType srcQueue = RHIQueueType::Graphics; // src != dst 이면 큐 소유권 이전 (Release/Acquire 쌍)
+		RHIQueueType dstQueue = RHIQueueType::Graphics;
+	};
+
+	/**
+	 * @brief 한 번의 파이프라인 배리어 호출로 기록되는 배리어 묶음
+	 */
+	struct RHIBarrierBatch
+	{
+		std::vector<RHIImageBarrier> imageBarriers;
+		std::vector<RHIBufferBarrier> bufferBarriers;
+
+		bool empty() const { return imageBarriers.empty() && bufferBarriers.empty(); }
+		size_t size() const { return imageBarriers.size() + bufferBarriers.size(); }
+		void clear()
+		{
+			imageBarriers.clear();
+			bufferBarriers.clear();
+		}
+	};
+
+	/**
+	 * @brief 다른 큐의 제출 완료 대기 (큐별 Timeline 값 기준)
+	 */
+	struct RHIQueueWait
+	{
+		RHIQueueType queue = RHIQueueType::Graphics;
+		uint64_t value = 0;                        // submitCommands()가 반환한 값
+		RHIPipelineStageFlags stageMask = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	};
+
+	/**
+	 * @brief 큐 단위 커맨드 제출 정보
+	 * 
+	 * endOfFrame 제출은 프레임 Fence와 Present 세마포어를 signal 하며
+	 * 다른 큐에 남은 제출도 모두 기다림 (Graphics 큐만 가능)
+	 */
+	struct RHIQueueSubmitInfo
+	{
+		RHIQueueType queue = RHIQueueType::Graphics;
+		std::vector<RHIQueueWait> waits;
+		bool endOfFrame = true;
+	};
+
 } // namespace BinRenderer
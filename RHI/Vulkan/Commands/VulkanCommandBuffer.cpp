@@ -4,6 +4,7 @@
 #include "../Pipeline/VulkanPipeline.h"
 #include "../Pipeline/VulkanDescriptor.h"
 #include "Core/Logger.h"
+#include <algorithm>
 
 namespace BinRenderer::Vulkan
 {
@@ -30,6 +31,29 @@ namespace BinRenderer::Vulkan
 		}
 
 		isRecording_ = true;
+		invalidateBindState();
+		bindStats_ = {};
+	}
+
+	void VulkanCommandBuffer::beginSecondary()
+	{
+		// Render Pass/Dynamic Rendering을 상속하지 않으므로 빈 상속 정보로 충분
+		VkCommandBufferInheritanceInfo inheritanceInfo{};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+		if (vkBeginCommandBuffer(commandBuffer_, &beginInfo) != VK_SUCCESS)
+		{
+			exitWithMessage("Failed to begin recording secondary command buffer!");
+		}
+
+		isRecording_ = true;
+		invalidateBindState();
+		bindStats_ = {};
 	}
 
 	void VulkanCommandBuffer::end()
@@ -51,13 +75,47 @@ namespace BinRenderer::Vulkan
 	{
 		vkResetCommandBuffer(commandBuffer_, 0);
 		isRecording_ = false;
+		invalidateBindState();
+	}
+
+	void VulkanCommandBuffer::invalidateBindState()
+	{
+		for (auto& bindPoint : bindPoints_)
+		{
+			bindPoint = BindPointState{};
+		}
+		for (auto& binding : vertexBindings_)
+		{
+			binding = BufferBinding{};
+		}
+		indexBinding_ = BufferBinding{};
+	}
+
+	RHIBindStats VulkanCommandBuffer::takeBindStats()
+	{
+		RHIBindStats stats = bindStats_;
+		bindStats_ = {};
+		return stats;
 	}
 
 	void VulkanCommandBuffer::bindPipeline(RHIPipeline* pipeline)
 	{
 		auto* vulkanPipeline = static_cast<VulkanPipeline*>(pipeline);
 		VkPipelineBindPoint bindPoint = static_cast<VkPipelineBindPoint>(vulkanPipeline->getBindPoint());
-		vkCmdBindPipeline(commandBuffer_, bindPoint, vulkanPipeline->getVkPipeline());
+		VkPipeline vkPipeline = vulkanPipeline->getVkPipeline();
+
+		if (bindPoint < kCachedBindPoints)
+		{
+			if (bindPoints_[bindPoint].pipeline == vkPipeline)
+			{
+				bindStats_.pipelineBindsSkipped++;
+				return;
+			}
+			bindPoints_[bindPoint].pipeline = vkPipeline;
+		}
+
+		vkCmdBindPipeline(commandBuffer_, bindPoint, vkPipeline);
+		bindStats_.pipelineBinds++;
 	}
 
 	void VulkanCommandBuffer::bindVertexBuffer(uint32_t binding, RHIBuffer* buffer, RHIDeviceSize offset)
@@ -65,13 +123,82 @@ namespace BinRenderer::Vulkan
 		auto* vulkanBuffer = static_cast<VulkanBuffer*>(buffer);
 		VkBuffer vkBuffer = vulkanBuffer->getVkBuffer();
 		VkDeviceSize vkOffset = offset;
+
+		if (binding < kCachedVertexBindings)
+		{
+			BufferBinding& cached = vertexBindings_[binding];
+			if (cached.buffer == vkBuffer && cached.offset == vkOffset)
+			{
+				bindStats_.vertexBufferBindsSkipped++;
+				return;
+			}
+			cached = { vkBuffer, vkOffset };
+		}
+
 		vkCmdBindVertexBuffers(commandBuffer_, binding, 1, &vkBuffer, &vkOffset);
+		bindStats_.vertexBufferBinds++;
 	}
 
 	void VulkanCommandBuffer::bindIndexBuffer(RHIBuffer* buffer, RHIDeviceSize offset)
 	{
 		auto* vulkanBuffer = static_cast<VulkanBuffer*>(buffer);
-		vkCmdBindIndexBuffer(commandBuffer_, vulkanBuffer->getVkBuffer(), offset, VK_INDEX_TYPE_UINT32);
+		VkBuffer vkBuffer = vulkanBuffer->getVkBuffer();
+		if (indexBinding_.buffer == vkBuffer && indexBinding_.offset == offset)
+		{
+			bindStats_.indexBufferBindsSkipped++;
+			return;
+		}
+		indexBinding_ = { vkBuffer, offset };
+
+		vkCmdBindIndexBuffer(commandBuffer_, vkBuffer, offset, VK_INDEX_TYPE_UINT32);
+		bindStats_.indexBufferBinds++;
+	}
+
+	void VulkanCommandBuffer::bindDescriptorSets(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet,
+		uint32_t setCount, const VkDescriptorSet* sets)
+	{
+		if (setCount == 0)
+		{
+			return;
+		}
+
+		uint32_t first = 0;
+		uint32_t last = setCount;  // [first, last) 구간만 실제로 바인딩
+		if (bindPoint < kCachedBindPoints && firstSet + setCount <= kCachedDescriptorSets)
+		{
+			BindPointState& state = bindPoints_[bindPoint];
+			if (state.layout != layout)
+			{
+				// 레이아웃 호환성은 알 수 없으므로 다른 레이아웃이면 이전 세트를 모두 무효로 봄
+				std::fill(std::begin(state.sets), std::end(state.sets), VK_NULL_HANDLE);
+				state.layout = layout;
+			}
+
+			// 앞뒤로 이미 같은 세트가 바인딩된 부분은 잘라냄 (같은 레이아웃이므로 나머지 세트는 유지됨)
+			while (first < last && sets[first] != VK_NULL_HANDLE && state.sets[firstSet + first] == sets[first])
+			{
+				++first;
+			}
+			while (last > first && sets[last - 1] != VK_NULL_HANDLE && state.sets[firstSet + last - 1] == sets[last - 1])
+			{
+				--last;
+			}
+
+			std::copy(sets + first, sets + last, state.sets + firstSet + first);
+			bindStats_.descriptorSetBindsSkipped += setCount - (last - first);
+			if (first == last)
+			{
+				return;
+			}
+		}
+		else if (bindPoint < kCachedBindPoints)
+		{
+			// 캐시 범위를 넘는 바인딩은 그대로 기록하고 캐시는 버림
+			bindPoints_[bindPoint].layout = VK_NULL_HANDLE;
+		}
+
+		vkCmdBindDescriptorSets(commandBuffer_, bindPoint, layout, firstSet + first, last - first, sets + first, 0, nullptr);
+		bindStats_.descriptorSetBinds += last - first;
 	}
 
 	void VulkanCommandBuffer::bindDescriptorSets(RHIPipelineLayout* layout, uint32_t firstSet, uint32_t setCount, RHIDescriptorSet** sets)
@@ -2,6 +2,7 @@
 
 #include <vulkan/vulkan.h>
 #include "../../Commands/RHICommandBuffer.h"
+#include "../../Structs/RHICommandStructs.h"
 
 namespace BinRenderer::Vulkan
 {
@@ -9,6 +10,9 @@ namespace BinRenderer::Vulkan
 
 	/**
 	 * @brief Vulkan 커맨드 버퍼 구현
+	 *
+	 * 파이프라인/디스크립터 세트/정점·인덱스 버퍼의 마지막 바인딩을 기억해서
+	 * 같은 상태를 다시 바인딩하는 vkCmdBind*는 기록하지 않음 (begin/reset 또는 invalidateBindState로 초기화)
 	 */
 	class VulkanCommandBuffer : public RHICommandBuffer
 	{
@@ -30,14 +34,58 @@ namespace BinRenderer::Vulkan
 		void drawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override;
 		void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
 
+		/**
+		 * @brief Secondary 커맨드 버퍼 기록 시작 (렌더링 상속 없이 독립적으로 실행되는 커맨드 묶음)
+		 */
+		void beginSecondary();
+
+		/**
+		 * @brief 디스크립터 세트 바인딩 (레이아웃이 같고 이미 바인딩된 세트는 생략)
+		 */
+		void bindDescriptorSets(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet,
+			uint32_t setCount, const VkDescriptorSet* sets);
+
+		/**
+		 * @brief 캐시한 바인딩 상태를 버림 (vkCmdExecuteCommands 등으로 바인딩이 정의되지 않은 상태가 된 뒤)
+		 */
+		void invalidateBindState();
+
+		/**
+		 * @brief 지금까지의 바인딩 통계를 반환하고 0으로 초기화
+		 */
+		RHIBindStats takeBindStats();
+
 		// Vulkan 네이티브 접근
 		VkCommandBuffer getVkCommandBuffer() const { return commandBuffer_; }
 
 	private:
+		static constexpr uint32_t kCachedBindPoints = 2;       // Graphics, Compute
+		static constexpr uint32_t kCachedDescriptorSets = 8;
+		static constexpr uint32_t kCachedVertexBindings = 4;
+
+		// 바인드 포인트별 상태 (세트는 layout으로 바인딩된 것만 유효)
+		struct BindPointState
+		{
+			VkPipeline pipeline = VK_NULL_HANDLE;
+			VkPipelineLayout layout = VK_NULL_HANDLE;
+			VkDescriptorSet sets[kCachedDescriptorSets] = {};
+		};
+
+		struct BufferBinding
+		{
+			VkBuffer buffer = VK_NULL_HANDLE;
+			VkDeviceSize offset = 0;
+		};
+
 		VkDevice device_;
 		VkCommandBuffer commandBuffer_;
 		VulkanCommandPool* pool_;
 		bool isRecording_ = false;
+
+		BindPointState bindPoints_[kCachedBindPoints];
+		BufferBinding vertexBindings_[kCachedVertexBindings];
+		BufferBinding indexBinding_;
+		RHIBindStats bindStats_;
 	};
 
 } // namespace BinRenderer::Vulkan
@@ -151,7 +151,8 @@ namespace BinRenderer::Vulkan
 		std::set<uint32_t> uniqueQueueFamilies = {
 			indices.graphicsFamily,
 			indices.presentFamily,
-			indices.computeFamily
+			indices.computeFamily,
+			indices.transferFamily
 		};
 
 		std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
@@ -175,6 +176,19 @@ namespace BinRenderer::Vulkan
 		vulkan12Features.runtimeDescriptorArray = VK_TRUE;
 		vulkan12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;
 		vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+		vulkan12Features.timelineSemaphore = VK_TRUE;  // 큐 간 동기화 (Async Compute)
+
+		//  GPU-driven 렌더링: 지원하는 경우에만 켬 (없으면 CPU 드로우 경로 사용)
+		VkPhysicalDeviceVulkan12Features supported12{};
+		supported12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+		VkPhysicalDeviceFeatures2 supportedFeatures{};
+		supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		supportedFeatures.pNext = &supported12;
+		vkGetPhysicalDeviceFeatures2(physicalDevice_, &supportedFeatures);
+
+		multiDrawIndirectEnabled_ = deviceFeatures_.multiDrawIndirect && deviceFeatures_.drawIndirectFirstInstance;
+		drawIndirectCountEnabled_ = multiDrawIndirectEnabled_ && supported12.drawIndirectCount;
+		vulkan12Features.drawIndirectCount = drawIndirectCountEnabled_ ? VK_TRUE : VK_FALSE;
 
 		//  Vulkan 1.3 Features: Dynamic Rendering & Synchronization2
 		VkPhysicalDeviceSynchronization2Features sync2Features{};
@@ -190,6 +204,8 @@ namespace BinRenderer::Vulkan
 		VkPhysicalDeviceFeatures2 deviceFeatures2{};
 		deviceFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
 		deviceFeatures2.features.samplerAnisotropy = VK_TRUE;
+		deviceFeatures2.features.multiDrawIndirect = multiDrawIndirectEnabled_ ? VK_TRUE : VK_FALSE;
+		deviceFeatures2.features.drawIndirectFirstInstance = multiDrawIndirectEnabled_ ? VK_TRUE : VK_FALSE;
 		deviceFeatures2.pNext = &dynamicRenderingFeatures;
 
 
@@ -221,16 +237,24 @@ namespace BinRenderer::Vulkan
 		vkGetDeviceQueue(device_, indices.graphicsFamily, 0, &graphicsQueue_);
 		vkGetDeviceQueue(device_, indices.presentFamily, 0, &presentQueue_);
 		vkGetDeviceQueue(device_, indices.computeFamily, 0, &computeQueue_);
+		vkGetDeviceQueue(device_, indices.transferFamily, 0, &transferQueue_);
 
 		graphicsQueueFamily_ = indices.graphicsFamily;
 		presentQueueFamily_ = indices.presentFamily;
 		computeQueueFamily_ = indices.computeFamily;
+		transferQueueFamily_ = indices.transferFamily;
+
+		printLog(" Queue families: graphics {}, compute {}{}, transfer {}{}",
+			graphicsQueueFamily_,
+			computeQueueFamily_, hasDedicatedComputeQueue() ? " (async)" : " (shared)",
+			transferQueueFamily_, hasDedicatedTransferQueue() ? " (dedicated)" : " (shared)");
 
 		printLog(" Vulkan features enabled:");
 		printLog("   - Dynamic Rendering (1.3)");
 		printLog("   - Synchronization2 (1.3)");
 		printLog("   - Descriptor Indexing (1.2)");
 		printLog("   - Bindless Descriptor Arrays (1.2)");
+		printLog("   - Timeline Semaphore (1.2)");
 
 		return true;
 	}
@@ -250,26 +274,47 @@ namespace BinRenderer::Vulkan
 		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
 		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
 
-		uint32_t i = 0;
-		for (const auto& queueFamily : queueFamilies)
+		// 그래픽스 패밀리 (일반적으로 그래픽스 큐가 프레젠트도 지원)
+		for (uint32_t i = 0; i < queueFamilyCount; i++)
 		{
-			if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
+			if (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)
 			{
 				indices.graphicsFamily = i;
-				indices.presentFamily = i; // 일반적으로 그래픽스 큐가 프레젠트도 지원
+				indices.presentFamily = i;
+				break;
 			}
+		}
 
-			if (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT)
+		// Async Compute: 그래픽스를 지원하지 않는 컴퓨트 전용 패밀리 우선
+		for (uint32_t i = 0; i < queueFamilyCount; i++)
+		{
+			const VkQueueFlags flags = queueFamilies[i].queueFlags;
+			if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT))
 			{
 				indices.computeFamily = i;
+				break;
 			}
+		}
 
-			if (indices.isComplete())
+		// 전용 전송(DMA) 패밀리: 그래픽스/컴퓨트를 지원하지 않는 패밀리
+		for (uint32_t i = 0; i < queueFamilyCount; i++)
+		{
+			const VkQueueFlags flags = queueFamilies[i].queueFlags;
+			if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
 			{
+				indices.transferFamily = i;
 				break;
 			}
+		}
 
-			i++;
+		// 전용 패밀리가 없으면 그래픽스 패밀리 공유
+		if (indices.computeFamily == UINT32_MAX)
+		{
+			indices.computeFamily = indices.graphicsFamily;
+		}
+		if (indices.transferFamily == UINT32_MAX)
+		{
+			indices.transferFamily = indices.graphicsFamily;
 		}
 
 		return indices;
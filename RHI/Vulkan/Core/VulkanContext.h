@@ -27,10 +27,16 @@ namespace BinRenderer::Vulkan
 		VkQueue getGraphicsQueue() const { return graphicsQueue_; }
 		VkQueue getPresentQueue() const { return presentQueue_; }
 		VkQueue getComputeQueue() const { return computeQueue_; }
+		VkQueue getTransferQueue() const { return transferQueue_; }
 
 		uint32_t getGraphicsQueueFamily() const { return graphicsQueueFamily_; }
 		uint32_t getPresentQueueFamily() const { return presentQueueFamily_; }
 		uint32_t getComputeQueueFamily() const { return computeQueueFamily_; }
+		uint32_t getTransferQueueFamily() const { return transferQueueFamily_; }
+
+		// 그래픽스와 다른 전용 패밀리를 찾았는지 (Async Compute / 전용 DMA 큐)
+		bool hasDedicatedComputeQueue() const { return computeQueueFamily_ != graphicsQueueFamily_; }
+		bool hasDedicatedTransferQueue() const { return transferQueueFamily_ != graphicsQueueFamily_; }
 
 		// 유틸리티
 		void waitIdle();
@@ -78,6 +84,12 @@ namespace BinRenderer::Vulkan
 		const VkPhysicalDeviceMemoryProperties& getMemoryProperties() const { return memoryProperties_; }
 		const VkPhysicalDeviceFeatures& getDeviceFeatures() const { return deviceFeatures_; }
 
+		/**
+		 * @brief GPU-driven 렌더링용 기능 (지원할 때만 디바이스 생성 시 활성화됨)
+		 */
+		bool isMultiDrawIndirectEnabled() const { return multiDrawIndirectEnabled_; }
+		bool isDrawIndirectCountEnabled() const { return drawIndirectCountEnabled_; }
+
 	private:
 		VkInstance instance_ = VK_NULL_HANDLE;
 		VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
@@ -87,10 +99,12 @@ namespace BinRenderer::Vulkan
 		VkQueue graphicsQueue_ = VK_NULL_HANDLE;
 		VkQueue presentQueue_ = VK_NULL_HANDLE;
 		VkQueue computeQueue_ = VK_NULL_HANDLE;
+		VkQueue transferQueue_ = VK_NULL_HANDLE;
 
 		uint32_t graphicsQueueFamily_ = 0;
 		uint32_t presentQueueFamily_ = 0;
 		uint32_t computeQueueFamily_ = 0;
+		uint32_t transferQueueFamily_ = 0;
 
 		bool validationEnabled_ = false;
 		bool requireSwapchain_ = true;  //  추가: 스왑체인 필요 여부
@@ -99,6 +113,8 @@ namespace BinRenderer::Vulkan
 		VkPhysicalDeviceProperties deviceProperties_{};
 		VkPhysicalDeviceMemoryProperties memoryProperties_{};
 		VkPhysicalDeviceFeatures deviceFeatures_{};
+		bool multiDrawIndirectEnabled_ = false;
+		bool drawIndirectCountEnabled_ = false;
 
 		// 초기화 헬퍼
 		bool createInstance(const std::vector<const char*>& extensions);
@@ -111,12 +127,14 @@ namespace BinRenderer::Vulkan
 		{
 			uint32_t graphicsFamily = UINT32_MAX;
 			uint32_t presentFamily = UINT32_MAX;
-			uint32_t computeFamily = UINT32_MAX;
+			uint32_t computeFamily = UINT32_MAX;   // 전용 패밀리가 없으면 graphicsFamily
+			uint32_t transferFamily = UINT32_MAX;  // 전용 패밀리가 없으면 graphicsFamily
 
 			bool isComplete() const {
 				return graphicsFamily != UINT32_MAX &&
 					presentFamily != UINT32_MAX &&
-					computeFamily != UINT32_MAX;
+					computeFamily != UINT32_MAX &&
+					transferFamily != UINT32_MAX;
 			}
 		};
 
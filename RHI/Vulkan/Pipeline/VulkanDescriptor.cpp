@@ -191,12 +191,27 @@ namespace BinRenderer::Vulkan
 	{
 		auto* vulkanImageView = static_cast<VulkanImageView*>(imageView);
 
+		//  Layout에서 descriptor type 조회 (Storage image는 GENERAL 레이아웃, 샘플러 없음)
+		VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;  // 기본값
+		if (layout_)
+		{
+			for (const auto& b : layout_->getBindings())
+			{
+				if (b.binding == binding)
+				{
+					descriptorType = b.descriptorType;
+					break;
+				}
+			}
+		}
+		const bool isStorageImage = descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+
 		VkDescriptorImageInfo imageInfo{};
-		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		imageInfo.imageLayout = isStorageImage ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		imageInfo.imageView = vulkanImageView->getVkImageView();
 		
 		//  Sampler 변환
-		if (sampler)
+		if (sampler && !isStorageImage)
 		{
 			auto* vulkanSampler = static_cast<VulkanSampler*>(sampler);
 			imageInfo.sampler = vulkanSampler->getVkSampler();
@@ -211,7 +226,7 @@ namespace BinRenderer::Vulkan
 		descriptorWrite.dstSet = descriptorSet_;
 		descriptorWrite.dstBinding = binding;
 		descriptorWrite.dstArrayElement = 0;
-		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrite.descriptorType = descriptorType;
 		descriptorWrite.descriptorCount = 1;
 		descriptorWrite.pImageInfo = &imageInfo;
 
@@ -27,6 +27,21 @@ namespace BinRenderer::Vulkan
 		}
 	}
 
+	VulkanPipeline::VulkanPipeline(VkDevice device, VulkanShader* computeShader, VulkanPipelineLayout* ownedLayout)
+		: device_(device), layout_(ownedLayout), bindPoint_(RHI_PIPELINE_BIND_POINT_COMPUTE), ownsLayout_(true)
+	{
+		VkComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		pipelineInfo.stage = computeShader->getStageCreateInfo();
+		pipelineInfo.layout = getVkPipelineLayout();
+
+		if (vkCreateComputePipelines(device_, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline_) != VK_SUCCESS)
+		{
+			printLog("❌ ERROR: Failed to create compute pipeline");
+			pipeline_ = VK_NULL_HANDLE;
+		}
+	}
+
 	VulkanPipeline::~VulkanPipeline()
 	{
 		destroy();
@@ -39,7 +54,13 @@ namespace BinRenderer::Vulkan
 			vkDestroyPipeline(device_, pipeline_, nullptr);
 			pipeline_ = VK_NULL_HANDLE;
 		}
-		// layout_ is not owned by VulkanPipeline, so we don't destroy it here.
+		// 그래픽스 파이프라인의 layout_은 외부 소유, 컴퓨트 파이프라인은 직접 만든 레이아웃을 해제
+		if (ownsLayout_)
+		{
+			delete layout_;
+			layout_ = nullptr;
+			ownsLayout_ = false;
+		}
 	}
 
 	VkPipelineLayout VulkanPipeline::getVkPipelineLayout() const
@@ -19,6 +19,9 @@ namespace BinRenderer::Vulkan
 	{
 	public:
 		VulkanPipeline(VkDevice device, const RHIPipelineCreateInfo& createInfo, const std::vector<VulkanShader*>& shaders, RHIPipelineLayout* layout);
+
+		// 컴퓨트 파이프라인 (layout 소유권을 넘겨받음)
+		VulkanPipeline(VkDevice device, VulkanShader* computeShader, VulkanPipelineLayout* ownedLayout);
 		~VulkanPipeline() override;
 
 		void destroy();
@@ -31,6 +34,7 @@ namespace BinRenderer::Vulkan
 		// Vulkan 네이티브 접근
 		VkPipeline getVkPipeline() const { return pipeline_; }
 		VkPipelineLayout getVkPipelineLayout() const;
+		bool isValid() const { return pipeline_ != VK_NULL_HANDLE; }
 
 	private:
 		VkDevice device_;
@@ -38,6 +42,7 @@ namespace BinRenderer::Vulkan
 		RHIPipelineLayout* layout_ = nullptr;
 		VulkanRenderPass* renderPass_ = nullptr;
 		RHIPipelineBindPoint bindPoint_ = RHI_PIPELINE_BIND_POINT_GRAPHICS;
+		bool ownsLayout_ = false;
 
 		bool createGraphicsPipeline(const RHIPipelineCreateInfo& createInfo, const std::vector<VulkanShader*>& shaders);
 	};
@@ -4,8 +4,8 @@
 
 namespace BinRenderer::Vulkan
 {
-	VulkanBuffer::VulkanBuffer(VkDevice device, VkPhysicalDevice physicalDevice)
-		: device_(device), physicalDevice_(physicalDevice)
+	VulkanBuffer::VulkanBuffer(VkDevice device, VulkanMemoryAllocator* allocator)
+		: device_(device), allocator_(allocator)
 	{
 	}
 
@@ -33,6 +33,8 @@ namespace BinRenderer::Vulkan
 			vkUsage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 		if (createInfo.usage & RHI_BUFFER_USAGE_TRANSFER_DST_BIT)
 			vkUsage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+		if (createInfo.usage & RHI_BUFFER_USAGE_INDIRECT_BUFFER_BIT)
+			vkUsage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
 
 		// Vulkan 버퍼 생성 정보
 		VkBufferCreateInfo bufferInfo{};
@@ -46,35 +48,25 @@ namespace BinRenderer::Vulkan
 			return false;
 		}
 
-		// 메모리 요구사항 가져오기
-		VkMemoryRequirements memRequirements;
-		vkGetBufferMemoryRequirements(device_, buffer_, &memRequirements);
-
-		// 메모리 할당
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(
-			memRequirements.memoryTypeBits,
-			static_cast<VkMemoryPropertyFlags>(createInfo.memoryProperties)
-		);
-
-		if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory_) != VK_SUCCESS)
+		// 메모리 서브 할당 및 바인딩
+		if (!allocator_ || !allocator_->allocateBufferMemory(buffer_,
+			static_cast<VkMemoryPropertyFlags>(createInfo.memoryProperties),
+			createInfo.allocationFlags, allocation_))
 		{
 			vkDestroyBuffer(device_, buffer_, nullptr);
 			buffer_ = VK_NULL_HANDLE;
 			return false;
 		}
 
-		// 버퍼에 메모리 바인딩
-		vkBindBufferMemory(device_, buffer_, memory_, 0);
-
 		// 초기 데이터 복사
 		if (createInfo.initialData)
 		{
 			void* data = map();
-			memcpy(data, createInfo.initialData, createInfo.size);
-			unmap();
+			if (data)
+			{
+				memcpy(data, createInfo.initialData, createInfo.size);
+				flush();
+			}
 		}
 
 		return true;
@@ -82,74 +74,44 @@ namespace BinRenderer::Vulkan
 
 	void VulkanBuffer::destroy()
 	{
-		if (mappedPtr_)
-		{
-			unmap();
-		}
-
 		if (buffer_ != VK_NULL_HANDLE)
 		{
 			vkDestroyBuffer(device_, buffer_, nullptr);
 			buffer_ = VK_NULL_HANDLE;
 		}
 
-		if (memory_ != VK_NULL_HANDLE)
+		if (allocation_.isValid())
 		{
-			vkFreeMemory(device_, memory_, nullptr);
-			memory_ = VK_NULL_HANDLE;
+			allocator_->freeMemory(allocation_);
 		}
 	}
 
 	void* VulkanBuffer::map()
 	{
-		if (!mappedPtr_)
-		{
-			vkMapMemory(device_, memory_, 0, size_, 0, &mappedPtr_);
-		}
-		return mappedPtr_;
+		// Host visible 블록은 할당자가 영구 매핑해 두므로 주소만 반환
+		return allocation_.mappedData;
 	}
 
 	void VulkanBuffer::unmap()
 	{
-		if (mappedPtr_)
-		{
-			vkUnmapMemory(device_, memory_);
-			mappedPtr_ = nullptr;
-		}
+		// 블록을 다른 리소스와 공유하므로 매핑을 유지 (vkUnmapMemory 하지 않음)
 	}
 
 	void VulkanBuffer::flush(RHIDeviceSize offset, RHIDeviceSize size)
 	{
-		VkMappedMemoryRange mappedRange{};
-		mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-		mappedRange.memory = memory_;
-		mappedRange.offset = offset;
-		mappedRange.size = (size == 0) ? VK_WHOLE_SIZE : size;
-		vkFlushMappedMemoryRanges(device_, 1, &mappedRange);
+		allocator_->flush(allocation_, offset, size);
 	}
 
 	void VulkanBuffer::updateData(const void* data, RHIDeviceSize size, RHIDeviceSize offset)
 	{
 		void* mapped = map();
-		memcpy(static_cast<char*>(mapped) + offset, data, size);
-		unmap();
-	}
-
-	uint32_t VulkanBuffer::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
-	{
-		VkPhysicalDeviceMemoryProperties memProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memProperties);
-
-		for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
+		if (!mapped)
 		{
-			if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
-			{
-				return i;
-			}
+			printLog("❌ ERROR: updateData on a buffer that is not host visible");
+			return;
 		}
-
-		exitWithMessage("Failed to find suitable memory type!");
-		return 0;
+		memcpy(static_cast<char*>(mapped) + offset, data, size);
+		flush(offset, size);
 	}
 
 } // namespace BinRenderer::Vulkan
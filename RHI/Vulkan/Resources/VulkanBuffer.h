@@ -2,6 +2,7 @@
 
 #include "../../Resources/RHIBuffer.h"
 #include "../../Structs/RHIStructs.h"
+#include "../Utilities/VulkanMemoryAllocator.h"
 #include <vulkan/vulkan.h>
 
 namespace BinRenderer::Vulkan
@@ -14,7 +15,7 @@ namespace BinRenderer::Vulkan
 	class VulkanBuffer : public RHIBuffer
 	{
 	public:
-		VulkanBuffer(VkDevice device, VkPhysicalDevice physicalDevice);
+		VulkanBuffer(VkDevice device, VulkanMemoryAllocator* allocator);
 		~VulkanBuffer() override;
 
 		bool create(const RHIBufferCreateInfo& createInfo);
@@ -31,19 +32,17 @@ namespace BinRenderer::Vulkan
 
 		// Vulkan 네이티브 접근
 		VkBuffer getVkBuffer() const { return buffer_; }
-		VkDeviceMemory getVkMemory() const { return memory_; }
+		VkDeviceMemory getVkMemory() const { return allocation_.memory; }
+		VkDeviceSize getMemoryOffset() const { return allocation_.offset; }
 
 	private:
 		VkDevice device_;
-		VkPhysicalDevice physicalDevice_;
+		VulkanMemoryAllocator* allocator_;
 		VkBuffer buffer_ = VK_NULL_HANDLE;
-		VkDeviceMemory memory_ = VK_NULL_HANDLE;
+		VulkanAllocation allocation_;
 
 		RHIDeviceSize size_ = 0;
 		RHIBufferUsageFlags usage_ = 0;
-		void* mappedPtr_ = nullptr;
-
-		uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 	};
 
 } // namespace BinRenderer::Vulkan
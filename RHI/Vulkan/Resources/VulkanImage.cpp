@@ -7,8 +7,8 @@ namespace BinRenderer::Vulkan
 	// VulkanImage 구현
 	// ========================================
 
-	VulkanImage::VulkanImage(VkDevice device, VkPhysicalDevice physicalDevice)
-		: device_(device), physicalDevice_(physicalDevice)
+	VulkanImage::VulkanImage(VkDevice device, VulkanMemoryAllocator* allocator)
+		: device_(device), allocator_(allocator)
 	{
 	}
 
@@ -50,29 +50,15 @@ namespace BinRenderer::Vulkan
 			return false;
 		}
 
-		// 메모리 요구사항 가져오기
-		VkMemoryRequirements memRequirements;
-		vkGetImageMemoryRequirements(device_, image_, &memRequirements);
-
-		// 메모리 할당
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(
-			memRequirements.memoryTypeBits,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-		);
-
-		if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory_) != VK_SUCCESS)
+		// 메모리 서브 할당 및 바인딩 (큰 렌더 타겟은 할당자가 전용 메모리로 처리)
+		if (!allocator_ || !allocator_->allocateImageMemory(image_, imageInfo.tiling, imageInfo.usage,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, createInfo.allocationFlags, allocation_))
 		{
 			vkDestroyImage(device_, image_, nullptr);
 			image_ = VK_NULL_HANDLE;
 			return false;
 		}
 
-		// 이미지에 메모리 바인딩
-		vkBindImageMemory(device_, image_, memory_, 0);
-
 		return true;
 	}
 
@@ -84,29 +70,10 @@ namespace BinRenderer::Vulkan
 			image_ = VK_NULL_HANDLE;
 		}
 
-		if (memory_ != VK_NULL_HANDLE)
-		{
-			vkFreeMemory(device_, memory_, nullptr);
-			memory_ = VK_NULL_HANDLE;
-		}
-	}
-
-	uint32_t VulkanImage::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
-	{
-		VkPhysicalDeviceMemoryProperties memProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memProperties);
-
-		for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
+		if (allocation_.isValid())
 		{
-			if ((typeFilter & (1 << i)) &&
-				(memProperties.memoryTypes[i].propertyFlags & properties) == properties)
-			{
-				return i;
-			}
+			allocator_->freeMemory(allocation_);
 		}
-
-		exitWithMessage("Failed to find suitable memory type for image!");
-		return 0;
 	}
 
 	// ========================================
@@ -123,7 +90,8 @@ namespace BinRenderer::Vulkan
 		destroy();
 	}
 
-	bool VulkanImageView::create(VkImageViewType viewType, VkImageAspectFlags aspectFlags)
+	bool VulkanImageView::create(VkImageViewType viewType, VkImageAspectFlags aspectFlags,
+		uint32_t baseMipLevel, uint32_t levelCount)
 	{
 		//  Swapchain image view는 이미 setVkImageView()로 설정되어 있음
 		if (imageView_ != VK_NULL_HANDLE)
@@ -149,8 +117,10 @@ namespace BinRenderer::Vulkan
 		viewInfo.viewType = viewType;
 		viewInfo.format = static_cast<VkFormat>(image_->getFormat());
 		viewInfo.subresourceRange.aspectMask = aspectFlags;
-		viewInfo.subresourceRange.baseMipLevel = 0;
-		viewInfo.subresourceRange.levelCount = image_->getMipLevels();
+		viewInfo.subresourceRange.baseMipLevel = baseMipLevel;
+		viewInfo.subresourceRange.levelCount = levelCount == VK_REMAINING_MIP_LEVELS
+			? image_->getMipLevels() - baseMipLevel
+			: levelCount;
 		viewInfo.subresourceRange.baseArrayLayer = 0;
 		viewInfo.subresourceRange.layerCount = image_->getArrayLayers();
 
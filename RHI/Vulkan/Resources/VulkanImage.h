@@ -2,6 +2,7 @@
 
 #include "../../Resources/RHIImage.h"
 #include "../../Structs/RHIStructs.h"
+#include "../Utilities/VulkanMemoryAllocator.h"
 #include <vulkan/vulkan.h>
 
 namespace BinRenderer::Vulkan
@@ -12,7 +13,7 @@ namespace BinRenderer::Vulkan
 	class VulkanImage : public RHIImage
 	{
 	public:
-		VulkanImage(VkDevice device, VkPhysicalDevice physicalDevice);
+		VulkanImage(VkDevice device, VulkanMemoryAllocator* allocator);
 		~VulkanImage() override;
 
 		bool create(const RHIImageCreateInfo& createInfo);
@@ -29,13 +30,14 @@ namespace BinRenderer::Vulkan
 
 		// Vulkan 네이티브 접근
 		VkImage getVkImage() const { return image_; }
-		VkDeviceMemory getVkMemory() const { return memory_; }
+		VkDeviceMemory getVkMemory() const { return allocation_.memory; }
+		VkDeviceSize getMemoryOffset() const { return allocation_.offset; }
 
 	private:
 		VkDevice device_;
-		VkPhysicalDevice physicalDevice_;
+		VulkanMemoryAllocator* allocator_;
 		VkImage image_ = VK_NULL_HANDLE;
-		VkDeviceMemory memory_ = VK_NULL_HANDLE;
+		VulkanAllocation allocation_;
 
 		uint32_t width_ = 0;
 		uint32_t height_ = 0;
@@ -44,8 +46,6 @@ namespace BinRenderer::Vulkan
 		uint32_t arrayLayers_ = 1;
 		RHIFormat format_ = RHI_FORMAT_UNDEFINED;
 		RHISampleCountFlagBits samples_ = RHI_SAMPLE_COUNT_1_BIT;
-
-		uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 	};
 
 	/**
@@ -57,7 +57,9 @@ namespace BinRenderer::Vulkan
 		VulkanImageView(VkDevice device, VulkanImage* image);
 		~VulkanImageView() override;
 
-		bool create(VkImageViewType viewType, VkImageAspectFlags aspectFlags);
+		// levelCount가 VK_REMAINING_MIP_LEVELS면 baseMipLevel부터 끝까지
+		bool create(VkImageViewType viewType, VkImageAspectFlags aspectFlags,
+			uint32_t baseMipLevel = 0, uint32_t levelCount = VK_REMAINING_MIP_LEVELS);
 		void destroy();
 
 		// RHIImageView 인터페이스 구현
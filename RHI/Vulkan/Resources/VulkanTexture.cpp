@@ -32,6 +32,11 @@ namespace BinRenderer::Vulkan
 		}
 	}
 
+	VulkanMemoryAllocator* VulkanTexture::getMemoryAllocator() const
+	{
+		return rhi_ ? rhi_->getMemoryAllocator() : nullptr;
+	}
+
 	// ========================================
 	//  새로운 로딩 메서드 (RHITextureLoader 사용)
 	// ========================================
@@ -67,7 +72,7 @@ namespace BinRenderer::Vulkan
 		mipLevels_ = loadedData.mipLevels;
 
 		// 1. RHIImage 생성
-		image_ = new VulkanImage(device_, physicalDevice_);
+		image_ = new VulkanImage(device_, getMemoryAllocator());
 
 		RHIImageCreateInfo imageInfo{};
 		imageInfo.width = loadedData.width;
@@ -136,7 +141,7 @@ namespace BinRenderer::Vulkan
 		stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
 		stagingInfo.initialData = loadedData.data.data();
 
-		auto* stagingBuffer = new VulkanBuffer(device_, physicalDevice_);
+		auto* stagingBuffer = new VulkanBuffer(device_, getMemoryAllocator());
 		if (!stagingBuffer->create(stagingInfo))
 		{
 			printLog("[VulkanTexture] ❌ Failed to create staging buffer");
@@ -148,14 +153,10 @@ namespace BinRenderer::Vulkan
 		VkCommandBuffer cmdBuffer = rhi_->beginSingleTimeCommands();
 
 		// 3. 이미지 레이아웃 전환: UNDEFINED -> TRANSFER_DST
-		rhi_->cmdTransitionImageLayout(
-			image_,
-			RHI_IMAGE_LAYOUT_UNDEFINED,
-			RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			RHI_IMAGE_ASPECT_COLOR_BIT,
-			0, loadedData.mipLevels,
-			0, loadedData.arrayLayers
-		);
+		transitionImageLayout(cmdBuffer, image_->getVkImage(),
+			VK_IMAGE_LAYOUT_UNDEFINED,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			loadedData.mipLevels, loadedData.arrayLayers);
 
 		// 4. 버퍼 -> 이미지 복사 (모든 레이어와 mipmap)
 		std::vector<VkBufferImageCopy> copyRegions;
@@ -191,16 +192,12 @@ namespace BinRenderer::Vulkan
 		);
 
 		// 5. 이미지 레이아웃 전환: TRANSFER_DST -> SHADER_READ_ONLY
-		rhi_->cmdTransitionImageLayout(
-			image_,
-			RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-			RHI_IMAGE_ASPECT_COLOR_BIT,
-			0, loadedData.mipLevels,
-			0, loadedData.arrayLayers
-		);
+		transitionImageLayout(cmdBuffer, image_->getVkImage(),
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			loadedData.mipLevels, loadedData.arrayLayers);
 
-		// 6. 커맨드 버퍼 제출 및 대기
+		// 6. 커맨드 버퍼 제출 및 대기 (이 제출만 대기)
 		rhi_->endSingleTimeCommands(cmdBuffer);
 
 		// 7. 스테이징 버퍼 정리
@@ -220,7 +217,7 @@ namespace BinRenderer::Vulkan
 		height_ = height;
 		mipLevels_ = mipLevels;
 
-		image_ = new VulkanImage(device_, physicalDevice_);
+		image_ = new VulkanImage(device_, getMemoryAllocator());
 		RHIImageCreateInfo imageInfo{};
 		imageInfo.width = width;
 		imageInfo.height = height;
@@ -301,32 +298,39 @@ namespace BinRenderer::Vulkan
 		stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
 		stagingInfo.initialData = data;
 
-		auto* stagingBuffer = new VulkanBuffer(device_, physicalDevice_);
+		auto* stagingBuffer = new VulkanBuffer(device_, getMemoryAllocator());
 		if (!stagingBuffer->create(stagingInfo))
 		{
 			delete stagingBuffer;
 			return false;
 		}
 
-		transitionImageLayout(image_->getVkImage(), format,
+		VkCommandBuffer commandBuffer = rhi_ ? rhi_->beginSingleTimeCommands() : VK_NULL_HANDLE;
+		if (!commandBuffer)
+		{
+			printLog("Failed to begin single time commands - RHI not available!");
+			delete stagingBuffer;
+			return false;
+		}
+
+		// 전환/복사/밉맵 생성을 한 번의 제출로 기록
+		transitionImageLayout(commandBuffer, image_->getVkImage(),
 			VK_IMAGE_LAYOUT_UNDEFINED,
 			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 			mipLevels_);
 
-		copyBufferToImage(stagingBuffer->getVkBuffer(), image_->getVkImage(), width, height);
+		copyBufferToImage(commandBuffer, stagingBuffer->getVkBuffer(), image_->getVkImage(), width, height);
 
-		if (mipLevels_ > 1)
+		if (mipLevels_ <= 1 || !generateMipmaps(commandBuffer, image_->getVkImage(), format, width, height, mipLevels_))
 		{
-			generateMipmaps(image_->getVkImage(), format, width, height, mipLevels_);
-		}
-		else
-		{
-			transitionImageLayout(image_->getVkImage(), format,
+			transitionImageLayout(commandBuffer, image_->getVkImage(),
 				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
 				mipLevels_);
 		}
 
+		rhi_->endSingleTimeCommands(commandBuffer);
+
 		delete stagingBuffer;
 
 		return true;
@@ -353,7 +357,7 @@ namespace BinRenderer::Vulkan
 		}
 	}
 
-	void VulkanTexture::generateMipmaps(VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels)
+	bool VulkanTexture::generateMipmaps(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels)
 	{
 		VkFormatProperties formatProperties;
 		vkGetPhysicalDeviceFormatProperties(physicalDevice_, format, &formatProperties);
@@ -361,14 +365,7 @@ namespace BinRenderer::Vulkan
 		if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
 		{
 			printLog("Texture image format does not support linear blitting!");
-			return;
-		}
-
-		VkCommandBuffer commandBuffer = rhi_ ? rhi_->beginSingleTimeCommands() : VK_NULL_HANDLE;
-		if (!commandBuffer)
-		{
-			printLog("Failed to begin single time commands - RHI not available!");
-			return;
+			return false;
 		}
 
 		VkImageMemoryBarrier barrier{};
@@ -445,21 +442,11 @@ namespace BinRenderer::Vulkan
 			0, nullptr,
 			1, &barrier);
 
-		if (rhi_)
-		{
-			rhi_->endSingleTimeCommands(commandBuffer);
-		}
+		return true;
 	}
 
-	void VulkanTexture::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels)
+	void VulkanTexture::transitionImageLayout(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels, uint32_t layerCount)
 	{
-		VkCommandBuffer commandBuffer = rhi_ ? rhi_->beginSingleTimeCommands() : VK_NULL_HANDLE;
-		if (!commandBuffer)
-		{
-			printLog("Failed to begin single time commands - RHI not available!");
-			return;
-		}
-
 		VkImageMemoryBarrier barrier{};
 		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		barrier.oldLayout = oldLayout;
@@ -471,7 +458,7 @@ namespace BinRenderer::Vulkan
 		barrier.subresourceRange.baseMipLevel = 0;
 		barrier.subresourceRange.levelCount = mipLevels;
 		barrier.subresourceRange.baseArrayLayer = 0;
-		barrier.subresourceRange.layerCount = 1;
+		barrier.subresourceRange.layerCount = layerCount;
 
 		VkPipelineStageFlags sourceStage;
 		VkPipelineStageFlags destinationStage;
@@ -505,22 +492,10 @@ namespace BinRenderer::Vulkan
 			0, nullptr,
 			1, &barrier
 		);
-
-		if (rhi_)
-		{
-			rhi_->endSingleTimeCommands(commandBuffer);
-		}
 	}
 
-	void VulkanTexture::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height)
+	void VulkanTexture::copyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height)
 	{
-		VkCommandBuffer commandBuffer = rhi_ ? rhi_->beginSingleTimeCommands() : VK_NULL_HANDLE;
-		if (!commandBuffer)
-		{
-			printLog("Failed to begin single time commands - RHI not available!");
-			return;
-		}
-
 		VkBufferImageCopy region{};
 		region.bufferOffset = 0;
 		region.bufferRowLength = 0;
@@ -533,11 +508,6 @@ namespace BinRenderer::Vulkan
 		region.imageExtent = { width, height, 1 };
 
 		vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-		if (rhi_)
-		{
-			rhi_->endSingleTimeCommands(commandBuffer);
-		}
 	}
 
 } // namespace BinRenderer::Vulkan
@@ -104,13 +104,16 @@ namespace BinRenderer::Vulkan
 		uint32_t height_ = 0;
 		uint32_t mipLevels_ = 1;
 
+		// 이미지/스테이징 버퍼 메모리는 RHI의 서브 할당자에서 할당
+		VulkanMemoryAllocator* getMemoryAllocator() const;
+
 		//  텍스처 데이터 업로드 (큐브맵 지원)
 		void uploadTextureData(const RHITextureLoader::LoadedTextureData& loadedData);
 
-		// 레거시 메서드
-		void generateMipmaps(VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels);
-		void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels);
-		void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
+		// 레거시 메서드 (호출자가 연 일회성 커맨드 버퍼에 기록)
+		bool generateMipmaps(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, uint32_t width, uint32_t height, uint32_t mipLevels);
+		void transitionImageLayout(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels, uint32_t layerCount = 1);
+		void copyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
 	};
 
 } // namespace BinRenderer::Vulkan
@@ -0,0 +1,254 @@
+﻿#include "TLSFAllocator.h"
+
+#include <bit>
+
+namespace BinRenderer::Vulkan
+{
+	TLSFAllocator::TLSFAllocator(uint64_t size)
+	{
+		reset(size);
+	}
+
+	void TLSFAllocator::reset(uint64_t size)
+	{
+		nodes_.clear();
+		unusedNodes_.clear();
+
+		firstLevelBitmap_ = 0;
+		for (uint32_t fl = 0; fl < kFirstLevelCount; ++fl) {
+			secondLevelBitmap_[fl] = 0;
+			for (uint32_t sl = 0; sl < kSecondLevelCount; ++sl) {
+				freeHeads_[fl][sl] = kInvalidNode;
+			}
+		}
+
+		size_ = size;
+		freeSize_ = size;
+		allocationCount_ = 0;
+
+		if (size > 0) {
+			uint32_t node = createNode();
+			nodes_[node].offset = 0;
+			nodes_[node].size = size;
+			insertFree(node);
+		}
+	}
+
+	uint32_t TLSFAllocator::allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset)
+	{
+		if (size == 0) {
+			size = 1;
+		}
+		if (alignment == 0) {
+			alignment = 1;
+		}
+
+		auto fits = [&](uint32_t candidate) {
+			const Node& n = nodes_[candidate];
+			uint64_t aligned = (n.offset + alignment - 1) & ~(alignment - 1);
+			return aligned + size <= n.offset + n.size;
+		};
+
+		// 1차: 크기만으로 찾은 구간이 정렬까지 만족하면 사용, 아니면 정렬 여유분을 더해 다시 검색
+		uint32_t node = findFreeNode(size);
+		if (node == kInvalidNode || !fits(node)) {
+			node = alignment > 1 ? findFreeNode(size + alignment - 1) : kInvalidNode;
+			if (node == kInvalidNode) {
+				return kInvalidNode;
+			}
+		}
+
+		removeFree(node);
+
+		// 앞쪽 정렬 패딩은 별도 자유 구간으로 분리
+		const uint64_t aligned = (nodes_[node].offset + alignment - 1) & ~(alignment - 1);
+		const uint64_t padding = aligned - nodes_[node].offset;
+		if (padding > 0) {
+			uint32_t front = createNode();
+			Node& n = nodes_[node];
+			Node& f = nodes_[front];
+			f.offset = n.offset;
+			f.size = padding;
+			f.prevPhysical = n.prevPhysical;
+			f.nextPhysical = node;
+			if (n.prevPhysical != kInvalidNode) {
+				nodes_[n.prevPhysical].nextPhysical = front;
+			}
+			n.prevPhysical = front;
+			n.offset = aligned;
+			n.size -= padding;
+			insertFree(front);
+		}
+
+		// 남는 뒤쪽 구간도 자유 구간으로 분리
+		const uint64_t remainder = nodes_[node].size - size;
+		if (remainder > 0) {
+			uint32_t back = createNode();
+			Node& n = nodes_[node];
+			Node& b = nodes_[back];
+			b.offset = n.offset + size;
+			b.size = remainder;
+			b.prevPhysical = node;
+			b.nextPhysical = n.nextPhysical;
+			if (n.nextPhysical != kInvalidNode) {
+				nodes_[n.nextPhysical].prevPhysical = back;
+			}
+			n.nextPhysical = back;
+			n.size = size;
+			insertFree(back);
+		}
+
+		nodes_[node].isFree = false;
+		freeSize_ -= size;
+		allocationCount_++;
+
+		outOffset = aligned;
+		return node;
+	}
+
+	void TLSFAllocator::free(uint32_t node)
+	{
+		if (node >= nodes_.size() || nodes_[node].isFree) {
+			return;
+		}
+
+		freeSize_ += nodes_[node].size;
+		allocationCount_--;
+
+		// 앞쪽 이웃과 병합
+		uint32_t prev = nodes_[node].prevPhysical;
+		if (prev != kInvalidNode && nodes_[prev].isFree) {
+			removeFree(prev);
+			nodes_[prev].size += nodes_[node].size;
+			nodes_[prev].nextPhysical = nodes_[node].nextPhysical;
+			if (nodes_[node].nextPhysical != kInvalidNode) {
+				nodes_[nodes_[node].nextPhysical].prevPhysical = prev;
+			}
+			releaseNode(node);
+			node = prev;
+		}
+
+		// 뒤쪽 이웃과 병합
+		uint32_t next = nodes_[node].nextPhysical;
+		if (next != kInvalidNode && nodes_[next].isFree) {
+			removeFree(next);
+			nodes_[node].size += nodes_[next].size;
+			nodes_[node].nextPhysical = nodes_[next].nextPhysical;
+			if (nodes_[next].nextPhysical != kInvalidNode) {
+				nodes_[nodes_[next].nextPhysical].prevPhysical = node;
+			}
+			releaseNode(next);
+		}
+
+		insertFree(node);
+	}
+
+	void TLSFAllocator::mapping(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel)
+	{
+		// 작은 크기는 0번 1단계에 바이트 단위로 선형 배치
+		if (size < kSmallSize) {
+			firstLevel = 0;
+			secondLevel = static_cast<uint32_t>(size);
+			return;
+		}
+
+		const uint32_t msb = 63 - static_cast<uint32_t>(std::countl_zero(size));
+		firstLevel = msb - kSecondLevelBits + 1;
+		secondLevel = static_cast<uint32_t>(size >> (msb - kSecondLevelBits)) & (kSecondLevelCount - 1);
+	}
+
+	uint32_t TLSFAllocator::findFreeNode(uint64_t size) const
+	{
+		// 요청 크기를 다음 등급 경계로 올려서, 찾은 리스트의 어떤 구간이든 크기를 만족하게 함
+		if (size >= kSmallSize) {
+			const uint32_t msb = 63 - static_cast<uint32_t>(std::countl_zero(size));
+			size += (1ull << (msb - kSecondLevelBits)) - 1;
+		}
+
+		uint32_t fl, sl;
+		mapping(size, fl, sl);
+		if (fl >= kFirstLevelCount) {
+			return kInvalidNode;
+		}
+
+		uint32_t slMap = sl < kSecondLevelCount ? (secondLevelBitmap_[fl] & (~0u << sl)) : 0;
+		if (slMap == 0) {
+			if (fl + 1 >= kFirstLevelCount) {
+				return kInvalidNode;
+			}
+			const uint64_t flMap = firstLevelBitmap_ & (~0ull << (fl + 1));
+			if (flMap == 0) {
+				return kInvalidNode;
+			}
+			fl = static_cast<uint32_t>(std::countr_zero(flMap));
+			slMap = secondLevelBitmap_[fl];
+		}
+
+		sl = static_cast<uint32_t>(std::countr_zero(slMap));
+		return freeHeads_[fl][sl];
+	}
+
+	uint32_t TLSFAllocator::createNode()
+	{
+		if (!unusedNodes_.empty()) {
+			uint32_t node = unusedNodes_.back();
+			unusedNodes_.pop_back();
+			nodes_[node] = Node{};
+			return node;
+		}
+
+		nodes_.emplace_back();
+		return static_cast<uint32_t>(nodes_.size() - 1);
+	}
+
+	void TLSFAllocator::releaseNode(uint32_t node)
+	{
+		nodes_[node] = Node{};
+		unusedNodes_.push_back(node);
+	}
+
+	void TLSFAllocator::insertFree(uint32_t node)
+	{
+		uint32_t fl, sl;
+		mapping(nodes_[node].size, fl, sl);
+
+		Node& n = nodes_[node];
+		n.isFree = true;
+		n.prevFree = kInvalidNode;
+		n.nextFree = freeHeads_[fl][sl];
+		if (n.nextFree != kInvalidNode) {
+			nodes_[n.nextFree].prevFree = node;
+		}
+		freeHeads_[fl][sl] = node;
+
+		firstLevelBitmap_ |= 1ull << fl;
+		secondLevelBitmap_[fl] |= 1u << sl;
+	}
+
+	void TLSFAllocator::removeFree(uint32_t node)
+	{
+		uint32_t fl, sl;
+		mapping(nodes_[node].size, fl, sl);
+
+		Node& n = nodes_[node];
+		if (n.prevFree != kInvalidNode) {
+			nodes_[n.prevFree].nextFree = n.nextFree;
+		} else {
+			freeHeads_[fl][sl] = n.nextFree;
+		}
+		if (n.nextFree != kInvalidNode) {
+			nodes_[n.nextFree].prevFree = n.prevFree;
+		}
+		n.prevFree = kInvalidNode;
+		n.nextFree = kInvalidNode;
+		n.isFree = false;
+
+		if (freeHeads_[fl][sl] == kInvalidNode) {
+			secondLevelBitmap_[fl] &= ~(1u << sl);
+			if (secondLevelBitmap_[fl] == 0) {
+				firstLevelBitmap_ &= ~(1ull << fl);
+			}
+		}
+	}
+
+} // namespace BinRenderer::Vulkan
@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer::Vulkan
+{
+	/**
+	 * @brief TLSF (Two-Level Segregated Fit) 오프셋 할당자
+	 *
+	 * 실제 메모리를 만지지 않고 [0, size) 구간의 오프셋만 관리 (VkDeviceMemory 블록 내부 서브 할당용)
+	 * - 1단계: 크기의 최상위 비트, 2단계: 그 아래 kSecondLevelBits 비트로 자유 리스트를 분류
+	 * - 비트맵 두 개로 알맞은 자유 리스트를 O(1)에 찾고, 해제 시 인접 자유 구간과 즉시 병합
+	 */
+	class TLSFAllocator
+	{
+	public:
+		static constexpr uint32_t kInvalidNode = UINT32_MAX;
+
+		explicit TLSFAllocator(uint64_t size = 0);
+
+		void reset(uint64_t size);
+
+		/**
+		 * @brief 구간 할당
+		 * @param alignment 2의 거듭제곱
+		 * @param outOffset 정렬된 시작 오프셋
+		 * @return 해제할 때 넘길 노드 (실패 시 kInvalidNode)
+		 */
+		uint32_t allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+
+		void free(uint32_t node);
+
+		uint64_t getSize() const { return size_; }
+		uint64_t getFreeSize() const { return freeSize_; }
+		uint32_t getAllocationCount() const { return allocationCount_; }
+		bool isEmpty() const { return allocationCount_ == 0; }
+
+	private:
+		static constexpr uint32_t kSecondLevelBits = 5;
+		static constexpr uint32_t kSecondLevelCount = 1u << kSecondLevelBits;
+		static constexpr uint32_t kFirstLevelCount = 64 - kSecondLevelBits + 1;
+		static constexpr uint64_t kSmallSize = 1ull << kSecondLevelBits;
+
+		struct Node
+		{
+			uint64_t offset = 0;
+			uint64_t size = 0;
+			uint32_t prevPhysical = kInvalidNode;  // 주소 순서 이웃 (병합용)
+			uint32_t nextPhysical = kInvalidNode;
+			uint32_t prevFree = kInvalidNode;      // 같은 크기 등급의 자유 리스트
+			uint32_t nextFree = kInvalidNode;
+			bool isFree = false;
+		};
+
+		static void mapping(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel);
+		uint32_t findFreeNode(uint64_t size) const;
+
+		uint32_t createNode();
+		void releaseNode(uint32_t node);
+		void insertFree(uint32_t node);
+		void removeFree(uint32_t node);
+
+		std::vector<Node> nodes_;
+		std::vector<uint32_t> unusedNodes_;
+
+		uint64_t firstLevelBitmap_ = 0;
+		uint32_t secondLevelBitmap_[kFirstLevelCount] = {};
+		uint32_t freeHeads_[kFirstLevelCount][kSecondLevelCount];
+
+		uint64_t size_ = 0;
+		uint64_t freeSize_ = 0;
+		uint32_t allocationCount_ = 0;
+	};
+
+} // namespace BinRenderer::Vulkan
@@ -423,6 +423,25 @@ namespace BinRenderer::Vulkan
 
 			return info;
 		}
+
+		void pipelineBarriers(
+			VkCommandBuffer cmd,
+			const std::vector<VkImageMemoryBarrier2>& imageBarriers,
+			const std::vector<VkBufferMemoryBarrier2>& bufferBarriers)
+		{
+			if (imageBarriers.empty() && bufferBarriers.empty())
+			{
+				return;
+			}
+
+			VkDependencyInfo depInfo{ VK_STRUCTURE_TYPE_DEPENDENCY_INFO };
+			depInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers.size());
+			depInfo.pImageMemoryBarriers = imageBarriers.data();
+			depInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers.size());
+			depInfo.pBufferMemoryBarriers = bufferBarriers.data();
+
+			vkCmdPipelineBarrier2(cmd, &depInfo);
+		}
 	}
 
 } // namespace BinRenderer::Vulkan
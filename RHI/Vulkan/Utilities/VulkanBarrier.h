@@ -159,6 +159,16 @@ namespace BinRenderer::Vulkan
 		};
 
 		LayoutAccessInfo getLayoutAccessInfo(VkImageLayout layout);
+
+		/**
+		 * @brief 여러 배리어를 한 번의 vkCmdPipelineBarrier2로 기록
+		 * 
+		 * 배리어가 하나도 없으면 아무것도 기록하지 않음
+		 */
+		void pipelineBarriers(
+			VkCommandBuffer cmd,
+			const std::vector<VkImageMemoryBarrier2>& imageBarriers,
+			const std::vector<VkBufferMemoryBarrier2>& bufferBarriers);
 	}
 
 } // namespace BinRenderer::Vulkan
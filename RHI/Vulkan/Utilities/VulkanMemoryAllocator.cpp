@@ -1,87 +1,215 @@
 ﻿#include "VulkanMemoryAllocator.h"
 #include "Core/Logger.h"
 
+#include <algorithm>
+
 namespace BinRenderer::Vulkan
 {
-	VulkanMemoryAllocator::VulkanMemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice)
+	namespace
+	{
+		constexpr VkDeviceSize kMaxBlockSize = 256ull * 1024 * 1024;        // 큰 힙의 기본 블록 크기
+		constexpr VkDeviceSize kLinearBlockSize = 8ull * 1024 * 1024;       // 프레임 선형 풀 블록 크기
+		constexpr VkDeviceSize kLargeRenderTargetSize = 16ull * 1024 * 1024; // 이 이상인 렌더 타겟은 전용 할당
+
+		VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	VulkanMemoryAllocator::VulkanMemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t frameCount)
 		: device_(device), physicalDevice_(physicalDevice)
 	{
 		vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice_, &properties);
+		bufferImageGranularity_ = std::max<VkDeviceSize>(properties.limits.bufferImageGranularity, 1);
+		nonCoherentAtomSize_ = std::max<VkDeviceSize>(properties.limits.nonCoherentAtomSize, 1);
+
+		// 힙이 작으면 (통합 메모리의 Host visible 힙 등) 힙 크기의 1/8로 블록을 줄임
+		pools_.resize(memoryProperties_.memoryTypeCount * 2);
+		for (uint32_t type = 0; type < memoryProperties_.memoryTypeCount; ++type)
+		{
+			const VkDeviceSize heapSize = memoryProperties_.memoryHeaps[memoryProperties_.memoryTypes[type].heapIndex].size;
+			const VkDeviceSize blockSize = alignUp(std::min(kMaxBlockSize, std::max<VkDeviceSize>(heapSize / 8, 1)), 256);
+			for (uint32_t kind = 0; kind < 2; ++kind)
+			{
+				pools_[type * 2 + kind].memoryTypeIndex = type;
+				pools_[type * 2 + kind].blockSize = blockSize;
+			}
+		}
+
+		linearPools_.resize(std::max(frameCount, 1u));
+		for (auto& framePools : linearPools_)
+		{
+			framePools.resize(memoryProperties_.memoryTypeCount);
+		}
+
+		printLog(" VulkanMemoryAllocator initialized ({} memory types, bufferImageGranularity {})",
+			memoryProperties_.memoryTypeCount, bufferImageGranularity_);
 	}
 
 	VulkanMemoryAllocator::~VulkanMemoryAllocator()
 	{
-		// 남은 메모리 정리
-		for (auto& pair : allocations_)
+		// 남은 메모리 정리 (vkFreeMemory가 매핑도 함께 해제)
+		for (auto& pool : pools_)
+		{
+			for (auto& block : pool.blocks)
+			{
+				vkFreeMemory(device_, block->memory, nullptr);
+			}
+			pool.blocks.clear();
+		}
+
+		for (auto& pair : dedicated_)
 		{
 			vkFreeMemory(device_, pair.first, nullptr);
 		}
-		allocations_.clear();
+		dedicated_.clear();
+
+		for (auto& framePools : linearPools_)
+		{
+			for (auto& pool : framePools)
+			{
+				for (auto& block : pool.blocks)
+				{
+					vkFreeMemory(device_, block.memory, nullptr);
+				}
+			}
+		}
+		linearPools_.clear();
 	}
 
-	VkDeviceMemory VulkanMemoryAllocator::allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties)
+	bool VulkanMemoryAllocator::allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties,
+		RHIAllocationFlags flags, VulkanAllocation& outAllocation)
 	{
-		VkMemoryRequirements memRequirements;
-		vkGetBufferMemoryRequirements(device_, buffer, &memRequirements);
+		VkMemoryDedicatedRequirements dedicatedRequirements{ VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS };
+		VkMemoryRequirements2 memRequirements{ VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+		memRequirements.pNext = &dedicatedRequirements;
 
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+		VkBufferMemoryRequirementsInfo2 requirementsInfo{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2 };
+		requirementsInfo.buffer = buffer;
+		vkGetBufferMemoryRequirements2(device_, &requirementsInfo, &memRequirements);
 
-		VkDeviceMemory memory;
-		if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		const bool dedicated = (flags & RHI_ALLOCATION_DEDICATED_BIT) ||
+			dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
+		const bool transient = (flags & RHI_ALLOCATION_FRAME_TRANSIENT_BIT) && !dedicated;
+
+		if (!allocate(memRequirements.memoryRequirements, properties, false, dedicated, transient,
+			buffer, VK_NULL_HANDLE, outAllocation))
 		{
-			return VK_NULL_HANDLE;
+			return false;
 		}
 
-		// 통계 업데이트
-		stats_.totalAllocated += memRequirements.size;
-		stats_.allocationCount++;
-		allocations_[memory] = memRequirements.size;
+		if (vkBindBufferMemory(device_, buffer, outAllocation.memory, outAllocation.offset) != VK_SUCCESS)
+		{
+			freeMemory(outAllocation);
+			return false;
+		}
 
-		return memory;
+		return true;
 	}
 
-	VkDeviceMemory VulkanMemoryAllocator::allocateImageMemory(VkImage image, VkMemoryPropertyFlags properties)
+	bool VulkanMemoryAllocator::allocateImageMemory(VkImage image, VkImageTiling tiling, VkImageUsageFlags usage,
+		VkMemoryPropertyFlags properties, RHIAllocationFlags flags, VulkanAllocation& outAllocation)
 	{
-		VkMemoryRequirements memRequirements;
-		vkGetImageMemoryRequirements(device_, image, &memRequirements);
+		VkMemoryDedicatedRequirements dedicatedRequirements{ VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS };
+		VkMemoryRequirements2 memRequirements{ VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+		memRequirements.pNext = &dedicatedRequirements;
 
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+		VkImageMemoryRequirementsInfo2 requirementsInfo{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2 };
+		requirementsInfo.image = image;
+		vkGetImageMemoryRequirements2(device_, &requirementsInfo, &memRequirements);
 
-		VkDeviceMemory memory;
-		if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		// 큰 렌더 타겟은 전용 메모리가 드라이버 최적화(압축 등)에 유리하고 블록 단편화도 줄임
+		const bool renderTarget = (usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) != 0;
+		const bool dedicated = (flags & RHI_ALLOCATION_DEDICATED_BIT) ||
+			dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation ||
+			(renderTarget && memRequirements.memoryRequirements.size >= kLargeRenderTargetSize);
+
+		if (!allocate(memRequirements.memoryRequirements, properties, tiling == VK_IMAGE_TILING_OPTIMAL, dedicated, false,
+			VK_NULL_HANDLE, image, outAllocation))
 		{
-			return VK_NULL_HANDLE;
+			return false;
 		}
 
-		// 통계 업데이트
-		stats_.totalAllocated += memRequirements.size;
-		stats_.allocationCount++;
-		allocations_[memory] = memRequirements.size;
+		if (vkBindImageMemory(device_, image, outAllocation.memory, outAllocation.offset) != VK_SUCCESS)
+		{
+			freeMemory(outAllocation);
+			return false;
+		}
 
-		return memory;
+		return true;
 	}
 
-	void VulkanMemoryAllocator::freeMemory(VkDeviceMemory memory)
+	void VulkanMemoryAllocator::freeMemory(VulkanAllocation& allocation)
 	{
-		if (memory == VK_NULL_HANDLE)
+		if (!allocation.isValid())
 		{
 			return;
 		}
 
-		auto it = allocations_.find(memory);
-		if (it != allocations_.end())
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		switch (allocation.type)
+		{
+		case VulkanAllocationType::Block:
 		{
-			stats_.totalFreed += it->second;
-			allocations_.erase(it);
+			auto* block = static_cast<MemoryBlock*>(allocation.owner);
+			block->allocator.free(allocation.node);
+			releaseIfEmpty(block);
+			break;
+		}
+		case VulkanAllocationType::Dedicated:
+			dedicated_.erase(allocation.memory);
+			freeDeviceMemory(allocation.memory);
+			stats_.dedicatedCount--;
+			break;
+		case VulkanAllocationType::Linear:
+		case VulkanAllocationType::None:
+			break;
 		}
 
-		vkFreeMemory(device_, memory, nullptr);
+		stats_.totalFreed += allocation.size;
+		stats_.allocationCount--;
+
+		allocation = VulkanAllocation{};
+	}
+
+	void VulkanMemoryAllocator::flush(const VulkanAllocation& allocation, VkDeviceSize offset, VkDeviceSize size)
+	{
+		if (!allocation.isValid() ||
+			(memoryProperties_.memoryTypes[allocation.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+		{
+			return;
+		}
+
+		// 범위를 nonCoherentAtomSize로 맞춤 (non-coherent 할당은 시작과 메모리 크기가 이미 atom 단위로 정렬됨)
+		const VkDeviceSize begin = allocation.offset + offset;
+		const VkDeviceSize end = allocation.offset + ((size == 0) ? allocation.size : offset + size);
+
+		VkMappedMemoryRange mappedRange{};
+		mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		mappedRange.memory = allocation.memory;
+		mappedRange.offset = begin & ~(nonCoherentAtomSize_ - 1);
+		mappedRange.size = alignUp(end, nonCoherentAtomSize_) - mappedRange.offset;
+		vkFlushMappedMemoryRanges(device_, 1, &mappedRange);
+	}
+
+	void VulkanMemoryAllocator::beginFrame(uint32_t frameIndex)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		currentFrame_ = frameIndex % static_cast<uint32_t>(linearPools_.size());
+		for (auto& pool : linearPools_[currentFrame_])
+		{
+			for (auto& block : pool.blocks)
+			{
+				block.used = 0;
+			}
+			pool.current = 0;
+		}
 	}
 
 	uint32_t VulkanMemoryAllocator::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
@@ -99,9 +227,279 @@ namespace BinRenderer::Vulkan
 		return 0;
 	}
 
+	VulkanMemoryAllocator::Stats VulkanMemoryAllocator::getStats() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+
 	void VulkanMemoryAllocator::resetStats()
 	{
-		stats_ = Stats{};
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		// 누적값만 초기화 (현재 살아 있는 개수는 유지)
+		stats_.totalAllocated = 0;
+		stats_.totalFreed = 0;
+	}
+
+	// ========================================
+	// 내부 구현
+	// ========================================
+
+	bool VulkanMemoryAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties,
+		bool optimalImage, bool dedicated, bool transient,
+		VkBuffer dedicatedBuffer, VkImage dedicatedImage, VulkanAllocation& outAllocation)
+	{
+		const uint32_t memoryTypeIndex = findMemoryType(requirements.memoryTypeBits, properties);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		bool allocated = false;
+		if (transient)
+		{
+			allocated = allocateLinear(requirements, memoryTypeIndex, outAllocation);
+		}
+
+		// bufferImageGranularity가 1이면 종류 구분 없이 같은 블록 사용
+		BlockPool& pool = pools_[memoryTypeIndex * 2 + ((optimalImage && bufferImageGranularity_ > 1) ? 1 : 0)];
+		if (!allocated && !dedicated && requirements.size <= pool.blockSize / 2)
+		{
+			allocated = allocateFromPool(pool, requirements, outAllocation);
+		}
+
+		if (!allocated)
+		{
+			allocated = allocateDedicated(requirements, memoryTypeIndex, dedicatedBuffer, dedicatedImage, outAllocation);
+		}
+
+		if (!allocated)
+		{
+			printLog("❌ ERROR: Failed to allocate {} bytes (memory type {})", requirements.size, memoryTypeIndex);
+			return false;
+		}
+
+		stats_.totalAllocated += requirements.size;
+		stats_.allocationCount++;
+		return true;
+	}
+
+	bool VulkanMemoryAllocator::allocateFromPool(BlockPool& pool, const VkMemoryRequirements& requirements, VulkanAllocation& outAllocation)
+	{
+		const VkDeviceSize alignment = getAlignment(pool.memoryTypeIndex, requirements.alignment);
+
+		auto tryBlock = [&](MemoryBlock& block) {
+			if (block.allocator.getFreeSize() < requirements.size)
+			{
+				return false;
+			}
+
+			uint64_t offset = 0;
+			uint32_t node = block.allocator.allocate(requirements.size, alignment, offset);
+			if (node == TLSFAllocator::kInvalidNode)
+			{
+				return false;
+			}
+
+			outAllocation = VulkanAllocation{};
+			outAllocation.memory = block.memory;
+			outAllocation.offset = offset;
+			outAllocation.size = requirements.size;
+			outAllocation.mappedData = block.mapped ? static_cast<char*>(block.mapped) + offset : nullptr;
+			outAllocation.memoryTypeIndex = pool.memoryTypeIndex;
+			outAllocation.type = VulkanAllocationType::Block;
+			outAllocation.owner = &block;
+			outAllocation.node = node;
+			return true;
+		};
+
+		for (auto& block : pool.blocks)
+		{
+			if (tryBlock(*block))
+			{
+				return true;
+			}
+		}
+
+		// 새 블록: 메모리가 부족하면 1/8 크기까지 줄여 가며 재시도
+		void* mapped = nullptr;
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize blockSize = pool.blockSize;
+		while (true)
+		{
+			memory = allocateDeviceMemory(blockSize, pool.memoryTypeIndex, nullptr, &mapped);
+			if (memory != VK_NULL_HANDLE || blockSize / 2 < requirements.size || blockSize / 2 < pool.blockSize / 8)
+			{
+				break;
+			}
+			blockSize /= 2;
+		}
+
+		if (memory == VK_NULL_HANDLE)
+		{
+			return false;
+		}
+
+		auto block = std::make_unique<MemoryBlock>();
+		block->memory = memory;
+		block->mapped = mapped;
+		block->allocator.reset(blockSize);
+		block->poolIndex = static_cast<uint32_t>(&pool - pools_.data());
+
+		stats_.blockCount++;
+		stats_.blockBytes += blockSize;
+
+		MemoryBlock& newBlock = *block;
+		pool.blocks.push_back(std::move(block));
+		return tryBlock(newBlock);
+	}
+
+	bool VulkanMemoryAllocator::allocateDedicated(const VkMemoryRequirements& requirements, uint32_t memoryTypeIndex,
+		VkBuffer buffer, VkImage image, VulkanAllocation& outAllocation)
+	{
+		VkMemoryDedicatedAllocateInfo dedicatedInfo{ VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO };
+		dedicatedInfo.buffer = buffer;
+		dedicatedInfo.image = image;
+
+		void* mapped = nullptr;
+		VkDeviceSize size = requirements.size;
+		VkDeviceMemory memory = allocateDeviceMemory(size, memoryTypeIndex, &dedicatedInfo, &mapped);
+		if (memory == VK_NULL_HANDLE)
+		{
+			return false;
+		}
+
+		dedicated_[memory] = size;
+		stats_.dedicatedCount++;
+
+		outAllocation = VulkanAllocation{};
+		outAllocation.memory = memory;
+		outAllocation.offset = 0;
+		outAllocation.size = requirements.size;
+		outAllocation.mappedData = mapped;
+		outAllocation.memoryTypeIndex = memoryTypeIndex;
+		outAllocation.type = VulkanAllocationType::Dedicated;
+		return true;
+	}
+
+	bool VulkanMemoryAllocator::allocateLinear(const VkMemoryRequirements& requirements, uint32_t memoryTypeIndex, VulkanAllocation& outAllocation)
+	{
+		LinearPool& pool = linearPools_[currentFrame_][memoryTypeIndex];
+		const VkDeviceSize alignment = getAlignment(memoryTypeIndex, requirements.alignment);
+
+		// 현재 블록부터 앞으로만 진행 (beginFrame()에서 처음으로 되돌림)
+		for (; pool.current < pool.blocks.size(); ++pool.current)
+		{
+			LinearBlock& block = pool.blocks[pool.current];
+			const VkDeviceSize offset = alignUp(block.used, alignment);
+			if (offset + requirements.size <= block.size)
+			{
+				block.used = offset + requirements.size;
+
+				outAllocation = VulkanAllocation{};
+				outAllocation.memory = block.memory;
+				outAllocation.offset = offset;
+				outAllocation.size = requirements.size;
+				outAllocation.mappedData = block.mapped ? static_cast<char*>(block.mapped) + offset : nullptr;
+				outAllocation.memoryTypeIndex = memoryTypeIndex;
+				outAllocation.type = VulkanAllocationType::Linear;
+				return true;
+			}
+		}
+
+		LinearBlock block;
+		block.size = std::max(kLinearBlockSize, requirements.size);
+		block.memory = allocateDeviceMemory(block.size, memoryTypeIndex, nullptr, &block.mapped);
+		if (block.memory == VK_NULL_HANDLE)
+		{
+			return false;
+		}
+
+		stats_.blockBytes += block.size;
+		pool.blocks.push_back(block);
+		return allocateLinear(requirements, memoryTypeIndex, outAllocation);
+	}
+
+	void VulkanMemoryAllocator::releaseIfEmpty(MemoryBlock* block)
+	{
+		if (!block->allocator.isEmpty())
+		{
+			return;
+		}
+
+		// 할당/해제가 반복될 때 블록을 계속 만들고 지우지 않도록 빈 블록 하나는 남겨 둠
+		BlockPool& pool = pools_[block->poolIndex];
+		const auto emptyBlocks = std::count_if(pool.blocks.begin(), pool.blocks.end(),
+			[](const std::unique_ptr<MemoryBlock>& b) { return b->allocator.isEmpty(); });
+		if (emptyBlocks <= 1)
+		{
+			return;
+		}
+
+		auto it = std::find_if(pool.blocks.begin(), pool.blocks.end(),
+			[block](const std::unique_ptr<MemoryBlock>& b) { return b.get() == block; });
+		if (it == pool.blocks.end())
+		{
+			return;
+		}
+
+		stats_.blockCount--;
+		stats_.blockBytes -= block->allocator.getSize();
+		freeDeviceMemory(block->memory);
+		pool.blocks.erase(it);
+	}
+
+	VkDeviceMemory VulkanMemoryAllocator::allocateDeviceMemory(VkDeviceSize& size, uint32_t memoryTypeIndex, const void* pNext, void** outMapped)
+	{
+		// Non-coherent 메모리는 크기를 atom 단위로 올려 flush 범위가 메모리 끝을 넘지 않게 함
+		const VkMemoryPropertyFlags flags = memoryProperties_.memoryTypes[memoryTypeIndex].propertyFlags;
+		if ((flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+		{
+			size = alignUp(size, nonCoherentAtomSize_);
+		}
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.pNext = pNext;
+		allocInfo.allocationSize = size;
+		allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		{
+			return VK_NULL_HANDLE;
+		}
+
+		*outMapped = nullptr;
+		if (isHostVisible(memoryTypeIndex) &&
+			vkMapMemory(device_, memory, 0, VK_WHOLE_SIZE, 0, outMapped) != VK_SUCCESS)
+		{
+			*outMapped = nullptr;
+		}
+
+		stats_.deviceMemoryCount++;
+		return memory;
+	}
+
+	void VulkanMemoryAllocator::freeDeviceMemory(VkDeviceMemory memory)
+	{
+		vkFreeMemory(device_, memory, nullptr);
+		stats_.deviceMemoryCount--;
+	}
+
+	VkDeviceSize VulkanMemoryAllocator::getAlignment(uint32_t memoryTypeIndex, VkDeviceSize alignment) const
+	{
+		// Non-coherent 메모리는 flush 단위가 이웃 할당과 겹치지 않도록 atom 크기로 정렬
+		const VkMemoryPropertyFlags flags = memoryProperties_.memoryTypes[memoryTypeIndex].propertyFlags;
+		if ((flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+		{
+			alignment = std::max(alignment, nonCoherentAtomSize_);
+		}
+		return std::max<VkDeviceSize>(alignment, 1);
+	}
+
+	bool VulkanMemoryAllocator::isHostVisible(uint32_t memoryTypeIndex) const
+	{
+		return (memoryProperties_.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
 	}
 
 } // namespace BinRenderer::Vulkan
@@ -1,30 +1,74 @@
 ﻿#pragma once
 
+#include "../../Core/RHIType.h"
+#include "TLSFAllocator.h"
 #include <vulkan/vulkan.h>
-#include <vector>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace BinRenderer::Vulkan
 {
+	enum class VulkanAllocationType : uint8_t
+	{
+		None,
+		Block,      // 공유 블록 안의 TLSF 서브 할당
+		Dedicated,  // 리소스 전용 VkDeviceMemory
+		Linear,     // 프레임 선형 풀 (개별 해제 없음)
+	};
+
+	/**
+	 * @brief 리소스 하나에 바인딩된 메모리 구간
+	 */
+	struct VulkanAllocation
+	{
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize offset = 0;
+		VkDeviceSize size = 0;
+		void* mappedData = nullptr;  // Host visible 메모리는 블록 전체가 영구 매핑됨 (offset 적용된 주소)
+		uint32_t memoryTypeIndex = 0;
+		VulkanAllocationType type = VulkanAllocationType::None;
+
+		// 내부 추적용
+		void* owner = nullptr;  // Block 할당의 MemoryBlock
+		uint32_t node = TLSFAllocator::kInvalidNode;
+
+		bool isValid() const { return memory != VK_NULL_HANDLE; }
+	};
+
 	/**
-	 * @brief 간단한 Vulkan 메모리 할당자
+	 * @brief Vulkan 메모리 서브 할당자
 	 *
- * 실제 프로젝트에서는 VMA (Vulkan Memory Allocator) 사용 권장
+	 * - 메모리 타입별로 큰 VkDeviceMemory 블록을 만들고 그 안을 TLSF로 나눠 씀 (maxMemoryAllocationCount 회피)
+	 * - bufferImageGranularity > 1이면 선형 리소스(버퍼)와 Optimal 이미지를 서로 다른 블록에 배치
+	 * - 드라이버가 원하거나 블록 절반보다 큰 리소스, 큰 렌더 타겟은 전용 할당
+	 * - RHI_ALLOCATION_FRAME_TRANSIENT_BIT 버퍼는 프레임 슬롯별 선형 풀에서 bump 할당, beginFrame()에서 일괄 회수
+	 *   (슬롯의 beginFrame 이후 만들고 매 프레임 다시 할당: 본 팔레트, 인스턴스 행렬, 스키닝 작업 테이블)
+	 * - Host visible 블록은 생성 시 한 번만 매핑하고 유지
 	 */
 	class VulkanMemoryAllocator
 	{
 	public:
-		VulkanMemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice);
+		VulkanMemoryAllocator(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t frameCount);
 		~VulkanMemoryAllocator();
 
-		// 버퍼 메모리 할당
-		VkDeviceMemory allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties);
+		// 버퍼 메모리 할당 후 바인딩
+		bool allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties,
+			RHIAllocationFlags flags, VulkanAllocation& outAllocation);
 
-		// 이미지 메모리 할당
-		VkDeviceMemory allocateImageMemory(VkImage image, VkMemoryPropertyFlags properties);
+		// 이미지 메모리 할당 후 바인딩
+		bool allocateImageMemory(VkImage image, VkImageTiling tiling, VkImageUsageFlags usage,
+			VkMemoryPropertyFlags properties, RHIAllocationFlags flags, VulkanAllocation& outAllocation);
 
-		// 메모리 해제
-		void freeMemory(VkDeviceMemory memory);
+		// 메모리 해제 (선형 풀 할당은 beginFrame()에서 일괄 회수)
+		void freeMemory(VulkanAllocation& allocation);
+
+		// Non-coherent 메모리 플러시 (offset/size는 할당 기준, size 0이면 끝까지)
+		void flush(const VulkanAllocation& allocation, VkDeviceSize offset, VkDeviceSize size);
+
+		// 프레임 슬롯 시작: 해당 슬롯의 선형 풀 회수 (GPU가 그 프레임을 끝낸 뒤 호출)
+		void beginFrame(uint32_t frameIndex);
 
 		// 메모리 타입 찾기
 		uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
@@ -32,21 +76,79 @@ namespace BinRenderer::Vulkan
 		// 통계
 		struct Stats
 		{
-			uint64_t totalAllocated = 0;
+			uint64_t totalAllocated = 0;    // 리소스에 할당한 누적 바이트
 			uint64_t totalFreed = 0;
-			uint32_t allocationCount = 0;
+			uint32_t allocationCount = 0;   // 현재 살아 있는 리소스 할당 수
+			uint32_t deviceMemoryCount = 0; // 현재 살아 있는 VkDeviceMemory 수 (블록 + 전용 + 선형)
+			uint32_t blockCount = 0;
+			uint32_t dedicatedCount = 0;
+			uint64_t blockBytes = 0;        // 블록/선형 풀로 잡아 둔 전체 크기
 		};
 
-		Stats getStats() const { return stats_; }
+		Stats getStats() const;
 		void resetStats();
 
 	private:
+		struct MemoryBlock
+		{
+			VkDeviceMemory memory = VK_NULL_HANDLE;
+			void* mapped = nullptr;
+			TLSFAllocator allocator;
+			uint32_t poolIndex = 0;
+		};
+
+		// 메모리 타입 x 리소스 종류(선형/Optimal)별 블록 목록
+		struct BlockPool
+		{
+			uint32_t memoryTypeIndex = 0;
+			VkDeviceSize blockSize = 0;
+			std::vector<std::unique_ptr<MemoryBlock>> blocks;
+		};
+
+		struct LinearBlock
+		{
+			VkDeviceMemory memory = VK_NULL_HANDLE;
+			VkDeviceSize size = 0;
+			VkDeviceSize used = 0;
+			void* mapped = nullptr;
+		};
+
+		// 프레임 슬롯 x 메모리 타입별 선형 풀
+		struct LinearPool
+		{
+			std::vector<LinearBlock> blocks;
+			uint32_t current = 0;
+		};
+
+		bool allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties,
+			bool optimalImage, bool dedicated, bool transient,
+			VkBuffer dedicatedBuffer, VkImage dedicatedImage, VulkanAllocation& outAllocation);
+		bool allocateFromPool(BlockPool& pool, const VkMemoryRequirements& requirements, VulkanAllocation& outAllocation);
+		bool allocateDedicated(const VkMemoryRequirements& requirements, uint32_t memoryTypeIndex,
+			VkBuffer buffer, VkImage image, VulkanAllocation& outAllocation);
+		bool allocateLinear(const VkMemoryRequirements& requirements, uint32_t memoryTypeIndex, VulkanAllocation& outAllocation);
+
+		void releaseIfEmpty(MemoryBlock* block);
+
+		VkDeviceMemory allocateDeviceMemory(VkDeviceSize& size, uint32_t memoryTypeIndex, const void* pNext, void** outMapped);
+		void freeDeviceMemory(VkDeviceMemory memory);
+
+		VkDeviceSize getAlignment(uint32_t memoryTypeIndex, VkDeviceSize alignment) const;
+		bool isHostVisible(uint32_t memoryTypeIndex) const;
+
 		VkDevice device_;
 		VkPhysicalDevice physicalDevice_;
 		VkPhysicalDeviceMemoryProperties memoryProperties_;
+		VkDeviceSize bufferImageGranularity_ = 1;
+		VkDeviceSize nonCoherentAtomSize_ = 1;
+
+		std::vector<BlockPool> pools_;                        // [memoryType * 2 + optimalImage]
+		std::unordered_map<VkDeviceMemory, VkDeviceSize> dedicated_;  // 종료 시 정리용
+		std::vector<std::vector<LinearPool>> linearPools_;    // [프레임][memoryType]
+		uint32_t currentFrame_ = 0;
 
+		mutable std::mutex mutex_;
 		Stats stats_;
-		std::unordered_map<VkDeviceMemory, VkDeviceSize> allocations_;
 	};
 
 } // namespace BinRenderer::Vulkan
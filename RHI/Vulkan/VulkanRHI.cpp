@@ -16,9 +16,12 @@
 #include <GLFW/glfw3.h>
 #include <cassert>
 #include <algorithm>
+#include <thread>
 
 namespace BinRenderer::Vulkan
 {
+	thread_local VulkanRHI::RecordingContext* VulkanRHI::threadContext_ = nullptr;
+
 	VulkanRHI::~VulkanRHI()
 	{
 		shutdown();
@@ -41,6 +44,10 @@ namespace BinRenderer::Vulkan
 				return false;
 			}
 
+			// 버퍼/이미지 메모리 할당자 (프레임 선형 풀은 프레임 슬롯 수만큼)
+			memoryAllocator_ = std::make_unique<VulkanMemoryAllocator>(
+				context_->getDevice(), context_->getPhysicalDevice(), maxFramesInFlight_);
+
 			//  헤드레스 모드 체크: window가 있을 때만 스왑체인 생성
 			if (requireSwapchain) {
 				printLog("Creating swapchain for window mode...");
@@ -50,19 +57,26 @@ namespace BinRenderer::Vulkan
 				printLog("⚠️  Headless mode: Skipping swapchain creation");
 			}
 
-			// 커맨드 풀 생성
-			commandPool_ = std::make_unique<VulkanCommandPool>(context_->getDevice());
-			if (!commandPool_->create(context_->getGraphicsQueueFamily(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT))
+			// 병렬 기록 컨텍스트 수: 하드웨어 스레드 수 기준 (컨텍스트마다 프레임별 커맨드 풀 생성)
+			maxRecordingContexts_ = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+
+			// 큐별 커맨드 풀/버퍼 및 Timeline 세마포어 생성
+			if (!createQueueContexts())
 			{
 				printLog("Failed to create command pool");
 				return false;
 			}
 
-			// 커맨드 버퍼 할당
-			commandBuffers_ = commandPool_->allocateCommandBuffers(maxFramesInFlight_);
-
 			createSyncObjects();
 
+			// 스테이징 업로드 (실패하면 메시가 Host visible 버퍼로 대체)
+			uploadManager_ = std::make_unique<RHIUploadManager>(this);
+			if (!uploadManager_->initialize())
+			{
+				printLog("⚠️  Failed to initialize upload manager");
+				uploadManager_.reset();
+			}
+
 			printLog(" VulkanRHI initialized successfully ({})", 
 			  requireSwapchain ? "Window Mode" : "Headless Mode");
 			return true;
@@ -80,6 +94,9 @@ namespace BinRenderer::Vulkan
 			context_->waitIdle();
 		}
 
+		// 스테이징 버퍼는 버퍼 풀/메모리 할당자보다 먼저 해제
+		uploadManager_.reset();
+
 		// 동기화 객체 정리
 		VkDevice device = context_ ? context_->getDevice() : VK_NULL_HANDLE;
 		if (device != VK_NULL_HANDLE)
@@ -120,13 +137,15 @@ namespace BinRenderer::Vulkan
 			}
 		}
 
-		// 커맨드 버퍼 및 풀 정리
-		commandBuffers_.clear();
-		commandPool_.reset();
+		// 커맨드 버퍼, 풀 및 Timeline 세마포어 정리
+		destroyQueueContexts();
 
 		// 스왑체인 정리
 		destroySwapchain();
 
+		// 남은 메모리 블록 정리 (아직 파괴되지 않은 리소스의 메모리도 함께 해제)
+		memoryAllocator_.reset();
+
 		// Surface 정리
 		if (surface_ != VK_NULL_HANDLE && context_)
 		{
@@ -182,6 +201,16 @@ namespace BinRenderer::Vulkan
 		//  이 image를 현재 frame의 fence로 마크
 		imagesInFlight_[imageIndex] = inFlightFences_[currentFrameIndex_];
 
+		//  Fence가 이 프레임의 모든 큐 제출을 덮으므로 커맨드 버퍼와 프레임 선형 풀 재사용 가능
+		resetFrameCommandBuffers();
+		memoryAllocator_->beginFrame(currentFrameIndex_);
+
+		//  지난 프레임 동안 모인 업로드를 이 프레임 커맨드보다 먼저 제출하고 끝난 배치/지연 해제 정리
+		if (uploadManager_)
+		{
+			uploadManager_->update();
+		}
+
 		//  imageIndex를 저장 (submitCommands와 endFrame에서 사용)
 		currentImageIndex_ = imageIndex;
 		
@@ -236,7 +265,7 @@ namespace BinRenderer::Vulkan
 
 RHIBufferHandle VulkanRHI::createBuffer(const RHIBufferCreateInfo& createInfo)
 	{
-		auto* vulkanBuffer = new VulkanBuffer(context_->getDevice(), context_->getPhysicalDevice());
+		auto* vulkanBuffer = new VulkanBuffer(context_->getDevice(), memoryAllocator_.get());
 		if (!vulkanBuffer->create(createInfo))
 		{
 			delete vulkanBuffer;
@@ -247,7 +276,7 @@ RHIBufferHandle VulkanRHI::createBuffer(const RHIBufferCreateInfo& createInfo)
 
 	RHIImageHandle VulkanRHI::createImage(const RHIImageCreateInfo& createInfo)
 	{
-		auto* vulkanImage = new VulkanImage(context_->getDevice(), context_->getPhysicalDevice());
+		auto* vulkanImage = new VulkanImage(context_->getDevice(), memoryAllocator_.get());
 		if (!vulkanImage->create(createInfo))
 		{
 			delete vulkanImage;
@@ -312,6 +341,62 @@ RHIBufferHandle VulkanRHI::createBuffer(const RHIBufferCreateInfo& createInfo)
 		return pipelinePool.insert(vulkanPipeline);
 	}
 
+	RHIPipelineHandle VulkanRHI::createComputePipeline(const RHIComputePipelineCreateInfo& createInfo)
+	{
+		RHIShader* shader = shaderPool.get(createInfo.computeShader);
+		if (!shader)
+		{
+			printLog("❌ ERROR: Invalid shader handle in createComputePipeline");
+			return {};
+		}
+
+		std::vector<VkDescriptorSetLayout> vkSetLayouts;
+		vkSetLayouts.reserve(createInfo.descriptorSetLayouts.size());
+		for (const auto& handle : createInfo.descriptorSetLayouts)
+		{
+			RHIDescriptorSetLayout* layout = descriptorSetLayoutPool.get(handle);
+			if (!layout)
+			{
+				printLog("❌ ERROR: Invalid descriptor set layout handle in createComputePipeline");
+				return {};
+			}
+			vkSetLayouts.push_back(static_cast<VulkanDescriptorSetLayout*>(layout)->getVkDescriptorSetLayout());
+		}
+
+		std::vector<VkPushConstantRange> vkRanges;
+		vkRanges.reserve(createInfo.pushConstantRanges.size());
+		for (const auto& range : createInfo.pushConstantRanges)
+		{
+			vkRanges.push_back({ static_cast<VkShaderStageFlags>(range.stageFlags), range.offset, range.size });
+		}
+
+		VkPipelineLayoutCreateInfo layoutInfo{};
+		layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layoutInfo.setLayoutCount = static_cast<uint32_t>(vkSetLayouts.size());
+		layoutInfo.pSetLayouts = vkSetLayouts.data();
+		layoutInfo.pushConstantRangeCount = static_cast<uint32_t>(vkRanges.size());
+		layoutInfo.pPushConstantRanges = vkRanges.data();
+
+		VkPipelineLayout vkLayout = VK_NULL_HANDLE;
+		if (vkCreatePipelineLayout(context_->getDevice(), &layoutInfo, nullptr, &vkLayout) != VK_SUCCESS)
+		{
+			printLog("❌ ERROR: Failed to create compute pipeline layout");
+			return {};
+		}
+
+		auto* layout = new VulkanPipelineLayout(context_->getDevice(), vkLayout);
+		layout->setSetLayoutCount(static_cast<uint32_t>(vkSetLayouts.size()));
+
+		// 레이아웃은 파이프라인이 소유 (파이프라인 파괴 시 함께 해제)
+		auto* vulkanPipeline = new VulkanPipeline(context_->getDevice(), static_cast<VulkanShader*>(shader), layout);
+		if (!vulkanPipeline->isValid())
+		{
+			delete vulkanPipeline;
+			return {};
+		}
+		return pipelinePool.insert(vulkanPipeline);
+	}
+
 	RHIImageViewHandle VulkanRHI::createImageView(RHIImageHandle imageHandle, const RHIImageViewCreateInfo& createInfo)
 	{
 		RHIImage* image = imagePool.get(imageHandle);
@@ -336,7 +421,7 @@ RHIBufferHandle VulkanRHI::createBuffer(const RHIBufferCreateInfo& createInfo)
      else if (createInfo.aspectMask == RHI_IMAGE_ASPECT_STENCIL_BIT)
    aspectFlags = VK_IMAGE_ASPECT_STENCIL_BIT;
 
-if (!imageView->create(viewType, aspectFlags))
+if (!imageView->create(viewType, aspectFlags, createInfo.baseMipLevel, createInfo.levelCount))
  {
       delete imageView;
             return {};
@@ -369,34 +454,58 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::beginCommandRecording()
 	{
+		beginCommandRecording(RHIQueueType::Graphics);
+	}
+
+	void VulkanRHI::beginCommandRecording(RHIQueueType queueType)
+	{
+		QueueContext& queue = getQueueContext(queueType);
+
 		// 커맨드 버퍼 유효성 검사
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!queue.commandPool || currentFrameIndex_ >= queue.frameCommandBuffers.size())
 		{
-			printLog("❌ ERROR: Invalid command buffer index {} (size: {})", 
-				currentFrameIndex_, commandBuffers_.size());
+			printLog("❌ ERROR: Invalid command buffer index {} (size: {})",
+				currentFrameIndex_, queue.frameCommandBuffers.size());
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		// 이 프레임에서 아직 사용하지 않은 커맨드 버퍼 선택 (부족하면 추가 할당)
+		auto& buffers = queue.frameCommandBuffers[currentFrameIndex_];
+		uint32_t& used = queue.usedCommandBuffers[currentFrameIndex_];
+		if (used >= buffers.size())
+		{
+			auto allocated = queue.commandPool->allocateCommandBuffers(1);
+			if (allocated.empty() || !allocated[0])
+			{
+				printLog("❌ ERROR: Failed to allocate command buffer");
+				return;
+			}
+			buffers.push_back(allocated[0]);
+		}
+
+		VulkanCommandBuffer* cmdBuffer = buffers[used++];
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer {} is null", currentFrameIndex_);
 			return;
 		}
 
+		primaryContext_.commandBuffer = cmdBuffer;
+		activeQueue_ = resolveQueue(queueType);
+
 		cmdBuffer->reset();
 		cmdBuffer->begin();
 	}
 
 	void VulkanRHI::endCommandRecording()
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!primaryContext_.commandBuffer)
 		{
 			printLog("❌ ERROR: Invalid command buffer index in endCommandRecording");
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = primaryContext_.commandBuffer;
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer is null in endCommandRecording");
@@ -404,57 +513,436 @@ if (!imageView->create(viewType, aspectFlags))
 		}
 
 		cmdBuffer->end();
+		bindStats_ += cmdBuffer->takeBindStats();
 	}
 
 	void VulkanRHI::submitCommands()
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
-		{
-			printLog("❌ ERROR: Invalid command buffer index in submitCommands");
-			return;
-		}
+		submitCommands(RHIQueueSubmitInfo{});
+	}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+	uint64_t VulkanRHI::submitCommands(const RHIQueueSubmitInfo& submitInfo)
+	{
+		VulkanCommandBuffer* cmdBuffer = primaryContext_.commandBuffer;
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer is null in submitCommands");
-			return;
+			return 0;
 		}
 
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		
-		// ❌ acquire에서 semaphore를 사용하지 않았으므로 wait 불필요
-		submitInfo.waitSemaphoreCount = 0;
-		submitInfo.pWaitSemaphores = nullptr;
-		submitInfo.pWaitDstStageMask = nullptr;
-		
-		// 커맨드 버퍼 설정
-		submitInfo.commandBufferCount = 1;
-		VkCommandBuffer vkCmdBuffer = cmdBuffer->getVkCommandBuffer();
-		submitInfo.pCommandBuffers = &vkCmdBuffer;
-		
-		//  currentImageIndex_로 semaphore 선택 (present에서 사용)
-		VkSemaphore signalSemaphores[] = { renderFinishedSemaphores_[currentImageIndex_] };
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = signalSemaphores;
+		const RHIQueueType queueType = resolveQueue(submitInfo.queue);
+		if (queueType != activeQueue_)
+		{
+			printLog("❌ ERROR: Command buffer was recorded for a different queue");
+			return 0;
+		}
+
+		QueueContext& queue = getQueueContext(queueType);
+		const bool endOfFrame = submitInfo.endOfFrame && queueType == RHIQueueType::Graphics;
 
-		// Fence와 함께 제출
-		VkResult result = vkQueueSubmit(context_->getGraphicsQueue(), 1, &submitInfo, inFlightFences_[currentFrameIndex_]);
+		// 다른 큐의 Timeline 값 대기 (같은 큐는 제출 순서로 보장됨)
+		std::vector<VkSemaphoreSubmitInfo> waitInfos;
+		auto addWait = [&](RHIQueueType srcType, uint64_t value, VkPipelineStageFlags2 stageMask) {
+			QueueContext& src = getQueueContext(srcType);
+			if (&src == &queue || src.timeline == VK_NULL_HANDLE || value == 0)
+			{
+				return;
+			}
+			for (auto& existing : waitInfos)
+			{
+				if (existing.semaphore == src.timeline)
+				{
+					existing.value = std::max(existing.value, value);
+					existing.stageMask |= stageMask;
+					return;
+				}
+			}
+			VkSemaphoreSubmitInfo waitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO };
+			waitInfo.semaphore = src.timeline;
+			waitInfo.value = value;
+			waitInfo.stageMask = stageMask;
+			waitInfos.push_back(waitInfo);
+		};
+
+		for (const auto& wait : submitInfo.waits)
+		{
+			addWait(wait.queue, wait.value, static_cast<VkPipelineStageFlags2>(wait.stageMask));
+		}
+
+		// 프레임 마지막 제출은 다른 큐의 모든 작업을 기다려 Fence 하나로 프레임 전체를 덮음
+		if (endOfFrame)
+		{
+			for (uint32_t i = 0; i < RHI_QUEUE_TYPE_COUNT; ++i)
+			{
+				addWait(static_cast<RHIQueueType>(i), queues_[i].timelineValue, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+			}
+		}
+
+		// Timeline signal (+ 프레임 마지막이면 Present 세마포어)
+		std::vector<VkSemaphoreSubmitInfo> signalInfos;
+		VkSemaphoreSubmitInfo timelineSignal{ VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO };
+		timelineSignal.semaphore = queue.timeline;
+		timelineSignal.value = ++queue.timelineValue;
+		timelineSignal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+		signalInfos.push_back(timelineSignal);
+
+		if (endOfFrame && swapchain_)
+		{
+			//  currentImageIndex_로 semaphore 선택 (present에서 사용)
+			VkSemaphoreSubmitInfo presentSignal{ VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO };
+			presentSignal.semaphore = renderFinishedSemaphores_[currentImageIndex_];
+			presentSignal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+			signalInfos.push_back(presentSignal);
+		}
+
+		VkCommandBufferSubmitInfo commandBufferInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO };
+		commandBufferInfo.commandBuffer = cmdBuffer->getVkCommandBuffer();
+
+		VkSubmitInfo2 vkSubmitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO_2 };
+		vkSubmitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(waitInfos.size());
+		vkSubmitInfo.pWaitSemaphoreInfos = waitInfos.data();
+		vkSubmitInfo.commandBufferInfoCount = 1;
+		vkSubmitInfo.pCommandBufferInfos = &commandBufferInfo;
+		vkSubmitInfo.signalSemaphoreInfoCount = static_cast<uint32_t>(signalInfos.size());
+		vkSubmitInfo.pSignalSemaphoreInfos = signalInfos.data();
+
+		// 프레임 Fence는 beginFrame()에서 리셋되므로 스왑체인이 있을 때만 사용
+		VkFence fence = (endOfFrame && swapchain_) ? inFlightFences_[currentFrameIndex_] : VK_NULL_HANDLE;
+
+		VkResult result = vkQueueSubmit2(queue.queue, 1, &vkSubmitInfo, fence);
 		if (result != VK_SUCCESS)
 		{
 			printLog("❌ ERROR: Failed to submit commands! Error: {}", static_cast<int>(result));
 		}
+
+		queue.frameSubmitValues[currentFrameIndex_] = queue.timelineValue;
+		primaryContext_.commandBuffer = nullptr;
+
+		// 헤드리스 모드는 beginFrame()의 Fence 대기가 없으므로 여기서 완료를 기다린 뒤 커맨드 버퍼 재사용
+		if (endOfFrame && !swapchain_)
+		{
+			VkSemaphoreWaitInfo waitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+			waitInfo.semaphoreCount = 1;
+			waitInfo.pSemaphores = &queue.timeline;
+			waitInfo.pValues = &queue.timelineValue;
+			vkWaitSemaphores(context_->getDevice(), &waitInfo, UINT64_MAX);
+
+			resetFrameCommandBuffers();
+			memoryAllocator_->beginFrame(currentFrameIndex_);
+		}
+
+		return queue.timelineValue;
+	}
+
+	uint64_t VulkanRHI::getCompletedQueueValue(RHIQueueType queueType) const
+	{
+		const QueueContext& queue = queues_[static_cast<uint32_t>(resolveQueue(queueType))];
+		if (queue.timeline == VK_NULL_HANDLE)
+		{
+			return 0;
+		}
+
+		uint64_t value = 0;
+		vkGetSemaphoreCounterValue(context_->getDevice(), queue.timeline, &value);
+		return value;
+	}
+
+	void VulkanRHI::waitQueueValue(RHIQueueType queueType, uint64_t value)
+	{
+		const QueueContext& queue = getQueueContext(queueType);
+		if (queue.timeline == VK_NULL_HANDLE || value == 0)
+		{
+			return;
+		}
+
+		VkSemaphoreWaitInfo waitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+		waitInfo.semaphoreCount = 1;
+		waitInfo.pSemaphores = &queue.timeline;
+		waitInfo.pValues = &value;
+		vkWaitSemaphores(context_->getDevice(), &waitInfo, UINT64_MAX);
+	}
+
+	bool VulkanRHI::hasDedicatedQueue(RHIQueueType queue) const
+	{
+		if (!context_)
+		{
+			return false;
+		}
+
+		switch (queue)
+		{
+		case RHIQueueType::Graphics:
+			return true;
+		case RHIQueueType::Compute:
+			return context_->hasDedicatedComputeQueue();
+		case RHIQueueType::Transfer:
+			return context_->hasDedicatedTransferQueue();
+		default:
+			return false;
+		}
+	}
+
+	bool VulkanRHI::isMultiDrawIndirectSupported() const
+	{
+		return context_ && context_->isMultiDrawIndirectEnabled();
+	}
+
+	bool VulkanRHI::isDrawIndirectCountSupported() const
+	{
+		return context_ && context_->isDrawIndirectCountEnabled();
+	}
+
+	RHIQueueType VulkanRHI::resolveQueue(RHIQueueType queue) const
+	{
+		return hasDedicatedQueue(queue) ? queue : RHIQueueType::Graphics;
+	}
+
+	bool VulkanRHI::createQueueContexts()
+	{
+		VkDevice device = context_->getDevice();
+
+		const VkQueue vkQueues[RHI_QUEUE_TYPE_COUNT] = {
+			context_->getGraphicsQueue(), context_->getComputeQueue(), context_->getTransferQueue()
+		};
+		const uint32_t families[RHI_QUEUE_TYPE_COUNT] = {
+			context_->getGraphicsQueueFamily(), context_->getComputeQueueFamily(), context_->getTransferQueueFamily()
+		};
+
+		for (uint32_t i = 0; i < RHI_QUEUE_TYPE_COUNT; ++i)
+		{
+			QueueContext& queue = queues_[i];
+			queue.queue = vkQueues[i];
+			queue.family = families[i];
+
+			// 전용 패밀리가 없는 큐는 Graphics 컨텍스트로 대체되므로 풀을 만들지 않음
+			if (!hasDedicatedQueue(static_cast<RHIQueueType>(i)))
+			{
+				continue;
+			}
+
+			queue.commandPool = std::make_unique<VulkanCommandPool>(device);
+			if (!queue.commandPool->create(queue.family, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT))
+			{
+				return false;
+			}
+
+			// 커맨드 버퍼 할당 (프레임당 1개로 시작, 필요하면 beginCommandRecording에서 추가)
+			queue.frameCommandBuffers.resize(maxFramesInFlight_);
+			queue.usedCommandBuffers.assign(maxFramesInFlight_, 0);
+			queue.frameSubmitValues.assign(maxFramesInFlight_, 0);
+			queue.workerPools.resize(maxFramesInFlight_);  // 병렬 기록용 풀은 처음 쓸 때 생성
+			for (auto& buffers : queue.frameCommandBuffers)
+			{
+				buffers = queue.commandPool->allocateCommandBuffers(1);
+			}
+
+			VkSemaphoreTypeCreateInfo typeInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
+			typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+			typeInfo.initialValue = 0;
+
+			VkSemaphoreCreateInfo semaphoreInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+			semaphoreInfo.pNext = &typeInfo;
+
+			if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &queue.timeline) != VK_SUCCESS)
+			{
+				return false;
+			}
+			queue.timelineValue = 0;
+		}
+
+		return true;
+	}
+
+	void VulkanRHI::destroyQueueContexts()
+	{
+		VkDevice device = context_ ? context_->getDevice() : VK_NULL_HANDLE;
+
+		for (auto& queue : queues_)
+		{
+			if (queue.timeline != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
+			{
+				vkDestroySemaphore(device, queue.timeline, nullptr);
+			}
+			queue.timeline = VK_NULL_HANDLE;
+			queue.timelineValue = 0;
+			queue.frameCommandBuffers.clear();
+			queue.usedCommandBuffers.clear();
+			queue.frameSubmitValues.clear();
+			queue.workerPools.clear();
+			queue.commandPool.reset();
+		}
+
+		primaryContext_ = {};
+		parallelContexts_.clear();
+	}
+
+	void VulkanRHI::resetFrameCommandBuffers()
+	{
+		for (auto& queue : queues_)
+		{
+			// 프레임 Fence가 덮지 않는 제출 (첫 프레임 전 로딩 중 업로드 등)도 끝난 뒤 재사용
+			if (currentFrameIndex_ < queue.frameSubmitValues.size() && queue.frameSubmitValues[currentFrameIndex_] > 0)
+			{
+				VkSemaphoreWaitInfo waitInfo{ VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+				waitInfo.semaphoreCount = 1;
+				waitInfo.pSemaphores = &queue.timeline;
+				waitInfo.pValues = &queue.frameSubmitValues[currentFrameIndex_];
+				vkWaitSemaphores(context_->getDevice(), &waitInfo, UINT64_MAX);
+			}
+
+			if (currentFrameIndex_ < queue.usedCommandBuffers.size())
+			{
+				queue.usedCommandBuffers[currentFrameIndex_] = 0;
+			}
+
+			// Secondary 커맨드 버퍼는 풀 단위로 한 번에 리셋
+			if (currentFrameIndex_ < queue.workerPools.size())
+			{
+				for (auto& worker : queue.workerPools[currentFrameIndex_])
+				{
+					if (worker.pool && worker.used > 0)
+					{
+						worker.pool->reset();
+					}
+					worker.used = 0;
+				}
+			}
+		}
+	}
+
+	VulkanCommandBuffer* VulkanRHI::acquireSecondaryCommandBuffer(QueueContext& queue, uint32_t contextIndex)
+	{
+		if (currentFrameIndex_ >= queue.workerPools.size())
+		{
+			return nullptr;
+		}
+
+		auto& workers = queue.workerPools[currentFrameIndex_];
+		if (contextIndex >= workers.size())
+		{
+			workers.resize(contextIndex + 1);
+		}
+
+		WorkerCommandPool& worker = workers[contextIndex];
+		if (!worker.pool)
+		{
+			worker.pool = std::make_unique<VulkanCommandPool>(context_->getDevice());
+			if (!worker.pool->create(queue.family, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT))
+			{
+				worker.pool.reset();
+				return nullptr;
+			}
+		}
+
+		// 같은 프레임에 여러 번 병렬 기록할 수 있으므로 풀마다 Secondary 버퍼를 쌓아 두고 재사용
+		if (worker.used >= worker.secondaryBuffers.size())
+		{
+			auto allocated = worker.pool->allocateCommandBuffers(1, RHI_COMMAND_BUFFER_LEVEL_SECONDARY);
+			if (allocated.empty() || !allocated[0])
+			{
+				return nullptr;
+			}
+			worker.secondaryBuffers.push_back(allocated[0]);
+		}
+
+		return worker.secondaryBuffers[worker.used++];
+	}
+
+	bool VulkanRHI::beginParallelRecording(uint32_t contextCount)
+	{
+		if (!primaryContext_.commandBuffer)
+		{
+			printLog("❌ ERROR: beginParallelRecording called without an active command buffer");
+			return false;
+		}
+
+		if (!parallelContexts_.empty())
+		{
+			printLog("❌ ERROR: beginParallelRecording called while parallel recording is already active");
+			return false;
+		}
+
+		contextCount = std::clamp(contextCount, 1u, maxRecordingContexts_);
+		QueueContext& queue = getQueueContext(activeQueue_);
+
+		parallelContexts_.resize(contextCount);
+		for (uint32_t i = 0; i < contextCount; ++i)
+		{
+			VulkanCommandBuffer* cmdBuffer = acquireSecondaryCommandBuffer(queue, i);
+			if (!cmdBuffer)
+			{
+				printLog("❌ ERROR: Failed to allocate secondary command buffer for context {}", i);
+
+				// 이미 시작한 Secondary 버퍼는 실행하지 않고 풀 리셋 때 정리됨
+				for (uint32_t j = 0; j < i; ++j)
+				{
+					parallelContexts_[j].commandBuffer->end();
+				}
+				parallelContexts_.clear();
+				return false;
+			}
+
+			// 시작/종료는 호출 스레드에서 수행하고 작업 스레드는 커맨드만 기록
+			cmdBuffer->beginSecondary();
+			parallelContexts_[i].commandBuffer = cmdBuffer;
+		}
+
+		return true;
+	}
+
+	void VulkanRHI::beginRecordingContext(uint32_t contextIndex)
+	{
+		if (contextIndex >= parallelContexts_.size())
+		{
+			printLog("❌ ERROR: Invalid recording context index {} (count: {})", contextIndex, parallelContexts_.size());
+			return;
+		}
+
+		threadContext_ = &parallelContexts_[contextIndex];
+	}
+
+	void VulkanRHI::endRecordingContext()
+	{
+		threadContext_ = nullptr;
+	}
+
+	void VulkanRHI::endParallelRecording()
+	{
+		if (parallelContexts_.empty())
+		{
+			return;
+		}
+
+		std::vector<VkCommandBuffer> secondaryBuffers;
+		secondaryBuffers.reserve(parallelContexts_.size());
+		for (auto& context : parallelContexts_)
+		{
+			context.commandBuffer->end();
+			bindStats_ += context.commandBuffer->takeBindStats();
+			secondaryBuffers.push_back(context.commandBuffer->getVkCommandBuffer());
+		}
+
+		// 컨텍스트 인덱스 순서 = 실행 순서
+		if (primaryContext_.commandBuffer)
+		{
+			vkCmdExecuteCommands(primaryContext_.commandBuffer->getVkCommandBuffer(),
+				static_cast<uint32_t>(secondaryBuffers.size()), secondaryBuffers.data());
+
+			// Secondary 실행 후 주 커맨드 버퍼의 바인딩 상태는 정의되지 않음
+			primaryContext_.commandBuffer->invalidateBindState();
+		}
+
+		parallelContexts_.clear();
 	}
 
 	void VulkanRHI::cmdBindPipeline(RHIPipelineHandle pipelineHandle)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -469,12 +957,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdBindVertexBuffer(RHIBufferHandle bufferHandle, RHIDeviceSize offset)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -489,12 +977,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdBindIndexBuffer(RHIBufferHandle bufferHandle, RHIDeviceSize offset)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -509,12 +997,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdBindDescriptorSets(RHIPipelineLayout* layout, const RHIDescriptorSetHandle* sets, uint32_t setCount)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -547,13 +1035,13 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdBindDescriptorSets(RHIPipelineHandle pipelineHandle, uint32_t firstSet, const RHIDescriptorSetHandle* sets, uint32_t setCount)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			printLog("❌ ERROR: Invalid command buffer index in cmdBindDescriptorSets");
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer is null in cmdBindDescriptorSets");
@@ -593,27 +1081,24 @@ if (!imageView->create(viewType, aspectFlags))
 			}
 		}
 
-		// Vulkan 커맨드 버퍼에 바인딩
-		VkCommandBuffer vkCmdBuffer = cmdBuffer->getVkCommandBuffer();
-		vkCmdBindDescriptorSets(
-			vkCmdBuffer,
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
+		// Vulkan 커맨드 버퍼에 바인딩 (그래픽스/컴퓨트는 파이프라인 종류를 따름, 이미 바인딩된 세트는 생략)
+		cmdBuffer->bindDescriptorSets(
+			static_cast<VkPipelineBindPoint>(vulkanPipeline->getBindPoint()),
 			vkPipelineLayout,
 			firstSet,
 			setCount,
-			vkDescriptorSets.data(),
-			0, nullptr // dynamic offsets
+			vkDescriptorSets.data()
 		);
 	}
 
 	void VulkanRHI::cmdPushConstants(RHIPipelineLayout* layout, RHIShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -636,12 +1121,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdPushConstants(RHIPipelineHandle pipelineHandle, RHIShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -678,12 +1163,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdSetViewport(const RHIViewport& viewport)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -702,12 +1187,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdSetScissor(const RHIRect2D& scissor)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -722,12 +1207,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -738,12 +1223,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -751,6 +1236,66 @@ if (!imageView->create(viewType, aspectFlags))
 
 		cmdBuffer->drawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 	}
+
+	void VulkanRHI::cmdDrawIndexedIndirect(RHIBufferHandle bufferHandle, RHIDeviceSize offset, uint32_t drawCount, uint32_t stride)
+	{
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
+		if (!cmdBuffer)
+		{
+			return;
+		}
+
+		RHIBuffer* buffer = bufferPool.get(bufferHandle);
+		if (!buffer)
+		{
+			printLog("❌ ERROR: Invalid buffer in cmdDrawIndexedIndirect");
+			return;
+		}
+
+		vkCmdDrawIndexedIndirect(cmdBuffer->getVkCommandBuffer(),
+			static_cast<VulkanBuffer*>(buffer)->getVkBuffer(), offset, drawCount, stride);
+	}
+
+	void VulkanRHI::cmdDrawIndexedIndirectCount(RHIBufferHandle bufferHandle, RHIDeviceSize offset,
+		RHIBufferHandle countBufferHandle, RHIDeviceSize countOffset, uint32_t maxDrawCount, uint32_t stride)
+	{
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
+		if (!cmdBuffer)
+		{
+			return;
+		}
+
+		RHIBuffer* buffer = bufferPool.get(bufferHandle);
+		RHIBuffer* countBuffer = bufferPool.get(countBufferHandle);
+		if (!buffer || !countBuffer)
+		{
+			printLog("❌ ERROR: Invalid buffer in cmdDrawIndexedIndirectCount");
+			return;
+		}
+
+		if (!isDrawIndirectCountSupported())
+		{
+			printLog("❌ ERROR: drawIndirectCount is not enabled on this device");
+			return;
+		}
+
+		vkCmdDrawIndexedIndirectCount(cmdBuffer->getVkCommandBuffer(),
+			static_cast<VulkanBuffer*>(buffer)->getVkBuffer(), offset,
+			static_cast<VulkanBuffer*>(countBuffer)->getVkBuffer(), countOffset,
+			maxDrawCount, stride);
+	}
+
+	void VulkanRHI::cmdDispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+	{
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
+		if (!cmdBuffer)
+		{
+			return;
+		}
+
+		vkCmdDispatch(cmdBuffer->getVkCommandBuffer(), groupCountX, groupCountY, groupCountZ);
+	}
+
     void* VulkanRHI::mapBuffer(RHIBufferHandle bufferHandle)
 	{
         RHIBuffer* buffer = bufferPool.get(bufferHandle);
@@ -931,51 +1476,76 @@ if (!imageView->create(viewType, aspectFlags))
 		return commandBuffer;
 	}
 
-	void VulkanRHI::endSingleTimeCommands(VkCommandBuffer commandBuffer)
+	uint64_t VulkanRHI::endSingleTimeCommands(VkCommandBuffer commandBuffer)
 	{
 		vkEndCommandBuffer(commandBuffer);
 
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &commandBuffer;
+		// vkQueueWaitIdle 대신 Graphics Timeline으로 이 제출만 기다림 (진행 중인 프레임/업로드는 계속 실행)
+		QueueContext& queue = getQueueContext(RHIQueueType::Graphics);
+
+		VkCommandBufferSubmitInfo commandBufferInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO };
+		commandBufferInfo.commandBuffer = commandBuffer;
 
-		vkQueueSubmit(context_->getGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
-		vkQueueWaitIdle(context_->getGraphicsQueue());
+		VkSemaphoreSubmitInfo timelineSignal{ VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO };
+		timelineSignal.semaphore = queue.timeline;
+		timelineSignal.value = ++queue.timelineValue;
+		timelineSignal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+		VkSubmitInfo2 submitInfo{ VK_STRUCTURE_TYPE_SUBMIT_INFO_2 };
+		submitInfo.commandBufferInfoCount = 1;
+		submitInfo.pCommandBufferInfos = &commandBufferInfo;
+		submitInfo.signalSemaphoreInfoCount = 1;
+		submitInfo.pSignalSemaphoreInfos = &timelineSignal;
+
+		vkQueueSubmit2(queue.queue, 1, &submitInfo, VK_NULL_HANDLE);
+		waitQueueValue(RHIQueueType::Graphics, timelineSignal.value);
 
 		vkFreeCommandBuffers(context_->getDevice(), transferCommandPool_, 1, &commandBuffer);
+		return timelineSignal.value;
 	}
 
 	void VulkanRHI::cmdBeginRendering(uint32_t width, uint32_t height, RHIImageViewHandle colorAttachmentHandle, RHIImageViewHandle depthAttachmentHandle)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			printLog("❌ ERROR: Invalid command buffer in cmdBeginRendering");
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer is null in cmdBeginRendering");
 			return;
 		}
 
-		//  Color attachment 검증 및 올바른 캐스팅
-		RHIImageView* colorAttachment = imageViewPool.get(colorAttachmentHandle);
-		if (!colorAttachment)
+		//  Color attachment가 없으면 Depth-only 렌더링 (Depth 프리패스 등, 이때 depth는 저장)
+		const bool depthOnly = !colorAttachmentHandle.isValid();
+		if (depthOnly && !depthAttachmentHandle.isValid())
 		{
-			printLog("❌ ERROR: Color attachment is null in cmdBeginRendering");
+			printLog("❌ ERROR: cmdBeginRendering needs a color or depth attachment");
 			return;
 		}
 
-		auto* vulkanColorImageView = static_cast<VulkanImageView*>(colorAttachment);
-		VkImageView vkColorImageView = vulkanColorImageView->getVkImageView();
-		
-		if (vkColorImageView == VK_NULL_HANDLE)
+		//  Color attachment 검증 및 올바른 캐스팅
+		VkImageView vkColorImageView = VK_NULL_HANDLE;
+		if (!depthOnly)
 		{
-			printLog("❌ ERROR: VkImageView is null");
-			return;
+			RHIImageView* colorAttachment = imageViewPool.get(colorAttachmentHandle);
+			if (!colorAttachment)
+			{
+				printLog("❌ ERROR: Color attachment is null in cmdBeginRendering");
+				return;
+			}
+
+			auto* vulkanColorImageView = static_cast<VulkanImageView*>(colorAttachment);
+			vkColorImageView = vulkanColorImageView->getVkImageView();
+
+			if (vkColorImageView == VK_NULL_HANDLE)
+			{
+				printLog("❌ ERROR: VkImageView is null");
+				return;
+			}
 		}
 
 		VkCommandBuffer vkCmdBuffer = cmdBuffer->getVkCommandBuffer();
@@ -987,13 +1557,21 @@ if (!imageView->create(viewType, aspectFlags))
 			return;
 		}
 
-		//  Swapchain image 가져오기
-		VkImage swapchainImage = swapchain_->getVkImage(currentImageIndex_);
-		VkFormat swapchainFormat = swapchain_->getColorFormat();
+		//  스왑체인에 렌더링할 때만 레이아웃 전환
+		//  (오프스크린 타겟의 전환은 RenderGraph가 cmdPipelineBarrier로 처리)
+		bool& renderingToSwapchain = recordingContext().renderingToSwapchain;
+		renderingToSwapchain = !depthOnly && currentImageIndex_ < swapchainImageViewHandles_.size() &&
+			swapchainImageViewHandles_[currentImageIndex_] == colorAttachmentHandle;
 
-		//  VulkanBarrier를 사용한 레이아웃 전환
-		VulkanBarrier barrier(swapchainImage, swapchainFormat, 1, 1);
-		barrier.transitionToColorAttachment(vkCmdBuffer);
+		if (renderingToSwapchain)
+		{
+			VkImage swapchainImage = swapchain_->getVkImage(currentImageIndex_);
+			VkFormat swapchainFormat = swapchain_->getColorFormat();
+
+			//  VulkanBarrier를 사용한 레이아웃 전환
+			VulkanBarrier barrier(swapchainImage, swapchainFormat, 1, 1);
+			barrier.transitionToColorAttachment(vkCmdBuffer);
+		}
 
 		// Color attachment 설정
 		VkRenderingAttachmentInfo colorAttachmentInfo{};
@@ -1022,7 +1600,7 @@ if (!imageView->create(viewType, aspectFlags))
 					depthAttachmentInfo.imageView = vkDepthImageView;
 					depthAttachmentInfo.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 					depthAttachmentInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-					depthAttachmentInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+					depthAttachmentInfo.storeOp = depthOnly ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
 					depthAttachmentInfo.clearValue.depthStencil = {1.0f, 0};
 				}
 			}
@@ -1034,8 +1612,8 @@ if (!imageView->create(viewType, aspectFlags))
 		renderingInfo.renderArea.offset = {0, 0};
 		renderingInfo.renderArea.extent = {width, height};
 		renderingInfo.layerCount = 1;
-		renderingInfo.colorAttachmentCount = 1;
-		renderingInfo.pColorAttachments = &colorAttachmentInfo;
+		renderingInfo.colorAttachmentCount = depthOnly ? 0 : 1;
+		renderingInfo.pColorAttachments = depthOnly ? nullptr : &colorAttachmentInfo;
 		renderingInfo.pDepthAttachment = (vkDepthImageView != VK_NULL_HANDLE) ? &depthAttachmentInfo : nullptr;
 		renderingInfo.pStencilAttachment = nullptr;
 
@@ -1047,12 +1625,12 @@ if (!imageView->create(viewType, aspectFlags))
 
 	void VulkanRHI::cmdEndRendering()
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			return;
@@ -1063,6 +1641,14 @@ if (!imageView->create(viewType, aspectFlags))
 		// Dynamic rendering 종료
 		vkCmdEndRendering(vkCmdBuffer);
 
+		//  오프스크린 렌더링이었다면 Present 전환 불필요
+		bool& renderingToSwapchain = recordingContext().renderingToSwapchain;
+		if (!renderingToSwapchain)
+		{
+			return;
+		}
+		renderingToSwapchain = false;
+
 		//  Swapchain null check 추가
 		if (!swapchain_)
 		{
@@ -1225,7 +1811,7 @@ if (!imageView->create(viewType, aspectFlags))
 	)
 	{
 		RHIImage* image = imagePool.get(imageHandle);
-		if (!image || commandBuffers_.empty())
+		if (!image || !recordingContext().commandBuffer)
 		{
 			printLog("❌ cmdTransitionImageLayout: Invalid image or no active command buffer");
 			return;
@@ -1237,7 +1823,7 @@ if (!imageView->create(viewType, aspectFlags))
 		VkFormat vkFormat = static_cast<VkFormat>(image->getFormat());
 
 		// 현재 커맨드 버퍼
-		VkCommandBuffer cmdBuffer = commandBuffers_[currentFrameIndex_]->getVkCommandBuffer();
+		VkCommandBuffer cmdBuffer = recordingContext().commandBuffer->getVkCommandBuffer();
 
 		// VulkanBarrier 헬퍼 사용
 		BarrierHelpers::transitionImageLayout(
@@ -1254,6 +1840,155 @@ if (!imageView->create(viewType, aspectFlags))
 			static_cast<int>(oldLayout), static_cast<int>(newLayout));
 	}
 
+	void VulkanRHI::cmdPipelineBarrier(const RHIBarrierBatch& batch)
+	{
+		if (batch.empty())
+		{
+			return;
+		}
+
+		if (!recordingContext().commandBuffer)
+		{
+			printLog("❌ ERROR: Invalid command buffer in cmdPipelineBarrier");
+			return;
+		}
+
+		// 큐 소유권 이전: 패밀리가 다를 때만 Release/Acquire 인덱스 지정
+		auto resolveQueueFamilies = [this](RHIQueueType srcQueue, RHIQueueType dstQueue,
+			uint32_t& srcFamily, uint32_t& dstFamily) {
+			srcFamily = getQueueFamily(srcQueue);
+			dstFamily = getQueueFamily(dstQueue);
+			if (srcFamily == dstFamily)
+			{
+				srcFamily = VK_QUEUE_FAMILY_IGNORED;
+				dstFamily = VK_QUEUE_FAMILY_IGNORED;
+			}
+		};
+
+		std::vector<VkImageMemoryBarrier2> imageBarriers;
+		imageBarriers.reserve(batch.imageBarriers.size());
+
+		for (const auto& rhiBarrier : batch.imageBarriers)
+		{
+			RHIImage* image = imagePool.get(rhiBarrier.image);
+			if (!image)
+			{
+				printLog("❌ ERROR: Invalid image in cmdPipelineBarrier");
+				continue;
+			}
+
+			auto* vulkanImage = static_cast<VulkanImage*>(image);
+			VkFormat vkFormat = static_cast<VkFormat>(image->getFormat());
+
+			VkImageMemoryBarrier2 barrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2 };
+			barrier.srcStageMask = static_cast<VkPipelineStageFlags2>(rhiBarrier.srcStageMask);
+			barrier.dstStageMask = static_cast<VkPipelineStageFlags2>(rhiBarrier.dstStageMask);
+			barrier.srcAccessMask = static_cast<VkAccessFlags2>(rhiBarrier.srcAccessMask);
+			barrier.dstAccessMask = static_cast<VkAccessFlags2>(rhiBarrier.dstAccessMask);
+			barrier.oldLayout = static_cast<VkImageLayout>(rhiBarrier.oldLayout);
+			barrier.newLayout = static_cast<VkImageLayout>(rhiBarrier.newLayout);
+			barrier.image = vulkanImage->getVkImage();
+			barrier.subresourceRange.aspectMask = BarrierHelpers::getImageAspect(vkFormat);
+			barrier.subresourceRange.baseMipLevel = rhiBarrier.baseMipLevel;
+			barrier.subresourceRange.levelCount = rhiBarrier.levelCount;       // UINT32_MAX == VK_REMAINING_MIP_LEVELS
+			barrier.subresourceRange.baseArrayLayer = rhiBarrier.baseArrayLayer;
+			barrier.subresourceRange.layerCount = rhiBarrier.layerCount;       // UINT32_MAX == VK_REMAINING_ARRAY_LAYERS
+			resolveQueueFamilies(rhiBarrier.srcQueue, rhiBarrier.dstQueue,
+				barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex);
+
+			imageBarriers.push_back(barrier);
+		}
+
+		std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+		bufferBarriers.reserve(batch.bufferBarriers.size());
+
+		for (const auto& rhiBarrier : batch.bufferBarriers)
+		{
+			RHIBuffer* buffer = bufferPool.get(rhiBarrier.buffer);
+			if (!buffer)
+			{
+				printLog("❌ ERROR: Invalid buffer in cmdPipelineBarrier");
+				continue;
+			}
+
+			VkBufferMemoryBarrier2 barrier{ VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2 };
+			barrier.srcStageMask = static_cast<VkPipelineStageFlags2>(rhiBarrier.srcStageMask);
+			barrier.dstStageMask = static_cast<VkPipelineStageFlags2>(rhiBarrier.dstStageMask);
+			barrier.srcAccessMask = static_cast<VkAccessFlags2>(rhiBarrier.srcAccessMask);
+			barrier.dstAccessMask = static_cast<VkAccessFlags2>(rhiBarrier.dstAccessMask);
+			barrier.buffer = static_cast<VulkanBuffer*>(buffer)->getVkBuffer();
+			barrier.offset = rhiBarrier.offset;
+			barrier.size = rhiBarrier.size;                                    // ~0 == VK_WHOLE_SIZE
+			resolveQueueFamilies(rhiBarrier.srcQueue, rhiBarrier.dstQueue,
+				barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex);
+
+			bufferBarriers.push_back(barrier);
+		}
+
+		VkCommandBuffer cmdBuffer = recordingContext().commandBuffer->getVkCommandBuffer();
+		BarrierHelpers::pipelineBarriers(cmdBuffer, imageBarriers, bufferBarriers);
+	}
+
+	void VulkanRHI::cmdCopyBuffer(
+		RHIBufferHandle srcBufferHandle,
+		RHIBufferHandle dstBufferHandle,
+		uint32_t regionCount,
+		const RHIBufferCopy* pRegions
+	)
+	{
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
+		if (!cmdBuffer)
+		{
+			printLog("❌ ERROR: Invalid command buffer in cmdCopyBuffer");
+			return;
+		}
+
+		RHIBuffer* srcBuffer = bufferPool.get(srcBufferHandle);
+		RHIBuffer* dstBuffer = bufferPool.get(dstBufferHandle);
+
+		if (!srcBuffer || !dstBuffer)
+		{
+			printLog("❌ ERROR: Invalid buffer in cmdCopyBuffer");
+			return;
+		}
+
+		std::vector<VkBufferCopy> vkRegions(regionCount);
+		for (uint32_t i = 0; i < regionCount; ++i)
+		{
+			vkRegions[i].srcOffset = pRegions[i].srcOffset;
+			vkRegions[i].dstOffset = pRegions[i].dstOffset;
+			vkRegions[i].size = pRegions[i].size;
+		}
+
+		vkCmdCopyBuffer(
+			cmdBuffer->getVkCommandBuffer(),
+			static_cast<VulkanBuffer*>(srcBuffer)->getVkBuffer(),
+			static_cast<VulkanBuffer*>(dstBuffer)->getVkBuffer(),
+			regionCount,
+			vkRegions.data()
+		);
+	}
+
+	void VulkanRHI::cmdFillBuffer(RHIBufferHandle bufferHandle, RHIDeviceSize offset, RHIDeviceSize size, uint32_t data)
+	{
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
+		if (!cmdBuffer)
+		{
+			printLog("❌ ERROR: Invalid command buffer in cmdFillBuffer");
+			return;
+		}
+
+		RHIBuffer* buffer = bufferPool.get(bufferHandle);
+		if (!buffer)
+		{
+			printLog("❌ ERROR: Invalid buffer in cmdFillBuffer");
+			return;
+		}
+
+		vkCmdFillBuffer(cmdBuffer->getVkCommandBuffer(),
+			static_cast<VulkanBuffer*>(buffer)->getVkBuffer(), offset, size, data);
+	}
+
 	void VulkanRHI::cmdCopyBufferToImage(
 		RHIBufferHandle srcBufferHandle,
 		RHIImageHandle dstImageHandle,
@@ -1262,13 +1997,13 @@ if (!imageView->create(viewType, aspectFlags))
 		const RHIBufferImageCopy* pRegions
 	)
 	{
-		if (commandBuffers_.empty() || currentFrameIndex_ >= commandBuffers_.size())
+		if (!recordingContext().commandBuffer)
 		{
 			printLog("❌ ERROR: Invalid command buffer in cmdCopyBufferToImage");
 			return;
 		}
 
-		VulkanCommandBuffer* cmdBuffer = commandBuffers_[currentFrameIndex_];
+		VulkanCommandBuffer* cmdBuffer = recordingContext().commandBuffer;
 		if (!cmdBuffer)
 		{
 			printLog("❌ ERROR: Command buffer is null in cmdCopyBufferToImage");
@@ -7,11 +7,13 @@
 #include "../Commands/RHICommandPool.h"
 #include "../Commands/RHICommandQueue.h"
 #include "../Resources/RHITexture.h"
+#include "../Resources/RHIUploadManager.h"
 
 #include "Core/VulkanContext.h"
 #include "Core/VulkanSwapchain.h"
 #include "Commands/VulkanCommandPool.h"
 #include "Commands/VulkanCommandBuffer.h"
+#include "Utilities/VulkanMemoryAllocator.h"
 
 #include <memory>
 #include <vector>
@@ -47,6 +49,7 @@ namespace BinRenderer::Vulkan
 		RHIImageHandle createImage(const RHIImageCreateInfo& createInfo) override;
 		RHIShaderHandle createShader(const RHIShaderCreateInfo& createInfo) override;
 		RHIPipelineHandle createPipeline(const RHIPipelineCreateInfo& createInfo) override;
+		RHIPipelineHandle createComputePipeline(const RHIComputePipelineCreateInfo& createInfo) override;
 		RHIImageViewHandle createImageView(RHIImageHandle image, const RHIImageViewCreateInfo& createInfo) override;
 		RHISamplerHandle createSampler(const RHISamplerCreateInfo& createInfo) override;
 
@@ -80,6 +83,26 @@ namespace BinRenderer::Vulkan
 		void endCommandRecording() override;
 		void submitCommands() override;
 
+		// 멀티 큐 (Async Compute / 전용 Transfer)
+		bool hasDedicatedQueue(RHIQueueType queue) const override;
+		void beginCommandRecording(RHIQueueType queue) override;
+		uint64_t submitCommands(const RHIQueueSubmitInfo& submitInfo) override;
+		uint64_t getCompletedQueueValue(RHIQueueType queue) const override;
+		void waitQueueValue(RHIQueueType queue, uint64_t value) override;
+		RHIUploadManager* getUploadManager() override { return uploadManager_.get(); }
+
+		bool isMultiDrawIndirectSupported() const override;
+		bool isDrawIndirectCountSupported() const override;
+
+		// 병렬 커맨드 기록
+		uint32_t getMaxRecordingContexts() const override { return maxRecordingContexts_; }
+		bool beginParallelRecording(uint32_t contextCount) override;
+		void beginRecordingContext(uint32_t contextIndex) override;
+		void endRecordingContext() override;
+		void endParallelRecording() override;
+		RHIBindStats getBindStats() const override { return bindStats_; }
+		void resetBindStats() override { bindStats_ = {}; }
+
 		// 드로우 커맨드
 		void cmdBindPipeline(RHIPipelineHandle pipeline) override;
 		void cmdBindVertexBuffer(RHIBufferHandle buffer, RHIDeviceSize offset = 0) override;
@@ -90,6 +113,10 @@ namespace BinRenderer::Vulkan
 		void cmdSetScissor(const RHIRect2D& scissor) override;
 		void cmdDraw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
 		void cmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override;
+		void cmdDrawIndexedIndirect(RHIBufferHandle buffer, RHIDeviceSize offset, uint32_t drawCount, uint32_t stride) override;
+		void cmdDrawIndexedIndirectCount(RHIBufferHandle buffer, RHIDeviceSize offset,
+			RHIBufferHandle countBuffer, RHIDeviceSize countOffset, uint32_t maxDrawCount, uint32_t stride) override;
+		void cmdDispatch(uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1) override;
 
 		//  Descriptor Sets 바인딩 (Pipeline 사용)
 		void cmdBindDescriptorSets(RHIPipelineHandle pipeline, uint32_t firstSet, const RHIDescriptorSetHandle* sets, uint32_t setCount) override;
@@ -113,6 +140,20 @@ namespace BinRenderer::Vulkan
 			uint32_t layerCount = 1
 		) override;
 
+		//  Pipeline Barrier (배치)
+		void cmdPipelineBarrier(const RHIBarrierBatch& batch) override;
+
+		//  Buffer to Buffer Copy
+		void cmdCopyBuffer(
+			RHIBufferHandle srcBuffer,
+			RHIBufferHandle dstBuffer,
+			uint32_t regionCount,
+			const RHIBufferCopy* pRegions
+		) override;
+
+		//  Buffer Fill
+		void cmdFillBuffer(RHIBufferHandle buffer, RHIDeviceSize offset, RHIDeviceSize size, uint32_t data) override;
+
 		//  Buffer to Image Copy
 		void cmdCopyBufferToImage(
 			RHIBufferHandle srcBuffer,
@@ -130,13 +171,16 @@ namespace BinRenderer::Vulkan
 		RHIApiType getApiType() const override { return RHIApiType::Vulkan; }
 
 		// Vulkan-specific public methods
+		VulkanMemoryAllocator* getMemoryAllocator() const { return memoryAllocator_.get(); }
 		VkCommandBuffer beginSingleTimeCommands();
-		void endSingleTimeCommands(VkCommandBuffer commandBuffer);
+		uint64_t endSingleTimeCommands(VkCommandBuffer commandBuffer);  // 이 제출만 완료될 때까지 대기 (Graphics Timeline 값 반환)
 
 	private:
 		RHIInitInfo initInfo_;
 		std::unique_ptr<VulkanContext> context_;
 		std::unique_ptr<VulkanSwapchain> swapchain_;
+		std::unique_ptr<VulkanMemoryAllocator> memoryAllocator_;  // 버퍼/이미지 메모리 서브 할당
+		std::unique_ptr<RHIUploadManager> uploadManager_;         // 스테이징 링 버퍼 업로드
 
 		// 동기화 객체
 		std::vector<VkSemaphore> imageAvailableSemaphores_;
@@ -152,9 +196,47 @@ namespace BinRenderer::Vulkan
 		// 표면
 		VkSurfaceKHR surface_ = VK_NULL_HANDLE;
 
-		// 커맨드 풀 및 버퍼
-		std::unique_ptr<VulkanCommandPool> commandPool_;
-		std::vector<VulkanCommandBuffer*> commandBuffers_;
+		// 병렬 기록 컨텍스트 전용 커맨드 풀 (커맨드 풀은 외부 동기화가 필요하므로 컨텍스트마다 분리)
+		struct WorkerCommandPool
+		{
+			std::unique_ptr<VulkanCommandPool> pool;
+			std::vector<VulkanCommandBuffer*> secondaryBuffers;
+			uint32_t used = 0;  // 이번 프레임에 사용한 Secondary 커맨드 버퍼 수
+		};
+
+		// 큐별 커맨드 풀/버퍼 및 Timeline 세마포어
+		struct QueueContext
+		{
+			VkQueue queue = VK_NULL_HANDLE;
+			uint32_t family = 0;
+			std::unique_ptr<VulkanCommandPool> commandPool;
+			std::vector<std::vector<VulkanCommandBuffer*>> frameCommandBuffers; // [프레임][프레임 내 기록 순서]
+			std::vector<uint32_t> usedCommandBuffers;                           // 프레임별로 사용한 개수
+			VkSemaphore timeline = VK_NULL_HANDLE;
+			uint64_t timelineValue = 0;                                         // 마지막으로 제출한 signal 값
+			std::vector<uint64_t> frameSubmitValues;                            // 프레임별 커맨드 버퍼로 마지막 제출한 signal 값
+			std::vector<std::vector<WorkerCommandPool>> workerPools;            // [프레임][병렬 기록 컨텍스트]
+		};
+		QueueContext queues_[RHI_QUEUE_TYPE_COUNT];
+
+		// cmd* 호출이 기록되는 대상 (커맨드 버퍼 + 그 버퍼의 Dynamic Rendering 상태)
+		struct RecordingContext
+		{
+			VulkanCommandBuffer* commandBuffer = nullptr;
+			bool renderingToSwapchain = false;  // 스왑체인에 렌더링 중인지 (스왑체인일 때만 Present 전환)
+		};
+
+		// 주 커맨드 버퍼 (beginCommandRecording) 와 병렬 기록용 Secondary 커맨드 버퍼들
+		RecordingContext primaryContext_;
+		std::vector<RecordingContext> parallelContexts_;
+		RHIQueueType activeQueue_ = RHIQueueType::Graphics;
+		uint32_t maxRecordingContexts_ = 1;
+		RHIBindStats bindStats_;  // 기록을 마친 커맨드 버퍼들의 바인딩 통계 합계
+
+		// 호출한 스레드가 기록 중인 병렬 컨텍스트 (없으면 주 커맨드 버퍼)
+		static thread_local RecordingContext* threadContext_;
+		RecordingContext& recordingContext() { return threadContext_ ? *threadContext_ : primaryContext_; }
+
 		VkCommandPool transferCommandPool_ = VK_NULL_HANDLE;
 
 		// 리소스 풀
@@ -179,6 +261,13 @@ namespace BinRenderer::Vulkan
 		void createSurface();
 		void createSwapchain();
 		void createTransferCommandPool();
+		bool createQueueContexts();
+		void destroyQueueContexts();
+		void resetFrameCommandBuffers();  // 현재 프레임의 커맨드 버퍼 재사용 준비 (프레임 완료 후 호출)
+		VulkanCommandBuffer* acquireSecondaryCommandBuffer(QueueContext& queue, uint32_t contextIndex);
+		RHIQueueType resolveQueue(RHIQueueType queue) const;  // 전용 큐가 없으면 Graphics
+		QueueContext& getQueueContext(RHIQueueType queue) { return queues_[static_cast<uint32_t>(resolveQueue(queue))]; }
+		uint32_t getQueueFamily(RHIQueueType queue) const { return queues_[static_cast<uint32_t>(resolveQueue(queue))].family; }
 		void destroySwapchain();
 	};
 
@@ -52,9 +52,8 @@ namespace BinRenderer
 		width_ = width;
 		height_ = height;
 
-		// RenderGraph 재구성
-		renderGraph_.reset();
-		renderGraph_ = std::make_unique<RenderGraph>(rhi_);
+		// RenderGraph 재구성 (해상도와 무관한 물리 리소스는 compile()에서 재사용됨)
+		renderGraph_->reset();
 		setupRenderGraph();
 		renderGraph_->compile();
 	}
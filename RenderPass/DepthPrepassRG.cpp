@@ -0,0 +1,233 @@
+﻿#include "DepthPrepassRG.h"
+#include "../Core/Logger.h"
+#include "../Rendering/RHIRenderer.h"
+#include "../Rendering/RHIVertex.h"
+#include <fstream>
+#include <vector>
+
+namespace BinRenderer
+{
+	// 셰이더 파일 읽기 헬퍼 함수
+	static std::vector<uint32_t> readShaderFile(const std::string& filename)
+	{
+		std::ifstream file(filename, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+		{
+			printLog("❌ Failed to open shader file: {}", filename);
+			return {};
+		}
+
+		size_t fileSize = static_cast<size_t>(file.tellg());
+		if (fileSize == 0 || fileSize % 4 != 0)
+		{
+			printLog("❌ Invalid shader file size: {}", filename);
+			return {};
+		}
+
+		file.seekg(0);
+		std::vector<uint32_t> buffer(fileSize / sizeof(uint32_t));
+		file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
+		file.close();
+
+		return buffer;
+	}
+
+	DepthPrepassRG::DepthPrepassRG(RHI* rhi, RHIRenderer* renderer)
+		: RGPass<DepthPrepassData>(rhi, "DepthPrepass")
+		, renderer_(renderer)
+	{
+	}
+
+	DepthPrepassRG::~DepthPrepassRG()
+	{
+		shutdown();
+	}
+
+	bool DepthPrepassRG::initialize()
+	{
+		printLog("[DepthPrepassRG] Initializing...");
+		if (!createPipeline())
+		{
+			destroyPipeline();
+			return false;
+		}
+		printLog("[DepthPrepassRG] Initialized successfully");
+		return true;
+	}
+
+	void DepthPrepassRG::shutdown()
+	{
+		destroyPipeline();
+	}
+
+	void DepthPrepassRG::setup(DepthPrepassData& data, RenderGraphBuilder& builder)
+	{
+		// Early 컬링이 쓴 Indirect 인자 (컴퓨트 쓰기 → Indirect 읽기 배리어는 그래프가 생성)
+		data.commandsIn = builder.readBuffer(commandsHandle_, RGResourceUsage::IndirectBuffer);
+		data.drawCountIn = builder.readBuffer(drawCountHandle_, RGResourceUsage::IndirectBuffer);
+
+		RHIHiZPyramid* pyramid = renderer_ ? renderer_->getHiZPyramid() : nullptr;
+		if (!pyramid)
+		{
+			return;
+		}
+
+		RGTextureDesc depthDesc;
+		depthDesc.name = "Occlusion_Depth";
+		depthDesc.width = pyramid->getWidth();
+		depthDesc.height = pyramid->getHeight();
+		depthDesc.format = pyramid->getDepthFormat();
+		depthDesc.usage = RHI_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RHI_IMAGE_USAGE_SAMPLED_BIT;
+
+		// 매 프레임 Clear하므로 이전 내용은 필요 없음
+		data.depthOut = builder.importTexture(depthDesc.name, pyramid->getDepthImage(), depthDesc);
+		builder.writeTexture(data.depthOut, RGResourceUsage::DepthStencilAttachment);
+	}
+
+	void DepthPrepassRG::execute(const DepthPrepassData& data, RHI* rhi, uint32_t frameIndex)
+	{
+		RHIHiZPyramid* pyramid = renderer_ ? renderer_->getHiZPyramid() : nullptr;
+		if (!pyramid || !pipeline_.isValid())
+		{
+			return;
+		}
+
+		const uint32_t width = pyramid->getWidth();
+		const uint32_t height = pyramid->getHeight();
+
+		// 그릴 것이 없어도 Clear는 해야 Hi-Z가 "가림막 없음"(1.0)이 됨
+		rhi->cmdBeginRendering(width, height, {}, pyramid->getDepthView());
+
+		RHIViewport viewport{};
+		viewport.x = 0.0f;
+		viewport.y = 0.0f;
+		viewport.width = static_cast<float>(width);
+		viewport.height = static_cast<float>(height);
+		viewport.minDepth = 0.0f;
+		viewport.maxDepth = 1.0f;
+		rhi->cmdSetViewport(viewport);
+
+		RHIRect2D scissor{};
+		scissor.offset = {0, 0};
+		scissor.extent = {width, height};
+		rhi->cmdSetScissor(scissor);
+
+		RHIGpuCuller* culler = renderer_->getGpuCuller();
+		if (renderer_->isGpuDrivenRendering() && culler && culler->isOcclusionEnabled())
+		{
+			const RHIDescriptorSetHandle drawSet = culler->getDrawDescriptorSet();
+			const glm::mat4& viewProjection = renderer_->getViewProjection();
+
+			rhi->cmdBindPipeline(pipeline_);
+			rhi->cmdBindDescriptorSets(pipeline_, 0, &drawSet, 1);
+			rhi->cmdPushConstants(pipeline_, RHI_SHADER_STAGE_VERTEX_BIT, 0, sizeof(glm::mat4), &viewProjection);
+
+			culler->recordDraws(RHIGpuCuller::Phase::Early);
+		}
+
+		rhi->cmdEndRendering();
+	}
+
+	bool DepthPrepassRG::createPipeline()
+	{
+		RHIGpuCuller* culler = renderer_ ? renderer_->getGpuCuller() : nullptr;
+		RHIHiZPyramid* pyramid = renderer_ ? renderer_->getHiZPyramid() : nullptr;
+		if (!culler || !pyramid)
+		{
+			return false;
+		}
+
+		auto vertCode = readShaderFile("../../assets/shaders/depthPrepass.vert.spv");
+		if (vertCode.empty())
+		{
+			printLog("[DepthPrepassRG] ⚠️  depthPrepass.vert.spv not found, occlusion culling disabled");
+			return false;
+		}
+
+		RHIShaderCreateInfo vertShaderInfo{};
+		vertShaderInfo.stage = RHI_SHADER_STAGE_VERTEX_BIT;
+		vertShaderInfo.name = "depthPrepass.vert";
+		vertShaderInfo.entryPoint = "main";
+		vertShaderInfo.code = std::move(vertCode);
+
+		vertexShader_ = rhi_->createShader(vertShaderInfo);
+		if (!vertexShader_.isValid())
+		{
+			printLog("[DepthPrepassRG] ❌ Failed to create vertex shader");
+			return false;
+		}
+
+		RHIPipelineCreateInfo pipelineInfo{};
+
+		// Depth-only Dynamic Rendering
+		pipelineInfo.useDynamicRendering = true;
+		pipelineInfo.depthAttachmentFormat = pyramid->getDepthFormat();
+
+		pipelineInfo.shaderStages.push_back(vertexShader_);
+
+		// Set 0: 드로우 레코드 (모델 행렬은 gl_InstanceIndex로 읽음)
+		pipelineInfo.descriptorSetLayouts.push_back(culler->getDrawDescriptorLayout());
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(glm::mat4); // viewProjection
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		// 합친 정점 버퍼와 같은 stride, 위치(location 0)만 읽음
+		pipelineInfo.vertexInputState.bindings.push_back(RHIVertexHelper::getVertexBinding());
+		pipelineInfo.vertexInputState.attributes.push_back(RHIVertexHelper::getVertexAttributesBasic()[0]);
+
+		pipelineInfo.enableInstancing = false;
+
+		pipelineInfo.inputAssemblyState.topology = RHI_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipelineInfo.inputAssemblyState.primitiveRestartEnable = false;
+
+		pipelineInfo.viewportState.viewportCount = 1;
+		pipelineInfo.viewportState.scissorCount = 1;
+
+		// 양면 모두 그려야 뒤집힌 가림막도 깊이를 남김 (CPU 래스터라이저와 같은 규칙)
+		pipelineInfo.rasterizationState.depthClampEnable = false;
+		pipelineInfo.rasterizationState.rasterizerDiscardEnable = false;
+		pipelineInfo.rasterizationState.polygonMode = RHI_POLYGON_MODE_FILL;
+		pipelineInfo.rasterizationState.cullMode = RHI_CULL_MODE_NONE;
+		pipelineInfo.rasterizationState.frontFace = RHI_FRONT_FACE_COUNTER_CLOCKWISE;
+		pipelineInfo.rasterizationState.depthBiasEnable = false;
+		pipelineInfo.rasterizationState.lineWidth = 1.0f;
+
+		pipelineInfo.multisampleState.rasterizationSamples = RHI_SAMPLE_COUNT_1_BIT;
+		pipelineInfo.multisampleState.sampleShadingEnable = false;
+
+		pipelineInfo.depthStencilState.depthTestEnable = true;
+		pipelineInfo.depthStencilState.depthWriteEnable = true;
+		pipelineInfo.depthStencilState.depthCompareOp = RHI_COMPARE_OP_LESS;
+		pipelineInfo.depthStencilState.stencilTestEnable = false;
+
+		pipelineInfo.dynamicStates.push_back(RHI_DYNAMIC_STATE_VIEWPORT);
+		pipelineInfo.dynamicStates.push_back(RHI_DYNAMIC_STATE_SCISSOR);
+
+		pipeline_ = rhi_->createPipeline(pipelineInfo);
+		if (!pipeline_.isValid())
+		{
+			printLog("[DepthPrepassRG] ❌ Failed to create pipeline");
+			return false;
+		}
+
+		printLog("[DepthPrepassRG]  Pipeline created ({}x{} depth)", pyramid->getWidth(), pyramid->getHeight());
+		return true;
+	}
+
+	void DepthPrepassRG::destroyPipeline()
+	{
+		if (pipeline_.isValid()) {
+			rhi_->destroyPipeline(pipeline_);
+			pipeline_ = {};
+		}
+
+		if (vertexShader_.isValid()) {
+			rhi_->destroyShader(vertexShader_);
+			vertexShader_ = {};
+		}
+	}
+
+} // namespace BinRenderer
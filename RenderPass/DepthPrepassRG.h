@@ -0,0 +1,74 @@
+﻿#pragma once
+
+#include "RGPassBase.h"
+
+namespace BinRenderer
+{
+	// Forward declarations
+	class RHIRenderer;
+
+	/**
+	 * @brief Depth Prepass 데이터
+	 */
+	struct DepthPrepassData
+	{
+		// 입력
+		RGBufferHandle commandsIn;   // Early Indirect 커맨드 (GpuCullingPassRG Early)
+		RGBufferHandle drawCountIn;  // Early 드로우 수
+
+		// 출력
+		RGTextureHandle depthOut;  // 가림막 깊이 (RHIHiZPyramid 소유, 임포트)
+	};
+
+	/**
+	 * @brief Depth Prepass (가림막 컬링용 Depth-only 렌더링)
+	 * 
+	 * @features
+	 * - GpuCullingPassRG(Early)가 만든 목록 = 지난 프레임에 보였던 정적 메시를 Indirect로 드로우
+	 * - 위치 속성만 읽는 정점 셰이더, Fragment 셰이더 없음
+	 * 
+	 * @inputs
+	 * - RHIGpuCuller의 Early Indirect 커맨드
+	 * 
+	 * @outputs
+	 * - Occlusion Depth (렌더러 해상도, D32_SFLOAT) → HiZPassRG
+	 */
+	class DepthPrepassRG : public RGPass<DepthPrepassData>
+	{
+	public:
+		DepthPrepassRG(RHI* rhi, RHIRenderer* renderer);
+		~DepthPrepassRG() override;
+
+		// RGPass 인터페이스
+		void setup(DepthPrepassData& data, RenderGraphBuilder& builder) override;
+		void execute(const DepthPrepassData& data, RHI* rhi, uint32_t frameIndex) override;
+
+		// 기존 API 호환 (셰이더나 Hi-Z 피라미드가 없으면 false)
+		bool initialize() override;
+		void shutdown() override;
+
+		// 입력 핸들 설정 (Early 컬링 패스 출력, setup 전에 호출)
+		void setDrawCommandHandles(RGBufferHandle commands, RGBufferHandle drawCount)
+		{
+			commandsHandle_ = commands;
+			drawCountHandle_ = drawCount;
+		}
+
+		// 출력 핸들
+		RGTextureHandle getDepthHandle() const { return getData().depthOut; }
+
+	private:
+		RHIRenderer* renderer_ = nullptr;
+
+		// 입력 핸들
+		RGBufferHandle commandsHandle_;
+		RGBufferHandle drawCountHandle_;
+
+		RHIPipelineHandle pipeline_;
+		RHIShaderHandle vertexShader_;
+
+		bool createPipeline();
+		void destroyPipeline();
+	};
+
+} // namespace BinRenderer
@@ -40,11 +40,19 @@ namespace BinRenderer
 		return buffer;
 	}
 
+	static const char* kSkinnedVertexShaderPath = "../../assets/shaders/pbrForwardSkinned.vert.spv";
+	static const char* kLegacyVertexShaderPath = "../../assets/shaders/pbrForward.vert.spv";
+
+	// pbrForward.vert의 BoneDataUBO (대체 경로에서 0으로 채워 스키닝하지 않음)
+	static constexpr RHIDeviceSize kLegacyBoneUniformSize = sizeof(glm::mat4) * 65 + sizeof(glm::vec4);
+
 	ForwardPassRG::ForwardPassRG(RHI* rhi, RHIScene* scene, RHIRenderer* renderer)
 		: RGPass<ForwardPassData>(rhi, "ForwardPass")
 		, scene_(scene)
 		, renderer_(renderer)
 	{
+		// 스왑체인에 직접 렌더링하므로 최종 출력과 연결되지 않아도 Culling하지 않음
+		setSideEffect(true);
 	}
 
 	ForwardPassRG::~ForwardPassRG()
@@ -55,6 +63,15 @@ namespace BinRenderer
 	bool ForwardPassRG::initialize()
 	{
 		printLog("[ForwardPassRG] Initializing...");
+
+		// 0. 본 팔레트 정점 셰이더가 아직 컴파일되지 않았으면 본 UBO를 쓰는 pbrForward.vert로 대체
+		//    (Set 0 Binding 2 타입이 달라지므로 Descriptor Set보다 먼저 결정)
+		legacyBoneUniform_ = readShaderFile(kSkinnedVertexShaderPath).empty();
+		if (legacyBoneUniform_)
+		{
+			printLog("[ForwardPassRG] ⚠️  pbrForwardSkinned.vert.spv not found, falling back to pbrForward.vert "
+				"(no bone palettes: skinned meshes draw in bind pose, indirect/instanced draws disabled)");
+		}
 		
 		// 1. Dummy Resources 생성 (Descriptor Sets보다 먼저)
 		createDummyResources();
@@ -91,6 +108,14 @@ namespace BinRenderer
 
 		data.forwardOut = builder.createTexture(forwardDesc);
 		builder.writeTexture(data.forwardOut);
+
+		// GPU-driven: 컬링 패스가 쓴 Indirect 인자 (컴퓨트 쓰기 → Indirect 읽기 배리어는 그래프가 생성)
+		data.drawCommandsIn = builder.readBuffer(drawCommandsHandle_, RGResourceUsage::IndirectBuffer);
+		data.drawCountIn = builder.readBuffer(drawCountHandle_, RGResourceUsage::IndirectBuffer);
+		data.clusterIndicesIn = builder.readBuffer(clusterIndicesHandle_, RGResourceUsage::IndexBuffer);
+
+		// 프리스키닝: 컴퓨트가 쓴 스킨드 정점을 정점 셰이더가 읽음 (Set 0 Binding 3)
+		data.skinnedVerticesIn = builder.readBuffer(skinnedVerticesHandle_, RGResourceUsage::ShaderRead);
 		
 		printLog("[ForwardPassRG] Setup complete - Output texture created");
 	}
@@ -113,8 +138,7 @@ namespace BinRenderer
 			}
 		}
 
-		// 커맨드 버퍼 기록 시작
-		rhi->beginCommandRecording();
+		// 커맨드 기록 시작/제출과 오프스크린 리소스 배리어는 RenderGraph가 담당
 		
 		// ========================================
 		// Pass 책임: Render Target 및 상태 설정
@@ -125,8 +149,6 @@ namespace BinRenderer
 		if (!swapchain)
 		{
 			printLog("[ForwardPassRG] ❌ Swapchain is null!");
-			rhi->endCommandRecording();
-			rhi->submitCommands();
 			return;
 		}
 
@@ -135,11 +157,9 @@ namespace BinRenderer
 		
 		//  RHIImageView 가져오기 (이제 제대로 구현됨!)
 		RHIImageViewHandle swapchainImageView = swapchain->getImageView(imageIndex);
-		if (swapchainImageView.isValid())
+		if (!swapchainImageView.isValid())
 		{
 			printLog("[ForwardPassRG] ❌ Swapchain image view is null! (index: {})", imageIndex);
-			rhi->endCommandRecording();
-			rhi->submitCommands();
 			return;
 		}
 
@@ -185,6 +205,7 @@ namespace BinRenderer
 		if (!sceneDescriptorSets_.empty() && pipeline_.isValid())
 		{
 			uint32_t currentFrame = frameIndex % sceneDescriptorSets_.size();
+			updateDescriptorSets(currentFrame);
 			
 			//  모든 Descriptor Sets 바인딩 (Set 0, 1, 2, 3)
 			std::vector<RHIDescriptorSetHandle> allSets;
@@ -209,7 +230,40 @@ namespace BinRenderer
 		// Renderer 책임: 실제 렌더링 로직
 		// ========================================
 		
-		if (scene_ && renderer_ && pipeline_.isValid())
+		if (scene_ && renderer_ && renderer_->isGpuDrivenRendering() && indirectPipeline_.isValid())
+		{
+			// GPU-driven: 컬링 패스가 만든 Indirect 커맨드로 전체 메시를 한 번에 드로우
+			RHIGpuCuller* culler = renderer_->getGpuCuller();
+
+			rhi->cmdBindPipeline(indirectPipeline_);
+
+			std::vector<RHIDescriptorSetHandle> allSets;
+			allSets.push_back(sceneDescriptorSets_[frameIndex % sceneDescriptorSets_.size()]); // Set 0
+			allSets.push_back(materialDescriptorSet_); // Set 1
+			allSets.push_back(iblDescriptorSet_);      // Set 2
+			allSets.push_back(shadowDescriptorSet_);   // Set 3
+			allSets.push_back(culler->getDrawDescriptorSet()); // Set 4: 드로우 레코드
+			rhi->cmdBindDescriptorSets(indirectPipeline_, 0, allSets.data(), static_cast<uint32_t>(allSets.size()));
+
+			// 모델 행렬, 머티리얼, 본 팔레트 오프셋, 스킨드 정점 위치는 레코드에서 읽으므로 push constants는 한 번만
+			PbrPushConstants pushConstants{};
+
+			rhi->cmdPushConstants(
+				indirectPipeline_,
+				RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT,
+				0,
+				sizeof(PbrPushConstants),
+				&pushConstants
+			);
+
+			culler->recordDraws();
+
+			if (frameIndex % 60 == 0)
+			{
+				printLog("[ForwardPassRG]   - {} mesh records drawn with indirect draw", culler->getRecordCount());
+			}
+		}
+		else if (scene_ && renderer_ && pipeline_.isValid())
 		{
 			//  View와 Projection 행렬 가져오기
 			auto& camera = scene_->getCamera();
@@ -233,52 +287,100 @@ namespace BinRenderer
 				printLog("  Proj[1][1]: {:.2f}", projection[1][1]);
 			}
 
-			//  Scene Nodes 순회 (transform 포함)
-			const auto& nodes = scene_->getNodes();
-			
-			for (const auto& node : nodes)
-			{
-				if (!node.model || !node.visible)
-					continue;
+			//  컬링을 통과한 메시를 파이프라인/머티리얼/깊이 순으로 정렬 (불투명은 앞→뒤, 반투명은 뒤→앞)
+			renderer_->buildRenderQueue(*scene_, pipeline_, 0, renderQueue_);
 
-				//  Model matrix 계산: NodeTransform * ModelTransform
-				glm::mat4 modelMatrix = node.transform * node.model->getTransform();
-				
-				//  PBR Push Constants 구조체
-				struct PushConstants {
-					glm::mat4 model;
-					uint32_t materialIndex;
-					float coeffs[15];
-				} pushConstants;
-				
-				pushConstants.model = modelMatrix;
-				pushConstants.materialIndex = 0; // TODO: 실제 material index
-				// coeffs는 0으로 초기화됨
-				
-				//  Push constants 전달 (model + materialIndex + coeffs)
-				rhi->cmdPushConstants(
-					pipeline_,
-					RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT,
-					0,
-					sizeof(PushConstants),
-					&pushConstants
-				);
-
-				//  각 메시 렌더링
-				for (const auto& meshPtr : node.model->getMeshes())
+			//  자동 인스턴싱: 같은 메시를 쓰는 노드를 묶어 인스턴스 드로우 한 번으로 (스킨드 노드도 인스턴스별 팔레트 오프셋)
+			RHIInstanceBatcher* batcher = renderer_->getInstanceBatcher();
+			RHISkinningCache* skinning = renderer_->isPreSkinningEnabled() ? renderer_->getSkinningCache() : nullptr;
+			if (instancedPipeline_.isValid() && batcher && batcher->build(*scene_, renderQueue_, renderer_->getBonePaletteArena(), skinning))
+			{
+				rhi->cmdBindPipeline(instancedPipeline_);
+
+				std::vector<RHIDescriptorSetHandle> allSets;
+				allSets.push_back(sceneDescriptorSets_[frameIndex % sceneDescriptorSets_.size()]); // Set 0
+				allSets.push_back(materialDescriptorSet_); // Set 1
+				allSets.push_back(iblDescriptorSet_);      // Set 2
+				allSets.push_back(shadowDescriptorSet_);   // Set 3
+				allSets.push_back(batcher->getDescriptorSet()); // Set 4: 인스턴스 행렬
+				rhi->cmdBindDescriptorSets(instancedPipeline_, 0, allSets.data(), static_cast<uint32_t>(allSets.size()));
+
+				// 모델 행렬, 본 팔레트 오프셋, 스킨드 정점 위치는 인스턴스 버퍼에서 읽으므로 push constants는 머티리얼이 바뀔 때만
+				PbrPushConstants pushConstants{};
+				uint32_t lastMaterial = UINT32_MAX;
+				for (const auto& batch : batcher->getBatches())
 				{
-					if (!meshPtr)
-						continue;
+					const uint32_t materialIndex = renderer_->getMaterialIndex(batch.model, batch.mesh->getMaterialIndex());
+					if (materialIndex != lastMaterial)
+					{
+						lastMaterial = materialIndex;
+						pushConstants.materialIndex = materialIndex;
+
+						rhi->cmdPushConstants(
+							instancedPipeline_,
+							RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT,
+							0,
+							sizeof(PbrPushConstants),
+							&pushConstants
+						);
+					}
+
+					batch.mesh->bind(rhi);
+					batch.mesh->draw(rhi, batch.instanceCount, batch.firstInstance);
+				}
 
-					// RHIMesh의 bind와 draw 메서드 사용
-					meshPtr->bind(rhi);
-					meshPtr->draw(rhi, 1);
+				if (frameIndex % 60 == 0)
+				{
+					printLog("[ForwardPassRG]   - {} sorted meshes rendered with {} instanced draws",
+						batcher->getInstanceCount(), batcher->getBatches().size());
 				}
 			}
-			
-			if (frameIndex % 60 == 0)
+			else
 			{
-				printLog("[ForwardPassRG]   - {} scene nodes rendered with PBR", nodes.size());
+				const auto& nodes = scene_->getNodes();
+				uint32_t lastNode = UINT32_MAX;
+				uint32_t lastSkinnedVertexBase = RHISkinningCache::kNoCache;
+				uint32_t lastMaterial = UINT32_MAX;
+				for (const auto& item : renderQueue_.getItems())
+				{
+					const auto& node = nodes[item.nodeIndex];
+					const auto& meshPtr = node.model->getMeshes()[item.meshIndex];
+					const uint32_t skinnedVertexBase = renderer_->getSkinnedVertexBase(item.nodeIndex, item.meshIndex);
+					const uint32_t materialIndex = renderer_->getMaterialIndex(node.model.get(), meshPtr->getMaterialIndex());
+
+					//  정렬 후에는 같은 노드의 메시가 흩어질 수 있으므로 노드나 머티리얼이 바뀔 때마다 push
+					//  (프리스키닝된 노드는 캐시 위치가 메시마다 달라 메시마다 push)
+					if (item.nodeIndex != lastNode || skinnedVertexBase != lastSkinnedVertexBase || materialIndex != lastMaterial)
+					{
+						lastNode = item.nodeIndex;
+						lastSkinnedVertexBase = skinnedVertexBase;
+						lastMaterial = materialIndex;
+
+						//  Model matrix 계산: NodeTransform * ModelTransform
+						PbrPushConstants pushConstants{};
+						pushConstants.model = node.transform * node.model->getTransform();
+						pushConstants.materialIndex = materialIndex;
+						pushConstants.skinnedVertexBase = skinnedVertexBase;
+						pushConstants.boneOffset = renderer_->getBoneOffset(item.nodeIndex);
+
+						rhi->cmdPushConstants(
+							pipeline_,
+							RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT,
+							0,
+							sizeof(PbrPushConstants),
+							&pushConstants
+						);
+					}
+
+					// 같은 정점/인덱스 버퍼 재바인딩은 커맨드 버퍼의 바인딩 캐시가 생략
+					meshPtr->bind(rhi);
+					meshPtr->draw(rhi, 1);
+				}
+				
+				if (frameIndex % 60 == 0)
+				{
+					printLog("[ForwardPassRG]   - {} scene nodes, {} sorted meshes rendered with PBR", nodes.size(), renderQueue_.size());
+				}
 			}
 		}
 
@@ -289,18 +391,14 @@ namespace BinRenderer
 		{
 			printLog("[ForwardPassRG]   - Rendering commands recorded");
 		}
-		
-		// 커맨드 버퍼 기록 종료 및 제출
-		rhi->endCommandRecording();
-		rhi->submitCommands();
 	}
 
 	void ForwardPassRG::createPipeline()
 	{
 		printLog("[ForwardPassRG] Creating PBR pipeline...");
 
-		//  PBR 셰이더 사용
-		auto vertCode = readShaderFile("../../assets/shaders/pbrForward.vert.spv");
+		//  PBR 셰이더 사용 (본 팔레트 SSBO로 스키닝하는 RHI 경로 전용 정점 셰이더, 없으면 기본 정점 셰이더)
+		auto vertCode = readShaderFile(legacyBoneUniform_ ? kLegacyVertexShaderPath : kSkinnedVertexShaderPath);
 		if (vertCode.empty())
 		{
 			printLog("[ForwardPassRG] ❌ Failed to read PBR vertex shader file");
@@ -309,7 +407,7 @@ namespace BinRenderer
 
 		RHIShaderCreateInfo vertShaderInfo{};
 		vertShaderInfo.stage = RHI_SHADER_STAGE_VERTEX_BIT;
-		vertShaderInfo.name = "pbrForward.vert";
+		vertShaderInfo.name = legacyBoneUniform_ ? "pbrForward.vert" : "pbrForwardSkinned.vert";
 		vertShaderInfo.entryPoint = "main";
 		vertShaderInfo.code = std::move(vertCode);
 
@@ -376,11 +474,11 @@ namespace BinRenderer
 		printLog("[ForwardPassRG]   - Pipeline will use {} descriptor set layouts", 
 			pipelineInfo.descriptorSetLayouts.size());
 
-		//  PBR 셰이더용 Push constants (model matrix + materialIndex + coeffs)
+		//  PBR 셰이더용 Push constants (model matrix + materialIndex + coeffs + skinnedVertexBase + boneOffset)
 		RHIPushConstantRange pushConstantRange{};
 		pushConstantRange.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT;
 		pushConstantRange.offset = 0;
-		pushConstantRange.size = sizeof(glm::mat4) + sizeof(uint32_t) + sizeof(float) * 15; // 128 bytes
+		pushConstantRange.size = sizeof(PbrPushConstants); // 128 bytes
 		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
 
 		//  Vertex Input State - RHIVertexHelper 사용 (half precision 지원)
@@ -445,10 +543,123 @@ namespace BinRenderer
 		}
 
 		printLog("[ForwardPassRG]  Pipeline created successfully");
+
+		// Indirect/인스턴스 정점 셰이더는 Binding 2를 본 팔레트 SSBO로 선언하므로 대체 레이아웃과 호환되지 않음
+		if (!legacyBoneUniform_)
+		{
+			createIndirectPipeline(pipelineInfo);
+			createInstancedPipeline(pipelineInfo);
+		}
+	}
+
+	void ForwardPassRG::createIndirectPipeline(const RHIPipelineCreateInfo& baseInfo)
+	{
+		RHIGpuCuller* culler = renderer_ ? renderer_->getGpuCuller() : nullptr;
+		if (!culler || baseInfo.descriptorSetLayouts.size() != 4)
+		{
+			return;
+		}
+
+		auto vertCode = readShaderFile("../../assets/shaders/pbrForwardIndirect.vert.spv");
+		if (vertCode.empty())
+		{
+			printLog("[ForwardPassRG] ⚠️  Indirect vertex shader not found, using per-mesh draws");
+			return;
+		}
+
+		RHIShaderCreateInfo vertShaderInfo{};
+		vertShaderInfo.stage = RHI_SHADER_STAGE_VERTEX_BIT;
+		vertShaderInfo.name = "pbrForwardIndirect.vert";
+		vertShaderInfo.entryPoint = "main";
+		vertShaderInfo.code = std::move(vertCode);
+
+		indirectVertexShader_ = rhi_->createShader(vertShaderInfo);
+		if (!indirectVertexShader_.isValid())
+		{
+			printLog("[ForwardPassRG] ❌ Failed to create indirect vertex shader");
+			return;
+		}
+
+		// 정점 셰이더와 Set 4만 다르고 나머지 상태는 기본 파이프라인과 동일
+		RHIPipelineCreateInfo pipelineInfo = baseInfo;
+		pipelineInfo.shaderStages = { indirectVertexShader_, fragmentShader_ };
+		pipelineInfo.descriptorSetLayouts.push_back(culler->getDrawDescriptorLayout());
+
+		indirectPipeline_ = rhi_->createPipeline(pipelineInfo);
+		if (!indirectPipeline_.isValid())
+		{
+			printLog("[ForwardPassRG] ❌ Failed to create indirect pipeline");
+			return;
+		}
+
+		printLog("[ForwardPassRG]  Indirect pipeline created (GPU-driven culling)");
+	}
+
+	void ForwardPassRG::createInstancedPipeline(const RHIPipelineCreateInfo& baseInfo)
+	{
+		RHIInstanceBatcher* batcher = renderer_ ? renderer_->getInstanceBatcher() : nullptr;
+		if (!batcher || baseInfo.descriptorSetLayouts.size() != 4)
+		{
+			return;
+		}
+
+		auto vertCode = readShaderFile("../../assets/shaders/pbrForwardInstanced.vert.spv");
+		if (vertCode.empty())
+		{
+			printLog("[ForwardPassRG] ⚠️  Instanced vertex shader not found, using per-mesh draws");
+			return;
+		}
+
+		RHIShaderCreateInfo vertShaderInfo{};
+		vertShaderInfo.stage = RHI_SHADER_STAGE_VERTEX_BIT;
+		vertShaderInfo.name = "pbrForwardInstanced.vert";
+		vertShaderInfo.entryPoint = "main";
+		vertShaderInfo.code = std::move(vertCode);
+
+		instancedVertexShader_ = rhi_->createShader(vertShaderInfo);
+		if (!instancedVertexShader_.isValid())
+		{
+			printLog("[ForwardPassRG] ❌ Failed to create instanced vertex shader");
+			return;
+		}
+
+		// 정점 셰이더와 Set 4만 다르고 나머지 상태는 기본 파이프라인과 동일
+		RHIPipelineCreateInfo pipelineInfo = baseInfo;
+		pipelineInfo.shaderStages = { instancedVertexShader_, fragmentShader_ };
+		pipelineInfo.descriptorSetLayouts.push_back(batcher->getDescriptorLayout());
+
+		instancedPipeline_ = rhi_->createPipeline(pipelineInfo);
+		if (!instancedPipeline_.isValid())
+		{
+			printLog("[ForwardPassRG] ❌ Failed to create instanced pipeline");
+			return;
+		}
+
+		printLog("[ForwardPassRG]  Instanced pipeline created (automatic instancing)");
 	}
 
 	void ForwardPassRG::destroyPipeline()
 	{
+		if (instancedPipeline_.isValid()) {
+			rhi_->destroyPipeline(instancedPipeline_);
+			instancedPipeline_ = {};
+		}
+
+		if (instancedVertexShader_.isValid()) {
+			rhi_->destroyShader(instancedVertexShader_);
+			instancedVertexShader_ = {};
+		}
+
+		if (indirectPipeline_.isValid()) {
+			rhi_->destroyPipeline(indirectPipeline_);
+			indirectPipeline_ = {};
+		}
+
+		if (indirectVertexShader_.isValid()) {
+			rhi_->destroyShader(indirectVertexShader_);
+			indirectVertexShader_ = {};
+		}
+
 		if (pipeline_.isValid()) {
 			rhi_->destroyPipeline(pipeline_);
 			pipeline_ = {};
@@ -476,7 +687,7 @@ namespace BinRenderer
 		}
 
 		// ========================================
-		// Set 0: Scene UBO (SceneData, Options, BoneData)
+		// Set 0: Scene UBO (SceneData, Options) + 본 팔레트 SSBO
 		// ========================================
 		{
 			RHIDescriptorSetLayoutCreateInfo layoutInfo{};
@@ -497,13 +708,22 @@ namespace BinRenderer
 			optionsBinding.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT;
 			layoutInfo.bindings.push_back(optionsBinding);
 			
-			// Binding 2: BoneDataUBO
+			// Binding 2: BonePalettes (RHIBonePaletteArena, 프레임마다 updateDescriptorSets에서 갱신)
+			//            대체 경로는 pbrForward.vert의 BoneDataUBO (더미 유니폼 버퍼)
 			RHIDescriptorSetLayoutBinding boneBinding{};
 			boneBinding.binding = 2;
-			boneBinding.descriptorType = RHI_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+			boneBinding.descriptorType = legacyBoneUniform_ ? RHI_DESCRIPTOR_TYPE_UNIFORM_BUFFER : RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
 			boneBinding.descriptorCount = 1;
 			boneBinding.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT;
 			layoutInfo.bindings.push_back(boneBinding);
+
+			// Binding 3: SkinnedVertices (RHISkinningCache, 프레임마다 updateDescriptorSets에서 갱신)
+			RHIDescriptorSetLayoutBinding skinnedBinding{};
+			skinnedBinding.binding = 3;
+			skinnedBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			skinnedBinding.descriptorCount = 1;
+			skinnedBinding.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT;
+			layoutInfo.bindings.push_back(skinnedBinding);
 			
 			sceneDescriptorLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
 			if (!sceneDescriptorLayout_.isValid())
@@ -614,16 +834,16 @@ namespace BinRenderer
 			RHIDescriptorPoolCreateInfo poolInfo{};
 			poolInfo.maxSets = 20; // 여유있게 할당
 			
-			// Uniform buffers (Set 0: 3 bindings * 2 frames)
+			// Uniform buffers (Set 0: 2 bindings (대체 경로는 본 UBO까지 3) * 2 frames)
 			RHIDescriptorPoolSize uniformPoolSize{};
 			uniformPoolSize.type = RHI_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 			uniformPoolSize.descriptorCount = 6;
 			poolInfo.poolSizes.push_back(uniformPoolSize);
 			
-			// Storage buffers (Set 1: Material buffer)
+			// Storage buffers (Set 0: 본 팔레트 + 스킨드 정점 * 2 frames + Set 1: Material buffer)
 			RHIDescriptorPoolSize storagePoolSize{};
 			storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-			storagePoolSize.descriptorCount = 2;
+			storagePoolSize.descriptorCount = 6;
 			poolInfo.poolSizes.push_back(storagePoolSize);
 			
 			// Combined image samplers (Set 1: 512 textures + Set 2: 3 IBL + Set 3: 1 shadow)
@@ -660,7 +880,6 @@ namespace BinRenderer
 				// Uniform buffers 바인딩
 				RHIBufferHandle sceneBuffer = renderer_->getSceneUniformBuffer(i);
 				RHIBufferHandle optionsBuffer = renderer_->getOptionsUniformBuffer(i);
-				RHIBufferHandle boneBuffer = renderer_->getBoneDataUniformBuffer(i);
 				
 				if (sceneBuffer.isValid())
 				{
@@ -670,11 +889,22 @@ namespace BinRenderer
 				{
 					rhi_->updateDescriptorSet(sceneDescriptorSets_[i], 1, optionsBuffer, 0, sizeof(OptionsUniform));
 				}
-				if (boneBuffer.isValid())
+				// 본 팔레트/스킨드 정점은 버퍼가 정해지는 첫 execute에서 연결 (그 전/없으면 더미 SSBO, 오프셋이 없어 읽지 않음)
+				if (legacyBoneUniform_ && dummyBoneBuffer_.isValid())
+				{
+					rhi_->updateDescriptorSet(sceneDescriptorSets_[i], 2, dummyBoneBuffer_, 0, kLegacyBoneUniformSize);
+				}
+				else if (dummyMaterialBuffer_.isValid())
 				{
-					rhi_->updateDescriptorSet(sceneDescriptorSets_[i], 2, boneBuffer, 0, sizeof(BoneDataUniform));
+					rhi_->updateDescriptorSet(sceneDescriptorSets_[i], 2, dummyMaterialBuffer_, 0, 0);
+				}
+				if (dummyMaterialBuffer_.isValid())
+				{
+					rhi_->updateDescriptorSet(sceneDescriptorSets_[i], 3, dummyMaterialBuffer_, 0, 0);
 				}
 			}
+			boundPaletteBuffers_.assign(maxFrames, RHIBufferHandle{});
+			boundSkinnedBuffers_.assign(maxFrames, RHIBufferHandle{});
 			
 			printLog("[ForwardPassRG]    Scene descriptor sets allocated and updated ({})", maxFrames);
 		}
@@ -757,7 +987,10 @@ namespace BinRenderer
 		
 		// Descriptor Sets는 Pool이 파괴되면 자동으로 해제됨
 		sceneDescriptorSets_.clear();
+		boundPaletteBuffers_.clear();
+		boundSkinnedBuffers_.clear();
 		materialDescriptorSet_ = {};
+		boundMaterialBuffer_ = {};
 		iblDescriptorSet_ = {};
 		shadowDescriptorSet_ = {};
 		
@@ -795,9 +1028,41 @@ namespace BinRenderer
 
 	void ForwardPassRG::updateDescriptorSets(uint32_t frameIndex)
 	{
-		// TODO: Update descriptor sets per frame
-		// - Scene UBO binding
-		// - Material textures binding
+		// Material buffer는 패스를 추가한 뒤에 만들어지므로 처음 그리는 프레임에 연결
+		// (공유 Set이지만 buildMaterialBuffer는 첫 프레임 전에만 호출됨)
+		RHIBufferHandle materialBuffer = renderer_ ? renderer_->getMaterialBuffer() : RHIBufferHandle{};
+		if (materialBuffer.isValid() && materialBuffer != boundMaterialBuffer_ && materialDescriptorSet_.isValid())
+		{
+			rhi_->updateDescriptorSet(materialDescriptorSet_, 0, materialBuffer, 0, 0);
+			boundMaterialBuffer_ = materialBuffer;
+		}
+
+		// 본 팔레트 버퍼는 프레임 선형 풀에서 upload마다 새로 할당되므로 핸들이 바뀐 경우에만 다시 연결
+		// (이 Set을 쓰던 프레임은 같은 슬롯이라 beginFrame에서 이미 끝난 상태)
+		RHIBonePaletteArena* palettes = renderer_ ? renderer_->getBonePaletteArena() : nullptr;
+		if (!palettes || frameIndex >= boundPaletteBuffers_.size())
+		{
+			return;
+		}
+
+		// 대체 경로는 Binding 2가 더미 본 UBO로 고정
+		RHIBufferHandle paletteBuffer = legacyBoneUniform_ ? RHIBufferHandle{} : palettes->getBuffer();
+		if (paletteBuffer.isValid() && paletteBuffer != boundPaletteBuffers_[frameIndex])
+		{
+			rhi_->updateDescriptorSet(sceneDescriptorSets_[frameIndex], 2, paletteBuffer, 0, palettes->getBufferSize());
+			boundPaletteBuffers_[frameIndex] = paletteBuffer;
+		}
+
+		// 프리스키닝 출력 버퍼도 정점 수가 늘면 새로 만들어지므로 같은 방식으로 연결
+		RHISkinningCache* skinning = renderer_->isPreSkinningEnabled() ? renderer_->getSkinningCache() : nullptr;
+		RHIBufferHandle skinnedBuffer = skinning ? skinning->getOutputBuffer() : RHIBufferHandle{};
+		if (skinnedBuffer.isValid() && skinnedBuffer != boundSkinnedBuffers_[frameIndex])
+		{
+			rhi_->updateDescriptorSet(sceneDescriptorSets_[frameIndex], 3, skinnedBuffer, 0, skinning->getOutputBufferSize());
+			boundSkinnedBuffers_[frameIndex] = skinnedBuffer;
+		}
+
+		// TODO: Material textures binding
 	}
 
 	void ForwardPassRG::createDummyResources()
@@ -850,6 +1115,26 @@ namespace BinRenderer
 			}
 		}
 
+		// ========================================
+		// Dummy Bone UBO (pbrForward.vert 대체 경로 전용, 0 = 애니메이션 없음)
+		// ========================================
+		if (legacyBoneUniform_)
+		{
+			RHIBufferCreateInfo bufferInfo{};
+			bufferInfo.size = kLegacyBoneUniformSize;
+			bufferInfo.usage = RHI_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+			bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+			dummyBoneBuffer_ = rhi_->createBuffer(bufferInfo);
+			if (dummyBoneBuffer_.isValid())
+			{
+				void* data = rhi_->mapBuffer(dummyBoneBuffer_);
+				memset(data, 0, static_cast<size_t>(kLegacyBoneUniformSize));
+				rhi_->unmapBuffer(dummyBoneBuffer_);
+				printLog("[ForwardPassRG]    Dummy bone uniform buffer created");
+			}
+		}
+
 		// ========================================
 		// Dummy 2D Texture (흰색 4x4) -  1x1 대신 4x4 사용
 		// ========================================
@@ -991,6 +1276,7 @@ namespace BinRenderer
 		if (dummyTexture_.isValid()) rhi_->destroyImage(dummyTexture_);
 		if (dummySampler_.isValid()) rhi_->destroySampler(dummySampler_);
 		if (dummyMaterialBuffer_.isValid()) rhi_->destroyBuffer(dummyMaterialBuffer_);
+		if (dummyBoneBuffer_.isValid()) rhi_->destroyBuffer(dummyBoneBuffer_);
 
 		dummyShadowMapView_ = {};
 		dummyShadowMap_ = {};
@@ -1000,6 +1286,7 @@ namespace BinRenderer
 		dummyTexture_ = {};
 		dummySampler_ = {};
 		dummyMaterialBuffer_ = {};
+		dummyBoneBuffer_ = {};
 
 		printLog("[ForwardPassRG]  Dummy resources cleanup complete");
 	}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RGPassBase.h"
+#include "../Rendering/RHIRenderQueue.h"
 
 namespace BinRenderer
 {
@@ -16,6 +17,10 @@ namespace BinRenderer
 		// 입력
 		RGTextureHandle lightingIn;  // HDR from LightingPass
 		RGTextureHandle depthIn;  // Depth from GBufferPass
+		RGBufferHandle drawCommandsIn;  // GPU-driven: Indirect 커맨드 (GpuCullingPassRG)
+		RGBufferHandle drawCountIn;     // GPU-driven: 드로우 수
+		RGBufferHandle clusterIndicesIn;  // GPU-driven: meshlet 컬링 결과 인덱스 버퍼
+		RGBufferHandle skinnedVerticesIn; // 프리스키닝: 스킨드 정점 캐시 (SkinningPassRG)
 
 		// 출력
 		RGTextureHandle forwardOut;  // HDR + Transparent Objects
@@ -57,10 +62,21 @@ namespace BinRenderer
 		// 입력 핸들 설정 (setup 전에 호출)
 		void setLightingHandle(RGTextureHandle handle) { lightingHandle_ = handle; }
 		void setDepthHandle(RGTextureHandle handle) { depthHandle_ = handle; }
+		void setDrawCommandHandles(RGBufferHandle commands, RGBufferHandle drawCount, RGBufferHandle clusterIndices = {})
+		{
+			drawCommandsHandle_ = commands;
+			drawCountHandle_ = drawCount;
+			clusterIndicesHandle_ = clusterIndices;
+		}
+		void setSkinnedVerticesHandle(RGBufferHandle handle) { skinnedVerticesHandle_ = handle; }
 
 		// 출력 핸들
 		RGTextureHandle getForwardHandle() const { return getData().forwardOut; }
 
+		// GPU 컬링 결과를 Indirect로 그리는 파이프라인이 있는지 (셰이더/디바이스 기능이 없으면 false)
+		bool hasIndirectPipeline() const { return indirectPipeline_.isValid(); }
+		bool usesBonePalettes() const { return !legacyBoneUniform_; }
+
 	private:
 		// Scene/Renderer 참조
 		RHIScene* scene_ = nullptr;
@@ -69,6 +85,10 @@ namespace BinRenderer
 		// 입력 핸들
 		RGTextureHandle lightingHandle_;
 		RGTextureHandle depthHandle_;
+		RGBufferHandle drawCommandsHandle_;
+		RGBufferHandle drawCountHandle_;
+		RGBufferHandle clusterIndicesHandle_;
+		RGBufferHandle skinnedVerticesHandle_;
 
 		// 파이프라인 리소스
 		RHIPipelineHandle pipeline_;
@@ -76,6 +96,19 @@ namespace BinRenderer
 		RHIShaderHandle vertexShader_;
 		RHIShaderHandle fragmentShader_;
 
+		// GPU-driven 경로: 모델 행렬을 드로우 레코드(Set 4)에서 읽는 정점 셰이더
+		RHIPipelineHandle indirectPipeline_;
+		RHIShaderHandle indirectVertexShader_;
+
+		// CPU 경로 자동 인스턴싱: 모델 행렬을 인스턴스 버퍼(Set 4)에서 읽는 정점 셰이더
+		RHIPipelineHandle instancedPipeline_;
+		RHIShaderHandle instancedVertexShader_;
+
+		bool legacyBoneUniform_ = false;  // pbrForwardSkinned.vert.spv가 없어 pbrForward.vert로 대체 (본 팔레트 미사용)
+
+		// CPU 경로 드로우 순서 (프레임마다 재사용)
+		RHIRenderQueue renderQueue_;
+
 		//  Descriptor Sets (PBR용)
 		RHIDescriptorSetLayoutHandle sceneDescriptorLayout_;     // Set 0: Scene UBO
 		RHIDescriptorSetLayoutHandle materialDescriptorLayout_;  // Set 1: Materials
@@ -84,12 +117,16 @@ namespace BinRenderer
 		
 		RHIDescriptorPoolHandle descriptorPool_;
 		std::vector<RHIDescriptorSetHandle> sceneDescriptorSets_;  // Per-frame
+		std::vector<RHIBufferHandle> boundPaletteBuffers_;         // Per-frame, Set 0 Binding 2에 연결된 본 팔레트 버퍼
+		std::vector<RHIBufferHandle> boundSkinnedBuffers_;         // Per-frame, Set 0 Binding 3에 연결된 스킨드 정점 버퍼
 		RHIDescriptorSetHandle materialDescriptorSet_;   // 공유
+		RHIBufferHandle boundMaterialBuffer_;            // Set 1 Binding 0에 연결된 렌더러 Material buffer
 		RHIDescriptorSetHandle iblDescriptorSet_;        // 공유
 		RHIDescriptorSetHandle shadowDescriptorSet_;     // 공유
 
 		//  Dummy Resources (Material/IBL/Shadow용)
 		RHIBufferHandle dummyMaterialBuffer_;
+		RHIBufferHandle dummyBoneBuffer_;      // pbrForward.vert 대체 경로의 BoneDataUBO
 		RHIImageHandle dummyTexture_;          // 흰색 1x1 texture
 		RHIImageViewHandle dummyTextureView_;
 		RHISamplerHandle dummySampler_;
@@ -99,6 +136,8 @@ namespace BinRenderer
 		RHIImageViewHandle dummyShadowMapView_;
 
 		void createPipeline();
+		void createIndirectPipeline(const RHIPipelineCreateInfo& baseInfo);
+		void createInstancedPipeline(const RHIPipelineCreateInfo& baseInfo);
 		void destroyPipeline();
 		void createDescriptorSets();
 		void destroyDescriptorSets();
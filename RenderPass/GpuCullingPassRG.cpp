@@ -0,0 +1,109 @@
+﻿#include "GpuCullingPassRG.h"
+#include "../Rendering/RHIRenderer.h"
+
+namespace BinRenderer
+{
+	static const char* getPassName(RHIGpuCuller::Phase phase)
+	{
+		switch (phase)
+		{
+		case RHIGpuCuller::Phase::Early: return "GpuCullingPass_Early";
+		case RHIGpuCuller::Phase::Late:  return "GpuCullingPass_Late";
+		default:                         return "GpuCullingPass";
+		}
+	}
+
+	GpuCullingPassRG::GpuCullingPassRG(RHI* rhi, RHIRenderer* renderer, RHIGpuCuller::Phase phase)
+		: RGPass<GpuCullingPassData>(rhi, getPassName(phase))
+		, renderer_(renderer)
+		, phase_(phase)
+	{
+	}
+
+	void GpuCullingPassRG::setup(GpuCullingPassData& data, RenderGraphBuilder& builder)
+	{
+		// Indirect 커맨드/드로우 수: 프레임 슬롯별 버퍼이므로 실행 때마다 현재 슬롯 핸들로 임포트
+		RHIGpuCuller* culler = renderer_ ? renderer_->getGpuCuller() : nullptr;
+		if (culler)
+		{
+			const RHIGpuCuller::Phase phase = phase_;
+			const bool early = phase_ == RHIGpuCuller::Phase::Early;
+
+			RGBufferDesc commandDesc;
+			commandDesc.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+			data.commands = builder.importBuffer(early ? "GpuCull_EarlyCommands" : "GpuCull_Commands",
+				[culler, phase]() { return culler->getCommandBuffer(phase); }, commandDesc);
+			builder.writeBuffer(data.commands, RGResourceUsage::Storage);
+
+			// 드로우 수는 0으로 채운 뒤(Transfer) 컴퓨트에서 atomicAdd, 최종 목록은 통계용으로 복사(Transfer)
+			RGBufferDesc countDesc;
+			countDesc.size = sizeof(uint32_t);
+			countDesc.usage = commandDesc.usage | RHI_BUFFER_USAGE_TRANSFER_SRC_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+			data.drawCount = builder.importBuffer(early ? "GpuCull_EarlyDrawCount" : "GpuCull_DrawCount",
+				[culler, phase]() { return culler->getCountBuffer(phase); }, countDesc);
+			builder.writeBuffer(data.drawCount, RGResourceUsage::TransferDst);
+			builder.readWriteBuffer(data.drawCount, RGResourceUsage::Storage);
+			if (!early)
+			{
+				builder.readBuffer(data.drawCount, RGResourceUsage::TransferSrc);
+			}
+
+			// meshlet 컬링 결과 인덱스: 드로우 패스가 인덱스 버퍼로 읽음
+			if (!early)
+			{
+				RGBufferDesc clusterDesc;
+				clusterDesc.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_INDEX_BUFFER_BIT;
+				data.clusterIndices = builder.importBuffer("GpuCull_ClusterIndices",
+					[culler]() { return culler->getClusterIndexBuffer(); }, clusterDesc);
+				builder.writeBuffer(data.clusterIndices, RGResourceUsage::Storage);
+			}
+
+			// 가시성: Early가 (필요하면 0으로 채운 뒤) 읽고 Late가 갱신
+			if (early)
+			{
+				RGBufferDesc visibilityDesc;
+				visibilityDesc.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+				data.visibility = builder.importBuffer("GpuCull_Visibility",
+					[culler]() { return culler->getVisibilityBuffer(); }, visibilityDesc);
+				builder.writeBuffer(data.visibility, RGResourceUsage::TransferDst);
+				builder.readWriteBuffer(data.visibility, RGResourceUsage::Storage);
+			}
+			else if (phase_ == RHIGpuCuller::Phase::Late && visibilityHandle_.isValid())
+			{
+				data.visibility = builder.readWriteBuffer(visibilityHandle_, RGResourceUsage::Storage);
+			}
+		}
+
+		RHIHiZPyramid* pyramid = renderer_ ? renderer_->getHiZPyramid() : nullptr;
+		if (phase_ == RHIGpuCuller::Phase::Early && pyramid)
+		{
+			RGTextureDesc hiZDesc;
+			hiZDesc.name = "HiZ_Pyramid";
+			hiZDesc.width = pyramid->getHiZWidth();
+			hiZDesc.height = pyramid->getHiZHeight();
+			hiZDesc.format = pyramid->getHiZFormat();
+			hiZDesc.mipLevels = pyramid->getMipCount();
+			hiZDesc.usage = RHI_IMAGE_USAGE_SAMPLED_BIT | RHI_IMAGE_USAGE_STORAGE_BIT;
+
+			// Early 셰이더는 Hi-Z를 샘플링하지 않지만 디스크립터가 가리키므로 읽기 레이아웃으로 둠
+			data.hiZ = builder.importTexture(hiZDesc.name, pyramid->getHiZImage(), hiZDesc);
+			builder.readTexture(data.hiZ, RGResourceUsage::ShaderRead);
+		}
+		else if (phase_ == RHIGpuCuller::Phase::Late && hiZHandle_.isValid())
+		{
+			data.hiZ = builder.readTexture(hiZHandle_, RGResourceUsage::ShaderRead);
+		}
+	}
+
+	void GpuCullingPassRG::execute(const GpuCullingPassData& data, RHI* rhi, uint32_t frameIndex)
+	{
+		if (!renderer_ || !renderer_->isGpuDrivenRendering())
+		{
+			return;
+		}
+
+		renderer_->getGpuCuller()->recordCulling(renderer_->getViewFrustum(), renderer_->getViewProjection(),
+			renderer_->isFrustumCullingEnabled(), phase_);
+	}
+
+} // namespace BinRenderer
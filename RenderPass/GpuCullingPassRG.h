@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "RGPassBase.h"
+#include "../Rendering/RHIGpuCuller.h"
+
+namespace BinRenderer
+{
+	// Forward declarations
+	class RHIRenderer;
+
+	/**
+	 * @brief GPU Culling Pass 데이터 (레코드/커맨드 버퍼는 RHIGpuCuller가 프레임 슬롯별로 소유, 현재 슬롯을 임포트)
+	 */
+	struct GpuCullingPassData
+	{
+		RGTextureHandle hiZ;  // Early/Late만 사용 (Hi-Z 피라미드)
+
+		// 출력 (Early는 Early 목록, 나머지는 최종 목록)
+		RGBufferHandle commands;   // Indirect 커맨드
+		RGBufferHandle drawCount;  // 드로우 수
+		RGBufferHandle clusterIndices;  // Early 제외 (meshlet 컬링 결과 인덱스, 클러스터 컬링을 안 하는 프레임은 빈 버퍼)
+
+		RGBufferHandle visibility;  // Early/Late만 사용 (레코드별 지난 프레임 가시성)
+	};
+
+	/**
+	 * @brief GPU Culling Pass (컴퓨트 절두체 컬링 → Indirect 커맨드 생성)
+	 * 
+	 * @features
+	 * - 메시별 드로우 레코드를 절두체 테스트
+	 * - 보이는 메시의 Indirect 커맨드와 드로우 수 기록
+	 * 
+	 * @outputs
+	 * - RHIGpuCuller의 Indirect 커맨드/드로우 수 버퍼 (getCommandsHandle/getDrawCountHandle)
+	 * 
+	 * 드로우 패스가 출력을 IndirectBuffer로 읽기로 선언해야 실행 순서와 배리어가 생기고 Culling되지 않음
+	 *
+	 * 가림막 컬링은 Early → DepthPrepassRG → HiZPassRG → Late 순서로 추가
+	 * - Early: Hi-Z를 임포트해서 읽기로 선언 (HiZPassRG의 쓰기보다 먼저 실행되도록)
+	 * - Late: setHiZHandle로 HiZPassRG 출력을 받아 읽음
+	 * - 가시성 버퍼는 Early가 임포트해서 읽기/쓰기, Late는 setVisibilityHandle로 받아 씀
+	 */
+	class GpuCullingPassRG : public RGPass<GpuCullingPassData>
+	{
+	public:
+		GpuCullingPassRG(RHI* rhi, RHIRenderer* renderer, RHIGpuCuller::Phase phase = RHIGpuCuller::Phase::Frustum);
+		~GpuCullingPassRG() override = default;
+
+		// RGPass 인터페이스
+		void setup(GpuCullingPassData& data, RenderGraphBuilder& builder) override;
+		void execute(const GpuCullingPassData& data, RHI* rhi, uint32_t frameIndex) override;
+
+		// 입력 핸들 설정 (Late, setup 전에 호출)
+		void setHiZHandle(RGTextureHandle handle) { hiZHandle_ = handle; }
+		void setVisibilityHandle(RGBufferHandle handle) { visibilityHandle_ = handle; }
+
+		// 출력 핸들 (Early가 임포트한 Hi-Z)
+		RGTextureHandle getHiZHandle() const { return getData().hiZ; }
+		RGBufferHandle getCommandsHandle() const { return getData().commands; }
+		RGBufferHandle getDrawCountHandle() const { return getData().drawCount; }
+		RGBufferHandle getClusterIndicesHandle() const { return getData().clusterIndices; }
+		RGBufferHandle getVisibilityHandle() const { return getData().visibility; }
+
+	private:
+		RHIRenderer* renderer_ = nullptr;
+		RHIGpuCuller::Phase phase_;
+		RGTextureHandle hiZHandle_;
+		RGBufferHandle visibilityHandle_;
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,37 @@
+﻿#include "HiZPassRG.h"
+#include "../Rendering/RHIRenderer.h"
+
+namespace BinRenderer
+{
+	HiZPassRG::HiZPassRG(RHI* rhi, RHIRenderer* renderer)
+		: RGPass<HiZPassData>(rhi, "HiZPass")
+		, renderer_(renderer)
+	{
+	}
+
+	void HiZPassRG::setup(HiZPassData& data, RenderGraphBuilder& builder)
+	{
+		if (depthHandle_.isValid())
+		{
+			data.depthIn = builder.readTexture(depthHandle_, RGResourceUsage::ShaderRead);
+		}
+
+		// 밉 사이 배리어는 RHIHiZPyramid가 기록, 그래프는 이미지 전체를 Storage로 전환
+		if (hiZHandle_.isValid())
+		{
+			data.hiZOut = builder.writeTexture(hiZHandle_, RGResourceUsage::Storage);
+		}
+	}
+
+	void HiZPassRG::execute(const HiZPassData& data, RHI* rhi, uint32_t frameIndex)
+	{
+		RHIHiZPyramid* pyramid = renderer_ ? renderer_->getHiZPyramid() : nullptr;
+		if (!pyramid || !data.depthIn.isValid() || !data.hiZOut.isValid())
+		{
+			return;
+		}
+
+		pyramid->recordBuild();
+	}
+
+} // namespace BinRenderer
@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include "RGPassBase.h"
+
+namespace BinRenderer
+{
+	// Forward declarations
+	class RHIRenderer;
+
+	/**
+	 * @brief Hi-Z Pass 데이터
+	 */
+	struct HiZPassData
+	{
+		RGTextureHandle depthIn;  // from DepthPrepassRG
+		RGTextureHandle hiZOut;   // Hi-Z 피라미드 (전체 밉)
+	};
+
+	/**
+	 * @brief Hi-Z Pass (깊이 → max 밉 체인, 컴퓨트)
+	 * 
+	 * @inputs
+	 * - Occlusion Depth (from DepthPrepassRG)
+	 * - Hi-Z 핸들 (GpuCullingPassRG(Early)가 임포트, 이 패스가 덮어씀)
+	 * 
+	 * @outputs
+	 * - Hi-Z Pyramid (R32_SFLOAT) → GpuCullingPassRG(Late)
+	 */
+	class HiZPassRG : public RGPass<HiZPassData>
+	{
+	public:
+		HiZPassRG(RHI* rhi, RHIRenderer* renderer);
+		~HiZPassRG() override = default;
+
+		// RGPass 인터페이스
+		void setup(HiZPassData& data, RenderGraphBuilder& builder) override;
+		void execute(const HiZPassData& data, RHI* rhi, uint32_t frameIndex) override;
+
+		// 입력 핸들 설정 (setup 전에 호출)
+		void setDepthHandle(RGTextureHandle handle) { depthHandle_ = handle; }
+		void setHiZHandle(RGTextureHandle handle) { hiZHandle_ = handle; }
+
+		// 출력 핸들
+		RGTextureHandle getHiZHandle() const { return getData().hiZOut; }
+
+	private:
+		RHIRenderer* renderer_ = nullptr;
+
+		RGTextureHandle depthHandle_;
+		RGTextureHandle hiZHandle_;
+	};
+
+} // namespace BinRenderer
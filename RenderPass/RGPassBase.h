@@ -99,12 +99,37 @@ namespace BinRenderer
 		const std::vector<RGResourceDependency>& getDependencies() const { return dependencies_; }
 		void addDependency(const RGResourceDependency& dep) { dependencies_.push_back(dep); }
 
+		// Culling 정보
+		/**
+		 * @brief Side Effect 패스 여부 (그래프 외부에 결과를 남기는 패스, 예: 스왑체인 직접 렌더링)
+		 * 
+		 * Side Effect 패스는 최종 출력과 연결되지 않아도 Culling되지 않음
+		 */
+		bool hasSideEffect() const { return hasSideEffect_; }
+		void setSideEffect(bool sideEffect) { hasSideEffect_ = sideEffect; }
+
+		bool isCulled() const { return culled_; }
+		void setCulled(bool culled) { culled_ = culled; }
+
+		// 큐 정보
+		/**
+		 * @brief 패스가 실행될 선호 큐 (Graphics / Async Compute / Transfer)
+		 * 
+		 * 전용 큐가 없는 디바이스에서는 Graphics 큐에서 실행됨
+		 * Compute/Transfer 큐 패스는 execute()에서 그래픽스 커맨드(렌더링, 드로우)를 기록하면 안 됨
+		 */
+		RHIQueueType getQueue() const { return queue_; }
+		void setQueue(RHIQueueType queue) { queue_ = queue; }
+
 	protected:
 		RHI* rhi_;
 		std::string name_;
 		uint32_t width_ = 0;
 		uint32_t height_ = 0;
 		uint32_t executionOrder_ = 0;
+		bool hasSideEffect_ = false;
+		RHIQueueType queue_ = RHIQueueType::Graphics;
+		bool culled_ = false;
 
 		// RenderGraph 의존성 (자동 관리)
 		std::vector<RGResourceDependency> dependencies_;
@@ -20,7 +20,8 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGTextureHandle RenderGraphBuilder::importTexture(const std::string& name, RHIImageHandle image, const RGTextureDesc& desc)
+	RGTextureHandle RenderGraphBuilder::importTexture(const std::string& name, RHIImageHandle image, const RGTextureDesc& desc,
+		RHIImageLayout initialLayout)
 	{
 		RGTextureHandle handle;
 		handle.index = static_cast<uint32_t>(textures_.size());
@@ -30,18 +31,19 @@ namespace BinRenderer
 		node.desc.name = name;
 		node.desc.isImported = true;
 		node.importedImage = image;
+		node.initialLayout = initialLayout;
 		textures_.push_back(node);
 
 		return handle;
 	}
 
-	RGTextureHandle RenderGraphBuilder::readTexture(RGTextureHandle handle)
+	RGTextureHandle RenderGraphBuilder::readTexture(RGTextureHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= textures_.size()) {
 			return handle;
 		}
 
-		addTextureDependency(handle, RGResourceAccessType::Read);
+		addTextureDependency(handle, RGResourceAccessType::Read, usage);
 		
 		auto& node = textures_[handle.index];
 		node.isRead = true;
@@ -51,13 +53,13 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGTextureHandle RenderGraphBuilder::writeTexture(RGTextureHandle handle)
+	RGTextureHandle RenderGraphBuilder::writeTexture(RGTextureHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= textures_.size()) {
 			return handle;
 		}
 
-		addTextureDependency(handle, RGResourceAccessType::Write);
+		addTextureDependency(handle, RGResourceAccessType::Write, usage);
 		
 		auto& node = textures_[handle.index];
 		node.isWritten = true;
@@ -67,13 +69,13 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGTextureHandle RenderGraphBuilder::readWriteTexture(RGTextureHandle handle)
+	RGTextureHandle RenderGraphBuilder::readWriteTexture(RGTextureHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= textures_.size()) {
 			return handle;
 		}
 
-		addTextureDependency(handle, RGResourceAccessType::ReadWrite);
+		addTextureDependency(handle, RGResourceAccessType::ReadWrite, usage);
 		
 		auto& node = textures_[handle.index];
 		node.isRead = true;
@@ -115,13 +117,21 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGBufferHandle RenderGraphBuilder::readBuffer(RGBufferHandle handle)
+	RGBufferHandle RenderGraphBuilder::importBuffer(const std::string& name, RGBufferResolver resolver, const RGBufferDesc& desc)
+	{
+		RGBufferHandle handle = importBuffer(name, RHIBufferHandle{}, desc);
+		buffers_[handle.index].resolver = std::move(resolver);
+
+		return handle;
+	}
+
+	RGBufferHandle RenderGraphBuilder::readBuffer(RGBufferHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= buffers_.size()) {
 			return handle;
 		}
 
-		addBufferDependency(handle, RGResourceAccessType::Read);
+		addBufferDependency(handle, RGResourceAccessType::Read, usage);
 		
 		auto& node = buffers_[handle.index];
 		node.isRead = true;
@@ -131,13 +141,13 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGBufferHandle RenderGraphBuilder::writeBuffer(RGBufferHandle handle)
+	RGBufferHandle RenderGraphBuilder::writeBuffer(RGBufferHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= buffers_.size()) {
 			return handle;
 		}
 
-		addBufferDependency(handle, RGResourceAccessType::Write);
+		addBufferDependency(handle, RGResourceAccessType::Write, usage);
 		
 		auto& node = buffers_[handle.index];
 		node.isWritten = true;
@@ -147,13 +157,13 @@ namespace BinRenderer
 		return handle;
 	}
 
-	RGBufferHandle RenderGraphBuilder::readWriteBuffer(RGBufferHandle handle)
+	RGBufferHandle RenderGraphBuilder::readWriteBuffer(RGBufferHandle handle, RGResourceUsage usage)
 	{
 		if (!handle.isValid() || handle.index >= buffers_.size()) {
 			return handle;
 		}
 
-		addBufferDependency(handle, RGResourceAccessType::ReadWrite);
+		addBufferDependency(handle, RGResourceAccessType::ReadWrite, usage);
 		
 		auto& node = buffers_[handle.index];
 		node.isRead = true;
@@ -173,11 +183,33 @@ namespace BinRenderer
 		finalOutput_ = handle;
 	}
 
+	// ========================================
+	// Side Effect 출력
+	// ========================================
+
+	void RenderGraphBuilder::markSideEffect(RGTextureHandle handle)
+	{
+		if (!handle.isValid() || handle.index >= textures_.size()) {
+			return;
+		}
+
+		textures_[handle.index].isSideEffect = true;
+	}
+
+	void RenderGraphBuilder::markSideEffect(RGBufferHandle handle)
+	{
+		if (!handle.isValid() || handle.index >= buffers_.size()) {
+			return;
+		}
+
+		buffers_[handle.index].isSideEffect = true;
+	}
+
 	// ========================================
 	// 헬퍼 함수
 	// ========================================
 
-	void RenderGraphBuilder::addTextureDependency(RGTextureHandle handle, RGResourceAccessType accessType)
+	void RenderGraphBuilder::addTextureDependency(RGTextureHandle handle, RGResourceAccessType accessType, RGResourceUsage usage)
 	{
 		if (!currentPass_) {
 			return;
@@ -186,13 +218,14 @@ namespace BinRenderer
 		RGResourceDependency dep;
 		dep.texture = handle;
 		dep.accessType = accessType;
+		dep.usage = usage;
 		dep.isTexture = true;
 		
 		//  public 메서드 사용
 		currentPass_->addDependency(dep);
 	}
 
-	void RenderGraphBuilder::addBufferDependency(RGBufferHandle handle, RGResourceAccessType accessType)
+	void RenderGraphBuilder::addBufferDependency(RGBufferHandle handle, RGResourceAccessType accessType, RGResourceUsage usage)
 	{
 		if (!currentPass_) {
 			return;
@@ -201,6 +234,7 @@ namespace BinRenderer
 		RGResourceDependency dep;
 		dep.buffer = handle;
 		dep.accessType = accessType;
+		dep.usage = usage;
 		dep.isTexture = false;
 		
 		//  public 메서드 사용
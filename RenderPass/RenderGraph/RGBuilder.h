@@ -4,6 +4,7 @@
 //  전방 선언으로 변경 (순환 참조 방지)
 // #include "../RGPassBase.h"  
 #include "../../RHI/Core/RHI.h"
+#include <functional>
 #include <vector>
 #include <unordered_map>
 
@@ -12,6 +13,11 @@ namespace BinRenderer
 	//  전방 선언
 	class RGPassBase;
 
+	/**
+	 * @brief 실행 시점에 실제 버퍼를 돌려주는 함수 (프레임 슬롯별 버퍼, 크기가 바뀌면 다시 만드는 버퍼)
+	 */
+	using RGBufferResolver = std::function<RHIBufferHandle()>;
+
 	/**
 	 * @brief RenderGraph Builder
 	 * 
@@ -34,22 +40,23 @@ namespace BinRenderer
 		/**
 		 * @brief 외부 텍스처 임포트 (예: 스왑체인 이미지)
 		 */
-		RGTextureHandle importTexture(const std::string& name, RHIImageHandle image, const RGTextureDesc& desc);
+		RGTextureHandle importTexture(const std::string& name, RHIImageHandle image, const RGTextureDesc& desc,
+			RHIImageLayout initialLayout = RHI_IMAGE_LAYOUT_UNDEFINED);
 
 		/**
 		 * @brief 텍스처 읽기 선언
 		 */
-		RGTextureHandle readTexture(RGTextureHandle handle);
+		RGTextureHandle readTexture(RGTextureHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		/**
 		 * @brief 텍스처 쓰기 선언
 		 */
-		RGTextureHandle writeTexture(RGTextureHandle handle);
+		RGTextureHandle writeTexture(RGTextureHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		/**
 		 * @brief 텍스처 읽기/쓰기 선언
 		 */
-		RGTextureHandle readWriteTexture(RGTextureHandle handle);
+		RGTextureHandle readWriteTexture(RGTextureHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		// ========================================
 		// 버퍼 생성 및 관리
@@ -65,20 +72,28 @@ namespace BinRenderer
 		 */
 		RGBufferHandle importBuffer(const std::string& name, RHIBufferHandle buffer, const RGBufferDesc& desc);
 
+		/**
+		 * @brief 외부 버퍼 임포트 (핸들은 compile/execute 때마다 resolver로 다시 얻음)
+		 * 
+		 * 핸들이 바뀌어도 실행 순서는 그대로 두고 배리어만 다시 만듦
+		 * resolver가 무효 핸들을 돌려주면 그 프레임에는 배리어 없이 건너뜀
+		 */
+		RGBufferHandle importBuffer(const std::string& name, RGBufferResolver resolver, const RGBufferDesc& desc);
+
 		/**
 		 * @brief 버퍼 읽기 선언
 		 */
-		RGBufferHandle readBuffer(RGBufferHandle handle);
+		RGBufferHandle readBuffer(RGBufferHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		/**
 		 * @brief 버퍼 쓰기 선언
 		 */
-		RGBufferHandle writeBuffer(RGBufferHandle handle);
+		RGBufferHandle writeBuffer(RGBufferHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		/**
 		 * @brief 버퍼 읽기/쓰기 선언
 		 */
-		RGBufferHandle readWriteBuffer(RGBufferHandle handle);
+		RGBufferHandle readWriteBuffer(RGBufferHandle handle, RGResourceUsage usage = RGResourceUsage::Auto);
 
 		// ========================================
 		// 최종 출력 설정
@@ -91,6 +106,18 @@ namespace BinRenderer
 
 		RGTextureHandle getFinalOutput() const { return finalOutput_; }
 
+		// ========================================
+		// Side Effect 출력 설정
+		// ========================================
+
+		/**
+		 * @brief 그래프 외부에서 사용되는 리소스로 표시 (예: Imported 히스토리 버퍼, 리드백 버퍼)
+		 * 
+		 * 표시된 리소스를 쓰는 패스는 최종 출력과 연결되지 않아도 Culling되지 않음
+		 */
+		void markSideEffect(RGTextureHandle handle);
+		void markSideEffect(RGBufferHandle handle);
+
 	private:
 		friend class RenderGraph;
 
@@ -99,10 +126,13 @@ namespace BinRenderer
 		{
 			RGTextureDesc desc;
 			RHIImageHandle importedImage;
+			RHIImageLayout initialLayout = RHI_IMAGE_LAYOUT_UNDEFINED; // Imported 이미지의 프레임 시작 레이아웃
 			uint32_t firstUse = UINT32_MAX;
 			uint32_t lastUse = 0;
+			uint32_t refCount = 0;       // Culling 이후 이 리소스를 참조하는 패스 수
 			bool isRead = false;
 			bool isWritten = false;
+			bool isSideEffect = false;
 		};
 
 		// 버퍼 노드
@@ -110,10 +140,13 @@ namespace BinRenderer
 		{
 			RGBufferDesc desc;
 			RHIBufferHandle importedBuffer;
+			RGBufferResolver resolver;  // 있으면 importedBuffer는 마지막으로 얻은 핸들
 			uint32_t firstUse = UINT32_MAX;
 			uint32_t lastUse = 0;
+			uint32_t refCount = 0;       // Culling 이후 이 리소스를 참조하는 패스 수
 			bool isRead = false;
 			bool isWritten = false;
+			bool isSideEffect = false;
 		};
 
 		std::vector<TextureNode> textures_;
@@ -124,8 +157,8 @@ namespace BinRenderer
 		uint32_t currentPassIndex_ = 0;
 
 		// 의존성 추가 헬퍼
-		void addTextureDependency(RGTextureHandle handle, RGResourceAccessType accessType);
-		void addBufferDependency(RGBufferHandle handle, RGResourceAccessType accessType);
+		void addTextureDependency(RGTextureHandle handle, RGResourceAccessType accessType, RGResourceUsage usage);
+		void addBufferDependency(RGBufferHandle handle, RGResourceAccessType accessType, RGResourceUsage usage);
 	};
 
 } // namespace BinRenderer
@@ -1,6 +1,8 @@
 ﻿#include "RGGraph.h"
 #include <algorithm>
+#include <future>
 #include <queue>
+#include <map>
 #include <iostream>
 
 namespace BinRenderer
@@ -25,15 +27,40 @@ namespace BinRenderer
 			return;
 		}
 
+		compileStats_.compileCount++;
+
+		// 0. 구조가 이전 컴파일과 같으면 실행 순서/배리어/물리 리소스 재사용
+		//    (resolver 임포트 버퍼의 핸들만 바뀌었으면 배리어만 다시 생성)
+		const bool buffersChanged = resolveImportedBuffers();
+		const uint64_t hash = computeStructuralHash();
+		if (cacheValid_ && hash == cachedHash_ && restoreCachedSchedule()) {
+			compileStats_.cacheHitCount++;
+			if (buffersChanged) {
+				buildBarriers();
+				compileStats_.barrierRebuilds++;
+			}
+			compiled_ = true;
+			return;
+		}
+
 		// 1. 사용되지 않는 패스 제거
 		cullUnusedPasses();
 
-		// 2. Topological Sort로 실행 순서 결정
+		// 2. 패스별 실행 큐 결정
+		resolvePassQueues();
+
+		// 3. Topological Sort로 실행 순서 결정
 		topologicalSort();
 
-		// 3. 리소스 할당
+		// 4. 리소스 할당
 		allocateResources();
 
+		// 5. 패스 간 배리어 및 큐 배치 생성
+		buildBarriers();
+
+		cachedHash_ = hash;
+		cacheValid_ = !sortedPasses_.empty();
+
 		compiled_ = true;
 	}
 
@@ -48,22 +75,130 @@ namespace BinRenderer
 			return;
 		}
 
-		// 정렬된 순서대로 패스 실행
-		for (auto* pass : sortedPasses_) {
-			pass->execute(rhi_, frameIndex);
+		// 프레임 슬롯별 버퍼처럼 실행 때마다 바뀌는 임포트 버퍼는 순서는 그대로 두고 배리어만 갱신
+		if (resolveImportedBuffers()) {
+			buildBarriers();
+			compileStats_.barrierRebuilds++;
+		}
+
+		// 실행할 패스가 없어도 프레임 동기화(Fence/Present 세마포어)를 위해 빈 제출은 필요
+		if (queueBatches_.empty()) {
+			rhi_->beginCommandRecording();
+			rhi_->endCommandRecording();
+			rhi_->submitCommands();
+			return;
+		}
+
+		// 배치별 제출 결과 (다른 큐 배치가 기다릴 Timeline 값)
+		std::vector<uint64_t> batchValues(queueBatches_.size(), 0);
+
+		for (size_t b = 0; b < queueBatches_.size(); ++b) {
+			const auto& batch = queueBatches_[b];
+
+			rhi_->beginCommandRecording(batch.queue);
+
+			// 정렬된 순서대로 배리어 기록 후 패스 실행
+			recordPasses(batch.firstPass, batch.passCount, frameIndex);
+
+			// 다른 큐로 넘어가는 리소스의 소유권 Release
+			rhi_->cmdPipelineBarrier(batch.releaseBarriers);
+
+			rhi_->endCommandRecording();
+
+			RHIQueueSubmitInfo submitInfo;
+			submitInfo.queue = batch.queue;
+			submitInfo.endOfFrame = (b + 1 == queueBatches_.size());
+			for (uint32_t q = 0; q < RHI_QUEUE_TYPE_COUNT; ++q) {
+				const uint32_t waitBatch = batch.waitBatch[q];
+				if (waitBatch != UINT32_MAX) {
+					submitInfo.waits.push_back({ queueBatches_[waitBatch].queue, batchValues[waitBatch], batch.waitStages[q] });
+				}
+			}
+
+			batchValues[b] = rhi_->submitCommands(submitInfo);
+		}
+	}
+
+	void RenderGraph::setParallelRecording(uint32_t maxContexts, ParallelForFunc parallelFor)
+	{
+		maxRecordingContexts_ = std::max(maxContexts, 1u);
+		parallelFor_ = std::move(parallelFor);
+	}
+
+	void RenderGraph::recordPasses(uint32_t firstPass, uint32_t passCount, uint32_t frameIndex)
+	{
+		auto recordRange = [this, frameIndex](uint32_t begin, uint32_t end) {
+			for (uint32_t i = begin; i < end; ++i) {
+				if (i < passBarriers_.size()) {
+					rhi_->cmdPipelineBarrier(passBarriers_[i]);
+				}
+				sortedPasses_[i]->execute(rhi_, frameIndex);
+			}
+		};
+
+		const uint32_t contextCount = std::min({ maxRecordingContexts_, rhi_->getMaxRecordingContexts(),
+			passCount / kMinPassesPerContext });
+
+		if (contextCount <= 1 || !rhi_->beginParallelRecording(contextCount)) {
+			recordRange(firstPass, firstPass + passCount);
+			return;
+		}
+
+		// 연속 구간으로 나누어야 컨텍스트 순서대로 실행했을 때 정렬 순서와 배리어 위치가 그대로 유지됨
+		auto recordContext = [&](uint32_t context) {
+			const uint32_t begin = firstPass + passCount * context / contextCount;
+			const uint32_t end = firstPass + passCount * (context + 1) / contextCount;
+
+			rhi_->beginRecordingContext(context);
+			recordRange(begin, end);
+			rhi_->endRecordingContext();
+		};
+
+		if (parallelFor_) {
+			parallelFor_(contextCount, recordContext);
+		} else {
+			std::vector<std::future<void>> workers;
+			workers.reserve(contextCount - 1);
+			for (uint32_t context = 1; context < contextCount; ++context) {
+				workers.push_back(std::async(std::launch::async, recordContext, context));
+			}
+			recordContext(0);
+			for (auto& worker : workers) {
+				worker.get();
+			}
 		}
+
+		rhi_->endParallelRecording();
 	}
 
 	void RenderGraph::reset()
 	{
+		// 컴파일 캐시(실행 순서, 배리어, 물리 리소스)는 유지
 		passes_.clear();
 		sortedPasses_.clear();
 		builder_.textures_.clear();
 		builder_.buffers_.clear();
-		deallocateResources();
+		builder_.finalOutput_ = {};
+		builder_.currentPass_ = nullptr;
+		builder_.currentPassIndex_ = 0;
 		compiled_ = false;
 	}
 
+	void RenderGraph::releaseResources()
+	{
+		reset();
+		deallocateResources();
+		passBarriers_.clear();
+		queueBatches_.clear();
+		barrierCount_ = 0;
+		elidedBarrierCount_ = 0;
+		memoryStats_ = {};
+		cachedSchedule_.clear();
+		resolvedBuffers_.clear();
+		cachedHash_ = 0;
+		cacheValid_ = false;
+	}
+
 	// ========================================
 	// 리소스 접근
 	// ========================================
@@ -116,113 +251,521 @@ namespace BinRenderer
 	// 디버그
 	// ========================================
 
+	static const char* getQueueName(RHIQueueType queue)
+	{
+		switch (queue) {
+		case RHIQueueType::Graphics: return "Graphics";
+		case RHIQueueType::Compute: return "Compute";
+		case RHIQueueType::Transfer: return "Transfer";
+		default: return "Unknown";
+		}
+	}
+
 	void RenderGraph::printExecutionOrder() const
 	{
 		std::cout << "[RenderGraph] Execution Order:" << std::endl;
-		for (size_t i = 0; i < sortedPasses_.size(); ++i) {
-			std::cout << "  " << i << ": " << sortedPasses_[i]->getName() << std::endl;
+		for (size_t b = 0; b < queueBatches_.size(); ++b) {
+			const auto& batch = queueBatches_[b];
+			std::cout << "  [Batch " << b << " - " << getQueueName(batch.queue) << "]";
+			for (uint32_t q = 0; q < RHI_QUEUE_TYPE_COUNT; ++q) {
+				if (batch.waitBatch[q] != UINT32_MAX) {
+					std::cout << " waits batch " << batch.waitBatch[q];
+				}
+			}
+			if (!batch.releaseBarriers.empty()) {
+				std::cout << " (" << batch.releaseBarriers.size() << " ownership releases)";
+			}
+			std::cout << std::endl;
+
+			for (uint32_t i = batch.firstPass; i < batch.firstPass + batch.passCount && i < sortedPasses_.size(); ++i) {
+				std::cout << "  " << i << ": " << sortedPasses_[i]->getName();
+				if (i < passBarriers_.size() && !passBarriers_[i].empty()) {
+					std::cout << " (" << passBarriers_[i].size() << " barriers)";
+				}
+				std::cout << std::endl;
+			}
+		}
+		std::cout << "  Barriers: " << barrierCount_ << " emitted, "
+			<< elidedBarrierCount_ << " elided" << std::endl;
+		for (const auto& pass : passes_) {
+			if (pass->isCulled()) {
+				std::cout << "  (culled) " << pass->getName() << std::endl;
+			}
 		}
 	}
 
 	void RenderGraph::printResourceUsage() const
 	{
+		auto toMB = [](uint64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+
 		std::cout << "[RenderGraph] Resource Usage:" << std::endl;
-		std::cout << "  Textures: " << builder_.textures_.size() << std::endl;
-		std::cout << "  Buffers: " << builder_.buffers_.size() << std::endl;
+		std::cout << "  Textures: " << builder_.textures_.size()
+			<< " (transient " << memoryStats_.virtualTextures
+			<< " -> physical " << memoryStats_.physicalTextures << ")" << std::endl;
+		std::cout << "  Buffers: " << builder_.buffers_.size()
+			<< " (transient " << memoryStats_.virtualBuffers
+			<< " -> physical " << memoryStats_.physicalBuffers << ")" << std::endl;
+		std::cout << "  Transient Memory (naive): " << toMB(memoryStats_.naiveBytes) << " MB" << std::endl;
+		std::cout << "  Transient Memory (aliased): " << toMB(memoryStats_.allocatedBytes) << " MB" << std::endl;
+		// RHI에 placed 리소스/힙 API가 없어 메모리 범위가 아니라 호환 디스크립터끼리 리소스 전체를 공유
+		std::cout << "    (whole-resource sharing between compatible descriptors only; no placed-memory aliasing,"
+			<< " so the aliased total can stay above peak live)" << std::endl;
+		std::cout << "  Transient Memory (peak live): " << toMB(memoryStats_.peakBytes) << " MB" << std::endl;
+		std::cout << "  Compile Cache: " << compileStats_.cacheHitCount << "/" << compileStats_.compileCount
+			<< " hits, textures " << compileStats_.texturesReused << " reused / " << compileStats_.texturesCreated
+			<< " created, buffers " << compileStats_.buffersReused << " reused / " << compileStats_.buffersCreated
+			<< " created" << std::endl;
 	}
 
 	// ========================================
 	// 내부 헬퍼 함수
 	// ========================================
 
+	namespace
+	{
+		// FNV-1a 64비트 해시 누적기
+		class RGStructuralHasher
+		{
+		public:
+			void add(const void* data, size_t size)
+			{
+				const auto* bytes = static_cast<const uint8_t*>(data);
+				for (size_t i = 0; i < size; ++i) {
+					hash_ ^= bytes[i];
+					hash_ *= 1099511628211ull;
+				}
+			}
+
+			void add(uint64_t value) { add(&value, sizeof(value)); }
+
+			void add(const std::string& value)
+			{
+				add(static_cast<uint64_t>(value.size()));
+				add(value.data(), value.size());
+			}
+
+			uint64_t get() const { return hash_; }
+
+		private:
+			uint64_t hash_ = 14695981039346656037ull;
+		};
+	}
+
+	uint64_t RenderGraph::computeStructuralHash() const
+	{
+		RGStructuralHasher hasher;
+
+		hasher.add(static_cast<uint64_t>(builder_.textures_.size()));
+		for (const auto& node : builder_.textures_) {
+			const auto& desc = node.desc;
+			hasher.add(desc.name);
+			hasher.add(desc.width);
+			hasher.add(desc.height);
+			hasher.add(desc.depth);
+			hasher.add(desc.mipLevels);
+			hasher.add(desc.arrayLayers);
+			hasher.add(static_cast<uint64_t>(desc.format));
+			hasher.add(static_cast<uint64_t>(desc.samples));
+			hasher.add(static_cast<uint64_t>(desc.usage));
+			hasher.add(desc.isImported ? 1u : 0u);
+			hasher.add(node.isSideEffect ? 1u : 0u);
+			// Imported 핸들과 초기 레이아웃은 배리어에 그대로 기록되므로 구조의 일부
+			if (desc.isImported) {
+				hasher.add(node.importedImage.getIndex());
+				hasher.add(node.importedImage.getGeneration());
+				hasher.add(static_cast<uint64_t>(node.initialLayout));
+			}
+		}
+
+		hasher.add(static_cast<uint64_t>(builder_.buffers_.size()));
+		for (const auto& node : builder_.buffers_) {
+			const auto& desc = node.desc;
+			hasher.add(desc.name);
+			hasher.add(static_cast<uint64_t>(desc.size));
+			hasher.add(static_cast<uint64_t>(desc.usage));
+			hasher.add(desc.isImported ? 1u : 0u);
+			hasher.add(node.isSideEffect ? 1u : 0u);
+			// resolver 핸들은 프레임마다 바뀔 수 있으므로 구조가 아니라 배리어 입력으로만 취급
+			if (node.resolver) {
+				hasher.add(2u);
+			} else if (desc.isImported) {
+				hasher.add(node.importedBuffer.getIndex());
+				hasher.add(node.importedBuffer.getGeneration());
+			}
+		}
+
+		hasher.add(static_cast<uint64_t>(passes_.size()));
+		for (const auto& pass : passes_) {
+			hasher.add(pass->getName());
+			hasher.add(pass->hasSideEffect() ? 1u : 0u);
+			hasher.add(static_cast<uint64_t>(pass->getQueue()));
+
+			const auto& dependencies = pass->getDependencies();
+			hasher.add(static_cast<uint64_t>(dependencies.size()));
+			for (const auto& dep : dependencies) {
+				hasher.add(dep.isTexture ? 1u : 0u);
+				hasher.add(dep.isTexture ? dep.texture.index : dep.buffer.index);
+				hasher.add(static_cast<uint64_t>(dep.accessType));
+				hasher.add(static_cast<uint64_t>(dep.usage));
+			}
+		}
+
+		auto finalOutput = builder_.getFinalOutput();
+		hasher.add(finalOutput.isValid() ? static_cast<uint64_t>(finalOutput.index) : ~0ull);
+
+		return hasher.get();
+	}
+
+	bool RenderGraph::resolveImportedBuffers()
+	{
+		bool changed = false;
+		resolvedBuffers_.resize(builder_.buffers_.size());
+
+		for (size_t i = 0; i < builder_.buffers_.size(); ++i) {
+			auto& node = builder_.buffers_[i];
+			if (!node.resolver) {
+				continue;
+			}
+
+			node.importedBuffer = node.resolver();
+			if (node.importedBuffer != resolvedBuffers_[i]) {
+				resolvedBuffers_[i] = node.importedBuffer;
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+
+	bool RenderGraph::restoreCachedSchedule()
+	{
+		sortedPasses_.clear();
+
+		for (auto& pass : passes_) {
+			pass->setCulled(true);
+		}
+
+		for (uint32_t order = 0; order < static_cast<uint32_t>(cachedSchedule_.size()); ++order) {
+			const uint32_t index = cachedSchedule_[order];
+			if (index >= passes_.size()) {
+				sortedPasses_.clear();
+				return false;
+			}
+
+			RGPassBase* pass = passes_[index].get();
+			pass->setCulled(false);
+			pass->setExecutionOrder(order);
+			sortedPasses_.push_back(pass);
+		}
+
+		return true;
+	}
+
+	void RenderGraph::resolvePassQueues()
+	{
+		passQueues_.assign(passes_.size(), RHIQueueType::Graphics);
+
+		const RGTextureHandle finalOutput = builder_.getFinalOutput();
+
+		for (size_t i = 0; i < passes_.size(); ++i) {
+			const auto& pass = passes_[i];
+			RHIQueueType queue = pass->getQueue();
+
+			if (queue == RHIQueueType::Graphics || !rhi_->hasDedicatedQueue(queue)) {
+				continue;
+			}
+
+			// 프레임 밖에서 Graphics 큐가 소유하는 리소스는 소유권 이전 없이 Graphics 큐에서 접근
+			// (Imported 리소스의 프레임 경계 Release/Acquire는 아직 없음 → 현재 렌더러 패스는 모두 Graphics)
+			bool touchesExternal = false;
+			for (const auto& dep : pass->getDependencies()) {
+				if (dep.isTexture) {
+					if (dep.texture.isValid() && dep.texture.index < builder_.textures_.size()) {
+						const auto& node = builder_.textures_[dep.texture.index];
+						touchesExternal |= node.desc.isImported || node.isSideEffect || dep.texture == finalOutput;
+					}
+				} else if (dep.buffer.isValid() && dep.buffer.index < builder_.buffers_.size()) {
+					const auto& node = builder_.buffers_[dep.buffer.index];
+					touchesExternal |= node.desc.isImported || node.isSideEffect;
+				}
+			}
+
+			if (touchesExternal) {
+				std::cout << "[RenderGraph] " << pass->getName() << ": uses external resource, running on "
+					<< getQueueName(RHIQueueType::Graphics) << " queue instead of " << getQueueName(queue) << std::endl;
+				continue;
+			}
+
+			passQueues_[i] = queue;
+		}
+	}
+
 	void RenderGraph::topologicalSort()
 	{
 		sortedPasses_.clear();
+		cachedSchedule_.clear();
 
 		if (passes_.empty()) {
 			return;
 		}
 
 		// 각 패스의 진입 차수(indegree) 계산
-		std::vector<int> indegree(passes_.size(), 0);
-		std::vector<std::vector<int>> adjList(passes_.size());
+		const uint32_t passCount = static_cast<uint32_t>(passes_.size());
+		std::vector<int> indegree(passCount, 0);
+		std::vector<std::vector<int>> adjList(passCount);
 
-		// 의존성 그래프 구축
-		for (size_t i = 0; i < passes_.size(); ++i) {
+		// 리소스별 "마지막 Writer / 마지막 쓰기 이후의 Reader" 테이블
+		struct ResourceAccessState
+		{
+			uint32_t lastWriter = UINT32_MAX;
+			std::vector<uint32_t> readers;
+		};
+		std::vector<ResourceAccessState> textureStates(builder_.textures_.size());
+		std::vector<ResourceAccessState> bufferStates(builder_.buffers_.size());
+
+		// 패스 i로 들어오는 간선 중복 제거 (edgeStamp[j] == i 이면 j → i 이미 추가됨)
+		std::vector<uint32_t> edgeStamp(passCount, UINT32_MAX);
+
+		auto addEdge = [&](uint32_t from, uint32_t to) {
+			if (from == UINT32_MAX || from == to || edgeStamp[from] == to) {
+				return;
+			}
+			edgeStamp[from] = to;
+			adjList[from].push_back(static_cast<int>(to));
+			indegree[to]++;
+		};
+
+		// 의존성 그래프 구축: 패스 선언 순서대로 한 번만 순회 (O(P·D))
+		for (uint32_t i = 0; i < passCount; ++i) {
 			const auto& pass = passes_[i];
-			
+			if (pass->isCulled()) {
+				continue;
+			}
+
 			for (const auto& dep : pass->getDependencies()) {
-				// Read 의존성: 이전에 Write한 패스를 찾음
-				if (dep.accessType == RGResourceAccessType::Read || 
-				    dep.accessType == RGResourceAccessType::ReadWrite) {
-					
-					for (size_t j = 0; j < i; ++j) {
-						const auto& prevPass = passes_[j];
-						
-						for (const auto& prevDep : prevPass->getDependencies()) {
-							if (prevDep.accessType == RGResourceAccessType::Write ||
-							    prevDep.accessType == RGResourceAccessType::ReadWrite) {
-								
-								bool sameResource = false;
-								if (dep.isTexture && prevDep.isTexture && dep.texture == prevDep.texture) {
-									sameResource = true;
-								} else if (!dep.isTexture && !prevDep.isTexture && dep.buffer == prevDep.buffer) {
-									sameResource = true;
-								}
-
-								if (sameResource) {
-									adjList[j].push_back(static_cast<int>(i));
-									indegree[i]++;
-								}
-							}
-						}
+				ResourceAccessState* state = nullptr;
+				if (dep.isTexture && dep.texture.isValid() && dep.texture.index < textureStates.size()) {
+					state = &textureStates[dep.texture.index];
+				} else if (!dep.isTexture && dep.buffer.isValid() && dep.buffer.index < bufferStates.size()) {
+					state = &bufferStates[dep.buffer.index];
+				}
+				if (!state) {
+					continue;
+				}
+
+				const bool reads = dep.accessType != RGResourceAccessType::Write;
+				const bool writes = dep.accessType != RGResourceAccessType::Read;
+
+				// RAW (읽기) 또는 WAW (쓰기): 마지막 Writer 이후에 실행
+				addEdge(state->lastWriter, i);
+
+				if (writes) {
+					// WAR: 마지막 쓰기 이후의 Reader들이 모두 끝난 뒤에 덮어씀
+					for (uint32_t reader : state->readers) {
+						addEdge(reader, i);
 					}
+					state->readers.clear();
+					state->lastWriter = i;
+				} else if (reads) {
+					state->readers.push_back(i);
 				}
 			}
 		}
 
-		// Kahn's Algorithm을 사용한 Topological Sort
-		std::queue<int> q;
-		for (size_t i = 0; i < passes_.size(); ++i) {
+		// 준비된 패스 선택 우선순위: Async 큐 패스 → Async 패스의 선행 패스 → 나머지 (같으면 선언 순서)
+		// Async 작업을 최대한 일찍 제출해야 뒤따르는 Graphics 작업과 겹쳐 실행될 수 있음
+		auto isAsync = [this](uint32_t i) {
+			return i < passQueues_.size() && passQueues_[i] != RHIQueueType::Graphics;
+		};
+
+		// 간선은 항상 선언 순서가 앞선 패스 → 뒤의 패스이므로 역순 한 번으로 계산 가능
+		std::vector<uint8_t> feedsAsync(passCount, 0);
+		for (uint32_t i = passCount; i-- > 0;) {
+			for (int next : adjList[i]) {
+				if (isAsync(static_cast<uint32_t>(next)) || feedsAsync[next]) {
+					feedsAsync[i] = 1;
+					break;
+				}
+			}
+		}
+
+		auto rankOf = [&](uint32_t i) -> uint32_t {
+			return isAsync(i) ? 0u : (feedsAsync[i] ? 1u : 2u);
+		};
+
+		// Kahn's Algorithm을 사용한 Topological Sort (우선순위 큐)
+		using ReadyEntry = std::pair<uint32_t, uint32_t>; // (rank, 패스 인덱스)
+		std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> ready;
+		size_t livePassCount = 0;
+		for (uint32_t i = 0; i < passCount; ++i) {
+			if (passes_[i]->isCulled()) {
+				continue;
+			}
+			livePassCount++;
 			if (indegree[i] == 0) {
-				q.push(static_cast<int>(i));
+				ready.emplace(rankOf(i), i);
 			}
 		}
 
-		while (!q.empty()) {
-			int idx = q.front();
-			q.pop();
+		while (!ready.empty()) {
+			const uint32_t idx = ready.top().second;
+			ready.pop();
 
 			sortedPasses_.push_back(passes_[idx].get());
+			cachedSchedule_.push_back(idx);
 			passes_[idx]->setExecutionOrder(static_cast<uint32_t>(sortedPasses_.size()) - 1);
 
 			for (int next : adjList[idx]) {
 				indegree[next]--;
 				if (indegree[next] == 0) {
-					q.push(next);
+					ready.emplace(rankOf(static_cast<uint32_t>(next)), static_cast<uint32_t>(next));
 				}
 			}
 		}
 
 		// 순환 의존성 체크
-		if (sortedPasses_.size() != passes_.size()) {
+		if (sortedPasses_.size() != livePassCount) {
 			std::cerr << "[RenderGraph] Error: Circular dependency detected!" << std::endl;
 			sortedPasses_.clear();
+			cachedSchedule_.clear();
+		}
+	}
+
+	void RenderGraph::computeResourceLifetimes()
+	{
+		// Builder의 firstUse/lastUse는 패스 추가 순서 기준이므로 실행 순서 기준으로 다시 계산
+		for (auto& node : builder_.textures_) {
+			node.firstUse = UINT32_MAX;
+			node.lastUse = 0;
 		}
+		for (auto& node : builder_.buffers_) {
+			node.firstUse = UINT32_MAX;
+			node.lastUse = 0;
+		}
+
+		for (uint32_t order = 0; order < static_cast<uint32_t>(sortedPasses_.size()); ++order) {
+			for (const auto& dep : sortedPasses_[order]->getDependencies()) {
+				if (dep.isTexture) {
+					if (!dep.texture.isValid() || dep.texture.index >= builder_.textures_.size()) {
+						continue;
+					}
+					auto& node = builder_.textures_[dep.texture.index];
+					node.firstUse = std::min(node.firstUse, order);
+					node.lastUse = std::max(node.lastUse, order);
+				} else {
+					if (!dep.buffer.isValid() || dep.buffer.index >= builder_.buffers_.size()) {
+						continue;
+					}
+					auto& node = builder_.buffers_[dep.buffer.index];
+					node.firstUse = std::min(node.firstUse, order);
+					node.lastUse = std::max(node.lastUse, order);
+				}
+			}
+		}
+
+		// 최종 출력은 그래프 실행 이후에도 읽히므로 다른 리소스와 공유하지 않음
+		auto finalOutput = builder_.getFinalOutput();
+		if (finalOutput.isValid() && finalOutput.index < builder_.textures_.size()) {
+			builder_.textures_[finalOutput.index].lastUse = UINT32_MAX;
+		}
+	}
+
+	static uint32_t getFormatBytesPerPixel(RHIFormat format)
+	{
+		// RHIFormat 값은 VkFormat과 동일한 순서를 따름
+		if (format == RHI_FORMAT_UNDEFINED) return 0;
+		if (format == RHI_FORMAT_R4G4_UNORM_PACK8) return 1;
+		if (format <= RHI_FORMAT_A1R5G5B5_UNORM_PACK16) return 2;
+		if (format <= RHI_FORMAT_R8_SRGB) return 1;
+		if (format <= RHI_FORMAT_R8G8_SRGB) return 2;
+		if (format <= RHI_FORMAT_B8G8R8_SRGB) return 3;
+		if (format <= RHI_FORMAT_A2B10G10R10_SINT_PACK32) return 4;
+		if (format <= RHI_FORMAT_R16_SFLOAT) return 2;
+		if (format <= RHI_FORMAT_R16G16_SFLOAT) return 4;
+		if (format <= RHI_FORMAT_R16G16B16_SFLOAT) return 6;
+		if (format <= RHI_FORMAT_R16G16B16A16_SFLOAT) return 8;
+		if (format <= RHI_FORMAT_R32_SFLOAT) return 4;
+		if (format <= RHI_FORMAT_R32G32_SFLOAT) return 8;
+		if (format <= RHI_FORMAT_R32G32B32_SFLOAT) return 12;
+		if (format <= RHI_FORMAT_R32G32B32A32_SFLOAT) return 16;
+		if (format <= RHI_FORMAT_R64_SFLOAT) return 8;
+		if (format <= RHI_FORMAT_R64G64_SFLOAT) return 16;
+		if (format <= RHI_FORMAT_R64G64B64_SFLOAT) return 24;
+		if (format <= RHI_FORMAT_R64G64B64A64_SFLOAT) return 32;
+		if (format <= RHI_FORMAT_E5B9G9R9_UFLOAT_PACK32) return 4;
+		if (format == RHI_FORMAT_D16_UNORM) return 2;
+		if (format == RHI_FORMAT_S8_UINT) return 1;
+		if (format == RHI_FORMAT_D32_SFLOAT_S8_UINT) return 8;
+		if (format <= RHI_FORMAT_D24_UNORM_S8_UINT) return 4;
+
+		// 압축 포맷은 대략 텍셀당 1바이트로 추정
+		return 1;
+	}
+
+	static uint64_t estimateTextureSize(const RHIImageCreateInfo& info)
+	{
+		uint64_t total = 0;
+		uint64_t width = info.width;
+		uint64_t height = info.height;
+		uint64_t depth = info.depth;
+
+		for (uint32_t mip = 0; mip < std::max(info.mipLevels, 1u); ++mip) {
+			total += width * height * depth;
+			width = std::max<uint64_t>(width / 2, 1);
+			height = std::max<uint64_t>(height / 2, 1);
+			depth = std::max<uint64_t>(depth / 2, 1);
+		}
+
+		return total * getFormatBytesPerPixel(info.format) *
+			std::max(info.arrayLayers, 1u) * static_cast<uint64_t>(info.samples);
+	}
+
+	static bool isAliasCompatible(const RHIImageCreateInfo& a, const RHIImageCreateInfo& b)
+	{
+		return a.width == b.width && a.height == b.height && a.depth == b.depth &&
+			a.mipLevels == b.mipLevels && a.arrayLayers == b.arrayLayers &&
+			a.format == b.format && a.samples == b.samples &&
+			a.tiling == b.tiling && a.flags == b.flags;
 	}
 
 	void RenderGraph::allocateResources()
 	{
+		computeResourceLifetimes();
+		memoryStats_ = {};
+
+		// 이전 컴파일의 물리 리소스는 재사용 후보로 보관 (남은 것만 마지막에 해제)
+		std::vector<PhysicalTexture> previousTextures = std::move(physicalTextures_);
+		std::vector<PhysicalBuffer> previousBuffers = std::move(physicalBuffers_);
+		physicalTextures_.clear();
+		physicalBuffers_.clear();
+		allocatedTextures_.clear();
+		allocatedBuffers_.clear();
+
+		const uint32_t passCount = static_cast<uint32_t>(sortedPasses_.size());
+
+		// ========================================
 		// 텍스처 할당
-		for (size_t i = 0; i < builder_.textures_.size(); ++i) {
+		// ========================================
+
+		// firstUse 순으로 정렬 후 탐욕적으로 배정 (Interval Graph Coloring)
+		std::vector<uint32_t> textureOrder;
+		for (uint32_t i = 0; i < builder_.textures_.size(); ++i) {
+			// Imported 리소스와 Culling된 리소스(참조하는 패스 없음)는 건너뜀
 			const auto& node = builder_.textures_[i];
-			
-			// Imported 리소스는 건너뜀
-			if (node.desc.isImported) {
-				continue;
+			if (!node.desc.isImported && node.refCount > 0) {
+				textureOrder.push_back(i);
 			}
+		}
+		std::stable_sort(textureOrder.begin(), textureOrder.end(), [this](uint32_t a, uint32_t b) {
+			return builder_.textures_[a].firstUse < builder_.textures_[b].firstUse;
+		});
+
+		std::vector<std::pair<uint32_t, uint32_t>> textureAssignments; // (가상, 물리)
+		std::vector<uint64_t> textureSizes(builder_.textures_.size(), 0);
+
+		for (uint32_t index : textureOrder) {
+			const auto& node = builder_.textures_[index];
 
-			// RHI를 통해 텍스처 생성
 			RHIImageCreateInfo createInfo{};
 			createInfo.width = node.desc.width;
 			createInfo.height = node.desc.height;
@@ -233,59 +776,867 @@ namespace BinRenderer
 			createInfo.samples = node.desc.samples;
 			createInfo.usage = node.desc.usage;
 
-			RHIImageHandle image = rhi_->createImage(createInfo);
-			allocatedTextures_[static_cast<uint32_t>(i)] = image;
+			const uint64_t size = estimateTextureSize(createInfo);
+			textureSizes[index] = size;
+			memoryStats_.naiveBytes += size;
+			memoryStats_.virtualTextures++;
+
+			// 수명이 끝난 호환 물리 텍스처 탐색
+			uint32_t physicalIndex = UINT32_MAX;
+			for (uint32_t p = 0; p < physicalTextures_.size(); ++p) {
+				auto& physical = physicalTextures_[p];
+				if (physical.lastUse < node.firstUse && isAliasCompatible(physical.createInfo, createInfo)) {
+					physicalIndex = p;
+					break;
+				}
+			}
+
+			if (physicalIndex == UINT32_MAX) {
+				PhysicalTexture physical;
+				physical.createInfo = createInfo;
+				physical.lastUse = node.lastUse;
+				physical.sizeInBytes = size;
+				physicalIndex = static_cast<uint32_t>(physicalTextures_.size());
+				physicalTextures_.push_back(physical);
+			} else {
+				auto& physical = physicalTextures_[physicalIndex];
+				physical.lastUse = node.lastUse;
+				physical.createInfo.usage |= createInfo.usage;
+			}
+
+			textureAssignments.emplace_back(index, physicalIndex);
 		}
 
+		// RHI를 통해 물리 텍스처 생성 (생성 정보가 같은 이전 이미지는 그대로 재사용)
+		for (auto& physical : physicalTextures_) {
+			auto reusable = std::find_if(previousTextures.begin(), previousTextures.end(),
+				[&physical](const PhysicalTexture& previous) {
+					return previous.image.isValid() &&
+						previous.createInfo.usage == physical.createInfo.usage &&
+						isAliasCompatible(previous.createInfo, physical.createInfo);
+				});
+
+			if (reusable != previousTextures.end()) {
+				physical.image = reusable->image;
+				reusable->image = {};
+				compileStats_.texturesReused++;
+			} else {
+				physical.image = rhi_->createImage(physical.createInfo);
+				compileStats_.texturesCreated++;
+			}
+			memoryStats_.allocatedBytes += physical.sizeInBytes;
+		}
+
+		for (auto& previous : previousTextures) {
+			if (previous.image.isValid()) {
+				rhi_->destroyImage(previous.image);
+			}
+		}
+		memoryStats_.physicalTextures = static_cast<uint32_t>(physicalTextures_.size());
+
+		for (const auto& [virtualIndex, physicalIndex] : textureAssignments) {
+			allocatedTextures_[virtualIndex] = physicalTextures_[physicalIndex].image;
+		}
+
+		// ========================================
 		// 버퍼 할당
-		for (size_t i = 0; i < builder_.buffers_.size(); ++i) {
+		// ========================================
+
+		std::vector<uint32_t> bufferOrder;
+		for (uint32_t i = 0; i < builder_.buffers_.size(); ++i) {
+			// Imported 리소스와 Culling된 리소스(참조하는 패스 없음)는 건너뜀
 			const auto& node = builder_.buffers_[i];
-			
-			// Imported 리소스는 건너뜀
-			if (node.desc.isImported) {
-				continue;
+			if (!node.desc.isImported && node.refCount > 0) {
+				bufferOrder.push_back(i);
 			}
+		}
+		std::stable_sort(bufferOrder.begin(), bufferOrder.end(), [this](uint32_t a, uint32_t b) {
+			return builder_.buffers_[a].firstUse < builder_.buffers_[b].firstUse;
+		});
 
-			// RHI를 통해 버퍼 생성
-			RHIBufferCreateInfo createInfo{};
-			createInfo.size = node.desc.size;
-			createInfo.usage = node.desc.usage;
+		std::vector<std::pair<uint32_t, uint32_t>> bufferAssignments; // (가상, 물리)
+
+		for (uint32_t index : bufferOrder) {
+			const auto& node = builder_.buffers_[index];
+
+			memoryStats_.naiveBytes += node.desc.size;
+			memoryStats_.virtualBuffers++;
+
+			// 같은 usage를 가진 버퍼 중 크기 차이가 가장 작은 것 선택 (Best Fit)
+			uint32_t physicalIndex = UINT32_MAX;
+			RHIDeviceSize bestDiff = ~RHIDeviceSize(0);
+			for (uint32_t p = 0; p < physicalBuffers_.size(); ++p) {
+				const auto& physical = physicalBuffers_[p];
+				if (physical.lastUse >= node.firstUse || physical.createInfo.usage != node.desc.usage) {
+					continue;
+				}
+
+				RHIDeviceSize diff = physical.createInfo.size > node.desc.size
+					? physical.createInfo.size - node.desc.size
+					: node.desc.size - physical.createInfo.size;
+				if (diff < bestDiff) {
+					bestDiff = diff;
+					physicalIndex = p;
+				}
+			}
+
+			if (physicalIndex == UINT32_MAX) {
+				PhysicalBuffer physical;
+				physical.createInfo.size = node.desc.size;
+				physical.createInfo.usage = node.desc.usage;
+				physical.lastUse = node.lastUse;
+				physicalIndex = static_cast<uint32_t>(physicalBuffers_.size());
+				physicalBuffers_.push_back(physical);
+			} else {
+				auto& physical = physicalBuffers_[physicalIndex];
+				physical.lastUse = node.lastUse;
+				physical.createInfo.size = std::max(physical.createInfo.size, node.desc.size);
+			}
+
+			bufferAssignments.emplace_back(index, physicalIndex);
+		}
+
+		// RHI를 통해 물리 버퍼 생성 (크기와 usage가 같은 이전 버퍼는 그대로 재사용)
+		for (auto& physical : physicalBuffers_) {
+			auto reusable = std::find_if(previousBuffers.begin(), previousBuffers.end(),
+				[&physical](const PhysicalBuffer& previous) {
+					return previous.buffer.isValid() &&
+						previous.createInfo.size == physical.createInfo.size &&
+						previous.createInfo.usage == physical.createInfo.usage;
+				});
+
+			if (reusable != previousBuffers.end()) {
+				physical.buffer = reusable->buffer;
+				reusable->buffer = {};
+				compileStats_.buffersReused++;
+			} else {
+				physical.buffer = rhi_->createBuffer(physical.createInfo);
+				compileStats_.buffersCreated++;
+			}
+			memoryStats_.allocatedBytes += physical.createInfo.size;
+		}
+
+		for (auto& previous : previousBuffers) {
+			if (previous.buffer.isValid()) {
+				rhi_->destroyBuffer(previous.buffer);
+			}
+		}
+		memoryStats_.physicalBuffers = static_cast<uint32_t>(physicalBuffers_.size());
+
+		for (const auto& [virtualIndex, physicalIndex] : bufferAssignments) {
+			allocatedBuffers_[virtualIndex] = physicalBuffers_[physicalIndex].buffer;
+		}
+
+		// ========================================
+		// Peak 메모리 계산 (동시에 살아있는 리소스의 최대 합)
+		// ========================================
+
+		for (uint32_t order = 0; order < passCount; ++order) {
+			uint64_t liveBytes = 0;
+			for (uint32_t index : textureOrder) {
+				const auto& node = builder_.textures_[index];
+				if (node.firstUse <= order && order <= node.lastUse) {
+					liveBytes += textureSizes[index];
+				}
+			}
+			for (uint32_t index : bufferOrder) {
+				const auto& node = builder_.buffers_[index];
+				if (node.firstUse <= order && order <= node.lastUse) {
+					liveBytes += node.desc.size;
+				}
+			}
+			memoryStats_.peakBytes = std::max(memoryStats_.peakBytes, liveBytes);
+		}
+	}
+
+	// ========================================
+	// 배리어 생성
+	// ========================================
+
+	namespace
+	{
+		// 의존성 하나가 요구하는 동기화 정보
+		struct RGAccessInfo
+		{
+			RHIPipelineStageFlags stage = 0;
+			RHIAccessFlags access = 0;
+			RHIImageLayout layout = RHI_IMAGE_LAYOUT_UNDEFINED;
+			bool isWrite = false;
+		};
+
+		// 물리 리소스별 마지막 접근 상태
+		struct RGResourceState
+		{
+			RHIImageLayout layout = RHI_IMAGE_LAYOUT_UNDEFINED;
+			RHIPipelineStageFlags writeStages = 0;   // 마지막 쓰기(레이아웃 전환 포함) 스테이지
+			RHIAccessFlags writeAccess = 0;
+			RHIPipelineStageFlags readStages = 0;    // 마지막 쓰기 이후 읽은 스테이지
+			RHIPipelineStageFlags visibleStages = 0; // 마지막 쓰기가 이미 보이는 스테이지
+			RHIAccessFlags visibleAccess = 0;
+			uint32_t owner = UINT32_MAX;             // 현재 물리 리소스를 점유한 가상 리소스
+			RHIQueueType queue = RHIQueueType::Graphics; // 현재 소유 큐 (= 마지막으로 접근한 큐)
+			uint32_t lastAccessOrder = UINT32_MAX;   // 마지막으로 접근한 패스의 실행 순서
+		};
+
+		constexpr RHIPipelineStageFlags kShaderStages =
+			RHI_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+			RHI_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+			RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+		constexpr RHIAccessFlags kWriteAccessMask =
+			RHI_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+			RHI_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+			RHI_ACCESS_TRANSFER_WRITE_BIT |
+			RHI_ACCESS_SHADER_WRITE_BIT |
+			RHI_ACCESS_HOST_WRITE_BIT |
+			RHI_ACCESS_MEMORY_WRITE_BIT;
+
+		bool isDepthFormat(RHIFormat format)
+		{
+			return format >= RHI_FORMAT_D16_UNORM && format <= RHI_FORMAT_D32_SFLOAT_S8_UINT;
+		}
+
+		RGAccessInfo resolveAccess(const RGResourceDependency& dep, bool isDepth)
+		{
+			const bool reads = dep.accessType != RGResourceAccessType::Write;
+			const bool writes = dep.accessType != RGResourceAccessType::Read;
+
+			// Auto: 포맷과 접근 타입으로 사용 방식 추론
+			RGResourceUsage usage = dep.usage;
+			if (usage == RGResourceUsage::Auto) {
+				if (dep.isTexture) {
+					if (dep.accessType == RGResourceAccessType::Read) {
+						usage = isDepth ? RGResourceUsage::DepthStencilRead : RGResourceUsage::ShaderRead;
+					} else if (dep.accessType == RGResourceAccessType::Write) {
+						usage = isDepth ? RGResourceUsage::DepthStencilAttachment : RGResourceUsage::ColorAttachment;
+					} else {
+						usage = isDepth ? RGResourceUsage::DepthStencilAttachment : RGResourceUsage::Storage;
+					}
+				} else {
+					usage = writes ? RGResourceUsage::Storage : RGResourceUsage::ShaderRead;
+				}
+			}
+
+			RGAccessInfo info;
+			info.isWrite = writes;
+
+			switch (usage) {
+			case RGResourceUsage::ColorAttachment:
+				info.stage = RHI_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+				info.access = RHI_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+					(reads ? RHI_ACCESS_COLOR_ATTACHMENT_READ_BIT : 0);
+				info.layout = RHI_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+				info.isWrite = true;
+				break;
+
+			case RGResourceUsage::DepthStencilAttachment:
+				info.stage = RHI_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | RHI_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+				info.access = RHI_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | RHI_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+				info.layout = RHI_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+				info.isWrite = true;
+				break;
+
+			case RGResourceUsage::DepthStencilRead:
+				info.stage = RHI_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | RHI_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | kShaderStages;
+				info.access = RHI_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | RHI_ACCESS_SHADER_READ_BIT;
+				info.layout = RHI_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::ShaderRead:
+				info.stage = kShaderStages;
+				info.access = RHI_ACCESS_SHADER_READ_BIT;
+				info.layout = RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::Storage:
+				info.stage = kShaderStages;
+				info.access = (reads ? RHI_ACCESS_SHADER_READ_BIT : 0) | (writes ? RHI_ACCESS_SHADER_WRITE_BIT : 0);
+				info.layout = RHI_IMAGE_LAYOUT_GENERAL;
+				break;
+
+			case RGResourceUsage::TransferSrc:
+				info.stage = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+				info.access = RHI_ACCESS_TRANSFER_READ_BIT;
+				info.layout = RHI_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::TransferDst:
+				info.stage = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+				info.access = RHI_ACCESS_TRANSFER_WRITE_BIT;
+				info.layout = RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+				info.isWrite = true;
+				break;
+
+			case RGResourceUsage::VertexBuffer:
+				info.stage = RHI_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+				info.access = RHI_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::IndexBuffer:
+				info.stage = RHI_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+				info.access = RHI_ACCESS_INDEX_READ_BIT;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::IndirectBuffer:
+				info.stage = RHI_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+				info.access = RHI_ACCESS_INDIRECT_COMMAND_READ_BIT;
+				info.isWrite = false;
+				break;
+
+			case RGResourceUsage::UniformBuffer:
+				info.stage = kShaderStages;
+				info.access = RHI_ACCESS_UNIFORM_READ_BIT;
+				info.isWrite = false;
+				break;
+
+			default:
+				break;
+			}
+
+			return info;
+		}
+
+		/**
+		 * @brief 큐가 지원하지 않는 스테이지를 해당 큐에서 유효한 스테이지로 변환
+		 */
+		RHIPipelineStageFlags maskStagesForQueue(RHIPipelineStageFlags stages, RHIQueueType queue)
+		{
+			constexpr RHIPipelineStageFlags kCommonStages =
+				RHI_PIPELINE_STAGE_TOP_OF_PIPE_BIT |
+				RHI_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT |
+				RHI_PIPELINE_STAGE_TRANSFER_BIT |
+				RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+			RHIPipelineStageFlags masked = stages;
+			if (queue == RHIQueueType::Compute) {
+				// 셰이더 스테이지 선언(kShaderStages)은 Compute 큐에서 Compute 셰이더만 의미가 있음
+				masked &= kCommonStages | RHI_PIPELINE_STAGE_DRAW_INDIRECT_BIT | RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+				if (stages & kShaderStages) {
+					masked |= RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+				}
+			} else if (queue == RHIQueueType::Transfer) {
+				masked &= kCommonStages;
+			}
+
+			return (stages != 0 && masked == 0) ? RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT : masked;
+		}
+
+		/**
+		 * @brief 상태 전이 계산: 배리어가 필요하면 true를 반환하고 src/dst 정보를 채움
+		 */
+		bool transitionState(RGResourceState& state, const RGAccessInfo& info, uint32_t owner, bool isImage,
+			RHIPipelineStageFlags& srcStage, RHIAccessFlags& srcAccess, RHIImageLayout& oldLayout)
+		{
+			srcStage = state.writeStages | state.readStages;
+			srcAccess = state.writeAccess;
+			oldLayout = state.layout;
+
+			const bool ownerChanged = state.owner != owner;
+			const bool layoutChanged = isImage && state.layout != info.layout;
+			bool needsBarrier = false;
+
+			if (ownerChanged) {
+				// 처음 사용되거나 Aliasing으로 다른 가상 리소스가 쓰던 메모리: 이전 내용은 폐기하지만
+				// 이전 쓰기가 새 쓰기 뒤에 반영되지 않도록 (WAW) srcAccess는 유지
+				oldLayout = RHI_IMAGE_LAYOUT_UNDEFINED;
+				needsBarrier = isImage || srcStage != 0;
+			} else if (layoutChanged) {
+				needsBarrier = true;
+			} else if (info.isWrite) {
+				// WAW / WAR
+				needsBarrier = srcStage != 0;
+			} else {
+				// RAW: 마지막 쓰기가 아직 보이지 않는 스테이지/접근이 있을 때만
+				srcStage = state.writeStages;
+				needsBarrier = state.writeStages != 0 &&
+					((info.stage & ~state.visibleStages) != 0 || (info.access & ~state.visibleAccess) != 0);
+			}
+
+			// 상태 갱신
+			state.owner = owner;
+			if (isImage) {
+				state.layout = info.layout;
+			}
+
+			if (info.isWrite || ownerChanged || layoutChanged) {
+				// 레이아웃 전환도 쓰기로 취급
+				state.writeStages = info.stage;
+				state.writeAccess = info.access & kWriteAccessMask;
+				state.readStages = info.isWrite ? 0 : info.stage;
+				state.visibleStages = info.stage;
+				state.visibleAccess = info.access;
+			} else {
+				state.readStages |= info.stage;
+				if (needsBarrier) {
+					state.visibleStages |= info.stage;
+					state.visibleAccess |= info.access;
+				}
+			}
+
+			if (srcStage == 0) {
+				srcStage = RHI_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+			}
+
+			return needsBarrier;
+		}
+
+		/**
+		 * @brief 다른 큐가 마지막으로 접근한 리소스의 상태 전이
+		 *        세마포어 대기가 이전 큐 작업과의 실행/메모리 의존성을 보장하므로 이전 큐의 스테이지 정보는 버림
+		 * @return 내용을 유지해야 해서 소유권 이전(Release/Acquire)이 필요하면 true
+		 *         (false면 내용 폐기이므로 transitionState로 일반 배리어를 만들면 됨)
+		 */
+		bool transferQueue(RGResourceState& state, const RGAccessInfo& info, uint32_t owner, bool isImage,
+			RHIPipelineStageFlags& releaseStage, RHIAccessFlags& releaseAccess, RHIImageLayout& oldLayout)
+		{
+			releaseStage = state.writeStages | state.readStages;
+			releaseAccess = state.writeAccess;
+			oldLayout = state.layout;
+
+			state.writeStages = 0;
+			state.writeAccess = 0;
+			state.readStages = 0;
+			state.visibleStages = 0;
+			state.visibleAccess = 0;
+
+			if (state.owner != owner) {
+				return false;
+			}
+
+			// Acquire 배리어가 레이아웃 전환까지 수행하므로 쓰기로 취급
+			if (isImage) {
+				state.layout = info.layout;
+			}
+			state.writeStages = info.stage;
+			state.writeAccess = info.access & kWriteAccessMask;
+			state.readStages = info.isWrite ? 0 : info.stage;
+			state.visibleStages = info.stage;
+			state.visibleAccess = info.access;
+
+			if (releaseStage == 0) {
+				releaseStage = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			}
+
+			return true;
+		}
+	}
+
+	void RenderGraph::buildBarriers()
+	{
+		passBarriers_.assign(sortedPasses_.size(), RHIBarrierBatch{});
+		queueBatches_.clear();
+		barrierCount_ = 0;
+		elidedBarrierCount_ = 0;
+
+		auto queueOf = [this](size_t order) {
+			const uint32_t passIndex = order < cachedSchedule_.size() ? cachedSchedule_[order] : UINT32_MAX;
+			return passIndex < passQueues_.size() ? passQueues_[passIndex] : RHIQueueType::Graphics;
+		};
+
+		// 실행 순서별로 속한 QueueBatch 인덱스
+		std::vector<uint32_t> passBatch(sortedPasses_.size(), 0);
+
+		std::map<RHIImageHandle, RGResourceState> imageStates;
+		std::map<RHIBufferHandle, RGResourceState> bufferStates;
+
+		// Imported 리소스는 그래프 밖에서 사용되었으므로 보수적인 초기 상태로 시작
+		for (uint32_t i = 0; i < builder_.textures_.size(); ++i) {
+			const auto& node = builder_.textures_[i];
+			if (node.desc.isImported && node.importedImage.isValid()) {
+				RGResourceState state;
+				state.layout = node.initialLayout;
+				state.writeStages = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				state.writeAccess = RHI_ACCESS_MEMORY_WRITE_BIT;
+				state.owner = i;
+				imageStates[node.importedImage] = state;
+			}
+		}
+		for (uint32_t i = 0; i < builder_.buffers_.size(); ++i) {
+			const auto& node = builder_.buffers_[i];
+			if (node.desc.isImported && node.importedBuffer.isValid()) {
+				RGResourceState state;
+				state.writeStages = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				state.writeAccess = RHI_ACCESS_MEMORY_WRITE_BIT;
+				state.owner = i;
+				bufferStates[node.importedBuffer] = state;
+			}
+		}
+
+		// Transient 리소스도 이전 프레임(같은 물리 리소스를 쓰던 패스)이 아직 쓰는 중일 수 있으므로
+		// 소유자 없이 모든 쓰기 상태로 시작 (첫 사용은 내용을 폐기하되 이전 쓰기를 기다림)
+		RGResourceState transientState;
+		transientState.writeStages = RHI_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+		transientState.writeAccess = RHI_ACCESS_MEMORY_WRITE_BIT;
+		for (uint32_t i = 0; i < builder_.textures_.size(); ++i) {
+			RHIImageHandle image = getTexture(RGTextureHandle{ i });
+			if (!builder_.textures_[i].desc.isImported && image.isValid()) {
+				imageStates.try_emplace(image, transientState);
+			}
+		}
+		for (uint32_t i = 0; i < builder_.buffers_.size(); ++i) {
+			RHIBufferHandle buffer = getBuffer(RGBufferHandle{ i });
+			if (!builder_.buffers_[i].desc.isImported && buffer.isValid()) {
+				bufferStates.try_emplace(buffer, transientState);
+			}
+		}
+
+		for (size_t order = 0; order < sortedPasses_.size(); ++order) {
+			const RHIQueueType queue = queueOf(order);
+
+			// 같은 패스 안에서 같은 리소스에 대한 의존성을 하나로 병합
+			std::map<uint32_t, RGAccessInfo> textureAccesses;
+			std::map<uint32_t, RGAccessInfo> bufferAccesses;
+
+			for (const auto& dep : sortedPasses_[order]->getDependencies()) {
+				if (dep.isTexture) {
+					if (!dep.texture.isValid() || dep.texture.index >= builder_.textures_.size()) {
+						continue;
+					}
+					bool isDepth = isDepthFormat(builder_.textures_[dep.texture.index].desc.format);
+					RGAccessInfo info = resolveAccess(dep, isDepth);
+
+					auto [it, inserted] = textureAccesses.try_emplace(dep.texture.index, info);
+					if (!inserted) {
+						auto& merged = it->second;
+						if (merged.layout != info.layout) {
+							merged.layout = RHI_IMAGE_LAYOUT_GENERAL;
+						}
+						merged.stage |= info.stage;
+						merged.access |= info.access;
+						merged.isWrite |= info.isWrite;
+					}
+				} else {
+					if (!dep.buffer.isValid() || dep.buffer.index >= builder_.buffers_.size()) {
+						continue;
+					}
+					RGAccessInfo info = resolveAccess(dep, false);
+
+					auto [it, inserted] = bufferAccesses.try_emplace(dep.buffer.index, info);
+					if (!inserted) {
+						it->second.stage |= info.stage;
+						it->second.access |= info.access;
+						it->second.isWrite |= info.isWrite;
+					}
+				}
+			}
+
+			for (auto& [index, info] : textureAccesses) {
+				info.stage = maskStagesForQueue(info.stage, queue);
+			}
+			for (auto& [index, info] : bufferAccesses) {
+				info.stage = maskStagesForQueue(info.stage, queue);
+			}
+
+			// 다른 큐가 마지막으로 접근한 리소스는 그 패스가 속한 배치의 완료(Timeline 값)를 기다려야 함
+			// 같은 큐의 이전 제출은 큐 순서로 보장되므로 큐별로 가장 늦은 배치 하나만 기다리면 충분
+			std::array<uint32_t, RHI_QUEUE_TYPE_COUNT> waitBatch;
+			std::array<RHIPipelineStageFlags, RHI_QUEUE_TYPE_COUNT> waitStages;
+			waitBatch.fill(UINT32_MAX);
+			waitStages.fill(0);
+
+			auto collectWait = [&](const RGResourceState& state, RHIPipelineStageFlags dstStage) {
+				if (state.lastAccessOrder == UINT32_MAX || state.queue == queue) {
+					return;
+				}
+				const uint32_t q = static_cast<uint32_t>(state.queue);
+				const uint32_t srcBatch = passBatch[state.lastAccessOrder];
+				if (waitBatch[q] == UINT32_MAX || srcBatch > waitBatch[q]) {
+					waitBatch[q] = srcBatch;
+				}
+				waitStages[q] |= dstStage;
+			};
+
+			for (const auto& [index, info] : textureAccesses) {
+				auto it = imageStates.find(getTexture(RGTextureHandle{ index }));
+				if (it != imageStates.end()) {
+					collectWait(it->second, info.stage);
+				}
+			}
+			for (const auto& [index, info] : bufferAccesses) {
+				auto it = bufferStates.find(getBuffer(RGBufferHandle{ index }));
+				if (it != bufferStates.end()) {
+					collectWait(it->second, info.stage);
+				}
+			}
+
+			// 큐가 바뀌거나 현재 배치에 없는 대기가 필요하면 새 배치 시작
+			bool startBatch = queueBatches_.empty() || queueBatches_.back().queue != queue;
+			for (uint32_t q = 0; q < RHI_QUEUE_TYPE_COUNT && !startBatch; ++q) {
+				const uint32_t current = queueBatches_.back().waitBatch[q];
+				startBatch = waitBatch[q] != UINT32_MAX && (current == UINT32_MAX || waitBatch[q] > current);
+			}
+			if (startBatch) {
+				QueueBatch newBatch;
+				newBatch.queue = queue;
+				newBatch.firstPass = static_cast<uint32_t>(order);
+				queueBatches_.push_back(newBatch);
+			}
+
+			auto& queueBatch = queueBatches_.back();
+			queueBatch.passCount++;
+			passBatch[order] = static_cast<uint32_t>(queueBatches_.size()) - 1;
+			for (uint32_t q = 0; q < RHI_QUEUE_TYPE_COUNT; ++q) {
+				if (waitBatch[q] != UINT32_MAX) {
+					if (queueBatch.waitBatch[q] == UINT32_MAX || waitBatch[q] > queueBatch.waitBatch[q]) {
+						queueBatch.waitBatch[q] = waitBatch[q];
+					}
+					queueBatch.waitStages[q] |= waitStages[q];
+				}
+			}
+
+			auto& batch = passBarriers_[order];
+
+			for (const auto& [index, info] : textureAccesses) {
+				RHIImageHandle image = getTexture(RGTextureHandle{ index });
+				if (!image.isValid()) {
+					continue;
+				}
+
+				RHIImageBarrier barrier;
+				barrier.image = image;
+				barrier.dstStageMask = info.stage;
+				barrier.dstAccessMask = info.access;
+				barrier.newLayout = info.layout;
+
+				RGResourceState& state = imageStates[image];
+				const RHIQueueType srcQueue = state.queue;
+				const bool crossQueue = state.lastAccessOrder != UINT32_MAX && srcQueue != queue;
+
+				if (crossQueue && transferQueue(state, info, index, true,
+					barrier.srcStageMask, barrier.srcAccessMask, barrier.oldLayout)) {
+					// 소유권 이전: 이전 큐 배치 끝에서 Release, 현재 패스 앞에서 Acquire
+					barrier.srcQueue = srcQueue;
+					barrier.dstQueue = queue;
+
+					RHIImageBarrier release = barrier;
+					release.dstStageMask = 0;
+					release.dstAccessMask = 0;
+					queueBatches_[passBatch[state.lastAccessOrder]].releaseBarriers.imageBarriers.push_back(release);
+
+					barrier.srcStageMask = 0;
+					barrier.srcAccessMask = 0;
+					batch.imageBarriers.push_back(barrier);
+					barrierCount_ += 2;
+				} else if (transitionState(state, info, index, true,
+					barrier.srcStageMask, barrier.srcAccessMask, barrier.oldLayout)) {
+					batch.imageBarriers.push_back(barrier);
+					barrierCount_++;
+				} else {
+					elidedBarrierCount_++;
+				}
+
+				state.queue = queue;
+				state.lastAccessOrder = static_cast<uint32_t>(order);
+			}
+
+			for (const auto& [index, info] : bufferAccesses) {
+				RHIBufferHandle buffer = getBuffer(RGBufferHandle{ index });
+				if (!buffer.isValid()) {
+					continue;
+				}
+
+				RHIBufferBarrier barrier;
+				barrier.buffer = buffer;
+				barrier.dstStageMask = info.stage;
+				barrier.dstAccessMask = info.access;
 
-			RHIBufferHandle buffer = rhi_->createBuffer(createInfo);
-			allocatedBuffers_[static_cast<uint32_t>(i)] = buffer;
+				RGResourceState& state = bufferStates[buffer];
+				const RHIQueueType srcQueue = state.queue;
+				const bool crossQueue = state.lastAccessOrder != UINT32_MAX && srcQueue != queue;
+
+				RHIImageLayout unusedLayout;
+				if (crossQueue && transferQueue(state, info, index, false,
+					barrier.srcStageMask, barrier.srcAccessMask, unusedLayout)) {
+					barrier.srcQueue = srcQueue;
+					barrier.dstQueue = queue;
+
+					RHIBufferBarrier release = barrier;
+					release.dstStageMask = 0;
+					release.dstAccessMask = 0;
+					queueBatches_[passBatch[state.lastAccessOrder]].releaseBarriers.bufferBarriers.push_back(release);
+
+					barrier.srcStageMask = 0;
+					barrier.srcAccessMask = 0;
+					batch.bufferBarriers.push_back(barrier);
+					barrierCount_ += 2;
+				} else if (transitionState(state, info, index, false,
+					barrier.srcStageMask, barrier.srcAccessMask, unusedLayout)) {
+					batch.bufferBarriers.push_back(barrier);
+					barrierCount_++;
+				} else {
+					elidedBarrierCount_++;
+				}
+
+				state.queue = queue;
+				state.lastAccessOrder = static_cast<uint32_t>(order);
+			}
+		}
+
+		// 프레임 마지막 제출은 Present/Fence를 담당하는 Graphics 큐여야 함
+		if (!queueBatches_.empty() && queueBatches_.back().queue != RHIQueueType::Graphics) {
+			QueueBatch tail;
+			tail.firstPass = static_cast<uint32_t>(sortedPasses_.size());
+			queueBatches_.push_back(tail);
 		}
 	}
 
 	void RenderGraph::deallocateResources()
 	{
-		// 할당된 텍스처 해제
-		for (auto& pair : allocatedTextures_) {
-			if (pair.second.isValid()) {
-				rhi_->destroyImage(pair.second);
+		// 물리 텍스처 해제 (가상 → 물리 매핑은 같은 핸들을 공유하므로 여기서만 해제)
+		for (auto& physical : physicalTextures_) {
+			if (physical.image.isValid()) {
+				rhi_->destroyImage(physical.image);
 			}
 		}
+		physicalTextures_.clear();
 		allocatedTextures_.clear();
 
-		// 할당된 버퍼 해제
-		for (auto& pair : allocatedBuffers_) {
-			if (pair.second.isValid()) {
-				rhi_->destroyBuffer(pair.second);
+		// 물리 버퍼 해제
+		for (auto& physical : physicalBuffers_) {
+			if (physical.buffer.isValid()) {
+				rhi_->destroyBuffer(physical.buffer);
 			}
 		}
+		physicalBuffers_.clear();
 		allocatedBuffers_.clear();
 	}
 
 	void RenderGraph::cullUnusedPasses()
 	{
-		// 최종 출력과 연결되지 않은 패스 제거
-		auto finalOutput = builder_.getFinalOutput();
-		if (!finalOutput.isValid()) {
-			// 최종 출력이 없으면 모든 패스 유지
-			return;
+		for (auto& pass : passes_) {
+			pass->setCulled(false);
+		}
+		for (auto& node : builder_.textures_) {
+			node.refCount = 0;
+		}
+		for (auto& node : builder_.buffers_) {
+			node.refCount = 0;
+		}
+
+		// 각 리소스를 쓰는 패스 목록 (역방향 탐색용)
+		std::vector<std::vector<uint32_t>> textureWriters(builder_.textures_.size());
+		std::vector<std::vector<uint32_t>> bufferWriters(builder_.buffers_.size());
+
+		for (uint32_t i = 0; i < passes_.size(); ++i) {
+			for (const auto& dep : passes_[i]->getDependencies()) {
+				if (dep.accessType == RGResourceAccessType::Read) {
+					continue;
+				}
+				if (dep.isTexture && dep.texture.isValid() && dep.texture.index < textureWriters.size()) {
+					textureWriters[dep.texture.index].push_back(i);
+				} else if (!dep.isTexture && dep.buffer.isValid() && dep.buffer.index < bufferWriters.size()) {
+					bufferWriters[dep.buffer.index].push_back(i);
+				}
+			}
 		}
 
-		// TODO: 더 정교한 Culling 알고리즘 구현
-		// 현재는 모든 패스를 유지
+		// 루트: 최종 출력 + Side Effect 리소스
+		std::vector<bool> liveTextures(builder_.textures_.size(), false);
+		std::vector<bool> liveBuffers(builder_.buffers_.size(), false);
+		std::vector<RGResourceDependency> worklist;
+
+		auto pushTexture = [&](RGTextureHandle handle) {
+			if (handle.isValid() && handle.index < liveTextures.size() && !liveTextures[handle.index]) {
+				liveTextures[handle.index] = true;
+				RGResourceDependency dep;
+				dep.texture = handle;
+				dep.isTexture = true;
+				worklist.push_back(dep);
+			}
+		};
+		auto pushBuffer = [&](RGBufferHandle handle) {
+			if (handle.isValid() && handle.index < liveBuffers.size() && !liveBuffers[handle.index]) {
+				liveBuffers[handle.index] = true;
+				RGResourceDependency dep;
+				dep.buffer = handle;
+				dep.isTexture = false;
+				worklist.push_back(dep);
+			}
+		};
+
+		pushTexture(builder_.getFinalOutput());
+		for (uint32_t i = 0; i < builder_.textures_.size(); ++i) {
+			if (builder_.textures_[i].isSideEffect) {
+				pushTexture(RGTextureHandle{ i });
+			}
+		}
+		for (uint32_t i = 0; i < builder_.buffers_.size(); ++i) {
+			if (builder_.buffers_[i].isSideEffect) {
+				pushBuffer(RGBufferHandle{ i });
+			}
+		}
+
+		// 루트가 없으면 모든 패스 유지 (하위 호환)
+		const bool cullingEnabled = !worklist.empty();
+
+		std::vector<bool> livePasses(passes_.size(), !cullingEnabled);
+
+		auto markPassLive = [&](uint32_t passIndex) {
+			if (livePasses[passIndex]) {
+				return;
+			}
+			livePasses[passIndex] = true;
+
+			// 살아있는 패스가 읽는 리소스도 살아있음
+			for (const auto& dep : passes_[passIndex]->getDependencies()) {
+				if (dep.accessType == RGResourceAccessType::Write) {
+					continue;
+				}
+				if (dep.isTexture) {
+					pushTexture(dep.texture);
+				} else {
+					pushBuffer(dep.buffer);
+				}
+			}
+		};
+
+		if (cullingEnabled) {
+			for (uint32_t i = 0; i < passes_.size(); ++i) {
+				if (passes_[i]->hasSideEffect()) {
+					markPassLive(i);
+				}
+			}
+
+			// 역방향 도달 가능성 탐색: 살아있는 리소스를 쓰는 패스는 살아있음
+			while (!worklist.empty()) {
+				RGResourceDependency resource = worklist.back();
+				worklist.pop_back();
+
+				const auto& writers = resource.isTexture
+					? textureWriters[resource.texture.index]
+					: bufferWriters[resource.buffer.index];
+				for (uint32_t writer : writers) {
+					markPassLive(writer);
+				}
+			}
+		}
+
+		// 살아있는 패스 기준으로 리소스 참조 카운트 계산 (0이면 할당하지 않음)
+		uint32_t culledCount = 0;
+		for (uint32_t i = 0; i < passes_.size(); ++i) {
+			if (!livePasses[i]) {
+				passes_[i]->setCulled(true);
+				culledCount++;
+				continue;
+			}
+
+			for (const auto& dep : passes_[i]->getDependencies()) {
+				if (dep.isTexture && dep.texture.isValid() && dep.texture.index < builder_.textures_.size()) {
+					builder_.textures_[dep.texture.index].refCount++;
+				} else if (!dep.isTexture && dep.buffer.isValid() && dep.buffer.index < builder_.buffers_.size()) {
+					builder_.buffers_[dep.buffer.index].refCount++;
+				}
+			}
+		}
+
+		if (culledCount > 0) {
+			std::cout << "[RenderGraph] Culled " << culledCount << " unused pass(es)" << std::endl;
+		}
 	}
 
 	void RenderGraph::addPass(std::unique_ptr<RGPassBase> pass)
@@ -4,6 +4,7 @@
 #include "RGBuilder.h"
 #include "../RGPassBase.h"  //  새로운 통합 기본 클래스
 #include "../../RHI/Core/RHI.h"
+#include <array>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -85,9 +86,23 @@ namespace BinRenderer
 		void addPass(const std::string& name,
 		  typename RenderGraphPass<PassData>::SetupFunc setup,
 		             typename RenderGraphPass<PassData>::ExecuteFunc execute)
+		{
+			addPass<PassData>(name, RHIQueueType::Graphics, std::move(setup), std::move(execute));
+		}
+
+		/**
+		 * @brief 렌더 패스 추가 (람다 기반, 실행 큐 지정)
+		 * 
+		 * @param queue 선호 큐 (전용 큐가 없으면 Graphics에서 실행)
+		 */
+		template<typename PassData>
+		void addPass(const std::string& name, RHIQueueType queue,
+		             typename RenderGraphPass<PassData>::SetupFunc setup,
+		             typename RenderGraphPass<PassData>::ExecuteFunc execute)
 		{
 			auto pass = std::make_unique<RenderGraphPass<PassData>>(
 				name, std::move(setup), std::move(execute));
+			pass->setQueue(queue);
 
 			// Builder에 현재 패스 설정
 			builder_.currentPass_ = pass.get();
@@ -122,19 +137,50 @@ namespace BinRenderer
 
 		/**
 		 * @brief 그래프 컴파일 (의존성 분석 및 최적화)
+		 * 
+		 * 패스 이름, 리소스 설명자, 의존성 목록으로 구조 해시를 계산하여
+		 * 이전 컴파일과 같으면 실행 순서/배리어/물리 리소스를 그대로 재사용
 		 */
 		void compile();
 
 		/**
 		 * @brief 렌더 그래프 실행
+		 * 
+		 * 큐 배치마다: 커맨드 기록 시작 → (패스별 배리어 + 패스 실행) → 소유권 Release → 제출
+		 * 배치는 다른 큐 배치의 Timeline 값을 기다린 뒤 실행됨
 		 */
 		void execute(uint32_t frameIndex);
 
+		/**
+		 * @brief 병렬 작업 분배 함수: taskCount개의 task(i)를 실행하고 모두 끝난 뒤 반환
+		 */
+		using ParallelForFunc = std::function<void(uint32_t taskCount, const std::function<void(uint32_t)>& task)>;
+
+		/**
+		 * @brief 패스 병렬 기록 설정
+		 * 
+		 * 활성화하면 한 큐 배치의 패스들을 실행 순서상 연속 구간으로 나누어
+		 * 구간마다 별도 기록 컨텍스트(Secondary 커맨드 버퍼)에 동시에 기록하고 순서대로 실행
+		 * 이때 패스의 execute()는 커맨드 기록 외에 공유 상태를 변경하면 안 됨
+		 * 
+		 * @param maxContexts 최대 동시 기록 컨텍스트 수 (1이면 비활성화, RHI 한도로 제한됨)
+		 * @param parallelFor 작업 분배 함수 (비어 있으면 std::async 사용)
+		 */
+		void setParallelRecording(uint32_t maxContexts, ParallelForFunc parallelFor = {});
+
 		/**
 		 * @brief 그래프 리셋 (다음 프레임 준비)
+		 * 
+		 * 패스와 리소스 노드만 비우고 컴파일 결과와 물리 리소스는 유지
+		 * 다시 구성한 그래프의 구조가 같으면 compile()이 이를 재사용함
 		 */
 		void reset();
 
+		/**
+		 * @brief 컴파일 캐시와 모든 물리 리소스 해제
+		 */
+		void releaseResources();
+
 		// ========================================
 		// 리소스 접근
 		// ========================================
@@ -173,6 +219,26 @@ namespace BinRenderer
 		 */
 		size_t getPassCount() const { return passes_.size(); }
 
+		/**
+		 * @brief Transient 리소스 메모리 통계 (compile 이후 유효)
+		 */
+		const RGMemoryStats& getMemoryStats() const { return memoryStats_; }
+
+		/**
+		 * @brief 컴파일 캐시 통계
+		 */
+		const RGCompileStats& getCompileStats() const { return compileStats_; }
+
+		/**
+		 * @brief 마지막으로 컴파일된 그래프의 구조 해시
+		 */
+		uint64_t getStructuralHash() const { return cachedHash_; }
+
+		/**
+		 * @brief 큐 제출 단위 개수 (compile 이후 유효, Async Compute가 없으면 1)
+		 */
+		size_t getQueueBatchCount() const { return queueBatches_.size(); }
+
 	private:
 		RHI* rhi_;
 		RenderGraphBuilder builder_;
@@ -181,26 +247,138 @@ namespace BinRenderer
 		std::vector<std::unique_ptr<RGPassBase>> passes_;  //  RenderGraphPassBase → RGPassBase
 		std::vector<RGPassBase*> sortedPasses_; // 실행 순서
 
-		// 실제 할당된 리소스
+		// 물리 텍스처 (수명이 겹치지 않는 가상 텍스처들이 공유)
+		struct PhysicalTexture
+		{
+			RHIImageCreateInfo createInfo;
+			RHIImageHandle image;
+			uint32_t lastUse = 0;
+			uint64_t sizeInBytes = 0;
+		};
+
+		// 물리 버퍼 (수명이 겹치지 않는 가상 버퍼들이 공유)
+		struct PhysicalBuffer
+		{
+			RHIBufferCreateInfo createInfo;
+			RHIBufferHandle buffer;
+			uint32_t lastUse = 0;
+		};
+
+		std::vector<PhysicalTexture> physicalTextures_;
+		std::vector<PhysicalBuffer> physicalBuffers_;
+
+		// 가상 리소스 인덱스 → 실제 할당된 리소스 (Aliasing 시 같은 핸들을 공유)
 		std::unordered_map<uint32_t, RHIImageHandle> allocatedTextures_;
 		std::unordered_map<uint32_t, RHIBufferHandle> allocatedBuffers_;
 
+		RGMemoryStats memoryStats_;
+
+		// 패스별 실행 직전에 기록할 배리어 (sortedPasses_와 같은 인덱스)
+		std::vector<RHIBarrierBatch> passBarriers_;
+
+		// 큐 제출 단위: 같은 큐에서 연속 실행되는 패스 묶음
+		struct QueueBatch
+		{
+			RHIQueueType queue = RHIQueueType::Graphics;
+			uint32_t firstPass = 0;   // sortedPasses_ 기준 시작 인덱스
+			uint32_t passCount = 0;
+			std::array<uint32_t, RHI_QUEUE_TYPE_COUNT> waitBatch;               // 큐별로 기다릴 마지막 배치 (UINT32_MAX: 없음)
+			std::array<RHIPipelineStageFlags, RHI_QUEUE_TYPE_COUNT> waitStages; // 대기 지점 스테이지
+			RHIBarrierBatch releaseBarriers;  // 배치 끝에 기록할 큐 소유권 Release 배리어
+
+			QueueBatch()
+			{
+				waitBatch.fill(UINT32_MAX);
+				waitStages.fill(0);
+			}
+		};
+		std::vector<QueueBatch> queueBatches_;
+		std::vector<RHIQueueType> passQueues_;  // passes_ 인덱스별 실제 실행 큐
+		uint32_t barrierCount_ = 0;        // 생성된 배리어 수
+		uint32_t elidedBarrierCount_ = 0;  // 불필요하여 생략된 배리어 수
+
 		bool compiled_ = false;
 
+		// 병렬 기록 설정
+		uint32_t maxRecordingContexts_ = 1;
+		ParallelForFunc parallelFor_;
+		static constexpr uint32_t kMinPassesPerContext = 2;  // 컨텍스트 하나가 맡을 최소 패스 수
+
+		// 컴파일 캐시 (reset 이후에도 유지)
+		bool cacheValid_ = false;
+		uint64_t cachedHash_ = 0;
+		std::vector<uint32_t> cachedSchedule_;  // 실행 순서대로의 패스 인덱스 (passes_ 기준)
+		std::vector<RHIBufferHandle> resolvedBuffers_;  // 버퍼 노드별로 배리어에 기록된 resolver 핸들
+		RGCompileStats compileStats_;
+
 		// ========================================
 		// 내부 헬퍼 함수
 		// ========================================
 
+		/**
+		 * @brief sortedPasses_[firstPass, firstPass + passCount) 구간의 배리어와 패스를 기록
+		 * 
+		 * 병렬 기록이 켜져 있으면 구간을 컨텍스트 수만큼 연속 구간으로 나눠 동시에 기록
+		 */
+		void recordPasses(uint32_t firstPass, uint32_t passCount, uint32_t frameIndex);
+
+		/**
+		 * @brief 그래프 구조 해시 계산
+		 * 
+		 * 패스 이름/Side Effect, 리소스 설명자/Imported 핸들, 의존성 목록, 최종 출력을 포함
+		 * (resolver로 임포트한 버퍼는 핸들 대신 resolver 여부만 포함)
+		 */
+		uint64_t computeStructuralHash() const;
+
+		/**
+		 * @brief resolver로 임포트한 버퍼의 현재 핸들을 다시 얻음
+		 * @return 마지막으로 배리어를 만든 뒤 핸들이 하나라도 바뀌었으면 true (배리어 재생성 필요)
+		 */
+		bool resolveImportedBuffers();
+
+		/**
+		 * @brief 캐시된 실행 순서를 현재 패스 객체에 적용
+		 */
+		bool restoreCachedSchedule();
+
+		/**
+		 * @brief 패스별 실제 실행 큐 결정
+		 * 
+		 * 전용 큐가 없거나, Imported/Side Effect/최종 출력 리소스(프레임 밖에서 Graphics 큐가 소유)를
+		 * 사용하는 패스는 Graphics 큐로 실행
+		 */
+		void resolvePassQueues();
+
 		/**
 		 * @brief Topological Sort로 실행 순서 결정
+		 * 
+		 * 준비된 패스 중 Async 큐 패스와 그 선행 패스를 먼저 배치하여 큐 간 겹침을 늘림
 		 */
 		void topologicalSort();
 
 		/**
-		 * @brief 리소스 할당
+		 * @brief 실행 순서 기준으로 리소스 수명(firstUse/lastUse) 재계산
+		 */
+		void computeResourceLifetimes();
+
+		/**
+		 * @brief 리소스 할당 (수명 기반 Aliasing)
+		 * 
+		 * 수명 구간 [firstUse, lastUse]가 겹치지 않고 설명자가 호환되는
+		 * 가상 리소스들을 하나의 물리 리소스에 배치 (Interval Graph Coloring)
+		 * 이전 컴파일의 물리 리소스 중 생성 정보가 같은 것은 다시 만들지 않고 재사용
 		 */
 		void allocateResources();
 
+		/**
+		 * @brief 패스 간 배리어, 레이아웃 전환 및 큐 배치 생성
+		 * 
+		 * 물리 리소스별 마지막 접근(stage, access, layout, queue)을 추적하여
+		 * 필요한 배리어만 패스 단위로 묶어서 생성 (중복/불필요한 배리어 제거)
+		 * 큐가 바뀌는 리소스는 세마포어 대기와 소유권 이전(Release/Acquire)을 생성
+		 */
+		void buildBarriers();
+
 		/**
 		 * @brief 리소스 해제
 		 */
@@ -30,6 +30,23 @@ namespace BinRenderer
 		ReadWrite  // 읽기/쓰기
 	};
 
+	// 리소스 사용 방식 (배리어/레이아웃 자동 생성용)
+	enum class RGResourceUsage
+	{
+		Auto,                    // 포맷과 접근 타입으로 추론
+		ColorAttachment,         // 렌더 타겟 쓰기
+		DepthStencilAttachment,  // 깊이 테스트 + 쓰기
+		DepthStencilRead,        // 깊이 읽기 전용 (테스트 또는 샘플링)
+		ShaderRead,              // 셰이더 샘플링 / 읽기 전용 버퍼
+		Storage,                 // 셰이더 읽기/쓰기 (Storage Image/Buffer)
+		TransferSrc,             // 복사 원본
+		TransferDst,             // 복사 대상
+		VertexBuffer,            // 정점 입력
+		IndexBuffer,             // 인덱스 입력
+		IndirectBuffer,          // Indirect Draw/Dispatch 인자
+		UniformBuffer            // 유니폼 버퍼
+	};
+
 	// 텍스처 설명자
 	struct RGTextureDesc
 	{
@@ -60,7 +77,32 @@ namespace BinRenderer
 		RGTextureHandle texture;
 		RGBufferHandle buffer;
 		RGResourceAccessType accessType;
+		RGResourceUsage usage = RGResourceUsage::Auto;
 		bool isTexture = true; // true: texture, false: buffer
 	};
 
+	// Transient 리소스 메모리 통계 (Aliasing 결과)
+	struct RGMemoryStats
+	{
+		uint64_t naiveBytes = 0;      // 모든 가상 리소스를 개별 할당했을 때의 크기
+		uint64_t allocatedBytes = 0;  // Aliasing 후 실제 할당된 물리 리소스 크기
+		uint64_t peakBytes = 0;       // 동시에 살아있는 리소스 크기의 최대값 (이론적 하한)
+		uint32_t virtualTextures = 0;
+		uint32_t physicalTextures = 0;
+		uint32_t virtualBuffers = 0;
+		uint32_t physicalBuffers = 0;
+	};
+
+	// 컴파일 캐시 통계 (구조 해시 기반 재사용 결과)
+	struct RGCompileStats
+	{
+		uint32_t compileCount = 0;     // compile() 호출 횟수
+		uint32_t cacheHitCount = 0;    // 구조 해시가 일치하여 이전 결과를 재사용한 횟수
+		uint32_t texturesCreated = 0;  // 새로 생성한 물리 텍스처 수 (누적)
+		uint32_t texturesReused = 0;   // 이전 컴파일에서 그대로 가져온 물리 텍스처 수 (누적)
+		uint32_t buffersCreated = 0;
+		uint32_t buffersReused = 0;
+		uint32_t barrierRebuilds = 0; // resolver 임포트 버퍼의 핸들이 바뀌어 배리어만 다시 만든 횟수
+	};
+
 } // namespace BinRenderer
@@ -0,0 +1,38 @@
+﻿#include "SkinningPassRG.h"
+#include "../Rendering/RHIRenderer.h"
+
+namespace BinRenderer
+{
+	SkinningPassRG::SkinningPassRG(RHI* rhi, RHIRenderer* renderer)
+		: RGPass<SkinningPassData>(rhi, "SkinningPass")
+		, renderer_(renderer)
+	{
+	}
+
+	void SkinningPassRG::setup(SkinningPassData& data, RenderGraphBuilder& builder)
+	{
+		// 출력 정점 버퍼: 프레임 슬롯별 버퍼이므로 실행 때마다 현재 슬롯 핸들로 임포트
+		RHISkinningCache* cache = renderer_ ? renderer_->getSkinningCache() : nullptr;
+		if (!cache)
+		{
+			return;
+		}
+
+		RGBufferDesc outputDesc;
+		outputDesc.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		data.skinnedVertices = builder.importBuffer("Skinning_Vertices",
+			[cache]() { return cache->getOutputBuffer(); }, outputDesc);
+		builder.writeBuffer(data.skinnedVertices, RGResourceUsage::Storage);
+	}
+
+	void SkinningPassRG::execute(const SkinningPassData& data, RHI* rhi, uint32_t frameIndex)
+	{
+		if (!renderer_ || !renderer_->isPreSkinningEnabled())
+		{
+			return;
+		}
+
+		renderer_->getSkinningCache()->recordSkinning();
+	}
+
+} // namespace BinRenderer
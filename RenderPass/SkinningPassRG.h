@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include "RGPassBase.h"
+
+namespace BinRenderer
+{
+	// Forward declarations
+	class RHIRenderer;
+
+	/**
+	 * @brief Skinning Pass 데이터 (출력 정점 버퍼는 RHISkinningCache가 프레임 슬롯별로 소유, 현재 슬롯을 임포트)
+	 */
+	struct SkinningPassData
+	{
+		RGBufferHandle skinnedVertices;  // 스킨드 정점 캐시 (컴퓨트 쓰기)
+	};
+
+	/**
+	 * @brief Skinning Pass (컴퓨트 프리스키닝 → 스킨드 정점 캐시)
+	 * 
+	 * @features
+	 * - 스킨드 인스턴스의 위치/법선/탄젠트를 프레임당 한 번만 스키닝
+	 * - 같은 Animation + 같은 모델을 쓰는 노드는 결과를 공유
+	 * 
+	 * @outputs
+	 * - RHISkinningCache의 출력 정점 버퍼 (getSkinnedVerticesHandle)
+	 * 
+	 * 스킨드 메시를 그리는 패스가 출력을 ShaderRead로 읽기로 선언해야 실행 순서와 배리어가 생기고 Culling되지 않음
+	 */
+	class SkinningPassRG : public RGPass<SkinningPassData>
+	{
+	public:
+		SkinningPassRG(RHI* rhi, RHIRenderer* renderer);
+		~SkinningPassRG() override = default;
+
+		// RGPass 인터페이스
+		void setup(SkinningPassData& data, RenderGraphBuilder& builder) override;
+		void execute(const SkinningPassData& data, RHI* rhi, uint32_t frameIndex) override;
+
+		// 출력 핸들
+		RGBufferHandle getSkinnedVerticesHandle() const { return getData().skinnedVertices; }
+
+	private:
+		RHIRenderer* renderer_ = nullptr;
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,174 @@
+﻿#include "RHIBonePaletteArena.h"
+#include "../Core/Logger.h"
+#include "../Core/RHIScene.h"
+#include "../Scene/Animation.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		// 프레임마다 할당하는 팔레트 버퍼의 최소 크기
+		constexpr uint32_t kMinPaletteCapacity = 256;
+	}
+
+	RHIBonePaletteArena::RHIBonePaletteArena(RHI* rhi, uint32_t frameCount)
+		: rhi_(rhi)
+		, frameCount_(std::max(frameCount, 1u))
+	{
+	}
+
+	RHIBonePaletteArena::~RHIBonePaletteArena()
+	{
+		shutdown();
+	}
+
+	bool RHIBonePaletteArena::initialize()
+	{
+		// 버퍼는 슬롯의 선형 풀에서 upload()가 매 프레임 할당 (그 전에는 소비자가 더미 버퍼를 연결)
+		frames_.resize(frameCount_);
+
+		printLog("[BonePalettes] Initialized ({} frame slots)", frameCount_);
+		return true;
+	}
+
+	void RHIBonePaletteArena::shutdown()
+	{
+		for (auto& frame : frames_)
+		{
+			destroyFrameBuffer(frame);
+		}
+		frames_.clear();
+
+		palettes_.clear();
+		nodeOffsets_.clear();
+		paletteIndices_.clear();
+		matrixCount_ = 0;
+	}
+
+	void RHIBonePaletteArena::assign(const RHIScene& scene)
+	{
+		palettes_.clear();
+		paletteIndices_.clear();
+		matrixCount_ = 0;
+
+		const auto& nodes = scene.getNodes();
+		nodeOffsets_.assign(nodes.size(), kNoPalette);
+
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			// 노드 전용 플레이어가 없으면 모델의 Animation (같은 모델 노드끼리 팔레트 공유)
+			const Animation* animation = nodes[i].model ? nodes[i].getAnimation() : nullptr;
+			const uint32_t boneCount = animation ? static_cast<uint32_t>(animation->getBoneMatrices().size()) : 0;
+			if (boneCount == 0)
+			{
+				continue;
+			}
+
+			auto [it, inserted] = paletteIndices_.try_emplace(animation, static_cast<uint32_t>(palettes_.size()));
+			if (inserted)
+			{
+				palettes_.push_back({ animation, matrixCount_, boneCount });
+				matrixCount_ += boneCount;
+			}
+			nodeOffsets_[i] = palettes_[it->second].offset;
+		}
+	}
+
+	bool RHIBonePaletteArena::upload()
+	{
+		if (!isReady() || matrixCount_ == 0)
+		{
+			return true;
+		}
+
+		FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		if (!allocateFrameBuffer(frame, matrixCount_))
+		{
+			std::fill(nodeOffsets_.begin(), nodeOffsets_.end(), kNoPalette);
+			return false;
+		}
+
+		// 팔레트를 배정 순서대로 이어서 복사하고 변경 구간 전체를 한 번에 flush
+		for (const Palette& palette : palettes_)
+		{
+			memcpy(frame.mappedMatrices + palette.offset, palette.animation->getBoneMatrices().data(),
+				static_cast<size_t>(palette.count) * sizeof(glm::mat4));
+		}
+		rhi_->flushBuffer(frame.buffer, 0, static_cast<RHIDeviceSize>(matrixCount_) * sizeof(glm::mat4));
+
+		return true;
+	}
+
+	const RHIBonePaletteArena::FrameResources* RHIBonePaletteArena::getCurrentFrame() const
+	{
+		return frames_.empty() ? nullptr : &frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+	}
+
+	RHIBufferHandle RHIBonePaletteArena::getBuffer() const
+	{
+		const FrameResources* frame = getCurrentFrame();
+		return frame ? frame->buffer : RHIBufferHandle{};
+	}
+
+	RHIDeviceSize RHIBonePaletteArena::getBufferSize() const
+	{
+		const FrameResources* frame = getCurrentFrame();
+		return frame ? static_cast<RHIDeviceSize>(frame->capacity) * sizeof(glm::mat4) : 0;
+	}
+
+	bool RHIBonePaletteArena::allocateFrameBuffer(FrameResources& frame, uint32_t matrixCount)
+	{
+		// 프레임 선형 풀은 이 슬롯이 다시 시작될 때 회수되므로 매 프레임 새로 할당 (bump 할당)
+		// 이 슬롯의 이전 프레임은 이미 끝났으므로 바로 다시 만들 수 있음
+		const uint32_t previousCapacity = frame.capacity;
+		destroyFrameBuffer(frame);
+
+		uint32_t capacity = std::max(previousCapacity, kMinPaletteCapacity);
+		while (capacity < matrixCount)
+		{
+			capacity *= 2;
+		}
+
+		// Coherent를 요구하지 않으므로 기록한 구간은 flushBuffer로 명시적으로 반영
+		RHIBufferCreateInfo bufferInfo{};
+		bufferInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(glm::mat4);
+		bufferInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+		bufferInfo.allocationFlags = RHI_ALLOCATION_FRAME_TRANSIENT_BIT;
+		frame.buffer = rhi_->createBuffer(bufferInfo);
+		if (!frame.buffer.isValid())
+		{
+			printLog("[BonePalettes] ❌ Failed to create palette buffer ({} matrices)", capacity);
+			return false;
+		}
+
+		frame.mappedMatrices = static_cast<glm::mat4*>(rhi_->mapBuffer(frame.buffer));
+		if (!frame.mappedMatrices)
+		{
+			destroyFrameBuffer(frame);
+			return false;
+		}
+		frame.capacity = capacity;
+		return true;
+	}
+
+	void RHIBonePaletteArena::destroyFrameBuffer(FrameResources& frame)
+	{
+		if (frame.buffer.isValid())
+		{
+			if (frame.mappedMatrices)
+			{
+				rhi_->unmapBuffer(frame.buffer);
+			}
+			rhi_->destroyBuffer(frame.buffer);
+		}
+
+		frame.buffer = {};
+		frame.mappedMatrices = nullptr;
+		frame.capacity = 0;
+	}
+
+} // namespace BinRenderer
@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#include "../RHI/Core/RHI.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace BinRenderer
+{
+	class RHIScene;
+	class Animation;
+
+	/**
+	 * @brief 프레임마다 스킨드 인스턴스의 본 행렬을 모아 올리는 SSBO 아레나
+	 *
+	 * - 스킨드 노드마다 팔레트 시작 오프셋을 배정 (같은 Animation을 쓰는 노드는 팔레트 하나를 공유)
+	 * - 모든 팔레트를 프레임 선형 풀(RHI_ALLOCATION_FRAME_TRANSIENT_BIT)의 Host visible 버퍼에 연속으로 복사하고 flushBuffer는 한 번만
+	 * - 정점 셰이더는 boneMatrices[boneOffset + boneIndex]로 읽음 (Set 0, Binding 2)
+	 * - 오프셋은 드로우별 데이터로 전달 (push constants / 인스턴스 버퍼 / GPU 드로우 레코드)
+	 */
+	class RHIBonePaletteArena
+	{
+	public:
+		// 스키닝하지 않는 노드의 오프셋 (셰이더는 0xFFFFFFFF로 비교)
+		static constexpr uint32_t kNoPalette = UINT32_MAX;
+
+		RHIBonePaletteArena(RHI* rhi, uint32_t frameCount);
+		~RHIBonePaletteArena();
+
+		bool initialize();
+		void shutdown();
+
+		bool isReady() const { return !frames_.empty(); }
+
+		/**
+		 * @brief 스킨드 노드에 팔레트 오프셋 배정 (씬 업데이트 후, 드로우 데이터를 만들기 전에 호출)
+		 *
+		 * GPU 버퍼는 건드리지 않으므로 RHI::beginFrame 이전에 호출해도 됨
+		 */
+		void assign(const RHIScene& scene);
+
+		/**
+		 * @brief assign한 팔레트를 현재 프레임 슬롯 버퍼에 기록
+		 *
+		 * RHI::beginFrame 이후(슬롯의 이전 프레임이 끝난 상태) 호출
+		 * @return 버퍼를 키우지 못하면 false (이번 프레임은 모든 노드가 kNoPalette)
+		 */
+		bool upload();
+
+		uint32_t getNodeOffset(size_t nodeIndex) const
+		{
+			return nodeIndex < nodeOffsets_.size() ? nodeOffsets_[nodeIndex] : kNoPalette;
+		}
+		const std::vector<uint32_t>& getNodeOffsets() const { return nodeOffsets_; }
+
+		uint32_t getPaletteCount() const { return static_cast<uint32_t>(palettes_.size()); }
+		uint32_t getMatrixCount() const { return matrixCount_; }
+
+		// 현재 프레임 슬롯의 팔레트 버퍼 (upload마다 새로 할당하므로 디스크립터는 핸들을 비교해 갱신)
+		RHIBufferHandle getBuffer() const;
+		RHIDeviceSize getBufferSize() const;
+
+	private:
+		struct FrameResources
+		{
+			RHIBufferHandle buffer;  // glm::mat4[capacity], 프레임 선형 풀 (블록이 영구 매핑)
+			glm::mat4* mappedMatrices = nullptr;
+			uint32_t capacity = 0;
+		};
+
+		struct Palette
+		{
+			const Animation* animation = nullptr;
+			uint32_t offset = 0;
+			uint32_t count = 0;
+		};
+
+		const FrameResources* getCurrentFrame() const;
+		bool allocateFrameBuffer(FrameResources& frame, uint32_t matrixCount);
+		void destroyFrameBuffer(FrameResources& frame);
+
+		RHI* rhi_;
+		uint32_t frameCount_;
+		std::vector<FrameResources> frames_;
+
+		// 프레임마다 다시 배정 (할당은 재사용)
+		std::vector<Palette> palettes_;
+		std::vector<uint32_t> nodeOffsets_;
+		std::unordered_map<const Animation*, uint32_t> paletteIndices_;  // Animation → palettes_ 인덱스
+		uint32_t matrixCount_ = 0;
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,246 @@
+﻿#include "RHIFrustumCuller.h"
+#include "RHIOcclusionBuffer.h"
+#include "../Core/RHIScene.h"
+#include "../Core/JobSystem.h"
+
+#include <atomic>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define BIN_FRUSTUM_CULLER_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kLaneCount = 4;         // SSE 한 번에 테스트하는 AABB 수
+		constexpr uint32_t kMinMeshesPerJob = 1024; // 이보다 작은 구간은 나누지 않음
+		constexpr uint32_t kMinOcclusionTestsPerJob = 128; // 가림막 테스트는 모서리 8개 투영이라 더 잘게 나눔
+
+		// 숨긴 노드/패딩 슬롯: 어떤 평면에 대해서도 d + r < 0
+		constexpr float kCulledExtent = -FLT_MAX;
+
+		uint32_t alignToLanes(uint32_t count)
+		{
+			return (count + kLaneCount - 1) & ~(kLaneCount - 1);
+		}
+	}
+
+	void RHIFrustumCuller::gather(std::vector<RHISceneNode>& nodes)
+	{
+		// 노드별 World AABB 캐시 갱신 (transform이 바뀐 노드만 재계산)
+		std::vector<uint8_t> changed(nodes.size(), 0);
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			changed[i] = nodes[i].updateWorldBounds() ? 1 : 0;
+		}
+
+		// 노드/메시 구성이 그대로인지 확인
+		bool layoutChanged = nodeRanges_.size() != nodes.size();
+		for (size_t i = 0; !layoutChanged && i < nodes.size(); ++i)
+		{
+			layoutChanged = nodeRanges_[i].model != nodes[i].model.get() ||
+				nodeRanges_[i].count != nodes[i].meshWorldBounds.size();
+		}
+
+		if (layoutChanged)
+		{
+			nodeRanges_.resize(nodes.size());
+
+			uint32_t first = 0;
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				NodeRange& range = nodeRanges_[i];
+				range.model = nodes[i].model.get();
+				range.first = first;
+				range.count = static_cast<uint32_t>(nodes[i].meshWorldBounds.size());
+				range.visible = nodes[i].visible;
+				first += range.count;
+			}
+			meshCount_ = first;
+
+			const uint32_t slotCount = alignToLanes(meshCount_);
+			centerX_.assign(slotCount, 0.0f);
+			centerY_.assign(slotCount, 0.0f);
+			centerZ_.assign(slotCount, 0.0f);
+			extentX_.assign(slotCount, kCulledExtent);
+			extentY_.assign(slotCount, kCulledExtent);
+			extentZ_.assign(slotCount, kCulledExtent);
+			visible_.assign(slotCount, 0);
+
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				writeNode(nodeRanges_[i], nodes[i]);
+			}
+			return;
+		}
+
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			NodeRange& range = nodeRanges_[i];
+			if (changed[i] || range.visible != nodes[i].visible)
+			{
+				range.visible = nodes[i].visible;
+				writeNode(range, nodes[i]);
+			}
+		}
+	}
+
+	void RHIFrustumCuller::writeNode(const NodeRange& range, const RHISceneNode& node)
+	{
+		for (uint32_t i = 0; i < range.count; ++i)
+		{
+			const uint32_t slot = range.first + i;
+			if (!range.visible)
+			{
+				extentX_[slot] = extentY_[slot] = extentZ_[slot] = kCulledExtent;
+				continue;
+			}
+
+			const AABB& bounds = node.meshWorldBounds[i];
+			const glm::vec3 center = bounds.getCenter();
+			const glm::vec3 extent = bounds.getExtents();
+			centerX_[slot] = center.x;
+			centerY_[slot] = center.y;
+			centerZ_[slot] = center.z;
+			extentX_[slot] = extent.x;
+			extentY_[slot] = extent.y;
+			extentZ_[slot] = extent.z;
+		}
+	}
+
+	uint32_t RHIFrustumCuller::cull(const RHIViewFrustum& frustum)
+	{
+		// 평면 데이터를 미리 펼쳐 둠 (반경 계산용 |n| 포함)
+		float planes[6][7];
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			const Plane& plane = frustum.getPlane(static_cast<RHIViewFrustum::PlaneIndex>(p));
+			planes[p][0] = plane.normal.x;
+			planes[p][1] = plane.normal.y;
+			planes[p][2] = plane.normal.z;
+			planes[p][3] = plane.distance;
+			planes[p][4] = std::fabs(plane.normal.x);
+			planes[p][5] = std::fabs(plane.normal.y);
+			planes[p][6] = std::fabs(plane.normal.z);
+		}
+
+		const uint32_t groupCount = alignToLanes(meshCount_) / kLaneCount;
+		std::atomic<uint32_t> visibleCount{ 0 };
+
+		// AABB 중심의 평면 거리 d와 평면 법선 방향 반경 r로 판정: d + r < 0이면 평면 바깥
+		JobSystem::getInstance().parallelFor(groupCount, kMinMeshesPerJob / kLaneCount,
+			[&](uint32_t beginGroup, uint32_t endGroup)
+			{
+				uint32_t localVisible = 0;
+
+#ifdef BIN_FRUSTUM_CULLER_SSE
+				const __m128 zero = _mm_setzero_ps();
+				for (uint32_t group = beginGroup; group < endGroup; ++group)
+				{
+					const uint32_t base = group * kLaneCount;
+					const __m128 cx = _mm_loadu_ps(&centerX_[base]);
+					const __m128 cy = _mm_loadu_ps(&centerY_[base]);
+					const __m128 cz = _mm_loadu_ps(&centerZ_[base]);
+					const __m128 ex = _mm_loadu_ps(&extentX_[base]);
+					const __m128 ey = _mm_loadu_ps(&extentY_[base]);
+					const __m128 ez = _mm_loadu_ps(&extentZ_[base]);
+
+					__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+					for (uint32_t p = 0; p < 6; ++p)
+					{
+						__m128 d = _mm_add_ps(
+							_mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(planes[p][0])), _mm_mul_ps(cy, _mm_set1_ps(planes[p][1]))),
+							_mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(planes[p][2])), _mm_set1_ps(planes[p][3])));
+						__m128 r = _mm_add_ps(
+							_mm_add_ps(_mm_mul_ps(ex, _mm_set1_ps(planes[p][4])), _mm_mul_ps(ey, _mm_set1_ps(planes[p][5]))),
+							_mm_mul_ps(ez, _mm_set1_ps(planes[p][6])));
+						inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), zero));
+					}
+
+					const int mask = _mm_movemask_ps(inside);
+					for (uint32_t lane = 0; lane < kLaneCount; ++lane)
+					{
+						visible_[base + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+					}
+					localVisible += static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(mask)));
+				}
+#else
+				for (uint32_t slot = beginGroup * kLaneCount; slot < endGroup * kLaneCount; ++slot)
+				{
+					bool inside = true;
+					for (uint32_t p = 0; p < 6 && inside; ++p)
+					{
+						const float d = centerX_[slot] * planes[p][0] + centerY_[slot] * planes[p][1] + centerZ_[slot] * planes[p][2] + planes[p][3];
+						const float r = extentX_[slot] * planes[p][4] + extentY_[slot] * planes[p][5] + extentZ_[slot] * planes[p][6];
+						inside = d + r >= 0.0f;
+					}
+					visible_[slot] = inside ? 1 : 0;
+					localVisible += visible_[slot];
+				}
+#endif
+
+				visibleCount.fetch_add(localVisible, std::memory_order_relaxed);
+			});
+
+		return visibleCount.load();
+	}
+
+	uint32_t RHIFrustumCuller::cullOccluded(const RHIOcclusionBuffer& occlusion)
+	{
+		std::atomic<uint32_t> occludedCount{ 0 };
+
+		// 버퍼는 읽기만 하므로 구간별로 나눠 테스트
+		JobSystem::getInstance().parallelFor(meshCount_, kMinOcclusionTestsPerJob,
+			[&](uint32_t begin, uint32_t end)
+			{
+				uint32_t localOccluded = 0;
+				for (uint32_t slot = begin; slot < end; ++slot)
+				{
+					if (!visible_[slot])
+					{
+						continue;
+					}
+
+					const glm::vec3 center(centerX_[slot], centerY_[slot], centerZ_[slot]);
+					const glm::vec3 extent(extentX_[slot], extentY_[slot], extentZ_[slot]);
+					if (!occlusion.isVisible(center, extent))
+					{
+						visible_[slot] = 0;
+						++localOccluded;
+					}
+				}
+				occludedCount.fetch_add(localOccluded, std::memory_order_relaxed);
+			});
+
+		return occludedCount.load();
+	}
+
+	uint32_t RHIFrustumCuller::markAllVisible()
+	{
+		uint32_t visibleCount = 0;
+		for (const NodeRange& range : nodeRanges_)
+		{
+			for (uint32_t i = 0; i < range.count; ++i)
+			{
+				visible_[range.first + i] = range.visible ? 1 : 0;
+			}
+			visibleCount += range.visible ? range.count : 0;
+		}
+		return visibleCount;
+	}
+
+	bool RHIFrustumCuller::isMeshVisible(size_t nodeIndex, size_t meshIndex) const
+	{
+		if (nodeIndex >= nodeRanges_.size() || meshIndex >= nodeRanges_[nodeIndex].count)
+		{
+			return true;
+		}
+		return visible_[nodeRanges_[nodeIndex].first + meshIndex] != 0;
+	}
+
+} // namespace BinRenderer
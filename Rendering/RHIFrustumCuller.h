@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include "RHIViewFrustum.h"
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	struct RHISceneNode;
+	class RHIOcclusionBuffer;
+
+	/**
+	 * @brief 메시 단위 CPU Frustum Culling
+	 *
+	 * - 노드가 캐시한 메시 World AABB를 중심/반경 SoA 배열로 모아 두고, 바뀐 노드 구간만 다시 씀
+	 * - 평면 6개 x AABB 4개를 SSE로 한 번에 테스트
+	 * - 메시가 많으면 JobSystem으로 구간을 나눠 병렬 처리
+	 */
+	class RHIFrustumCuller
+	{
+	public:
+		/**
+		 * @brief 노드 목록에서 컬링 대상 수집
+		 *
+		 * 노드/메시 구성이 바뀌면 SoA 배열 전체를 다시 만들고, 아니면 transform이 바뀐 노드만 갱신
+		 */
+		void gather(std::vector<RHISceneNode>& nodes);
+
+		/**
+		 * @brief 절두체 테스트
+		 * @return 보이는 메시 수
+		 */
+		uint32_t cull(const RHIViewFrustum& frustum);
+
+		/**
+		 * @brief 절두체 테스트를 통과한 메시를 가림막 버퍼로 다시 테스트 (cull() 이후)
+		 * @return 가려져서 보이지 않게 된 메시 수
+		 */
+		uint32_t cullOccluded(const RHIOcclusionBuffer& occlusion);
+
+		// 모든 메시를 보이는 것으로 표시 (컬링 비활성화 시, 숨긴 노드는 제외)
+		uint32_t markAllVisible();
+
+		// gather() 이후 추가된 노드/메시는 보이는 것으로 취급
+		bool isMeshVisible(size_t nodeIndex, size_t meshIndex) const;
+
+		uint32_t getMeshCount() const { return meshCount_; }
+
+	private:
+		struct NodeRange
+		{
+			const void* model = nullptr;  // 구성 변경 감지용
+			uint32_t first = 0;           // SoA 시작 인덱스
+			uint32_t count = 0;
+			bool visible = true;
+		};
+
+		void writeNode(const NodeRange& range, const RHISceneNode& node);
+
+		std::vector<NodeRange> nodeRanges_;
+		uint32_t meshCount_ = 0;
+
+		// SoA World AABB (SIMD 폭에 맞춰 패딩, 숨긴 노드/패딩은 음수 반경으로 항상 컬링)
+		std::vector<float> centerX_;
+		std::vector<float> centerY_;
+		std::vector<float> centerZ_;
+		std::vector<float> extentX_;
+		std::vector<float> extentY_;
+		std::vector<float> extentZ_;
+		std::vector<uint8_t> visible_;
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,1582 @@
+﻿#include "RHIGpuCuller.h"
+#include "RHIBonePaletteArena.h"
+#include "RHIHiZPyramid.h"
+#include "RHIMesh.h"
+#include "RHIMeshlet.h"
+#include "RHISkinningCache.h"
+#include "../Core/Logger.h"
+#include "../Core/RHIModel.h"
+#include "../Core/RHIScene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kWorkgroupSize = 64;     // gpuCull.comp local_size_x
+		constexpr uint32_t kMinRecordCapacity = 256;
+		constexpr uint64_t kMinClusterIndexCapacity = 1u << 16;
+		constexpr uint32_t kMaxDispatchGroups = 65535;
+
+		/**
+		 * @brief 컬링 셰이더 Push Constants (gpuCull.comp와 같은 배치)
+		 */
+		struct CullPushConstants
+		{
+			glm::vec4 planes[6];
+			uint32_t recordCount = 0;
+			uint32_t cullingEnabled = 1;
+			uint32_t compact = 1;
+			uint32_t padding = 0;
+		};
+
+		static_assert(sizeof(CullPushConstants) <= 128, "Push constants must fit in 128 bytes");
+
+		/**
+		 * @brief 가림막 컬링 셰이더 Push Constants (gpuOcclusionCull.comp와 같은 배치)
+		 */
+		struct OcclusionCullPushConstants
+		{
+			glm::mat4 viewProjection = glm::mat4(1.0f);
+			uint32_t recordCount = 0;
+			uint32_t cullingEnabled = 1;
+			uint32_t compact = 1;
+			uint32_t phase = 0;
+			uint32_t depthWidth = 0;   // Hi-Z를 만든 깊이 이미지 크기
+			uint32_t depthHeight = 0;
+			uint32_t hiZMipCount = 0;
+			uint32_t padding = 0;
+		};
+
+		static_assert(sizeof(OcclusionCullPushConstants) <= 128, "Push constants must fit in 128 bytes");
+
+		/**
+		 * @brief 클러스터 컬링 셰이더 Push Constants (clusterCull.comp와 같은 배치)
+		 */
+		struct ClusterCullPushConstants
+		{
+			glm::vec4 planes[6];
+			glm::vec4 cameraPosition = glm::vec4(0.0f);  // w = 0이면 cone 컬링 안 함
+			uint32_t recordCount = 0;
+			uint32_t cullingEnabled = 1;
+			uint32_t compact = 1;
+			uint32_t padding = 0;
+		};
+
+		static_assert(sizeof(ClusterCullPushConstants) <= 128, "Push constants must fit in 128 bytes");
+
+		std::vector<uint32_t> readShaderFile(const std::string& filename)
+		{
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+			{
+				return {};
+			}
+
+			size_t fileSize = static_cast<size_t>(file.tellg());
+			if (fileSize == 0 || fileSize % 4 != 0)
+			{
+				return {};
+			}
+
+			file.seekg(0);
+			std::vector<uint32_t> buffer(fileSize / sizeof(uint32_t));
+			file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
+			return buffer;
+		}
+	}
+
+	RHIGpuCuller::RHIGpuCuller(RHI* rhi, uint32_t frameCount)
+		: rhi_(rhi)
+		, frameCount_(std::clamp(frameCount, 1u, 8u))  // dirtySlots_ 비트 수
+	{
+	}
+
+	RHIGpuCuller::~RHIGpuCuller()
+	{
+		shutdown();
+	}
+
+	bool RHIGpuCuller::initialize()
+	{
+		if (!rhi_->isMultiDrawIndirectSupported())
+		{
+			printLog("[GpuCuller] multiDrawIndirect not supported, using CPU draw path");
+			return false;
+		}
+
+		if (!rhi_->getUploadManager())
+		{
+			printLog("[GpuCuller] Upload manager not available, using CPU draw path");
+			return false;
+		}
+
+		auto code = readShaderFile("../../assets/shaders/gpuCull.comp.spv");
+		if (code.empty())
+		{
+			printLog("[GpuCuller] gpuCull.comp.spv not found, using CPU draw path");
+			return false;
+		}
+
+		compact_ = rhi_->isDrawIndirectCountSupported();
+
+		// Set 0 (컴퓨트): 레코드 / Indirect 커맨드 / 드로우 수
+		{
+			RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+			for (uint32_t binding = 0; binding < 3; ++binding)
+			{
+				RHIDescriptorSetLayoutBinding storageBinding{};
+				storageBinding.binding = binding;
+				storageBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				storageBinding.descriptorCount = 1;
+				storageBinding.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+				layoutInfo.bindings.push_back(storageBinding);
+			}
+			cullLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+		}
+
+		// Set 4 (정점 셰이더): 레코드
+		{
+			RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+			RHIDescriptorSetLayoutBinding recordBinding{};
+			recordBinding.binding = 0;
+			recordBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			recordBinding.descriptorCount = 1;
+			recordBinding.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT;
+			layoutInfo.bindings.push_back(recordBinding);
+			drawLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+		}
+
+		if (!cullLayout_.isValid() || !drawLayout_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create descriptor set layouts");
+			shutdown();
+			return false;
+		}
+
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = frameCount_ * 2;
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		storagePoolSize.descriptorCount = frameCount_ * 4;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		descriptorPool_ = rhi_->createDescriptorPool(poolInfo);
+
+		frames_.resize(frameCount_);
+		for (auto& frame : frames_)
+		{
+			frame.cullSet = rhi_->allocateDescriptorSet(descriptorPool_, cullLayout_);
+			frame.drawSet = rhi_->allocateDescriptorSet(descriptorPool_, drawLayout_);
+			if (!frame.cullSet.isValid() || !frame.drawSet.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to allocate descriptor sets");
+				shutdown();
+				return false;
+			}
+		}
+
+		RHIShaderCreateInfo shaderInfo{};
+		shaderInfo.stage = RHI_SHADER_STAGE_COMPUTE_BIT;
+		shaderInfo.name = "gpuCull.comp";
+		shaderInfo.entryPoint = "main";
+		shaderInfo.code = std::move(code);
+		cullShader_ = rhi_->createShader(shaderInfo);
+
+		RHIComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.computeShader = cullShader_;
+		pipelineInfo.descriptorSetLayouts.push_back(cullLayout_);
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(CullPushConstants);
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		cullPipeline_ = cullShader_.isValid() ? rhi_->createComputePipeline(pipelineInfo) : RHIPipelineHandle{};
+		if (!cullPipeline_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create culling pipeline");
+			shutdown();
+			return false;
+		}
+
+		printLog("[GpuCuller] Initialized ({} frame slots, {})", frameCount_,
+			compact_ ? "compacted draws with drawIndirectCount" : "fixed draw count");
+		return true;
+	}
+
+	bool RHIGpuCuller::enableOcclusion(const RHIHiZPyramid& pyramid)
+	{
+		if (!isReady() || !pyramid.isReady())
+		{
+			return false;
+		}
+
+		auto code = readShaderFile("../../assets/shaders/gpuOcclusionCull.comp.spv");
+		if (code.empty())
+		{
+			printLog("[GpuCuller] gpuOcclusionCull.comp.spv not found, frustum culling only");
+			return false;
+		}
+
+		// Set 0: 레코드 / Indirect 커맨드 / 드로우 수 / 가시성 / Hi-Z
+		RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+		for (uint32_t binding = 0; binding < 5; ++binding)
+		{
+			RHIDescriptorSetLayoutBinding layoutBinding{};
+			layoutBinding.binding = binding;
+			layoutBinding.descriptorType = binding == 4 ? RHI_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			layoutBinding.descriptorCount = 1;
+			layoutBinding.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+			layoutInfo.bindings.push_back(layoutBinding);
+		}
+		occlusionLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = frameCount_ * 2;
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		storagePoolSize.descriptorCount = frameCount_ * 2 * 4;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		RHIDescriptorPoolSize samplerPoolSize{};
+		samplerPoolSize.type = RHI_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		samplerPoolSize.descriptorCount = frameCount_ * 2;
+		poolInfo.poolSizes.push_back(samplerPoolSize);
+		occlusionPool_ = occlusionLayout_.isValid() ? rhi_->createDescriptorPool(poolInfo) : RHIDescriptorPoolHandle{};
+
+		// 슬롯 버퍼는 Early 목록과 함께 다시 만들도록 비움 (첫 프레임 전이라 사용 중인 슬롯 없음)
+		for (auto& frame : frames_)
+		{
+			destroyFrameBuffers(frame);
+			frame.earlySet = occlusionPool_.isValid() ? rhi_->allocateDescriptorSet(occlusionPool_, occlusionLayout_) : RHIDescriptorSetHandle{};
+			frame.lateSet = occlusionPool_.isValid() ? rhi_->allocateDescriptorSet(occlusionPool_, occlusionLayout_) : RHIDescriptorSetHandle{};
+			if (!frame.earlySet.isValid() || !frame.lateSet.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to allocate occlusion descriptor sets");
+				disableOcclusion();
+				return false;
+			}
+
+			// Hi-Z는 Early에서 읽지 않지만 파이프라인이 같으므로 두 셋 모두 유효해야 함
+			rhi_->updateDescriptorSet(frame.earlySet, 4, pyramid.getHiZView(), pyramid.getSampler());
+			rhi_->updateDescriptorSet(frame.lateSet, 4, pyramid.getHiZView(), pyramid.getSampler());
+			frame.visibilityGeneration = 0;
+		}
+
+		RHIShaderCreateInfo shaderInfo{};
+		shaderInfo.stage = RHI_SHADER_STAGE_COMPUTE_BIT;
+		shaderInfo.name = "gpuOcclusionCull.comp";
+		shaderInfo.entryPoint = "main";
+		shaderInfo.code = std::move(code);
+		occlusionShader_ = rhi_->createShader(shaderInfo);
+
+		RHIComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.computeShader = occlusionShader_;
+		pipelineInfo.descriptorSetLayouts.push_back(occlusionLayout_);
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(OcclusionCullPushConstants);
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		occlusionPipeline_ = occlusionShader_.isValid() ? rhi_->createComputePipeline(pipelineInfo) : RHIPipelineHandle{};
+		if (!occlusionPipeline_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create occlusion culling pipeline");
+			disableOcclusion();
+			return false;
+		}
+
+		hiZ_ = &pyramid;
+		visibilityReset_ = true;
+
+		printLog("[GpuCuller] Two-phase occlusion culling enabled (Hi-Z {}x{}, {} mips)",
+			pyramid.getHiZWidth(), pyramid.getHiZHeight(), pyramid.getMipCount());
+		return true;
+	}
+
+	void RHIGpuCuller::disableOcclusion()
+	{
+		hiZ_ = nullptr;
+
+		if (occlusionPipeline_.isValid())
+		{
+			rhi_->destroyPipeline(occlusionPipeline_);
+			occlusionPipeline_ = {};
+		}
+		if (occlusionShader_.isValid())
+		{
+			rhi_->destroyShader(occlusionShader_);
+			occlusionShader_ = {};
+		}
+
+		// 디스크립터 셋은 풀과 함께 해제
+		for (auto& frame : frames_)
+		{
+			frame.earlySet = {};
+			frame.lateSet = {};
+		}
+		if (occlusionPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(occlusionPool_);
+			occlusionPool_ = {};
+		}
+		if (occlusionLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(occlusionLayout_);
+			occlusionLayout_ = {};
+		}
+
+		if (visibilityBuffer_.isValid())
+		{
+			retired_.push_back({ visibilityBuffer_, RHIUploadTicket{}, frameCounter_ });
+			visibilityBuffer_ = {};
+		}
+		visibilityCapacity_ = 0;
+	}
+
+	bool RHIGpuCuller::enableClusterCulling()
+	{
+		if (!isReady())
+		{
+			return false;
+		}
+
+		auto code = readShaderFile("../../assets/shaders/clusterCull.comp.spv");
+		if (code.empty())
+		{
+			printLog("[GpuCuller] clusterCull.comp.spv not found, mesh-level culling only");
+			return false;
+		}
+
+		// Set 0: 레코드 / Indirect 커맨드 / 드로우 수 / 클러스터 레코드 / meshlet / meshlet 정점 / meshlet 삼각형 / 출력 인덱스
+		constexpr uint32_t kClusterBindingCount = 8;
+		RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+		for (uint32_t binding = 0; binding < kClusterBindingCount; ++binding)
+		{
+			RHIDescriptorSetLayoutBinding layoutBinding{};
+			layoutBinding.binding = binding;
+			layoutBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			layoutBinding.descriptorCount = 1;
+			layoutBinding.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+			layoutInfo.bindings.push_back(layoutBinding);
+		}
+		clusterLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = frameCount_;
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		storagePoolSize.descriptorCount = frameCount_ * kClusterBindingCount;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		clusterPool_ = clusterLayout_.isValid() ? rhi_->createDescriptorPool(poolInfo) : RHIDescriptorPoolHandle{};
+
+		for (auto& frame : frames_)
+		{
+			frame.clusterSet = clusterPool_.isValid() ? rhi_->allocateDescriptorSet(clusterPool_, clusterLayout_) : RHIDescriptorSetHandle{};
+			frame.clusterGeneration = 0;
+			if (!frame.clusterSet.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to allocate cluster descriptor sets");
+				disableClusterCulling();
+				return false;
+			}
+		}
+
+		RHIShaderCreateInfo shaderInfo{};
+		shaderInfo.stage = RHI_SHADER_STAGE_COMPUTE_BIT;
+		shaderInfo.name = "clusterCull.comp";
+		shaderInfo.entryPoint = "main";
+		shaderInfo.code = std::move(code);
+		clusterShader_ = rhi_->createShader(shaderInfo);
+
+		RHIComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.computeShader = clusterShader_;
+		pipelineInfo.descriptorSetLayouts.push_back(clusterLayout_);
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(ClusterCullPushConstants);
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		clusterPipeline_ = clusterShader_.isValid() ? rhi_->createComputePipeline(pipelineInfo) : RHIPipelineHandle{};
+		if (!clusterPipeline_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create cluster culling pipeline");
+			disableClusterCulling();
+			return false;
+		}
+
+		printLog("[GpuCuller] Cluster culling enabled (meshlets of up to {} vertices / {} triangles)",
+			RHIMeshletBuilder::kMaxVertices, RHIMeshletBuilder::kMaxTriangles);
+		return true;
+	}
+
+	void RHIGpuCuller::disableClusterCulling()
+	{
+		if (clusterPipeline_.isValid())
+		{
+			rhi_->destroyPipeline(clusterPipeline_);
+			clusterPipeline_ = {};
+		}
+		if (clusterShader_.isValid())
+		{
+			rhi_->destroyShader(clusterShader_);
+			clusterShader_ = {};
+		}
+
+		// 디스크립터 셋은 풀과 함께 해제
+		for (auto& frame : frames_)
+		{
+			frame.clusterSet = {};
+			frame.clusterReady = false;
+		}
+		if (clusterPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(clusterPool_);
+			clusterPool_ = {};
+		}
+		if (clusterLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(clusterLayout_);
+			clusterLayout_ = {};
+		}
+
+		if (clusterRecordBuffer_.isValid())
+		{
+			retired_.push_back({ clusterRecordBuffer_, clusterRecordTicket_, frameCounter_ });
+			clusterRecordBuffer_ = {};
+		}
+		clusterRecordTicket_ = {};
+		clusterRecords_.clear();
+		clusterIndexCount_ = 0;
+	}
+
+	void RHIGpuCuller::shutdown()
+	{
+		disableOcclusion();
+		disableClusterCulling();
+
+		for (auto& frame : frames_)
+		{
+			destroyFrameBuffers(frame);
+		}
+		frames_.clear();
+
+		retireGeometry();
+		releaseRetired(true);
+		geometry_.clear();
+
+		nodeStates_.clear();
+		records_.clear();
+		dirtySlots_.clear();
+
+		if (cullPipeline_.isValid())
+		{
+			rhi_->destroyPipeline(cullPipeline_);
+			cullPipeline_ = {};
+		}
+		if (cullShader_.isValid())
+		{
+			rhi_->destroyShader(cullShader_);
+			cullShader_ = {};
+		}
+
+		// 디스크립터 셋은 풀과 함께 해제
+		if (descriptorPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(descriptorPool_);
+			descriptorPool_ = {};
+		}
+		if (cullLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(cullLayout_);
+			cullLayout_ = {};
+		}
+		if (drawLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(drawLayout_);
+			drawLayout_ = {};
+		}
+	}
+
+	// ========================================
+	// CPU: 레코드 변경 추적
+	// ========================================
+
+	void RHIGpuCuller::gather(std::vector<RHISceneNode>& nodes, const RHIBonePaletteArena* palettes,
+		const RHISkinningCache* skinning)
+	{
+		if (!isReady())
+		{
+			return;
+		}
+
+		// 노드/메시 구성이 그대로인지 확인 (머티리얼 시작 위치가 바뀌었으면 레코드 전체를 다시 씀)
+		bool layoutChanged = std::exchange(materialBasesChanged_, false) || nodeStates_.size() != nodes.size();
+		for (size_t i = 0; !layoutChanged && i < nodes.size(); ++i)
+		{
+			const RHIModel* model = nodes[i].model.get();
+			layoutChanged = nodeStates_[i].model != model ||
+				nodeStates_[i].count != (model ? model->getMeshes().size() : 0);
+		}
+
+		if (!layoutChanged)
+		{
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				NodeState& state = nodeStates_[i];
+				if (!state.model || state.count == 0)
+				{
+					continue;
+				}
+
+				const glm::mat4 worldTransform = nodes[i].transform * state.model->getTransform();
+				const uint32_t boneOffset = palettes ? palettes->getNodeOffset(i) : RHIBonePaletteArena::kNoPalette;
+				const uint32_t skinnedVertexBase = skinning ? skinning->getNodeVertexBase(i) : RHISkinningCache::kNoCache;
+				if (worldTransform != state.worldTransform || nodes[i].visible != state.visible ||
+					boneOffset != state.boneOffset || skinnedVertexBase != state.skinnedVertexBase)
+				{
+					state.worldTransform = worldTransform;
+					state.visible = nodes[i].visible;
+					state.boneOffset = boneOffset;
+					state.skinnedVertexBase = skinnedVertexBase;
+					writeNodeRecords(state, nodes[i]);
+					markDirty(state.first, state.count);
+				}
+			}
+			return;
+		}
+
+		// 새 모델이 생겼거나 빠졌으면 합친 지오메트리를 다시 만듦
+		std::vector<const RHIModel*> models;
+		for (const auto& node : nodes)
+		{
+			const RHIModel* model = node.model.get();
+			if (model && std::find(models.begin(), models.end(), model) == models.end())
+			{
+				models.push_back(model);
+			}
+		}
+
+		bool geometryChanged = models.size() != geometry_.size();
+		for (size_t i = 0; !geometryChanged && i < models.size(); ++i)
+		{
+			geometryChanged = geometry_[i].model != models[i] ||
+				geometry_[i].meshes.size() != models[i]->getMeshes().size();
+		}
+		if (geometryChanged && !rebuildGeometry(models))
+		{
+			nodeStates_.clear();
+			records_.clear();
+			dirtySlots_.clear();
+			rebuildClusterRecords();
+			return;
+		}
+
+		nodeStates_.resize(nodes.size());
+		uint32_t first = 0;
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			NodeState& state = nodeStates_[i];
+			state.model = nodes[i].model.get();
+			state.first = first;
+			state.count = state.model ? static_cast<uint32_t>(state.model->getMeshes().size()) : 0;
+			state.worldTransform = state.model ? nodes[i].transform * state.model->getTransform() : glm::mat4(0.0f);
+			state.visible = nodes[i].visible;
+			state.boneOffset = palettes ? palettes->getNodeOffset(i) : RHIBonePaletteArena::kNoPalette;
+			state.skinnedVertexBase = skinning ? skinning->getNodeVertexBase(i) : RHISkinningCache::kNoCache;
+			first += state.count;
+		}
+
+		records_.assign(first, GpuDrawRecord{});
+		dirtySlots_.assign(first, 0);
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			writeNodeRecords(nodeStates_[i], nodes[i]);
+		}
+
+		// 모든 슬롯이 레코드 전체를 다시 복사
+		for (auto& frame : frames_)
+		{
+			frame.dirtyRecords.clear();
+			frame.fullUpload = true;
+		}
+
+		// 레코드 인덱스가 바뀌었으므로 지난 프레임 가시성은 버림
+		visibilityReset_ = true;
+
+		rebuildClusterRecords();
+
+		printLog("[GpuCuller] Draw records rebuilt: {} nodes, {} meshes", nodes.size(), records_.size());
+	}
+
+	void RHIGpuCuller::writeNodeRecords(const NodeState& state, const RHISceneNode& node)
+	{
+		const ModelGeometry* geometry = findGeometry(state.model);
+		if (!geometry)
+		{
+			return;
+		}
+
+		const auto& meshes = state.model->getMeshes();
+		for (uint32_t i = 0; i < state.count; ++i)
+		{
+			GpuDrawRecord& record = records_[state.first + i];
+			const MeshGeometry& mesh = geometry->meshes[i];
+			const AABB& bounds = meshes[i]->getBounds();
+
+			record.model = state.worldTransform;
+			record.boundsCenter = glm::vec4(bounds.getCenter(), state.model->hasAnimation() ? 0.0f : 1.0f);
+			record.boundsExtent = glm::vec4(bounds.getExtents(), 0.0f);
+			record.indexCount = node.visible ? mesh.indexCount : 0;
+			record.firstIndex = mesh.firstIndex;
+			record.vertexOffset = mesh.vertexOffset;
+			record.materialIndex = getMaterialIndex(state.model, meshes[i]->getMaterialIndex());
+			record.boneOffset = state.boneOffset;
+			// 캐시의 메시 구간도 합친 정점 버퍼와 같은 순서/크기로 이어지므로 모델 안 정점 위치를 그대로 더함
+			record.skinnedVertexBase = state.skinnedVertexBase == RHISkinningCache::kNoCache ? RHISkinningCache::kNoCache :
+				state.skinnedVertexBase + static_cast<uint32_t>(mesh.vertexOffset - geometry->meshes[0].vertexOffset);
+		}
+	}
+
+	void RHIGpuCuller::setMaterialBases(std::unordered_map<const RHIModel*, uint32_t> bases)
+	{
+		materialBases_ = std::move(bases);
+		materialBasesChanged_ = true;
+	}
+
+	uint32_t RHIGpuCuller::getMaterialIndex(const RHIModel* model, uint32_t localIndex) const
+	{
+		// Material buffer에 없는 모델/범위 밖 인덱스는 기본 머티리얼 (셰이더가 버퍼 밖을 읽지 않도록)
+		const auto it = materialBases_.find(model);
+		if (it == materialBases_.end() || localIndex >= model->getMaterials().size())
+		{
+			return 0;
+		}
+		return it->second + localIndex;
+	}
+
+	void RHIGpuCuller::markDirty(uint32_t first, uint32_t count)
+	{
+		for (uint32_t record = first; record < first + count; ++record)
+		{
+			for (uint32_t slot = 0; slot < frames_.size(); ++slot)
+			{
+				const uint8_t bit = static_cast<uint8_t>(1u << slot);
+				if (!frames_[slot].fullUpload && !(dirtySlots_[record] & bit))
+				{
+					dirtySlots_[record] |= bit;
+					frames_[slot].dirtyRecords.push_back(record);
+				}
+			}
+		}
+	}
+
+	bool RHIGpuCuller::rebuildGeometry(const std::vector<const RHIModel*>& models)
+	{
+		retireGeometry();
+		geometry_.clear();
+
+		uint64_t vertexCount = 0;
+		uint64_t indexCount = 0;
+		for (const RHIModel* model : models)
+		{
+			for (const auto& mesh : model->getMeshes())
+			{
+				vertexCount += mesh->getVertexCount();
+				indexCount += mesh->getIndexCount();
+			}
+		}
+
+		if (vertexCount == 0 || indexCount == 0 || vertexCount > INT32_MAX || indexCount > UINT32_MAX)
+		{
+			return vertexCount == 0 && indexCount == 0;
+		}
+
+		RHIBufferCreateInfo vertexInfo{};
+		vertexInfo.size = vertexCount * sizeof(RHIVertex);
+		vertexInfo.usage = RHI_BUFFER_USAGE_VERTEX_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		vertexInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		vertexBuffer_ = rhi_->createBuffer(vertexInfo);
+
+		RHIBufferCreateInfo indexInfo{};
+		indexInfo.size = indexCount * sizeof(uint32_t);
+		indexInfo.usage = RHI_BUFFER_USAGE_INDEX_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		indexInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		indexBuffer_ = rhi_->createBuffer(indexInfo);
+
+		if (!vertexBuffer_.isValid() || !indexBuffer_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create merged geometry buffers");
+			retireGeometry();
+			return false;
+		}
+
+		// 메시 지오메트리를 이어 붙여 업로드 (복사는 다음 beginFrame에서 프레임보다 먼저 실행)
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+		uint32_t baseVertex = 0;
+		uint32_t baseIndex = 0;
+		for (const RHIModel* model : models)
+		{
+			ModelGeometry& entry = geometry_.emplace_back();
+			entry.model = model;
+
+			for (const auto& mesh : model->getMeshes())
+			{
+				MeshGeometry& geometry = entry.meshes.emplace_back();
+				geometry.firstIndex = baseIndex;
+				geometry.vertexOffset = static_cast<int32_t>(baseVertex);
+				geometry.indexCount = mesh->getIndexCount();
+
+				const auto& vertices = mesh->getVertices();
+				const auto& indices = mesh->getIndices();
+				if (!vertices.empty())
+				{
+					geometryTicket_ = uploadManager->uploadBuffer(vertexBuffer_, vertices.data(),
+						vertices.size() * sizeof(RHIVertex), static_cast<RHIDeviceSize>(baseVertex) * sizeof(RHIVertex));
+				}
+				if (!indices.empty())
+				{
+					geometryTicket_ = uploadManager->uploadBuffer(indexBuffer_, indices.data(),
+						indices.size() * sizeof(uint32_t), static_cast<RHIDeviceSize>(baseIndex) * sizeof(uint32_t));
+				}
+
+				baseVertex += mesh->getVertexCount();
+				baseIndex += mesh->getIndexCount();
+			}
+		}
+
+		if (!geometryTicket_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to upload merged geometry");
+			geometry_.clear();
+			retireGeometry();
+			return false;
+		}
+
+		if (isClusterCullingEnabled())
+		{
+			uploadMeshlets(models);
+		}
+
+		printLog("[GpuCuller] Merged geometry: {} models, {} vertices, {} indices", models.size(), vertexCount, indexCount);
+		return true;
+	}
+
+	const RHIGpuCuller::ModelGeometry* RHIGpuCuller::findGeometry(const RHIModel* model) const
+	{
+		for (const auto& entry : geometry_)
+		{
+			if (entry.model == model)
+			{
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+
+	bool RHIGpuCuller::uploadMeshlets(const std::vector<const RHIModel*>& models)
+	{
+		// meshlet이 없는 메시가 하나라도 있으면 (삼각형 리스트가 아님) 이 씬은 메시 단위 컬링만 사용
+		uint64_t meshletCount = 0;
+		uint64_t vertexCount = 0;
+		uint64_t triangleBytes = 0;
+		for (const RHIModel* model : models)
+		{
+			for (const auto& mesh : model->getMeshes())
+			{
+				const RHIMeshletData& meshlets = mesh->getMeshlets();
+				if (meshlets.empty() && mesh->getIndexCount() > 0)
+				{
+					printLog("[GpuCuller] Mesh '{}' has no meshlets, cluster culling disabled for this scene", mesh->getName());
+					return false;
+				}
+
+				meshletCount += meshlets.meshlets.size();
+				vertexCount += meshlets.vertices.size();
+				triangleBytes += meshlets.triangles.size();
+			}
+		}
+
+		if (meshletCount == 0 || vertexCount > UINT32_MAX || triangleBytes > UINT32_MAX)
+		{
+			return false;
+		}
+
+		meshletBytes_ = meshletCount * sizeof(RHIMeshlet);
+		meshletVertexBytes_ = vertexCount * sizeof(uint32_t);
+		meshletTriangleBytes_ = triangleBytes;
+
+		auto createStorage = [&](RHIDeviceSize size) {
+			RHIBufferCreateInfo bufferInfo{};
+			bufferInfo.size = size;
+			bufferInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+			bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			return rhi_->createBuffer(bufferInfo);
+		};
+
+		meshletBuffer_ = createStorage(meshletBytes_);
+		meshletVertexBuffer_ = createStorage(meshletVertexBytes_);
+		meshletTriangleBuffer_ = createStorage(meshletTriangleBytes_);
+
+		auto discard = [&]() {
+			// 업로드를 예약하지 않은 버퍼만 남으므로 바로 해제 (예약했으면 지오메트리와 같이 retire)
+			for (RHIBufferHandle* buffer : { &meshletBuffer_, &meshletVertexBuffer_, &meshletTriangleBuffer_ })
+			{
+				if (buffer->isValid())
+				{
+					rhi_->destroyBuffer(*buffer);
+					*buffer = {};
+				}
+			}
+		};
+
+		if (!meshletBuffer_.isValid() || !meshletVertexBuffer_.isValid() || !meshletTriangleBuffer_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create meshlet buffers ({} meshlets)", meshletCount);
+			discard();
+			return false;
+		}
+
+		// meshlet 오프셋을 합친 버퍼 기준으로 옮기고 정점/삼각형 목록은 그대로 이어 붙임
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+		std::vector<RHIMeshlet> merged;
+		merged.reserve(static_cast<size_t>(meshletCount));
+		uint32_t vertexBase = 0;
+		uint32_t triangleBase = 0;
+		RHIUploadTicket ticket = geometryTicket_;  // 마지막으로 예약된 복사
+		bool uploaded = true;
+		auto upload = [&](RHIBufferHandle buffer, const void* data, RHIDeviceSize size, RHIDeviceSize dstOffset) {
+			RHIUploadTicket result = uploaded ? uploadManager->uploadBuffer(buffer, data, size, dstOffset) : RHIUploadTicket{};
+			uploaded = result.isValid();
+			ticket = uploaded ? result : ticket;
+		};
+
+		for (size_t m = 0; m < models.size(); ++m)
+		{
+			const auto& meshes = models[m]->getMeshes();
+			for (size_t i = 0; i < meshes.size(); ++i)
+			{
+				const RHIMeshletData& meshlets = meshes[i]->getMeshlets();
+				MeshGeometry& geometry = geometry_[m].meshes[i];
+				geometry.meshletOffset = static_cast<uint32_t>(merged.size());
+				geometry.meshletCount = static_cast<uint32_t>(meshlets.meshlets.size());
+
+				for (RHIMeshlet meshlet : meshlets.meshlets)
+				{
+					meshlet.vertexOffset += vertexBase;
+					meshlet.triangleOffset += triangleBase;  // 메시별 삼각형 목록은 4바이트 단위로 끝나므로 정렬 유지
+					merged.push_back(meshlet);
+				}
+
+				if (!meshlets.vertices.empty())
+				{
+					upload(meshletVertexBuffer_, meshlets.vertices.data(),
+						meshlets.vertices.size() * sizeof(uint32_t), static_cast<RHIDeviceSize>(vertexBase) * sizeof(uint32_t));
+				}
+				if (!meshlets.triangles.empty())
+				{
+					upload(meshletTriangleBuffer_, meshlets.triangles.data(), meshlets.triangles.size(), triangleBase);
+				}
+
+				vertexBase += static_cast<uint32_t>(meshlets.vertices.size());
+				triangleBase += static_cast<uint32_t>(meshlets.triangles.size());
+			}
+		}
+		upload(meshletBuffer_, merged.data(), meshletBytes_, 0);
+		geometryTicket_ = ticket;
+
+		if (!uploaded)
+		{
+			// 일부 복사가 예약됐을 수 있으므로 마지막 복사가 끝난 뒤 해제
+			printLog("[GpuCuller] ❌ Failed to upload meshlets");
+			for (RHIBufferHandle* buffer : { &meshletBuffer_, &meshletVertexBuffer_, &meshletTriangleBuffer_ })
+			{
+				retired_.push_back({ *buffer, ticket, frameCounter_ });
+				*buffer = {};
+			}
+			return false;
+		}
+
+		printLog("[GpuCuller] Merged meshlets: {} meshlets, {} meshlet vertices", meshletCount, vertexCount);
+		return true;
+	}
+
+	void RHIGpuCuller::rebuildClusterRecords()
+	{
+		// 이전 레코드 버퍼는 진행 중인 프레임이 읽을 수 있으므로 retired_로 미룸
+		if (clusterRecordBuffer_.isValid())
+		{
+			retired_.push_back({ clusterRecordBuffer_, clusterRecordTicket_, frameCounter_ });
+			clusterRecordBuffer_ = {};
+		}
+		clusterRecordTicket_ = {};
+		clusterRecords_.clear();
+		clusterIndexCount_ = 0;
+		clusterGeneration_++;
+
+		if (!isClusterCullingEnabled() || !meshletBuffer_.isValid() || records_.empty())
+		{
+			return;
+		}
+
+		// 레코드마다 메시 인덱스 수만큼 출력 구간 예약 (meshlet이 전부 보여도 넘치지 않음)
+		clusterRecords_.assign(records_.size(), ClusterRecord{});
+		uint64_t outputOffset = 0;
+		for (const NodeState& state : nodeStates_)
+		{
+			const ModelGeometry* geometry = state.model ? findGeometry(state.model) : nullptr;
+			if (!geometry)
+			{
+				continue;
+			}
+
+			for (uint32_t i = 0; i < state.count; ++i)
+			{
+				const MeshGeometry& mesh = geometry->meshes[i];
+				ClusterRecord& cluster = clusterRecords_[state.first + i];
+				cluster.meshletOffset = mesh.meshletOffset;
+				cluster.meshletCount = mesh.meshletCount;
+				cluster.outputOffset = static_cast<uint32_t>(std::min<uint64_t>(outputOffset, UINT32_MAX));
+				outputOffset += mesh.indexCount;
+			}
+		}
+
+		if (outputOffset == 0 || outputOffset > UINT32_MAX)
+		{
+			if (outputOffset > 0)
+			{
+				printLog("[GpuCuller] Cluster output too large ({} indices), mesh-level culling only", outputOffset);
+			}
+			clusterRecords_.clear();
+			return;
+		}
+
+		RHIBufferCreateInfo recordInfo{};
+		recordInfo.size = clusterRecords_.size() * sizeof(ClusterRecord);
+		recordInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		recordInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		clusterRecordBuffer_ = rhi_->createBuffer(recordInfo);
+		if (clusterRecordBuffer_.isValid())
+		{
+			clusterRecordTicket_ = rhi_->getUploadManager()->uploadBuffer(clusterRecordBuffer_, clusterRecords_.data(), recordInfo.size);
+		}
+
+		if (!clusterRecordTicket_.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to upload cluster records ({} records)", clusterRecords_.size());
+			if (clusterRecordBuffer_.isValid())
+			{
+				rhi_->destroyBuffer(clusterRecordBuffer_);
+				clusterRecordBuffer_ = {};
+			}
+			clusterRecords_.clear();
+			return;
+		}
+
+		clusterIndexCount_ = static_cast<uint32_t>(outputOffset);
+	}
+
+	void RHIGpuCuller::retireGeometry()
+	{
+		// 이전 프레임들이 아직 그리고 있을 수 있으므로 frameCount_ 프레임 뒤에 해제
+		for (RHIBufferHandle* buffer : { &vertexBuffer_, &indexBuffer_, &meshletBuffer_, &meshletVertexBuffer_, &meshletTriangleBuffer_ })
+		{
+			if (buffer->isValid())
+			{
+				retired_.push_back({ *buffer, geometryTicket_, frameCounter_ });
+				*buffer = {};
+			}
+		}
+		geometryTicket_ = {};
+	}
+
+	void RHIGpuCuller::releaseRetired(bool force)
+	{
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+
+		auto it = retired_.begin();
+		while (it != retired_.end())
+		{
+			if (!force && frameCounter_ < it->retireFrame + frameCount_)
+			{
+				++it;
+				continue;
+			}
+
+			if (uploadManager && it->ticket.isValid())
+			{
+				uploadManager->deferDestroy(it->buffer, it->ticket);
+			}
+			else
+			{
+				rhi_->destroyBuffer(it->buffer);
+			}
+			it = retired_.erase(it);
+		}
+	}
+
+	// ========================================
+	// GPU: 프레임 슬롯 갱신 + 컬링 / 드로우 기록
+	// ========================================
+
+	RHIGpuCuller::FrameResources& RHIGpuCuller::currentFrame()
+	{
+		return frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+	}
+
+	RHIDescriptorSetHandle RHIGpuCuller::getDrawDescriptorSet() const
+	{
+		return frames_.empty() ? RHIDescriptorSetHandle{} : frames_[rhi_->getCurrentFrameIndex() % frames_.size()].drawSet;
+	}
+
+	RHIBufferHandle RHIGpuCuller::getCommandBuffer(Phase phase) const
+	{
+		if (frames_.empty())
+		{
+			return {};
+		}
+		const FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		return phase == Phase::Early ? frame.earlyCommandBuffer : frame.commandBuffer;
+	}
+
+	RHIBufferHandle RHIGpuCuller::getCountBuffer(Phase phase) const
+	{
+		if (frames_.empty())
+		{
+			return {};
+		}
+		const FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		return phase == Phase::Early ? frame.earlyCountBuffer : frame.countBuffer;
+	}
+
+	RHIBufferHandle RHIGpuCuller::getClusterIndexBuffer() const
+	{
+		if (frames_.empty())
+		{
+			return {};
+		}
+		const FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		return frame.clusterReady ? frame.clusterIndexBuffer : RHIBufferHandle{};
+	}
+
+	bool RHIGpuCuller::ensureCapacity(FrameResources& frame, uint32_t recordCount)
+	{
+		if (frame.capacity >= recordCount)
+		{
+			return true;
+		}
+
+		// 이 슬롯의 이전 프레임은 이미 끝났으므로 바로 다시 만들 수 있음
+		destroyFrameBuffers(frame);
+
+		uint32_t capacity = std::max(frame.capacity, kMinRecordCapacity);
+		while (capacity < recordCount)
+		{
+			capacity *= 2;
+		}
+
+		// 레코드는 바뀐 것만 다시 올리므로 프레임 선형 풀이 아닌 슬롯별 영구 버퍼
+		RHIBufferCreateInfo recordInfo{};
+		recordInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(GpuDrawRecord);
+		recordInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		recordInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		frame.recordBuffer = rhi_->createBuffer(recordInfo);
+
+		RHIBufferCreateInfo commandInfo{};
+		commandInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(RHIDrawIndexedIndirectCommand);
+		commandInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+			RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;  // 검증 도구(GpuCullingCheck)가 복사해서 읽음
+		commandInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		frame.commandBuffer = rhi_->createBuffer(commandInfo);
+
+		RHIBufferCreateInfo countInfo{};
+		countInfo.size = sizeof(uint32_t);
+		countInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+			RHI_BUFFER_USAGE_TRANSFER_SRC_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		countInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		frame.countBuffer = rhi_->createBuffer(countInfo);
+
+		// 최종 드로우 수를 복사받아 슬롯이 다시 돌아왔을 때 CPU가 읽음
+		RHIBufferCreateInfo statsInfo{};
+		statsInfo.size = sizeof(uint32_t);
+		statsInfo.usage = RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		statsInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		frame.statsBuffer = rhi_->createBuffer(statsInfo);
+
+		if (!frame.recordBuffer.isValid() || !frame.commandBuffer.isValid() || !frame.countBuffer.isValid() ||
+			!frame.statsBuffer.isValid())
+		{
+			printLog("[GpuCuller] ❌ Failed to create frame buffers ({} records)", capacity);
+			destroyFrameBuffers(frame);
+			return false;
+		}
+
+		frame.mappedRecords = static_cast<GpuDrawRecord*>(rhi_->mapBuffer(frame.recordBuffer));
+		frame.mappedStats = static_cast<const uint32_t*>(rhi_->mapBuffer(frame.statsBuffer));
+		frame.capacity = capacity;
+		frame.fullUpload = true;
+		frame.clusterGeneration = 0;  // 클러스터 셋도 새 버퍼를 가리키도록
+
+		rhi_->updateDescriptorSet(frame.cullSet, 0, frame.recordBuffer, 0, recordInfo.size);
+		rhi_->updateDescriptorSet(frame.cullSet, 1, frame.commandBuffer, 0, commandInfo.size);
+		rhi_->updateDescriptorSet(frame.cullSet, 2, frame.countBuffer, 0, countInfo.size);
+		rhi_->updateDescriptorSet(frame.drawSet, 0, frame.recordBuffer, 0, recordInfo.size);
+
+		if (isOcclusionEnabled())
+		{
+			// Early 목록은 Depth 프리패스용, 최종 목록(commandBuffer)은 Late가 씀
+			frame.earlyCommandBuffer = rhi_->createBuffer(commandInfo);
+			frame.earlyCountBuffer = rhi_->createBuffer(countInfo);
+			if (!frame.earlyCommandBuffer.isValid() || !frame.earlyCountBuffer.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to create early draw buffers ({} records)", capacity);
+				destroyFrameBuffers(frame);
+				return false;
+			}
+
+			rhi_->updateDescriptorSet(frame.earlySet, 0, frame.recordBuffer, 0, recordInfo.size);
+			rhi_->updateDescriptorSet(frame.earlySet, 1, frame.earlyCommandBuffer, 0, commandInfo.size);
+			rhi_->updateDescriptorSet(frame.earlySet, 2, frame.earlyCountBuffer, 0, countInfo.size);
+			rhi_->updateDescriptorSet(frame.lateSet, 0, frame.recordBuffer, 0, recordInfo.size);
+			rhi_->updateDescriptorSet(frame.lateSet, 1, frame.commandBuffer, 0, commandInfo.size);
+			rhi_->updateDescriptorSet(frame.lateSet, 2, frame.countBuffer, 0, countInfo.size);
+		}
+		return true;
+	}
+
+	bool RHIGpuCuller::ensureVisibility(FrameResources& frame, uint32_t recordCount)
+	{
+		if (visibilityCapacity_ < recordCount)
+		{
+			// 이전 버퍼는 아직 진행 중인 프레임이 읽을 수 있으므로 retired_로 미룸
+			if (visibilityBuffer_.isValid())
+			{
+				retired_.push_back({ visibilityBuffer_, RHIUploadTicket{}, frameCounter_ });
+			}
+
+			RHIBufferCreateInfo visibilityInfo{};
+			visibilityInfo.size = static_cast<RHIDeviceSize>(frame.capacity) * sizeof(uint32_t);
+			visibilityInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+			visibilityInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			visibilityBuffer_ = rhi_->createBuffer(visibilityInfo);
+			if (!visibilityBuffer_.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to create visibility buffer ({} records)", frame.capacity);
+				visibilityCapacity_ = 0;
+				return false;
+			}
+
+			visibilityCapacity_ = frame.capacity;
+			visibilityGeneration_++;
+			visibilityReset_ = true;
+		}
+
+		if (frame.visibilityGeneration != visibilityGeneration_)
+		{
+			const RHIDeviceSize size = static_cast<RHIDeviceSize>(visibilityCapacity_) * sizeof(uint32_t);
+			rhi_->updateDescriptorSet(frame.earlySet, 3, visibilityBuffer_, 0, size);
+			rhi_->updateDescriptorSet(frame.lateSet, 3, visibilityBuffer_, 0, size);
+			frame.visibilityGeneration = visibilityGeneration_;
+		}
+
+		frame.clearVisibility = visibilityReset_;
+		visibilityReset_ = false;
+		return true;
+	}
+
+	void RHIGpuCuller::destroyFrameBuffers(FrameResources& frame)
+	{
+		if (frame.recordBuffer.isValid())
+		{
+			rhi_->unmapBuffer(frame.recordBuffer);
+			rhi_->destroyBuffer(frame.recordBuffer);
+		}
+		if (frame.commandBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.commandBuffer);
+		}
+		if (frame.countBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.countBuffer);
+		}
+		if (frame.statsBuffer.isValid())
+		{
+			rhi_->unmapBuffer(frame.statsBuffer);
+			rhi_->destroyBuffer(frame.statsBuffer);
+		}
+		if (frame.earlyCommandBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.earlyCommandBuffer);
+		}
+		if (frame.earlyCountBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.earlyCountBuffer);
+		}
+		if (frame.clusterIndexBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.clusterIndexBuffer);
+		}
+
+		frame.recordBuffer = {};
+		frame.commandBuffer = {};
+		frame.countBuffer = {};
+		frame.statsBuffer = {};
+		frame.earlyCommandBuffer = {};
+		frame.earlyCountBuffer = {};
+		frame.clusterIndexBuffer = {};
+		frame.mappedRecords = nullptr;
+		frame.mappedStats = nullptr;
+		frame.statsPending = false;
+		frame.capacity = 0;
+		frame.clusterIndexCapacity = 0;
+		frame.clusterGeneration = 0;
+		frame.clusterReady = false;
+	}
+
+	bool RHIGpuCuller::prepareClusters(FrameResources& frame)
+	{
+		if (!isClusterCullingEnabled() || !clusterRecordBuffer_.isValid() || clusterIndexCount_ == 0)
+		{
+			return false;
+		}
+
+		if (frame.clusterIndexCapacity < clusterIndexCount_)
+		{
+			// 이 슬롯의 이전 프레임은 이미 끝났으므로 바로 다시 만들 수 있음
+			if (frame.clusterIndexBuffer.isValid())
+			{
+				rhi_->destroyBuffer(frame.clusterIndexBuffer);
+			}
+
+			uint64_t capacity = std::max<uint64_t>(frame.clusterIndexCapacity, kMinClusterIndexCapacity);
+			while (capacity < clusterIndexCount_)
+			{
+				capacity *= 2;
+			}
+			capacity = std::min<uint64_t>(capacity, UINT32_MAX);
+
+			RHIBufferCreateInfo indexInfo{};
+			indexInfo.size = capacity * sizeof(uint32_t);
+			indexInfo.usage = RHI_BUFFER_USAGE_INDEX_BUFFER_BIT | RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+			indexInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			frame.clusterIndexBuffer = rhi_->createBuffer(indexInfo);
+			frame.clusterGeneration = 0;
+			if (!frame.clusterIndexBuffer.isValid())
+			{
+				printLog("[GpuCuller] ❌ Failed to create cluster index buffer ({} indices)", capacity);
+				frame.clusterIndexCapacity = 0;
+				return false;
+			}
+			frame.clusterIndexCapacity = static_cast<uint32_t>(capacity);
+		}
+
+		if (frame.clusterGeneration != clusterGeneration_)
+		{
+			const RHIDeviceSize recordBytes = static_cast<RHIDeviceSize>(frame.capacity) * sizeof(GpuDrawRecord);
+			const RHIDeviceSize commandBytes = static_cast<RHIDeviceSize>(frame.capacity) * sizeof(RHIDrawIndexedIndirectCommand);
+			rhi_->updateDescriptorSet(frame.clusterSet, 0, frame.recordBuffer, 0, recordBytes);
+			rhi_->updateDescriptorSet(frame.clusterSet, 1, frame.commandBuffer, 0, commandBytes);
+			rhi_->updateDescriptorSet(frame.clusterSet, 2, frame.countBuffer, 0, sizeof(uint32_t));
+			rhi_->updateDescriptorSet(frame.clusterSet, 3, clusterRecordBuffer_, 0, clusterRecords_.size() * sizeof(ClusterRecord));
+			rhi_->updateDescriptorSet(frame.clusterSet, 4, meshletBuffer_, 0, meshletBytes_);
+			rhi_->updateDescriptorSet(frame.clusterSet, 5, meshletVertexBuffer_, 0, meshletVertexBytes_);
+			rhi_->updateDescriptorSet(frame.clusterSet, 6, meshletTriangleBuffer_, 0, meshletTriangleBytes_);
+			rhi_->updateDescriptorSet(frame.clusterSet, 7, frame.clusterIndexBuffer, 0,
+				static_cast<RHIDeviceSize>(frame.clusterIndexCapacity) * sizeof(uint32_t));
+			frame.clusterGeneration = clusterGeneration_;
+		}
+		return true;
+	}
+
+	void RHIGpuCuller::prepareFrame()
+	{
+		if (!isReady())
+		{
+			return;
+		}
+
+		frameCounter_++;
+		releaseRetired(false);
+
+		// 이 슬롯의 지난 프레임은 끝났으므로 그 프레임이 복사한 드로우 수를 읽을 수 있음
+		FrameResources& frame = currentFrame();
+		if (frame.statsPending && frame.mappedStats)
+		{
+			visibleCount_ = *frame.mappedStats;
+			visibleCountValid_ = true;
+			frame.statsPending = false;
+		}
+
+		const uint32_t recordCount = getRecordCount();
+		if (recordCount == 0 || !vertexBuffer_.isValid())
+		{
+			return;
+		}
+
+		if (!ensureCapacity(frame, recordCount) || !frame.mappedRecords)
+		{
+			return;
+		}
+
+		// 이 슬롯이 마지막으로 쓰인 뒤 바뀐 레코드만 복사
+		const uint8_t slotBit = static_cast<uint8_t>(1u << (&frame - frames_.data()));
+		if (frame.fullUpload)
+		{
+			memcpy(frame.mappedRecords, records_.data(), records_.size() * sizeof(GpuDrawRecord));
+			for (auto& slots : dirtySlots_)
+			{
+				slots &= ~slotBit;
+			}
+			frame.fullUpload = false;
+		}
+		else
+		{
+			for (uint32_t record : frame.dirtyRecords)
+			{
+				frame.mappedRecords[record] = records_[record];
+				dirtySlots_[record] &= ~slotBit;
+			}
+		}
+		frame.dirtyRecords.clear();
+
+		if (isOcclusionEnabled())
+		{
+			ensureVisibility(frame, recordCount);
+		}
+
+		frame.clusterReady = prepareClusters(frame);
+	}
+
+	void RHIGpuCuller::recordCulling(const RHIViewFrustum& frustum, const glm::mat4& viewProjection, bool cullingEnabled,
+		Phase phase)
+	{
+		const uint32_t recordCount = getRecordCount();
+		if (!isReady() || recordCount == 0 || !vertexBuffer_.isValid())
+		{
+			return;
+		}
+
+		FrameResources& frame = currentFrame();
+		if (frame.capacity < recordCount)
+		{
+			return;
+		}
+
+		const bool occlusion = phase != Phase::Frustum && isOcclusionEnabled() && visibilityBuffer_.isValid();
+		if (phase != Phase::Frustum && !occlusion)
+		{
+			// Early는 건너뛰고 Late는 절두체 컬링으로 대체
+			if (phase == Phase::Early)
+			{
+				return;
+			}
+			phase = Phase::Frustum;
+		}
+
+		const RHIBufferHandle countBuffer = phase == Phase::Early ? frame.earlyCountBuffer : frame.countBuffer;
+
+		// 드로우 수 초기화 → 컴퓨트에서 atomicAdd (압축하지 않을 때도 통계용으로 셈)
+		rhi_->cmdFillBuffer(countBuffer, 0, sizeof(uint32_t), 0);
+
+		RHIBarrierBatch clearBarrier;
+		RHIBufferBarrier& countBarrier = clearBarrier.bufferBarriers.emplace_back();
+		countBarrier.buffer = countBuffer;
+		countBarrier.srcStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+		countBarrier.srcAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+		countBarrier.dstStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		countBarrier.dstAccessMask = RHI_ACCESS_SHADER_READ_BIT | RHI_ACCESS_SHADER_WRITE_BIT;
+
+		if (occlusion)
+		{
+			// 레코드 구성이 바뀐 첫 프레임은 Early 목록이 비도록 가시성을 0으로
+			// (지난 프레임 Late의 쓰기 → 이번 프레임 접근 배리어는 RenderGraph가 패스 앞에 둠)
+			if (phase == Phase::Early && frame.clearVisibility)
+			{
+				rhi_->cmdFillBuffer(visibilityBuffer_, 0, static_cast<RHIDeviceSize>(visibilityCapacity_) * sizeof(uint32_t), 0);
+				frame.clearVisibility = false;
+
+				RHIBufferBarrier& barrier = clearBarrier.bufferBarriers.emplace_back();
+				barrier.buffer = visibilityBuffer_;
+				barrier.srcStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+				barrier.srcAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+				barrier.dstStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+				barrier.dstAccessMask = RHI_ACCESS_SHADER_READ_BIT | RHI_ACCESS_SHADER_WRITE_BIT;
+			}
+		}
+
+		rhi_->cmdPipelineBarrier(clearBarrier);
+
+		if (occlusion)
+		{
+			OcclusionCullPushConstants pushConstants{};
+			pushConstants.viewProjection = viewProjection;
+			pushConstants.recordCount = recordCount;
+			pushConstants.cullingEnabled = cullingEnabled ? 1 : 0;
+			pushConstants.compact = compact_ ? 1 : 0;
+			pushConstants.phase = static_cast<uint32_t>(phase);
+			pushConstants.depthWidth = hiZ_->getWidth();
+			pushConstants.depthHeight = hiZ_->getHeight();
+			pushConstants.hiZMipCount = hiZ_->getMipCount();
+
+			const RHIDescriptorSetHandle set = phase == Phase::Early ? frame.earlySet : frame.lateSet;
+			rhi_->cmdBindPipeline(occlusionPipeline_);
+			rhi_->cmdBindDescriptorSets(occlusionPipeline_, 0, &set, 1);
+			rhi_->cmdPushConstants(occlusionPipeline_, RHI_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+			rhi_->cmdDispatch((recordCount + kWorkgroupSize - 1) / kWorkgroupSize);
+		}
+		else
+		{
+			recordFrustumDispatch(frame, frustum, recordCount, cullingEnabled);
+		}
+
+		// 최종 목록은 meshlet 단위로 한 번 더 컬링 (Early 목록은 합친 인덱스 버퍼 그대로)
+		// 커맨드/드로우 수/클러스터 인덱스 → 드로우 배리어는 RenderGraph가 드로우 패스 앞에 둠 (GpuCullingPassRG가 쓰기로 선언)
+		if (phase != Phase::Early && frame.clusterReady)
+		{
+			recordClusterDispatch(frame, frustum, viewProjection, recordCount, cullingEnabled);
+		}
+
+		if (phase != Phase::Early)
+		{
+			recordStatsCopy(frame);
+		}
+	}
+
+	void RHIGpuCuller::recordStatsCopy(FrameResources& frame)
+	{
+		// 최종 드로우 수 → Host visible 복사본 (슬롯의 다음 prepareFrame에서 읽음)
+		RHIBarrierBatch copyBarrier;
+		RHIBufferBarrier& countBarrier = copyBarrier.bufferBarriers.emplace_back();
+		countBarrier.buffer = frame.countBuffer;
+		countBarrier.srcStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		countBarrier.srcAccessMask = RHI_ACCESS_SHADER_WRITE_BIT;
+		countBarrier.dstStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+		countBarrier.dstAccessMask = RHI_ACCESS_TRANSFER_READ_BIT;
+		rhi_->cmdPipelineBarrier(copyBarrier);
+
+		RHIBufferCopy region{ 0, 0, sizeof(uint32_t) };
+		rhi_->cmdCopyBuffer(frame.countBuffer, frame.statsBuffer, 1, &region);
+
+		RHIBarrierBatch hostBarrier;
+		RHIBufferBarrier& statsBarrier = hostBarrier.bufferBarriers.emplace_back();
+		statsBarrier.buffer = frame.statsBuffer;
+		statsBarrier.srcStageMask = RHI_PIPELINE_STAGE_TRANSFER_BIT;
+		statsBarrier.srcAccessMask = RHI_ACCESS_TRANSFER_WRITE_BIT;
+		statsBarrier.dstStageMask = RHI_PIPELINE_STAGE_HOST_BIT;
+		statsBarrier.dstAccessMask = RHI_ACCESS_HOST_READ_BIT;
+		rhi_->cmdPipelineBarrier(hostBarrier);
+
+		frame.statsPending = true;
+	}
+
+	void RHIGpuCuller::recordFrustumDispatch(const FrameResources& frame, const RHIViewFrustum& frustum,
+		uint32_t recordCount, bool cullingEnabled)
+	{
+		CullPushConstants pushConstants{};
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			const Plane& plane = frustum.getPlane(static_cast<RHIViewFrustum::PlaneIndex>(p));
+			pushConstants.planes[p] = glm::vec4(plane.normal, plane.distance);
+		}
+		pushConstants.recordCount = recordCount;
+		pushConstants.cullingEnabled = cullingEnabled ? 1 : 0;
+		pushConstants.compact = compact_ ? 1 : 0;
+
+		rhi_->cmdBindPipeline(cullPipeline_);
+		rhi_->cmdBindDescriptorSets(cullPipeline_, 0, &frame.cullSet, 1);
+		rhi_->cmdPushConstants(cullPipeline_, RHI_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+		rhi_->cmdDispatch((recordCount + kWorkgroupSize - 1) / kWorkgroupSize);
+	}
+
+	void RHIGpuCuller::recordClusterDispatch(const FrameResources& frame, const RHIViewFrustum& frustum,
+		const glm::mat4& viewProjection, uint32_t recordCount, bool cullingEnabled)
+	{
+		// 메시 단위 컬링이 쓴 커맨드/드로우 수를 클러스터 패스가 읽고 고쳐 씀
+		RHIBarrierBatch commandBarrier;
+		for (RHIBufferHandle buffer : { frame.commandBuffer, frame.countBuffer })
+		{
+			RHIBufferBarrier& barrier = commandBarrier.bufferBarriers.emplace_back();
+			barrier.buffer = buffer;
+			barrier.srcStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			barrier.srcAccessMask = RHI_ACCESS_SHADER_WRITE_BIT;
+			barrier.dstStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			barrier.dstAccessMask = RHI_ACCESS_SHADER_READ_BIT | RHI_ACCESS_SHADER_WRITE_BIT;
+		}
+		rhi_->cmdPipelineBarrier(commandBarrier);
+
+		ClusterCullPushConstants pushConstants{};
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			const Plane& plane = frustum.getPlane(static_cast<RHIViewFrustum::PlaneIndex>(p));
+			pushConstants.planes[p] = glm::vec4(plane.normal, plane.distance);
+		}
+
+		// 원근 투영의 시점 = 클립 공간에서 w = 0으로 가는 점, 직교 투영이면 무한원점이라 cone 컬링 안 함
+		const glm::vec4 eye = glm::inverse(viewProjection) * glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+		if (std::abs(eye.w) > 1e-6f)
+		{
+			pushConstants.cameraPosition = glm::vec4(glm::vec3(eye) / eye.w, 1.0f);
+		}
+
+		pushConstants.recordCount = recordCount;
+		pushConstants.cullingEnabled = cullingEnabled ? 1 : 0;
+		pushConstants.compact = compact_ ? 1 : 0;
+
+		// 드로우 하나당 워크그룹 하나 (compact면 드로우 수 이후 워크그룹은 바로 종료)
+		// maxComputeWorkGroupCount 최소 보장값(65535)을 넘으면 Y로 나눔
+		const uint32_t groupsX = std::min(recordCount, kMaxDispatchGroups);
+		const uint32_t groupsY = (recordCount + groupsX - 1) / groupsX;
+		rhi_->cmdBindPipeline(clusterPipeline_);
+		rhi_->cmdBindDescriptorSets(clusterPipeline_, 0, &frame.clusterSet, 1);
+		rhi_->cmdPushConstants(clusterPipeline_, RHI_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+		rhi_->cmdDispatch(groupsX, groupsY);
+	}
+
+	void RHIGpuCuller::recordDraws(Phase phase)
+	{
+		const uint32_t recordCount = getRecordCount();
+		if (!isReady() || recordCount == 0 || !vertexBuffer_.isValid())
+		{
+			return;
+		}
+
+		FrameResources& frame = currentFrame();
+		if (frame.capacity < recordCount)
+		{
+			return;
+		}
+
+		const bool early = phase == Phase::Early;
+		if (early && (!isOcclusionEnabled() || !visibilityBuffer_.isValid()))
+		{
+			return;
+		}
+
+		const RHIBufferHandle commandBuffer = early ? frame.earlyCommandBuffer : frame.commandBuffer;
+		const RHIBufferHandle countBuffer = early ? frame.earlyCountBuffer : frame.countBuffer;
+
+		// 클러스터 컬링한 최종 목록은 압축한 인덱스 버퍼를 가리킴
+		rhi_->cmdBindVertexBuffer(vertexBuffer_);
+		rhi_->cmdBindIndexBuffer(!early && frame.clusterReady ? frame.clusterIndexBuffer : indexBuffer_);
+
+		if (compact_)
+		{
+			rhi_->cmdDrawIndexedIndirectCount(commandBuffer, 0, countBuffer, 0,
+				recordCount, sizeof(RHIDrawIndexedIndirectCommand));
+		}
+		else
+		{
+			rhi_->cmdDrawIndexedIndirect(commandBuffer, 0, recordCount, sizeof(RHIDrawIndexedIndirectCommand));
+		}
+	}
+
+} // namespace BinRenderer
@@ -0,0 +1,328 @@
+﻿#pragma once
+
+#include "../RHI/Core/RHI.h"
+#include "../RHI/Resources/RHIUploadManager.h"
+#include "RHIViewFrustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace BinRenderer
+{
+	struct RHISceneNode;
+	class RHIModel;
+	class RHIHiZPyramid;
+	class RHIBonePaletteArena;
+	class RHISkinningCache;
+
+	/**
+	 * @brief 메시 하나의 GPU 드로우 레코드 (std430, gpuCull.comp / pbrForwardIndirect.vert와 같은 배치)
+	 */
+	struct GpuDrawRecord
+	{
+		glm::mat4 model = glm::mat4(1.0f);
+		glm::vec4 boundsCenter = glm::vec4(0.0f);  // 로컬 공간 AABB, w = 1이면 가림막 가능 (정적 메시)
+		glm::vec4 boundsExtent = glm::vec4(0.0f);
+		uint32_t indexCount = 0;                   // 0이면 숨긴 노드 (항상 컬링)
+		uint32_t firstIndex = 0;
+		int32_t vertexOffset = 0;
+		uint32_t materialIndex = 0;
+		uint32_t boneOffset = UINT32_MAX;          // 본 팔레트 시작 (UINT32_MAX면 스키닝 안 함)
+		uint32_t skinnedVertexBase = UINT32_MAX;   // 프리스키닝 캐시의 정점 시작 (UINT32_MAX면 캐시 안 씀)
+		uint32_t padding[2] = { 0, 0 };
+	};
+
+	static_assert(sizeof(GpuDrawRecord) == 128, "GpuDrawRecord must match the std430 DrawRecord layout");
+
+	/**
+	 * @brief GPU-driven 메시 컬링 + Indirect 드로우
+	 *
+	 * - 씬 메시의 정점/인덱스를 버퍼 하나씩으로 합치고 메시마다 드로우 레코드를 둠
+	 * - CPU는 transform/가시성이 바뀐 노드의 레코드만 갱신, 프레임 슬롯 버퍼에는 그 슬롯이 놓친 변경분만 복사
+	 * - 컴퓨트 셰이더가 절두체 테스트 후 보이는 메시의 Indirect 커맨드를 압축해서 쓰고,
+	 *   드로우는 메시 수와 관계없이 cmdDrawIndexedIndirectCount 한 번
+	 * - drawIndirectCount가 없으면 압축 없이 instanceCount = 0으로 컬링하고 cmdDrawIndexedIndirect 사용
+	 *
+	 * 가림막 컬링 (enableOcclusion 이후, gpuOcclusionCull.comp):
+	 * - Early: 지난 프레임에 보였던 정적 메시 → Depth 프리패스가 그려 Hi-Z 생성
+	 * - Late: 모든 메시를 절두체 + Hi-Z로 테스트 → 최종 드로우 목록, 결과는 다음 프레임 Early가 사용
+	 *
+	 * 클러스터 컬링 (enableClusterCulling 이후, clusterCull.comp):
+	 * - 최종 드로우 목록의 메시마다 meshlet을 절두체 + 법선 cone으로 다시 컬링
+	 * - 살아남은 meshlet의 인덱스를 프레임 슬롯의 출력 인덱스 버퍼에 압축하고 드로우 커맨드가 그 구간을 가리킴
+	 *   (출력 버퍼는 레코드마다 메시 인덱스 수만큼 구간을 예약)
+	 * - Early 목록(Depth 프리패스)은 합친 인덱스 버퍼를 그대로 사용
+	 */
+	class RHIGpuCuller
+	{
+	public:
+		enum class Phase : uint32_t
+		{
+			Frustum = 0,  // 절두체만 (gpuCull.comp)
+			Early = 1,    // 지난 프레임 가시 목록 → Depth 프리패스
+			Late = 2,     // 절두체 + Hi-Z → 최종 드로우
+		};
+
+		RHIGpuCuller(RHI* rhi, uint32_t frameCount);
+		~RHIGpuCuller();
+
+		/**
+		 * @brief 컴퓨트 파이프라인/디스크립터 생성
+		 * @return 디바이스 기능, 업로드 관리자, 셰이더 중 하나라도 없으면 false (CPU 드로우 경로 사용)
+		 */
+		bool initialize();
+		void shutdown();
+
+		bool isReady() const { return cullPipeline_.isValid(); }
+
+		/**
+		 * @brief 2단계 가림막 컬링 사용 (initialize 직후, 첫 프레임 전에 호출)
+		 * @return gpuOcclusionCull.comp.spv가 없거나 피라미드가 준비되지 않았으면 false
+		 */
+		bool enableOcclusion(const RHIHiZPyramid& pyramid);
+		bool isOcclusionEnabled() const { return occlusionPipeline_.isValid(); }
+
+		/**
+		 * @brief 최종 드로우 목록에 meshlet 단위 컬링 추가 (initialize 직후, 첫 gather 전에 호출)
+		 * @return clusterCull.comp.spv가 없으면 false (메시 단위 컬링만 사용)
+		 */
+		bool enableClusterCulling();
+		bool isClusterCullingEnabled() const { return clusterPipeline_.isValid(); }
+
+		/**
+		 * @brief 노드 목록에서 드로우 레코드 갱신 (프레임 커맨드 기록 전에 호출)
+		 *
+		 * 노드/메시 구성이 바뀌면 레코드 전체와 (모델이 바뀌었으면) 합친 지오메트리를 다시 만들고,
+		 * 아니면 transform/가시성/본 팔레트 오프셋/스키닝 캐시 위치가 바뀐 노드의 레코드만 갱신
+		 * @param palettes 이번 프레임에 배정한 본 팔레트 (nullptr이면 스키닝 없이 바인드 포즈)
+		 * @param skinning 이번 프레임에 배정한 프리스키닝 작업 (nullptr이면 정점 셰이더가 팔레트로 스키닝)
+		 */
+		void gather(std::vector<RHISceneNode>& nodes, const RHIBonePaletteArena* palettes = nullptr,
+			const RHISkinningCache* skinning = nullptr);
+
+		/**
+		 * @brief 모델별 Material buffer 시작 위치 설정 (RHIRenderer::buildMaterialBuffer 이후)
+		 *
+		 * 레코드의 materialIndex = 모델 시작 위치 + 메시의 모델 내 머티리얼 인덱스 (모르는 모델은 0)
+		 * 다음 gather에서 레코드 전체를 다시 씀
+		 */
+		void setMaterialBases(std::unordered_map<const RHIModel*, uint32_t> bases);
+
+		/**
+		 * @brief 현재 프레임 슬롯의 버퍼 크기 확보 후 밀린 레코드 복사
+		 *
+		 * RHI::beginFrame 이후(슬롯의 이전 프레임이 끝난 상태), 커맨드 기록 전에 호출
+		 * (병렬 기록 중인 패스가 공유 상태를 바꾸지 않도록 기록과 분리)
+		 */
+		void prepareFrame();
+
+		/**
+		 * @brief 컬링 디스패치 기록 (prepareFrame 이후, 렌더링 밖에서)
+		 *
+		 * Frustum은 frustum 평면, Early/Late는 viewProjection에서 평면을 다시 뽑아 사용
+		 * Late는 같은 프레임의 Hi-Z 빌드 이후에 기록해야 함
+		 * 커맨드/드로우 수를 드로우에서 읽기 전 배리어는 기록하지 않음 (RenderGraph가 패스 의존성으로 생성)
+		 */
+		void recordCulling(const RHIViewFrustum& frustum, const glm::mat4& viewProjection, bool cullingEnabled,
+			Phase phase = Phase::Frustum);
+
+		/**
+		 * @brief 합친 지오메트리 바인딩 후 Indirect 드로우 기록 (recordCulling 이후, 렌더링 중)
+		 *
+		 * 호출 전에 정점 셰이더의 레코드 Set에 getDrawDescriptorSet()을 바인딩해야 함
+		 * Early는 Early 목록, 나머지는 최종 목록 (Frustum 또는 Late 결과)
+		 */
+		void recordDraws(Phase phase = Phase::Frustum);
+
+		/**
+		 * @brief 현재 프레임 슬롯의 Indirect 커맨드/드로우 수 버퍼 (RenderGraph 임포트용)
+		 *
+		 * Early는 Early 목록, 나머지는 최종 목록. 용량이 늘면 다시 만들어지므로 프레임마다 다시 얻어야 함
+		 */
+		RHIBufferHandle getCommandBuffer(Phase phase = Phase::Frustum) const;
+		RHIBufferHandle getCountBuffer(Phase phase = Phase::Frustum) const;
+
+		// 현재 프레임 슬롯의 meshlet 컬링 인덱스 버퍼 (이번 프레임에 클러스터 컬링을 안 하면 빈 핸들)
+		RHIBufferHandle getClusterIndexBuffer() const;
+
+		// Early가 읽고 Late가 쓰는 가시성 버퍼 (모든 슬롯이 공유, 레코드 용량이 늘면 다시 만들어짐)
+		RHIBufferHandle getVisibilityBuffer() const { return visibilityBuffer_; }
+
+		// 정점 셰이더가 레코드를 읽는 디스크립터 (Set 4, Binding 0)
+		RHIDescriptorSetLayoutHandle getDrawDescriptorLayout() const { return drawLayout_; }
+		RHIDescriptorSetHandle getDrawDescriptorSet() const;
+
+		uint32_t getRecordCount() const { return static_cast<uint32_t>(records_.size()); }
+		bool usesDrawCount() const { return compact_; }
+
+		/**
+		 * @brief 최종 목록의 보이는 드로우 수 (CPU 통계용)
+		 *
+		 * 프레임 슬롯마다 드로우 수를 Host visible 버퍼로 복사해 두고 그 슬롯의 다음 prepareFrame에서 읽으므로
+		 * 프레임 슬롯 수만큼 지난 프레임의 값. 아직 읽은 값이 없으면 hasVisibleCount() == false
+		 */
+		bool hasVisibleCount() const { return visibleCountValid_; }
+		uint32_t getVisibleCount() const { return visibleCount_; }
+
+	private:
+		struct NodeState
+		{
+			const RHIModel* model = nullptr;
+			uint32_t first = 0;  // 레코드 시작 인덱스
+			uint32_t count = 0;
+			glm::mat4 worldTransform = glm::mat4(0.0f);
+			bool visible = true;
+			uint32_t boneOffset = UINT32_MAX;
+			uint32_t skinnedVertexBase = UINT32_MAX;  // 첫 메시 기준 (메시 구간은 메시 순서대로 연속)
+		};
+
+		// 합친 지오메트리 안에서 메시 위치
+		struct MeshGeometry
+		{
+			uint32_t firstIndex = 0;
+			int32_t vertexOffset = 0;
+			uint32_t indexCount = 0;
+			uint32_t meshletOffset = 0;  // 합친 meshlet 버퍼 안에서 위치
+			uint32_t meshletCount = 0;
+		};
+
+		// 레코드별 meshlet 범위 + 출력 인덱스 구간 (std430, clusterCull.comp의 ClusterRecord)
+		struct ClusterRecord
+		{
+			uint32_t meshletOffset = 0;
+			uint32_t meshletCount = 0;
+			uint32_t outputOffset = 0;
+			uint32_t padding = 0;
+		};
+
+		struct ModelGeometry
+		{
+			const RHIModel* model = nullptr;
+			std::vector<MeshGeometry> meshes;
+		};
+
+		// 프레임 슬롯별 리소스 (슬롯의 이전 프레임이 끝난 뒤에만 갱신)
+		struct FrameResources
+		{
+			RHIBufferHandle recordBuffer;   // Host visible, 영구 매핑
+			GpuDrawRecord* mappedRecords = nullptr;
+			RHIBufferHandle commandBuffer;  // RHIDrawIndexedIndirectCommand[capacity]
+			RHIBufferHandle countBuffer;    // uint32 드로우 수
+			RHIBufferHandle statsBuffer;    // Host visible 드로우 수 복사본 (통계 읽기용)
+			const uint32_t* mappedStats = nullptr;
+			bool statsPending = false;      // 이 슬롯의 지난 프레임이 드로우 수를 복사함
+			uint32_t capacity = 0;
+
+			RHIDescriptorSetHandle cullSet;
+			RHIDescriptorSetHandle drawSet;
+
+			// 가림막 컬링 (Early 목록은 최종 목록과 별도 버퍼)
+			RHIBufferHandle earlyCommandBuffer;
+			RHIBufferHandle earlyCountBuffer;
+			RHIDescriptorSetHandle earlySet;
+			RHIDescriptorSetHandle lateSet;
+			uint64_t visibilityGeneration = 0;  // 이 슬롯의 셋에 바인딩된 가시성 버퍼
+			bool clearVisibility = false;       // 이번 프레임 Early 전에 가시성 버퍼를 0으로
+
+			std::vector<uint32_t> dirtyRecords;  // 이 슬롯에 아직 복사하지 않은 레코드
+			bool fullUpload = true;
+
+			// 클러스터 컬링 (prepareFrame에서 결정, 같은 프레임의 컬링/드로우가 같은 인덱스 버퍼를 사용)
+			RHIBufferHandle clusterIndexBuffer;
+			uint32_t clusterIndexCapacity = 0;
+			RHIDescriptorSetHandle clusterSet;
+			uint64_t clusterGeneration = 0;     // 이 슬롯의 셋에 바인딩된 클러스터 데이터
+			bool clusterReady = false;
+		};
+
+		// 드로우하던 프레임이 끝난 뒤 해제할 지오메트리
+		struct RetiredBuffer
+		{
+			RHIBufferHandle buffer;
+			RHIUploadTicket ticket;
+			uint64_t retireFrame = 0;
+		};
+
+		bool rebuildGeometry(const std::vector<const RHIModel*>& models);
+		const ModelGeometry* findGeometry(const RHIModel* model) const;
+		void writeNodeRecords(const NodeState& state, const RHISceneNode& node);
+		void markDirty(uint32_t first, uint32_t count);
+		uint32_t getMaterialIndex(const RHIModel* model, uint32_t localIndex) const;
+		bool ensureCapacity(FrameResources& frame, uint32_t recordCount);
+		void destroyFrameBuffers(FrameResources& frame);
+		bool ensureVisibility(FrameResources& frame, uint32_t recordCount);
+		void recordFrustumDispatch(const FrameResources& frame, const RHIViewFrustum& frustum,
+			uint32_t recordCount, bool cullingEnabled);
+		bool uploadMeshlets(const std::vector<const RHIModel*>& models);
+		void rebuildClusterRecords();
+		bool prepareClusters(FrameResources& frame);
+		void recordClusterDispatch(const FrameResources& frame, const RHIViewFrustum& frustum,
+			const glm::mat4& viewProjection, uint32_t recordCount, bool cullingEnabled);
+		void recordStatsCopy(FrameResources& frame);
+		void disableClusterCulling();
+		void disableOcclusion();
+		void retireGeometry();
+		void releaseRetired(bool force);
+		FrameResources& currentFrame();
+
+		RHI* rhi_;
+		uint32_t frameCount_;
+		bool compact_ = false;
+
+		// CPU 측 상태
+		std::vector<NodeState> nodeStates_;
+		std::vector<GpuDrawRecord> records_;
+		std::vector<uint8_t> dirtySlots_;  // 레코드별: 아직 반영 안 된 프레임 슬롯 비트
+		std::unordered_map<const RHIModel*, uint32_t> materialBases_;
+		bool materialBasesChanged_ = false;
+
+		// 합친 지오메트리
+		std::vector<ModelGeometry> geometry_;
+		RHIBufferHandle vertexBuffer_;
+		RHIBufferHandle indexBuffer_;
+		RHIUploadTicket geometryTicket_;
+
+		std::vector<FrameResources> frames_;
+		std::vector<RetiredBuffer> retired_;
+		uint64_t frameCounter_ = 0;
+		uint32_t visibleCount_ = 0;
+		bool visibleCountValid_ = false;
+
+		// 컴퓨트 파이프라인
+		RHIShaderHandle cullShader_;
+		RHIPipelineHandle cullPipeline_;
+		RHIDescriptorSetLayoutHandle cullLayout_;
+		RHIDescriptorSetLayoutHandle drawLayout_;
+		RHIDescriptorPoolHandle descriptorPool_;
+
+		// 가림막 컬링 파이프라인 + 레코드별 가시성 (모든 슬롯이 공유, 프레임 순서대로 읽고 씀)
+		const RHIHiZPyramid* hiZ_ = nullptr;
+		RHIShaderHandle occlusionShader_;
+		RHIPipelineHandle occlusionPipeline_;
+		RHIDescriptorSetLayoutHandle occlusionLayout_;
+		RHIDescriptorPoolHandle occlusionPool_;
+		RHIBufferHandle visibilityBuffer_;
+		uint32_t visibilityCapacity_ = 0;
+		uint64_t visibilityGeneration_ = 0;
+		bool visibilityReset_ = false;  // 레코드 구성이 바뀌어 지난 프레임 결과가 무효
+
+		// 클러스터 컬링 파이프라인 + 합친 meshlet 데이터 (지오메트리와 같이 다시 만들고 같이 해제)
+		RHIShaderHandle clusterShader_;
+		RHIPipelineHandle clusterPipeline_;
+		RHIDescriptorSetLayoutHandle clusterLayout_;
+		RHIDescriptorPoolHandle clusterPool_;
+		RHIBufferHandle meshletBuffer_;
+		RHIBufferHandle meshletVertexBuffer_;
+		RHIBufferHandle meshletTriangleBuffer_;
+		RHIDeviceSize meshletBytes_ = 0;
+		RHIDeviceSize meshletVertexBytes_ = 0;
+		RHIDeviceSize meshletTriangleBytes_ = 0;
+		std::vector<ClusterRecord> clusterRecords_;
+		RHIBufferHandle clusterRecordBuffer_;
+		RHIUploadTicket clusterRecordTicket_;
+		uint32_t clusterIndexCount_ = 0;   // 출력 인덱스 버퍼에 필요한 크기 (레코드 메시 인덱스 수 합)
+		uint64_t clusterGeneration_ = 0;
+	};
+
+} // namespace BinRenderer
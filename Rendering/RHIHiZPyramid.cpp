@@ -0,0 +1,329 @@
+﻿#include "RHIHiZPyramid.h"
+#include "../Core/Logger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kWorkgroupSize = 8;  // hiZBuild.comp local_size_x/y
+
+		/**
+		 * @brief Hi-Z 빌드 Push Constants (hiZBuild.comp와 같은 배치)
+		 */
+		struct HiZBuildPushConstants
+		{
+			int32_t srcWidth = 0;
+			int32_t srcHeight = 0;
+			int32_t dstWidth = 0;
+			int32_t dstHeight = 0;
+			uint32_t fromDepth = 0;  // 1이면 깊이 이미지에서 mip 0 생성
+			uint32_t padding[3] = {};
+		};
+
+		std::vector<uint32_t> readShaderFile(const std::string& filename)
+		{
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+			{
+				return {};
+			}
+
+			size_t fileSize = static_cast<size_t>(file.tellg());
+			if (fileSize == 0 || fileSize % 4 != 0)
+			{
+				return {};
+			}
+
+			file.seekg(0);
+			std::vector<uint32_t> buffer(fileSize / sizeof(uint32_t));
+			file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
+			return buffer;
+		}
+	}
+
+	RHIHiZPyramid::RHIHiZPyramid(RHI* rhi)
+		: rhi_(rhi)
+	{
+	}
+
+	RHIHiZPyramid::~RHIHiZPyramid()
+	{
+		shutdown();
+	}
+
+	bool RHIHiZPyramid::initialize(uint32_t width, uint32_t height)
+	{
+		width_ = std::max(width, 2u);
+		height_ = std::max(height, 2u);
+
+		// 밉 크기는 절반씩 내림 (1 미만으로는 내려가지 않음)
+		hiZWidth_ = std::max(width_ / 2, 1u);
+		hiZHeight_ = std::max(height_ / 2, 1u);
+		mipCount_ = 1;
+		while ((hiZWidth_ >> mipCount_) > 0 || (hiZHeight_ >> mipCount_) > 0)
+		{
+			++mipCount_;
+		}
+
+		if (!createBuildPipeline() || !createImages())
+		{
+			shutdown();
+			return false;
+		}
+
+		printLog("[HiZ] Initialized: depth {}x{}, Hi-Z {}x{} ({} mips)", width_, height_, hiZWidth_, hiZHeight_, mipCount_);
+		return true;
+	}
+
+	bool RHIHiZPyramid::createBuildPipeline()
+	{
+		auto code = readShaderFile("../../assets/shaders/hiZBuild.comp.spv");
+		if (code.empty())
+		{
+			printLog("[HiZ] hiZBuild.comp.spv not found, occlusion culling disabled");
+			return false;
+		}
+
+		// Binding 0: 깊이 (sampler2D), 1: 이전 밉 (r32f 읽기), 2: 현재 밉 (r32f 쓰기)
+		RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+		for (uint32_t binding = 0; binding < 3; ++binding)
+		{
+			RHIDescriptorSetLayoutBinding layoutBinding{};
+			layoutBinding.binding = binding;
+			layoutBinding.descriptorType = binding == 0 ? RHI_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : RHI_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			layoutBinding.descriptorCount = 1;
+			layoutBinding.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+			layoutInfo.bindings.push_back(layoutBinding);
+		}
+		buildLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+		if (!buildLayout_.isValid())
+		{
+			printLog("[HiZ] ❌ Failed to create descriptor set layout");
+			return false;
+		}
+
+		RHIShaderCreateInfo shaderInfo{};
+		shaderInfo.stage = RHI_SHADER_STAGE_COMPUTE_BIT;
+		shaderInfo.name = "hiZBuild.comp";
+		shaderInfo.entryPoint = "main";
+		shaderInfo.code = std::move(code);
+		buildShader_ = rhi_->createShader(shaderInfo);
+
+		RHIComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.computeShader = buildShader_;
+		pipelineInfo.descriptorSetLayouts.push_back(buildLayout_);
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(HiZBuildPushConstants);
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		buildPipeline_ = buildShader_.isValid() ? rhi_->createComputePipeline(pipelineInfo) : RHIPipelineHandle{};
+		if (!buildPipeline_.isValid())
+		{
+			printLog("[HiZ] ❌ Failed to create build pipeline");
+			return false;
+		}
+		return true;
+	}
+
+	bool RHIHiZPyramid::createImages()
+	{
+		RHIImageCreateInfo depthInfo{};
+		depthInfo.width = width_;
+		depthInfo.height = height_;
+		depthInfo.format = getDepthFormat();
+		depthInfo.usage = RHI_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RHI_IMAGE_USAGE_SAMPLED_BIT;
+		depthImage_ = rhi_->createImage(depthInfo);
+
+		RHIImageCreateInfo hiZInfo{};
+		hiZInfo.width = hiZWidth_;
+		hiZInfo.height = hiZHeight_;
+		hiZInfo.mipLevels = mipCount_;
+		hiZInfo.format = getHiZFormat();
+		hiZInfo.usage = RHI_IMAGE_USAGE_STORAGE_BIT | RHI_IMAGE_USAGE_SAMPLED_BIT;
+		hiZImage_ = rhi_->createImage(hiZInfo);
+
+		if (!depthImage_.isValid() || !hiZImage_.isValid())
+		{
+			printLog("[HiZ] ❌ Failed to create depth / Hi-Z images");
+			return false;
+		}
+
+		RHIImageViewCreateInfo depthViewInfo{};
+		depthViewInfo.format = getDepthFormat();
+		depthViewInfo.aspectMask = RHI_IMAGE_ASPECT_DEPTH_BIT;
+		depthView_ = rhi_->createImageView(depthImage_, depthViewInfo);
+
+		RHIImageViewCreateInfo hiZViewInfo{};
+		hiZViewInfo.format = getHiZFormat();
+		hiZView_ = rhi_->createImageView(hiZImage_, hiZViewInfo);
+
+		if (!depthView_.isValid() || !hiZView_.isValid())
+		{
+			printLog("[HiZ] ❌ Failed to create depth / Hi-Z views");
+			return false;
+		}
+
+		for (uint32_t mip = 0; mip < mipCount_; ++mip)
+		{
+			RHIImageViewCreateInfo mipViewInfo{};
+			mipViewInfo.format = getHiZFormat();
+			mipViewInfo.baseMipLevel = mip;
+			mipViewInfo.levelCount = 1;
+			mipViews_.push_back(rhi_->createImageView(hiZImage_, mipViewInfo));
+			if (!mipViews_.back().isValid())
+			{
+				printLog("[HiZ] ❌ Failed to create Hi-Z mip {} view", mip);
+				return false;
+			}
+		}
+
+		// 깊이/Hi-Z 모두 texelFetch로 읽으므로 필터링 없음
+		RHISamplerCreateInfo samplerInfo{};
+		samplerInfo.magFilter = RHI_FILTER_NEAREST;
+		samplerInfo.minFilter = RHI_FILTER_NEAREST;
+		samplerInfo.mipmapMode = RHI_SAMPLER_MIPMAP_MODE_NEAREST;
+		samplerInfo.addressModeU = RHI_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.addressModeV = RHI_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.addressModeW = RHI_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		samplerInfo.maxLod = static_cast<float>(mipCount_);
+		sampler_ = rhi_->createSampler(samplerInfo);
+
+		// 밉마다 디스크립터 셋 하나 (이미지가 바뀌지 않으므로 프레임 슬롯 공유)
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = mipCount_;
+		RHIDescriptorPoolSize samplerPoolSize{};
+		samplerPoolSize.type = RHI_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		samplerPoolSize.descriptorCount = mipCount_;
+		poolInfo.poolSizes.push_back(samplerPoolSize);
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+		storagePoolSize.descriptorCount = mipCount_ * 2;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		descriptorPool_ = rhi_->createDescriptorPool(poolInfo);
+
+		for (uint32_t mip = 0; mip < mipCount_; ++mip)
+		{
+			RHIDescriptorSetHandle set = rhi_->allocateDescriptorSet(descriptorPool_, buildLayout_);
+			if (!sampler_.isValid() || !set.isValid())
+			{
+				printLog("[HiZ] ❌ Failed to allocate build descriptor sets");
+				return false;
+			}
+
+			// mip 0은 깊이에서 만들므로 Binding 1은 쓰지 않지만 유효한 뷰가 필요
+			rhi_->updateDescriptorSet(set, 0, depthView_, sampler_);
+			rhi_->updateDescriptorSet(set, 1, mipViews_[mip == 0 ? 0 : mip - 1], RHISamplerHandle{});
+			rhi_->updateDescriptorSet(set, 2, mipViews_[mip], RHISamplerHandle{});
+			mipSets_.push_back(set);
+		}
+		return true;
+	}
+
+	void RHIHiZPyramid::shutdown()
+	{
+		if (buildPipeline_.isValid())
+		{
+			rhi_->destroyPipeline(buildPipeline_);
+			buildPipeline_ = {};
+		}
+		if (buildShader_.isValid())
+		{
+			rhi_->destroyShader(buildShader_);
+			buildShader_ = {};
+		}
+
+		// 디스크립터 셋은 풀과 함께 해제
+		mipSets_.clear();
+		if (descriptorPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(descriptorPool_);
+			descriptorPool_ = {};
+		}
+		if (buildLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(buildLayout_);
+			buildLayout_ = {};
+		}
+
+		if (sampler_.isValid())
+		{
+			rhi_->destroySampler(sampler_);
+			sampler_ = {};
+		}
+		for (RHIImageViewHandle view : mipViews_)
+		{
+			if (view.isValid())
+			{
+				rhi_->destroyImageView(view);
+			}
+		}
+		mipViews_.clear();
+		for (RHIImageViewHandle* view : { &hiZView_, &depthView_ })
+		{
+			if (view->isValid())
+			{
+				rhi_->destroyImageView(*view);
+				*view = {};
+			}
+		}
+		for (RHIImageHandle* image : { &hiZImage_, &depthImage_ })
+		{
+			if (image->isValid())
+			{
+				rhi_->destroyImage(*image);
+				*image = {};
+			}
+		}
+	}
+
+	void RHIHiZPyramid::recordBuild()
+	{
+		if (!isReady() || mipSets_.size() != mipCount_)
+		{
+			return;
+		}
+
+		rhi_->cmdBindPipeline(buildPipeline_);
+
+		for (uint32_t mip = 0; mip < mipCount_; ++mip)
+		{
+			HiZBuildPushConstants pushConstants{};
+			pushConstants.srcWidth = static_cast<int32_t>(mip == 0 ? width_ : std::max(hiZWidth_ >> (mip - 1), 1u));
+			pushConstants.srcHeight = static_cast<int32_t>(mip == 0 ? height_ : std::max(hiZHeight_ >> (mip - 1), 1u));
+			pushConstants.dstWidth = static_cast<int32_t>(std::max(hiZWidth_ >> mip, 1u));
+			pushConstants.dstHeight = static_cast<int32_t>(std::max(hiZHeight_ >> mip, 1u));
+			pushConstants.fromDepth = mip == 0 ? 1 : 0;
+
+			rhi_->cmdBindDescriptorSets(buildPipeline_, 0, &mipSets_[mip], 1);
+			rhi_->cmdPushConstants(buildPipeline_, RHI_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+			rhi_->cmdDispatch(
+				(pushConstants.dstWidth + kWorkgroupSize - 1) / kWorkgroupSize,
+				(pushConstants.dstHeight + kWorkgroupSize - 1) / kWorkgroupSize);
+
+			// 다음 밉이 방금 쓴 밉을 읽음 (레이아웃은 GENERAL 유지, 밉 전체 전환은 RenderGraph가 처리)
+			if (mip + 1 < mipCount_)
+			{
+				RHIBarrierBatch mipBarrier;
+				RHIImageBarrier& barrier = mipBarrier.imageBarriers.emplace_back();
+				barrier.image = hiZImage_;
+				barrier.srcStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+				barrier.srcAccessMask = RHI_ACCESS_SHADER_WRITE_BIT;
+				barrier.dstStageMask = RHI_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+				barrier.dstAccessMask = RHI_ACCESS_SHADER_READ_BIT;
+				barrier.oldLayout = RHI_IMAGE_LAYOUT_GENERAL;
+				barrier.newLayout = RHI_IMAGE_LAYOUT_GENERAL;
+				barrier.baseMipLevel = mip;
+				barrier.levelCount = 1;
+				rhi_->cmdPipelineBarrier(mipBarrier);
+			}
+		}
+	}
+
+} // namespace BinRenderer
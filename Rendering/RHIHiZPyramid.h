@@ -0,0 +1,80 @@
+﻿#pragma once
+
+#include "../RHI/Core/RHI.h"
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief 가림막 컬링용 깊이 이미지 + Hi-Z 밉 체인
+	 *
+	 * - 깊이 이미지: Depth 프리패스가 그리고 Hi-Z 빌드가 샘플링 (D32)
+	 * - Hi-Z 이미지: R32F, mip 0 = 깊이 해상도의 절반, 텍셀마다 덮는 깊이의 최댓값(가장 먼 값)
+	 * - 크기가 홀수면 마지막 텍셀이 남는 행/열까지 덮음 (RHIOcclusionBuffer와 같은 규칙)
+	 * - 밉마다 hiZBuild.comp 디스패치 한 번, 밉 사이는 컴퓨트 → 컴퓨트 배리어
+	 *
+	 * 창 크기 변경 시 재생성은 하지 않음 (RenderGraph 리소스 재생성과 함께 처리할 부분)
+	 */
+	class RHIHiZPyramid
+	{
+	public:
+		explicit RHIHiZPyramid(RHI* rhi);
+		~RHIHiZPyramid();
+
+		/**
+		 * @brief 이미지, 뷰, 빌드 파이프라인 생성
+		 * @return hiZBuild.comp.spv가 없거나 생성에 실패하면 false
+		 */
+		bool initialize(uint32_t width, uint32_t height);
+		void shutdown();
+
+		bool isReady() const { return buildPipeline_.isValid(); }
+
+		/**
+		 * @brief 깊이 → Hi-Z 빌드 기록 (렌더링 밖, 깊이는 ShaderRead / Hi-Z는 Storage 상태)
+		 */
+		void recordBuild();
+
+		// 깊이 이미지 (Depth 프리패스 attachment)
+		RHIImageHandle getDepthImage() const { return depthImage_; }
+		RHIImageViewHandle getDepthView() const { return depthView_; }
+		RHIFormat getDepthFormat() const { return RHI_FORMAT_D32_SFLOAT; }
+		uint32_t getWidth() const { return width_; }
+		uint32_t getHeight() const { return height_; }
+
+		// Hi-Z 이미지 (컬링 셰이더가 texelFetch로 읽음)
+		RHIImageHandle getHiZImage() const { return hiZImage_; }
+		RHIImageViewHandle getHiZView() const { return hiZView_; }
+		RHISamplerHandle getSampler() const { return sampler_; }
+		RHIFormat getHiZFormat() const { return RHI_FORMAT_R32_SFLOAT; }
+		uint32_t getHiZWidth() const { return hiZWidth_; }
+		uint32_t getHiZHeight() const { return hiZHeight_; }
+		uint32_t getMipCount() const { return mipCount_; }
+
+	private:
+		bool createImages();
+		bool createBuildPipeline();
+
+		RHI* rhi_;
+		uint32_t width_ = 0;
+		uint32_t height_ = 0;
+		uint32_t hiZWidth_ = 0;
+		uint32_t hiZHeight_ = 0;
+		uint32_t mipCount_ = 0;
+
+		RHIImageHandle depthImage_;
+		RHIImageViewHandle depthView_;
+		RHIImageHandle hiZImage_;
+		RHIImageViewHandle hiZView_;             // 전체 밉 (컬링 셰이더)
+		std::vector<RHIImageViewHandle> mipViews_; // 밉별 (빌드 셰이더 Storage)
+		RHISamplerHandle sampler_;
+
+		RHIShaderHandle buildShader_;
+		RHIPipelineHandle buildPipeline_;
+		RHIDescriptorSetLayoutHandle buildLayout_;
+		RHIDescriptorPoolHandle descriptorPool_;
+		std::vector<RHIDescriptorSetHandle> mipSets_;  // 밉별 빌드 디스크립터
+	};
+
+} // namespace BinRenderer
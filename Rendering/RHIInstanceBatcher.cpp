@@ -0,0 +1,236 @@
+﻿#include "RHIInstanceBatcher.h"
+#include "RHIBonePaletteArena.h"
+#include "RHIMesh.h"
+#include "RHIRenderQueue.h"
+#include "RHISkinningCache.h"
+#include "../Core/Logger.h"
+#include "../Core/RHIModel.h"
+#include "../Core/RHIScene.h"
+
+#include <algorithm>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kMinInstanceCapacity = 256;
+	}
+
+	RHIInstanceBatcher::RHIInstanceBatcher(RHI* rhi, uint32_t frameCount)
+		: rhi_(rhi)
+		, frameCount_(std::max(frameCount, 1u))
+	{
+	}
+
+	RHIInstanceBatcher::~RHIInstanceBatcher()
+	{
+		shutdown();
+	}
+
+	bool RHIInstanceBatcher::initialize()
+	{
+		// Set 4 (정점 셰이더): 인스턴스 행렬
+		RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+		RHIDescriptorSetLayoutBinding instanceBinding{};
+		instanceBinding.binding = 0;
+		instanceBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		instanceBinding.descriptorCount = 1;
+		instanceBinding.stageFlags = RHI_SHADER_STAGE_VERTEX_BIT;
+		layoutInfo.bindings.push_back(instanceBinding);
+		descriptorLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+		if (!descriptorLayout_.isValid())
+		{
+			printLog("[InstanceBatcher] ❌ Failed to create descriptor set layout");
+			return false;
+		}
+
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = frameCount_;
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		storagePoolSize.descriptorCount = frameCount_;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		descriptorPool_ = rhi_->createDescriptorPool(poolInfo);
+
+		frames_.resize(frameCount_);
+		for (auto& frame : frames_)
+		{
+			frame.descriptorSet = descriptorPool_.isValid()
+				? rhi_->allocateDescriptorSet(descriptorPool_, descriptorLayout_)
+				: RHIDescriptorSetHandle{};
+			if (!frame.descriptorSet.isValid())
+			{
+				printLog("[InstanceBatcher] ❌ Failed to allocate descriptor sets");
+				shutdown();
+				return false;
+			}
+		}
+
+		printLog("[InstanceBatcher] Initialized ({} frame slots)", frameCount_);
+		return true;
+	}
+
+	void RHIInstanceBatcher::shutdown()
+	{
+		for (auto& frame : frames_)
+		{
+			destroyFrameBuffer(frame);
+		}
+		frames_.clear();
+
+		batches_.clear();
+		openBatches_.clear();
+		instanceCount_ = 0;
+
+		// 디스크립터 셋은 풀과 함께 해제
+		if (descriptorPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(descriptorPool_);
+			descriptorPool_ = {};
+		}
+		if (descriptorLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(descriptorLayout_);
+			descriptorLayout_ = {};
+		}
+	}
+
+	bool RHIInstanceBatcher::build(const RHIScene& scene, const RHIRenderQueue& queue, const RHIBonePaletteArena* palettes,
+		const RHISkinningCache* skinning)
+	{
+		batches_.clear();
+		openBatches_.clear();
+		instanceCount_ = 0;
+
+		if (!isReady())
+		{
+			return false;
+		}
+
+		const auto& nodes = scene.getNodes();
+		const auto& items = queue.getItems();
+		itemBatches_.resize(items.size());
+
+		// 1) 큐 순서대로 묶음 배정
+		for (size_t i = 0; i < items.size(); ++i)
+		{
+			const auto& item = items[i];
+			const RHIModel* model = nodes[item.nodeIndex].model.get();
+			RHIMesh* mesh = model->getMeshes()[item.meshIndex].get();
+
+			uint32_t batchIndex = 0;
+			if (RHIRenderQueue::isTransparentKey(item.key))
+			{
+				// 바로 앞 항목과 같은 메시일 때만 이어 붙임
+				const bool extend = i > 0 && RHIRenderQueue::isTransparentKey(items[i - 1].key) &&
+					batches_[itemBatches_[i - 1]].mesh == mesh;
+				batchIndex = extend ? itemBatches_[i - 1] : static_cast<uint32_t>(batches_.size());
+			}
+			else
+			{
+				batchIndex = openBatches_.try_emplace(mesh, static_cast<uint32_t>(batches_.size())).first->second;
+			}
+
+			if (batchIndex == batches_.size())
+			{
+				batches_.push_back({ mesh, model, 0, 0 });
+			}
+			batches_[batchIndex].instanceCount++;
+			itemBatches_[i] = batchIndex;
+		}
+
+		// 2) 묶음 순서대로 인스턴스 구간 배정
+		batchCursors_.resize(batches_.size());
+		for (size_t b = 0; b < batches_.size(); ++b)
+		{
+			batches_[b].firstInstance = instanceCount_;
+			batchCursors_[b] = instanceCount_;
+			instanceCount_ += batches_[b].instanceCount;
+		}
+
+		if (instanceCount_ == 0)
+		{
+			return true;
+		}
+
+		FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		if (!allocateFrameBuffer(frame, instanceCount_))
+		{
+			batches_.clear();
+			instanceCount_ = 0;
+			return false;
+		}
+
+		// 3) 큐 순서대로 행렬 기록 (묶음 안에서도 큐 순서 = 앞→뒤 또는 뒤→앞 유지)
+		for (size_t i = 0; i < items.size(); ++i)
+		{
+			const uint32_t nodeIndex = items[i].nodeIndex;
+			const auto& node = nodes[nodeIndex];
+			RHIInstanceEntry& entry = frame.mappedInstances[batchCursors_[itemBatches_[i]]++];
+			entry.model = node.transform * node.model->getTransform();
+			entry.boneOffset = palettes ? palettes->getNodeOffset(nodeIndex) : RHIBonePaletteArena::kNoPalette;
+			entry.skinnedVertexBase = skinning ? skinning->getSkinnedVertexBase(nodeIndex, items[i].meshIndex) : RHISkinningCache::kNoCache;
+		}
+
+		return true;
+	}
+
+	RHIDescriptorSetHandle RHIInstanceBatcher::getDescriptorSet() const
+	{
+		return frames_.empty() ? RHIDescriptorSetHandle{} : frames_[rhi_->getCurrentFrameIndex() % frames_.size()].descriptorSet;
+	}
+
+	bool RHIInstanceBatcher::allocateFrameBuffer(FrameResources& frame, uint32_t instanceCount)
+	{
+		// 프레임 선형 풀은 이 슬롯이 다시 시작될 때 회수되므로 매 프레임 새로 할당 (bump 할당)
+		// 이 슬롯의 이전 프레임은 이미 끝났으므로 바로 다시 만들 수 있음
+		const uint32_t previousCapacity = frame.capacity;
+		destroyFrameBuffer(frame);
+
+		uint32_t capacity = std::max(previousCapacity, kMinInstanceCapacity);
+		while (capacity < instanceCount)
+		{
+			capacity *= 2;
+		}
+
+		RHIBufferCreateInfo bufferInfo{};
+		bufferInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(RHIInstanceEntry);
+		bufferInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+		bufferInfo.allocationFlags = RHI_ALLOCATION_FRAME_TRANSIENT_BIT;
+		frame.instanceBuffer = rhi_->createBuffer(bufferInfo);
+		if (!frame.instanceBuffer.isValid())
+		{
+			printLog("[InstanceBatcher] ❌ Failed to create instance buffer ({} instances)", capacity);
+			return false;
+		}
+
+		frame.mappedInstances = static_cast<RHIInstanceEntry*>(rhi_->mapBuffer(frame.instanceBuffer));
+		if (!frame.mappedInstances)
+		{
+			destroyFrameBuffer(frame);
+			return false;
+		}
+		frame.capacity = capacity;
+
+		rhi_->updateDescriptorSet(frame.descriptorSet, 0, frame.instanceBuffer, 0, bufferInfo.size);
+		return true;
+	}
+
+	void RHIInstanceBatcher::destroyFrameBuffer(FrameResources& frame)
+	{
+		if (frame.instanceBuffer.isValid())
+		{
+			if (frame.mappedInstances)
+			{
+				rhi_->unmapBuffer(frame.instanceBuffer);
+			}
+			rhi_->destroyBuffer(frame.instanceBuffer);
+		}
+
+		frame.instanceBuffer = {};
+		frame.mappedInstances = nullptr;
+		frame.capacity = 0;
+	}
+
+} // namespace BinRenderer
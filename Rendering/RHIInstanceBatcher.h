@@ -0,0 +1,108 @@
+﻿#pragma once
+
+#include "../RHI/Core/RHI.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace BinRenderer
+{
+	class RHIScene;
+	class RHIMesh;
+	class RHIModel;
+	class RHIRenderQueue;
+	class RHIBonePaletteArena;
+	class RHISkinningCache;
+
+	/**
+	 * @brief 인스턴스 버퍼 항목 하나 (std430, pbrForwardInstanced.vert의 InstanceData와 같은 배치)
+	 */
+	struct RHIInstanceEntry
+	{
+		glm::mat4 model = glm::mat4(1.0f);
+		uint32_t boneOffset = UINT32_MAX;         // 본 팔레트 시작 (UINT32_MAX면 스키닝 안 함)
+		uint32_t skinnedVertexBase = UINT32_MAX;  // 프리스키닝 캐시의 정점 시작 (UINT32_MAX면 캐시 안 씀)
+		uint32_t padding[2] = { 0, 0 };
+	};
+
+	static_assert(sizeof(RHIInstanceEntry) == 80, "RHIInstanceEntry must match the std430 InstanceData layout");
+
+	/**
+	 * @brief 인스턴스 드로우 하나 (같은 메시 instanceCount개, 행렬은 인스턴스 버퍼의 firstInstance부터)
+	 */
+	struct RHIInstanceBatch
+	{
+		RHIMesh* mesh = nullptr;
+		const RHIModel* model = nullptr;  // mesh를 소유한 모델 (머티리얼 인덱스 기준)
+		uint32_t firstInstance = 0;
+		uint32_t instanceCount = 0;
+	};
+
+	/**
+	 * @brief CPU 드로우 경로의 자동 인스턴싱
+	 *
+	 * - 정렬된 렌더 큐에서 같은 메시(= 같은 모델의 같은 메시, 머티리얼 포함)를 쓰는 노드를 한 묶음으로 모음
+	 * - 불투명은 묶음을 큐에서 처음 나온 자리에 두고 뒤에 나오는 같은 메시를 합침 (상태 정렬 유지, 묶음 안은 앞→뒤)
+	 * - 반투명은 블렌딩 순서를 지키도록 큐에서 연속된 같은 메시만 합침
+	 * - 인스턴스별 model 행렬은 프레임 슬롯별 Host visible SSBO에 기록 (정점 셰이더 Set 4, gl_InstanceIndex로 읽음)
+	 * - 스킨드 노드는 인스턴스마다 본 팔레트 오프셋을 함께 기록하므로 같은 메시의 스킨드 군중도 드로우 한 번
+	 *   (프리스키닝 중이면 캐시의 정점 위치도 기록해 정점 셰이더는 스키닝 없이 읽기만 함)
+	 */
+	class RHIInstanceBatcher
+	{
+	public:
+		RHIInstanceBatcher(RHI* rhi, uint32_t frameCount);
+		~RHIInstanceBatcher();
+
+		bool initialize();
+		void shutdown();
+
+		bool isReady() const { return descriptorLayout_.isValid(); }
+
+		/**
+		 * @brief 큐를 묶음으로 나누고 현재 프레임 슬롯의 인스턴스 버퍼에 행렬 기록
+		 *
+		 * RHI::beginFrame 이후(슬롯의 이전 프레임이 끝난 상태) 호출
+		 * @param palettes 노드별 본 팔레트 오프셋 (nullptr이면 스키닝 없이 바인드 포즈)
+		 * @param skinning 노드/메시별 프리스키닝 캐시 위치 (nullptr이면 정점 셰이더가 팔레트로 스키닝)
+		 * @return 인스턴스 버퍼를 만들지 못하면 false (호출자는 메시별 드로우)
+		 */
+		bool build(const RHIScene& scene, const RHIRenderQueue& queue, const RHIBonePaletteArena* palettes = nullptr,
+			const RHISkinningCache* skinning = nullptr);
+
+		const std::vector<RHIInstanceBatch>& getBatches() const { return batches_; }
+		uint32_t getInstanceCount() const { return instanceCount_; }
+
+		// 정점 셰이더가 인스턴스 행렬을 읽는 디스크립터 (Set 4, Binding 0)
+		RHIDescriptorSetLayoutHandle getDescriptorLayout() const { return descriptorLayout_; }
+		RHIDescriptorSetHandle getDescriptorSet() const;
+
+	private:
+		struct FrameResources
+		{
+			RHIBufferHandle instanceBuffer;  // RHIInstanceEntry[capacity], 프레임 선형 풀 (블록이 영구 매핑)
+			RHIInstanceEntry* mappedInstances = nullptr;
+			uint32_t capacity = 0;
+			RHIDescriptorSetHandle descriptorSet;
+		};
+
+		bool allocateFrameBuffer(FrameResources& frame, uint32_t instanceCount);
+		void destroyFrameBuffer(FrameResources& frame);
+
+		RHI* rhi_;
+		uint32_t frameCount_;
+
+		std::vector<FrameResources> frames_;
+		RHIDescriptorSetLayoutHandle descriptorLayout_;
+		RHIDescriptorPoolHandle descriptorPool_;
+
+		// 프레임마다 다시 만드는 묶음 (할당은 재사용)
+		std::vector<RHIInstanceBatch> batches_;
+		std::vector<uint32_t> itemBatches_;                      // 큐 항목별 묶음 인덱스
+		std::vector<uint32_t> batchCursors_;                     // 행렬 기록 위치
+		std::unordered_map<const RHIMesh*, uint32_t> openBatches_;  // 불투명 메시 → 묶음 인덱스
+		uint32_t instanceCount_ = 0;
+	};
+
+} // namespace BinRenderer
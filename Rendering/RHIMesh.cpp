@@ -1,5 +1,6 @@
 ﻿#include "RHIMesh.h"
 #include "../Core/Logger.h"
+#include <cstring>
 
 namespace BinRenderer
 {
@@ -16,11 +17,23 @@ namespace BinRenderer
 	void RHIMesh::setVertices(const std::vector<RHIVertex>& vertices)
 	{
 		vertices_ = vertices;
+		meshlets_.clear();
 	}
 
 	void RHIMesh::setIndices(const std::vector<uint32_t>& indices)
 	{
 		indices_ = indices;
+		meshlets_.clear();
+	}
+
+	bool RHIMesh::buildMeshlets()
+	{
+		if (!RHIMeshletBuilder::build(vertices_, indices_, meshlets_))
+		{
+			printLog("Cannot build meshlets for mesh: {} ({} indices)", name_, indices_.size());
+			return false;
+		}
+		return true;
 	}
 
 	bool RHIMesh::createBuffers()
@@ -32,38 +45,18 @@ namespace BinRenderer
 		}
 
 		// Vertex Buffer
-		RHIBufferCreateInfo vertexBufferInfo{};
-		vertexBufferInfo.size = vertices_.size() * sizeof(RHIVertex);
-		vertexBufferInfo.usage = RHI_BUFFER_USAGE_VERTEX_BUFFER_BIT;
-		vertexBufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-
-		vertexBuffer_ = rhi_->createBuffer(vertexBufferInfo);
-		if (vertexBuffer_.isValid())
-		{
-			void* data = rhi_->mapBuffer(vertexBuffer_);
-			memcpy(data, vertices_.data(), vertexBufferInfo.size);
-			rhi_->unmapBuffer(vertexBuffer_);
-		}
-		else
+		vertexBuffer_ = createGeometryBuffer(RHI_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+			vertices_.data(), vertices_.size() * sizeof(RHIVertex));
+		if (!vertexBuffer_.isValid())
 		{
 			printLog("Failed to create vertex buffer");
 			return false;
 		}
 
 		// Index Buffer
-		RHIBufferCreateInfo indexBufferInfo{};
-		indexBufferInfo.size = indices_.size() * sizeof(uint32_t);
-		indexBufferInfo.usage = RHI_BUFFER_USAGE_INDEX_BUFFER_BIT;
-		indexBufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-
-		indexBuffer_ = rhi_->createBuffer(indexBufferInfo);
-		if (indexBuffer_.isValid())
-		{
-			void* data = rhi_->mapBuffer(indexBuffer_);
-			memcpy(data, indices_.data(), indexBufferInfo.size);
-			rhi_->unmapBuffer(indexBuffer_);
-		}
-		else
+		indexBuffer_ = createGeometryBuffer(RHI_BUFFER_USAGE_INDEX_BUFFER_BIT,
+			indices_.data(), indices_.size() * sizeof(uint32_t));
+		if (!indexBuffer_.isValid())
 		{
 			printLog("Failed to create index buffer");
 			destroyBuffers();
@@ -73,19 +66,75 @@ namespace BinRenderer
 		return true;
 	}
 
-	void RHIMesh::destroyBuffers()
+	RHIBufferHandle RHIMesh::createGeometryBuffer(RHIBufferUsageFlags usage, const void* data, RHIDeviceSize size)
 	{
-		if (vertexBuffer_.isValid())
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+
+		RHIBufferCreateInfo bufferInfo{};
+		bufferInfo.size = size;
+
+		// 스테이징 업로드가 가능하면 순수 Device local 메모리 (업로드는 RHIModel 로딩 끝에 일괄 제출, 대기 없음)
+		if (uploadManager)
 		{
-			rhi_->destroyBuffer(vertexBuffer_);
-			vertexBuffer_ = {};
+			bufferInfo.usage = usage | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+			bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		}
+		else
+		{
+			bufferInfo.usage = usage;
+			bufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
 		}
 
-		if (indexBuffer_.isValid())
+		RHIBufferHandle buffer = rhi_->createBuffer(bufferInfo);
+		if (!buffer.isValid())
 		{
-			rhi_->destroyBuffer(indexBuffer_);
-			indexBuffer_ = {};
+			return {};
 		}
+
+		if (uploadManager)
+		{
+			RHIUploadTicket ticket = uploadManager->uploadBuffer(buffer, data, size);
+			if (!ticket.isValid())
+			{
+				rhi_->destroyBuffer(buffer);
+				return {};
+			}
+			uploadTicket_ = ticket;
+		}
+		else
+		{
+			void* mapped = rhi_->mapBuffer(buffer);
+			memcpy(mapped, data, static_cast<size_t>(size));
+			rhi_->unmapBuffer(buffer);
+		}
+
+		return buffer;
+	}
+
+	void RHIMesh::destroyBuffers()
+	{
+		// 업로드가 아직 끝나지 않았을 수 있으면 복사가 완료된 뒤에 해제
+		RHIUploadManager* uploadManager = uploadTicket_.isValid() ? rhi_->getUploadManager() : nullptr;
+
+		auto release = [&](RHIBufferHandle& buffer) {
+			if (!buffer.isValid())
+			{
+				return;
+			}
+			if (uploadManager)
+			{
+				uploadManager->deferDestroy(buffer, uploadTicket_);
+			}
+			else
+			{
+				rhi_->destroyBuffer(buffer);
+			}
+			buffer = {};
+		};
+
+		release(vertexBuffer_);
+		release(indexBuffer_);
+		uploadTicket_ = {};
 	}
 
 	void RHIMesh::bind(RHI* rhi)
@@ -97,11 +146,11 @@ namespace BinRenderer
 		}
 	}
 
-	void RHIMesh::draw(RHI* rhi, uint32_t instanceCount)
+	void RHIMesh::draw(RHI* rhi, uint32_t instanceCount, uint32_t firstInstance)
 	{
 		if (indexBuffer_.isValid() && !indices_.empty())
 		{
-			rhi->cmdDrawIndexed(static_cast<uint32_t>(indices_.size()), instanceCount, 0, 0, 0);
+			rhi->cmdDrawIndexed(static_cast<uint32_t>(indices_.size()), instanceCount, 0, 0, firstInstance);
 		}
 	}
 
@@ -1,7 +1,10 @@
 ﻿#pragma once
 
 #include "../RHI/Core/RHI.h"
+#include "../RHI/Resources/RHIUploadManager.h"
 #include "RHIVertex.h"
+#include "RHIViewFrustum.h"
+#include "RHIMeshlet.h"
 #include <vector>
 #include <string>
 
@@ -26,11 +29,21 @@ namespace BinRenderer
 
 		// 렌더링
 		void bind(RHI* rhi);
-		void draw(RHI* rhi, uint32_t instanceCount = 1);
+		void draw(RHI* rhi, uint32_t instanceCount = 1, uint32_t firstInstance = 0);
 
 		// 정보
 		uint32_t getVertexCount() const { return static_cast<uint32_t>(vertices_.size()); }
 		uint32_t getIndexCount() const { return static_cast<uint32_t>(indices_.size()); }
+		const std::vector<RHIVertex>& getVertices() const { return vertices_; }
+		const std::vector<uint32_t>& getIndices() const { return indices_; }
+
+		// 로컬 공간 AABB (로딩 시 계산)
+		void setBounds(const AABB& bounds) { bounds_ = bounds; }
+		const AABB& getBounds() const { return bounds_; }
+
+		// 클러스터 컬링용 meshlet (로딩 시 setVertices/setIndices 이후 생성)
+		bool buildMeshlets();
+		const RHIMeshletData& getMeshlets() const { return meshlets_; }
 
 		// Material index
 		uint32_t getMaterialIndex() const { return materialIndex_; }
@@ -41,6 +54,8 @@ namespace BinRenderer
 		void setName(const std::string& name) { name_ = name; }
 
 	private:
+		RHIBufferHandle createGeometryBuffer(RHIBufferUsageFlags usage, const void* data, RHIDeviceSize size);
+
 		RHI* rhi_;
 		
 		std::vector<RHIVertex> vertices_;
@@ -48,6 +63,10 @@ namespace BinRenderer
 
 		RHIBufferHandle vertexBuffer_;
 		RHIBufferHandle indexBuffer_;
+		RHIUploadTicket uploadTicket_;  // 마지막 지오메트리 업로드 (완료 전 해제는 지연)
+
+		AABB bounds_;
+		RHIMeshletData meshlets_;
 
 		uint32_t materialIndex_ = 0;
 		std::string name_;
@@ -0,0 +1,443 @@
+﻿#include "RHIMeshOptimizer.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		// Forsyth, "Linear-Speed Vertex Cache Optimisation" 기본 상수
+		constexpr uint32_t kForsythCacheSize = 32;
+		constexpr float kLastTriangleScore = 0.75f;
+		constexpr float kCacheDecayPower = 1.5f;
+		constexpr float kValenceBoostScale = 2.0f;
+		constexpr float kValenceBoostPower = 0.5f;
+		constexpr uint32_t kMaxValence = 64;  // 이보다 많이 남은 정점은 같은 점수
+
+		constexpr uint32_t kNoTriangle = UINT32_MAX;
+
+		struct ScoreTable
+		{
+			float cache[kForsythCacheSize];
+			float valence[kMaxValence + 1];
+
+			ScoreTable()
+			{
+				for (uint32_t i = 0; i < kForsythCacheSize; ++i)
+				{
+					// 방금 그린 삼각형의 정점 3개는 같은 점수 (바로 다음 삼각형이 쓰는 걸 너무 선호하지 않도록)
+					cache[i] = i < 3 ? kLastTriangleScore
+						: std::pow(1.0f - float(i - 3) / float(kForsythCacheSize - 3), kCacheDecayPower);
+				}
+				valence[0] = 0.0f;
+				for (uint32_t i = 1; i <= kMaxValence; ++i)
+				{
+					valence[i] = kValenceBoostScale * std::pow(float(i), -kValenceBoostPower);
+				}
+			}
+
+			float score(int32_t cachePosition, uint32_t remaining) const
+			{
+				if (remaining == 0)
+				{
+					return -1.0f;  // 더 쓰일 일이 없는 정점
+				}
+				const float cacheScore = cachePosition >= 0 ? cache[cachePosition] : 0.0f;
+				return cacheScore + valence[std::min(remaining, kMaxValence)];
+			}
+		};
+
+		/**
+		 * @brief 타임스탬프 기반 FIFO 캐시 (ts[v]가 최근 cacheSize번의 미스 안에 있으면 히트)
+		 */
+		struct FifoCache
+		{
+			std::vector<uint32_t> timestamps;
+			uint32_t cacheSize;
+			uint32_t timestamp;
+
+			FifoCache(uint32_t vertexCount, uint32_t size)
+				: timestamps(vertexCount, 0), cacheSize(size), timestamp(size + 1)
+			{
+			}
+
+			void reset() { timestamp += cacheSize + 1; }
+
+			uint32_t update(uint32_t a, uint32_t b, uint32_t c)
+			{
+				uint32_t misses = 0;
+				for (uint32_t v : { a, b, c })
+				{
+					if (timestamp - timestamps[v] > cacheSize)
+					{
+						timestamps[v] = timestamp++;
+						misses++;
+					}
+				}
+				return misses;
+			}
+		};
+
+		bool isTriangleList(const std::vector<uint32_t>& indices, uint32_t vertexCount)
+		{
+			if (indices.empty() || indices.size() % 3 != 0)
+			{
+				return false;
+			}
+			return std::all_of(indices.begin(), indices.end(), [vertexCount](uint32_t index) { return index < vertexCount; });
+		}
+	}
+
+	RHIMeshOptimizer::Result RHIMeshOptimizer::optimize(std::vector<RHIVertex>& vertices, std::vector<uint32_t>& indices,
+		bool remapVertices)
+	{
+		Result result{};
+		result.vertexCountBefore = static_cast<uint32_t>(vertices.size());
+		result.before = analyzeVertexCache(indices, result.vertexCountBefore);
+
+		if (!isTriangleList(indices, result.vertexCountBefore))
+		{
+			result.after = result.before;
+			result.vertexCountAfter = result.vertexCountBefore;
+			return result;
+		}
+
+		optimizeVertexCache(indices, result.vertexCountBefore);
+		optimizeOverdraw(indices, vertices);
+		if (remapVertices)
+		{
+			optimizeVertexFetch(vertices, indices);
+		}
+
+		result.vertexCountAfter = static_cast<uint32_t>(vertices.size());
+		result.after = analyzeVertexCache(indices, result.vertexCountAfter);
+		return result;
+	}
+
+	RHIVertexCacheStats RHIMeshOptimizer::analyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+		uint32_t cacheSize)
+	{
+		RHIVertexCacheStats stats{};
+		if (!isTriangleList(indices, vertexCount))
+		{
+			return stats;
+		}
+
+		FifoCache cache(vertexCount, cacheSize);
+		for (size_t i = 0; i < indices.size(); i += 3)
+		{
+			stats.vertexTransforms += cache.update(indices[i], indices[i + 1], indices[i + 2]);
+		}
+
+		// 한 번이라도 변환된 정점 = 참조된 정점
+		uint32_t referenced = 0;
+		for (uint32_t timestamp : cache.timestamps)
+		{
+			referenced += timestamp != 0 ? 1 : 0;
+		}
+
+		stats.acmr = float(stats.vertexTransforms) / float(indices.size() / 3);
+		stats.atvr = referenced > 0 ? float(stats.vertexTransforms) / float(referenced) : 0.0f;
+		return stats;
+	}
+
+	void RHIMeshOptimizer::optimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount)
+	{
+		if (!isTriangleList(indices, vertexCount))
+		{
+			return;
+		}
+
+		static const ScoreTable scores;
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+		// 정점 → 남은 삼각형 목록 (CSR, 그린 삼각형은 구간 끝으로 보내고 remaining을 줄임)
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (uint32_t index : indices)
+		{
+			adjacencyOffsets[index + 1]++;
+		}
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
+
+		std::vector<uint32_t> adjacency(indices.size());
+		std::vector<uint32_t> remaining(vertexCount, 0);
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = indices[t * 3 + k];
+				adjacency[adjacencyOffsets[v] + remaining[v]++] = t;
+			}
+		}
+
+		std::vector<int32_t> cachePosition(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			vertexScores[v] = scores.score(-1, remaining[v]);
+		}
+
+		auto triangleScore = [&](uint32_t t) {
+			return vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+		};
+
+		// 시작 삼각형: 점수가 가장 높은 삼각형 (정점 수가 적은 경계부터 시작하게 됨)
+		uint32_t best = 0;
+		float bestScore = -FLT_MAX;
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			const float score = triangleScore(t);
+			if (score > bestScore)
+			{
+				best = t;
+				bestScore = score;
+			}
+		}
+
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+		std::vector<bool> emitted(triangleCount, false);
+		uint32_t cache[kForsythCacheSize + 3];
+		uint32_t cacheCount = 0;
+		uint32_t deadEndCursor = 0;
+
+		for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+		{
+			// 캐시에 붙은 후보가 없으면 아직 안 그린 다음 삼각형
+			if (best == kNoTriangle)
+			{
+				while (emitted[deadEndCursor])
+				{
+					deadEndCursor++;
+				}
+				best = deadEndCursor;
+			}
+
+			const uint32_t a = indices[best * 3];
+			const uint32_t b = indices[best * 3 + 1];
+			const uint32_t c = indices[best * 3 + 2];
+			output.push_back(a);
+			output.push_back(b);
+			output.push_back(c);
+			emitted[best] = true;
+
+			for (uint32_t v : { a, b, c })
+			{
+				uint32_t* begin = adjacency.data() + adjacencyOffsets[v];
+				uint32_t* last = begin + remaining[v] - 1;
+				std::iter_swap(std::find(begin, last, best), last);
+				remaining[v]--;
+			}
+
+			// LRU: 방금 그린 정점이 앞으로, 나머지는 한 칸씩 밀림 (kForsythCacheSize 밖은 제거)
+			uint32_t newCache[kForsythCacheSize + 3] = { a, b, c };
+			uint32_t newCount = 3;
+			for (uint32_t i = 0; i < cacheCount; ++i)
+			{
+				const uint32_t v = cache[i];
+				if (v != a && v != b && v != c)
+				{
+					newCache[newCount++] = v;
+				}
+			}
+
+			for (uint32_t i = 0; i < newCount; ++i)
+			{
+				const uint32_t v = newCache[i];
+				cachePosition[v] = i < kForsythCacheSize ? static_cast<int32_t>(i) : -1;
+				vertexScores[v] = scores.score(cachePosition[v], remaining[v]);
+			}
+
+			cacheCount = std::min(newCount, kForsythCacheSize);
+			std::copy(newCache, newCache + cacheCount, cache);
+
+			// 다음 삼각형: 캐시 정점에 붙은 남은 삼각형 중 점수 최대
+			best = kNoTriangle;
+			bestScore = -FLT_MAX;
+			for (uint32_t i = 0; i < cacheCount; ++i)
+			{
+				const uint32_t v = cache[i];
+				for (uint32_t j = 0; j < remaining[v]; ++j)
+				{
+					const uint32_t t = adjacency[adjacencyOffsets[v] + j];
+					const float score = triangleScore(t);
+					if (score > bestScore)
+					{
+						best = t;
+						bestScore = score;
+					}
+				}
+			}
+		}
+
+		indices.swap(output);
+	}
+
+	void RHIMeshOptimizer::optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<RHIVertex>& vertices,
+		float threshold)
+	{
+		const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+		if (!isTriangleList(indices, vertexCount))
+		{
+			return;
+		}
+
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+		FifoCache cache(vertexCount, kAnalysisCacheSize);
+
+		// 1. Hard 경계: 캐시 정점을 하나도 못 쓰는 삼각형 (캐시 최적화가 새로 시작한 지점)
+		std::vector<uint32_t> hardBoundaries;
+		for (uint32_t t = 0; t < triangleCount; ++t)
+		{
+			const uint32_t misses = cache.update(indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]);
+			if (t == 0 || misses == 3)
+			{
+				hardBoundaries.push_back(t);
+			}
+		}
+		hardBoundaries.push_back(triangleCount);
+
+		// 2. Soft 경계: hard 클러스터 안에서 ACMR이 클러스터 전체의 threshold배 이하가 되면 끊음
+		//    (끊을 때마다 캐시를 비운 것으로 보고 계산하므로 재정렬해도 ACMR 손실이 threshold 안쪽)
+		std::vector<uint32_t> clusters;
+		for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h)
+		{
+			const uint32_t start = hardBoundaries[h];
+			const uint32_t end = hardBoundaries[h + 1];
+
+			cache.reset();
+			uint32_t clusterMisses = 0;
+			for (uint32_t t = start; t < end; ++t)
+			{
+				clusterMisses += cache.update(indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]);
+			}
+			const float clusterThreshold = threshold * float(clusterMisses) / float(end - start);
+
+			clusters.push_back(start);
+			cache.reset();
+			uint32_t runningMisses = 0;
+			uint32_t runningTriangles = 0;
+			for (uint32_t t = start; t < end; ++t)
+			{
+				runningMisses += cache.update(indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]);
+				runningTriangles++;
+				if (float(runningMisses) / float(runningTriangles) <= clusterThreshold)
+				{
+					clusters.push_back(t + 1);
+					cache.reset();
+					runningMisses = 0;
+					runningTriangles = 0;
+				}
+			}
+
+			if (clusters.back() == end)
+			{
+				clusters.pop_back();
+			}
+		}
+		clusters.push_back(triangleCount);
+
+		const uint32_t clusterCount = static_cast<uint32_t>(clusters.size() - 1);
+		if (clusterCount < 2)
+		{
+			return;
+		}
+
+		// 3. 클러스터 정렬: 메시 중심에서 바깥을 향하고 멀리 있는 클러스터부터
+		//    (볼록한 부분이 먼저 그려져 뒤쪽 클러스터가 Early-Z로 걸러짐)
+		std::vector<glm::vec3> positions(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			positions[v] = vertices[v].getPosition();
+		}
+
+		std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.0f));
+		std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.0f));
+		std::vector<float> clusterAreas(clusterCount, 0.0f);
+		glm::vec3 meshCentroid(0.0f);
+		float meshArea = 0.0f;
+
+		for (uint32_t k = 0; k < clusterCount; ++k)
+		{
+			for (uint32_t t = clusters[k]; t < clusters[k + 1]; ++t)
+			{
+				const glm::vec3& p0 = positions[indices[t * 3]];
+				const glm::vec3& p1 = positions[indices[t * 3 + 1]];
+				const glm::vec3& p2 = positions[indices[t * 3 + 2]];
+				const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);  // 길이 = 넓이 * 2
+				const float area = glm::length(normal);
+				const glm::vec3 centroid = (p0 + p1 + p2) / 3.0f;
+
+				clusterCentroids[k] += centroid * area;
+				clusterNormals[k] += normal;
+				clusterAreas[k] += area;
+			}
+
+			meshCentroid += clusterCentroids[k];
+			meshArea += clusterAreas[k];
+		}
+		meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : glm::vec3(0.0f);
+
+		std::vector<float> sortKeys(clusterCount, 0.0f);
+		for (uint32_t k = 0; k < clusterCount; ++k)
+		{
+			const float normalLength = glm::length(clusterNormals[k]);
+			if (clusterAreas[k] > 0.0f && normalLength > 0.0f)
+			{
+				const glm::vec3 centroid = clusterCentroids[k] / clusterAreas[k];
+				sortKeys[k] = glm::dot(centroid - meshCentroid, clusterNormals[k] / normalLength);
+			}
+		}
+
+		std::vector<uint32_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), 0u);
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+		std::vector<uint32_t> output;
+		output.reserve(indices.size());
+		for (uint32_t k : order)
+		{
+			output.insert(output.end(), indices.begin() + size_t(clusters[k]) * 3, indices.begin() + size_t(clusters[k + 1]) * 3);
+		}
+		indices.swap(output);
+	}
+
+	uint32_t RHIMeshOptimizer::optimizeVertexFetch(std::vector<RHIVertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+		if (!isTriangleList(indices, vertexCount))
+		{
+			return vertexCount;
+		}
+
+		// 인덱스에서 처음 등장하는 순서로 새 번호 (참조되지 않는 정점은 빠짐)
+		std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		uint32_t next = 0;
+		for (uint32_t& index : indices)
+		{
+			if (remap[index] == UINT32_MAX)
+			{
+				remap[index] = next++;
+			}
+			index = remap[index];
+		}
+
+		std::vector<RHIVertex> remapped(next);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			if (remap[v] != UINT32_MAX)
+			{
+				remapped[remap[v]] = vertices[v];
+			}
+		}
+		vertices.swap(remapped);
+		return next;
+	}
+
+} // namespace BinRenderer
@@ -0,0 +1,64 @@
+﻿#pragma once
+
+#include "RHIVertex.h"
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief Post-transform 정점 캐시 시뮬레이션 결과
+	 *
+	 * - ACMR: 삼각형당 정점 셰이더 실행 수 (0.5 ~ 3, 낮을수록 좋음)
+	 * - ATVR: 참조된 정점당 실행 수 (1이 최적)
+	 */
+	struct RHIVertexCacheStats
+	{
+		uint32_t vertexTransforms = 0;
+		float acmr = 0.0f;
+		float atvr = 0.0f;
+	};
+
+	/**
+	 * @brief 임포트 시 메시 인덱스/정점 순서 최적화
+	 *
+	 * 1. optimizeVertexCache: Forsyth 방식 삼각형 재정렬 (LRU 32 캐시 점수)
+	 * 2. optimizeOverdraw: 캐시 효율을 크게 잃지 않는 클러스터로 나눈 뒤 바깥을 향한 클러스터부터 그리도록 정렬
+	 * 3. optimizeVertexFetch: 정점을 인덱스에서 처음 쓰이는 순서로 재배치 (참조되지 않는 정점 제거)
+	 *
+	 * 모두 삼각형 리스트 기준, 인덱스 수가 3의 배수가 아니면 아무것도 하지 않음
+	 */
+	class RHIMeshOptimizer
+	{
+	public:
+		static constexpr uint32_t kAnalysisCacheSize = 16;  // FIFO, 보고용
+		static constexpr float kOverdrawThreshold = 1.05f;  // 클러스터 ACMR이 이 비율 이하로 나빠지는 것까지 허용
+
+		struct Result
+		{
+			RHIVertexCacheStats before;
+			RHIVertexCacheStats after;
+			uint32_t vertexCountBefore = 0;
+			uint32_t vertexCountAfter = 0;
+		};
+
+		/**
+		 * @brief 세 단계를 순서대로 적용
+		 * @param remapVertices false면 정점 순서 유지 (정점 인덱스를 외부에서 참조하는 메시, 예: 본 가중치)
+		 */
+		static Result optimize(std::vector<RHIVertex>& vertices, std::vector<uint32_t>& indices, bool remapVertices = true);
+
+		static RHIVertexCacheStats analyzeVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount,
+			uint32_t cacheSize = kAnalysisCacheSize);
+
+		static void optimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount);
+		static void optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<RHIVertex>& vertices,
+			float threshold = kOverdrawThreshold);
+
+		/**
+		 * @return 재배치 후 정점 수
+		 */
+		static uint32_t optimizeVertexFetch(std::vector<RHIVertex>& vertices, std::vector<uint32_t>& indices);
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,297 @@
+﻿#include "RHIMeshlet.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint8_t kNotInMeshlet = 0xFF;
+		constexpr uint32_t kNoTriangle = UINT32_MAX;
+	}
+
+	void RHIMeshletData::clear()
+	{
+		meshlets.clear();
+		vertices.clear();
+		triangles.clear();
+	}
+
+	bool RHIMeshletBuilder::build(const std::vector<RHIVertex>& vertices, const std::vector<uint32_t>& indices,
+		RHIMeshletData& out)
+	{
+		out.clear();
+
+		const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+		if (triangleCount == 0 || indices.size() % 3 != 0)
+		{
+			return false;
+		}
+
+		// 정점 → 삼각형 인접 목록 (CSR)
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (uint32_t index : indices)
+		{
+			if (index >= vertexCount)
+			{
+				return false;
+			}
+			adjacencyOffsets[index + 1]++;
+		}
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
+
+		std::vector<uint32_t> adjacency(indices.size());
+		{
+			std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (uint32_t t = 0; t < triangleCount; ++t)
+			{
+				for (uint32_t k = 0; k < 3; ++k)
+				{
+					adjacency[cursor[indices[t * 3 + k]]++] = t;
+				}
+			}
+		}
+
+		// 정점별 아직 meshlet에 들어가지 않은 삼각형 수 (점수 동률 시 정점을 마무리하는 삼각형 우선)
+		std::vector<uint32_t> liveTriangles(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			liveTriangles[v] = adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+		}
+
+		std::vector<glm::vec3> positions(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			positions[v] = vertices[v].getPosition();
+		}
+
+		std::vector<uint8_t> localIndex(vertexCount, kNotInMeshlet);
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> candidates;
+		std::vector<uint32_t> candidateMeshlet(triangleCount, kNoTriangle);  // 후보 목록에 넣은 meshlet 번호 (중복 방지)
+		uint32_t seed = kNoTriangle;  // 들어가지 못한 인접 삼각형 → 다음 meshlet의 시작
+		uint32_t scanCursor = 0;
+
+		out.meshlets.reserve(triangleCount / kMaxTriangles + 1);
+		out.vertices.reserve(indices.size() / 2);
+		out.triangles.reserve(indices.size() + indices.size() / 8);
+
+		RHIMeshlet meshlet{};
+
+		auto newVertexCount = [&](uint32_t t) {
+			uint32_t count = 0;
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				count += localIndex[indices[t * 3 + k]] == kNotInMeshlet ? 1 : 0;
+			}
+			return count;
+		};
+
+		auto finishMeshlet = [&]() {
+			if (meshlet.triangleCount == 0)
+			{
+				return;
+			}
+
+			computeBounds(positions, out, meshlet);
+			out.meshlets.push_back(meshlet);
+
+			for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+			{
+				localIndex[out.vertices[meshlet.vertexOffset + i]] = kNotInMeshlet;
+			}
+
+			// 다음 meshlet의 삼각형이 4바이트 경계에서 시작하도록 (GPU에서 uint 단위로 읽음)
+			out.triangles.resize((out.triangles.size() + 3) & ~size_t(3), 0);
+
+			meshlet = RHIMeshlet{};
+			meshlet.vertexOffset = static_cast<uint32_t>(out.vertices.size());
+			meshlet.triangleOffset = static_cast<uint32_t>(out.triangles.size());
+			candidates.clear();
+		};
+
+		auto appendTriangle = [&](uint32_t t) {
+			for (uint32_t k = 0; k < 3; ++k)
+			{
+				const uint32_t v = indices[t * 3 + k];
+				if (localIndex[v] == kNotInMeshlet)
+				{
+					localIndex[v] = static_cast<uint8_t>(meshlet.vertexCount++);
+					out.vertices.push_back(v);
+
+					// 새 정점에 붙은 삼각형이 다음 후보
+					for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a)
+					{
+						const uint32_t candidate = adjacency[a];
+						if (!emitted[candidate] && candidateMeshlet[candidate] != out.meshlets.size())
+						{
+							candidateMeshlet[candidate] = static_cast<uint32_t>(out.meshlets.size());
+							candidates.push_back(candidate);
+						}
+					}
+				}
+				out.triangles.push_back(localIndex[v]);
+				liveTriangles[v]--;
+			}
+			emitted[t] = true;
+			meshlet.triangleCount++;
+		};
+
+		uint32_t remaining = triangleCount;
+		while (remaining > 0)
+		{
+			// 후보 중 새 정점이 가장 적은 삼각형 (이미 넣은 삼각형은 목록에서 제거)
+			uint32_t best = kNoTriangle;
+			uint32_t bestNew = 4;
+			uint32_t bestLive = UINT32_MAX;
+			size_t live = 0;
+			for (size_t i = 0; i < candidates.size(); ++i)
+			{
+				const uint32_t t = candidates[i];
+				if (emitted[t])
+				{
+					continue;
+				}
+				candidates[live++] = t;
+
+				const uint32_t added = newVertexCount(t);
+				const uint32_t liveCount = liveTriangles[indices[t * 3]] + liveTriangles[indices[t * 3 + 1]] + liveTriangles[indices[t * 3 + 2]];
+				if (added < bestNew || (added == bestNew && liveCount < bestLive))
+				{
+					best = t;
+					bestNew = added;
+					bestLive = liveCount;
+				}
+			}
+			candidates.resize(live);
+
+			// 인접 후보가 없으면 이전 meshlet에서 넘어온 삼각형, 그것도 없으면 인덱스 순서상 다음 삼각형
+			if (best == kNoTriangle)
+			{
+				if (seed != kNoTriangle && !emitted[seed])
+				{
+					best = seed;
+				}
+				else
+				{
+					while (emitted[scanCursor])
+					{
+						scanCursor++;
+					}
+					best = scanCursor;
+				}
+				bestNew = newVertexCount(best);
+			}
+
+			if (meshlet.vertexCount + bestNew > kMaxVertices || meshlet.triangleCount >= kMaxTriangles)
+			{
+				seed = best;
+				finishMeshlet();
+				continue;
+			}
+
+			appendTriangle(best);
+			remaining--;
+		}
+		finishMeshlet();
+
+		return true;
+	}
+
+	void RHIMeshletBuilder::computeBounds(const std::vector<glm::vec3>& positions, const RHIMeshletData& data,
+		RHIMeshlet& meshlet)
+	{
+		const uint32_t* meshletVertices = data.vertices.data() + meshlet.vertexOffset;
+		const uint8_t* meshletTriangles = data.triangles.data() + meshlet.triangleOffset;
+
+		// 바운딩 스피어 (Ritter): 축별 극점 중 가장 먼 쌍에서 시작해 밖에 있는 정점마다 확장
+		glm::vec3 minPoint[3];
+		glm::vec3 maxPoint[3];
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			minPoint[axis] = maxPoint[axis] = positions[meshletVertices[0]];
+		}
+		for (uint32_t i = 1; i < meshlet.vertexCount; ++i)
+		{
+			const glm::vec3& p = positions[meshletVertices[i]];
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				if (p[axis] < minPoint[axis][axis]) minPoint[axis] = p;
+				if (p[axis] > maxPoint[axis][axis]) maxPoint[axis] = p;
+			}
+		}
+
+		int spanAxis = 0;
+		float spanLength2 = -1.0f;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const glm::vec3 d = maxPoint[axis] - minPoint[axis];
+			const float length2 = glm::dot(d, d);
+			if (length2 > spanLength2)
+			{
+				spanAxis = axis;
+				spanLength2 = length2;
+			}
+		}
+
+		glm::vec3 center = (minPoint[spanAxis] + maxPoint[spanAxis]) * 0.5f;
+		float radius = std::sqrt(spanLength2) * 0.5f;
+		for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+		{
+			const glm::vec3& p = positions[meshletVertices[i]];
+			const float distance = glm::length(p - center);
+			if (distance > radius)
+			{
+				const float newRadius = (radius + distance) * 0.5f;
+				center += (p - center) * ((newRadius - radius) / distance);
+				radius = newRadius;
+			}
+		}
+		meshlet.boundingSphere = glm::vec4(center, radius);
+
+		// 법선 cone: 축 = 삼각형 법선 평균, cutoff = sin(축과 가장 벌어진 법선 사이 각도)
+		glm::vec3 normals[RHIMeshletBuilder::kMaxTriangles];
+		uint32_t normalCount = 0;
+		glm::vec3 axis(0.0f);
+		for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+		{
+			const glm::vec3& p0 = positions[meshletVertices[meshletTriangles[t * 3 + 0]]];
+			const glm::vec3& p1 = positions[meshletVertices[meshletTriangles[t * 3 + 1]]];
+			const glm::vec3& p2 = positions[meshletVertices[meshletTriangles[t * 3 + 2]]];
+			const glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+			const float length = glm::length(n);
+			if (length > 0.0f)  // 퇴화 삼각형은 어느 쪽에서도 보이지 않으므로 제외
+			{
+				normals[normalCount] = n / length;
+				axis += normals[normalCount];
+				normalCount++;
+			}
+		}
+
+		const float axisLength = glm::length(axis);
+		if (normalCount == 0 || axisLength <= 0.0f)
+		{
+			return;  // coneAxisCutoff.w = 1 (컬링 안 함)
+		}
+		axis /= axisLength;
+
+		float minDot = 1.0f;
+		for (uint32_t i = 0; i < normalCount; ++i)
+		{
+			minDot = std::min(minDot, glm::dot(axis, normals[i]));
+		}
+
+		// 법선이 90도 가까이 퍼지면 뒷면 판정이 거의 불가능하므로 cone을 쓰지 않음
+		if (minDot <= 0.1f)
+		{
+			return;
+		}
+		meshlet.coneAxisCutoff = glm::vec4(axis, std::sqrt(1.0f - minDot * minDot));
+	}
+
+} // namespace BinRenderer
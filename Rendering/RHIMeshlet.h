@@ -0,0 +1,64 @@
+﻿#pragma once
+
+#include "RHIVertex.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief 메시 클러스터 (std430, clusterCull.comp와 같은 배치)
+	 *
+	 * 정점은 RHIMeshletData::vertices[vertexOffset...]의 메시 로컬 정점 인덱스,
+	 * 삼각형은 RHIMeshletData::triangles[triangleOffset...]의 meshlet 로컬 인덱스 (삼각형당 3바이트)
+	 */
+	struct RHIMeshlet
+	{
+		glm::vec4 boundingSphere = glm::vec4(0.0f);                     // xyz = 중심, w = 반지름 (메시 로컬 공간)
+		glm::vec4 coneAxisCutoff = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);   // xyz = 법선 cone 축, w = cutoff (1이면 back-face 컬링 안 함)
+		uint32_t vertexOffset = 0;
+		uint32_t triangleOffset = 0;  // 바이트, 4바이트 정렬
+		uint32_t vertexCount = 0;
+		uint32_t triangleCount = 0;
+	};
+
+	static_assert(sizeof(RHIMeshlet) == 48, "RHIMeshlet must match the std430 Meshlet layout");
+
+	/**
+	 * @brief 메시 하나의 meshlet 목록
+	 */
+	struct RHIMeshletData
+	{
+		std::vector<RHIMeshlet> meshlets;
+		std::vector<uint32_t> vertices;   // meshlet 로컬 → 메시 정점 인덱스
+		std::vector<uint8_t> triangles;   // meshlet 로컬 정점 인덱스, meshlet마다 4바이트로 패딩
+
+		bool empty() const { return meshlets.empty(); }
+		void clear();
+	};
+
+	/**
+	 * @brief 인덱스 버퍼를 meshlet으로 분할 (로딩 시 1회)
+	 *
+	 * - 이미 넣은 정점을 가장 많이 공유하는 인접 삼각형을 우선 추가 (새 정점 수가 같으면 남은 삼각형이 적은 정점 우선)
+	 * - 인접 삼각형이 없으면 인덱스 순서상 다음 삼각형으로 이어감
+	 * - meshlet마다 바운딩 스피어와 법선 cone을 계산 (cone 컬링 식은 clusterCull.comp 참고)
+	 */
+	class RHIMeshletBuilder
+	{
+	public:
+		static constexpr uint32_t kMaxVertices = 64;
+		static constexpr uint32_t kMaxTriangles = 124;
+
+		/**
+		 * @return 삼각형 리스트가 아니거나(인덱스 수가 3의 배수가 아님) 범위를 벗어난 인덱스가 있으면 false
+		 */
+		static bool build(const std::vector<RHIVertex>& vertices, const std::vector<uint32_t>& indices,
+			RHIMeshletData& out);
+
+	private:
+		static void computeBounds(const std::vector<glm::vec3>& positions, const RHIMeshletData& data, RHIMeshlet& meshlet);
+	};
+
+} // namespace BinRenderer
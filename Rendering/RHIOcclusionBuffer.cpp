@@ -0,0 +1,281 @@
+﻿#include "RHIOcclusionBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		// clip.w가 이보다 작으면 카메라 평면에 걸친 것으로 취급
+		constexpr float kMinClipW = 1e-5f;
+
+		// 두 점 a→b 기준 p의 방향 (반시계면 양수)
+		float edgeFunction(const glm::vec3& a, const glm::vec3& b, float px, float py)
+		{
+			return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+		}
+	}
+
+	RHIOcclusionBuffer::RHIOcclusionBuffer(uint32_t width, uint32_t height)
+	{
+		resize(width, height);
+	}
+
+	void RHIOcclusionBuffer::resize(uint32_t width, uint32_t height)
+	{
+		width_ = std::max(width, 1u);
+		height_ = std::max(height, 1u);
+
+		// 밉 크기는 절반씩 내림, 홀수면 마지막 텍셀이 남는 행/열까지 덮음
+		levels_.clear();
+		uint32_t levelWidth = width_;
+		uint32_t levelHeight = height_;
+		while (true)
+		{
+			Level level;
+			level.width = levelWidth;
+			level.height = levelHeight;
+			level.depth.assign(static_cast<size_t>(levelWidth) * levelHeight, 1.0f);
+			levels_.push_back(std::move(level));
+
+			if (levelWidth == 1 && levelHeight == 1)
+			{
+				break;
+			}
+			levelWidth = std::max(levelWidth / 2, 1u);
+			levelHeight = std::max(levelHeight / 2, 1u);
+		}
+	}
+
+	void RHIOcclusionBuffer::clear(const glm::mat4& viewProjection)
+	{
+		viewProjection_ = viewProjection;
+		std::fill(levels_[0].depth.begin(), levels_[0].depth.end(), 1.0f);
+	}
+
+	uint32_t RHIOcclusionBuffer::rasterize(const glm::mat4& model, const glm::vec3* positions, uint32_t vertexCount,
+		const uint32_t* indices, uint32_t indexCount)
+	{
+		const glm::mat4 modelViewProjection = viewProjection_ * model;
+		const float halfWidth = 0.5f * static_cast<float>(width_);
+		const float halfHeight = 0.5f * static_cast<float>(height_);
+		const float invalid = std::numeric_limits<float>::quiet_NaN();
+
+		// 정점을 화면 좌표로 한 번만 변환 (near 평면 앞의 정점은 NaN으로 표시)
+		transformed_.resize(vertexCount);
+		for (uint32_t i = 0; i < vertexCount; ++i)
+		{
+			const glm::vec4 clip = modelViewProjection * glm::vec4(positions[i], 1.0f);
+			if (clip.w < kMinClipW || clip.z < 0.0f)
+			{
+				transformed_[i] = glm::vec3(invalid, 0.0f, 0.0f);
+				continue;
+			}
+
+			const float invW = 1.0f / clip.w;
+			transformed_[i] = glm::vec3(
+				(clip.x * invW + 1.0f) * halfWidth,
+				(clip.y * invW + 1.0f) * halfHeight,
+				clip.z * invW);
+		}
+
+		uint32_t triangleCount = 0;
+		for (uint32_t i = 0; i + 2 < indexCount; i += 3)
+		{
+			const uint32_t i0 = indices[i];
+			const uint32_t i1 = indices[i + 1];
+			const uint32_t i2 = indices[i + 2];
+			if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+			{
+				continue;
+			}
+
+			const glm::vec3& v0 = transformed_[i0];
+			const glm::vec3& v1 = transformed_[i1];
+			const glm::vec3& v2 = transformed_[i2];
+			if (std::isnan(v0.x) || std::isnan(v1.x) || std::isnan(v2.x))
+			{
+				continue;
+			}
+
+			rasterizeTriangle(v0, v1, v2);
+			++triangleCount;
+		}
+		return triangleCount;
+	}
+
+	void RHIOcclusionBuffer::rasterizeTriangle(const glm::vec3& v0, const glm::vec3& inV1, const glm::vec3& inV2)
+	{
+		// 앞/뒷면 모두 가림막으로 사용 (반시계로 정렬)
+		const float area = edgeFunction(v0, inV1, inV2.x, inV2.y);
+		if (std::fabs(area) < 1e-8f)
+		{
+			return;
+		}
+		const glm::vec3& v1 = area > 0.0f ? inV1 : inV2;
+		const glm::vec3& v2 = area > 0.0f ? inV2 : inV1;
+
+		const float depth = std::max({ v0.z, v1.z, v2.z });
+		if (depth >= 1.0f)
+		{
+			return;
+		}
+
+		// 픽셀 중심(x + 0.5)이 삼각형 경계 상자 안에 드는 범위
+		const float minX = std::min({ v0.x, v1.x, v2.x });
+		const float maxX = std::max({ v0.x, v1.x, v2.x });
+		const float minY = std::min({ v0.y, v1.y, v2.y });
+		const float maxY = std::max({ v0.y, v1.y, v2.y });
+		if (maxX < 0.5f || maxY < 0.5f || minX > width_ - 0.5f || minY > height_ - 0.5f)
+		{
+			return;
+		}
+
+		const int x0 = std::max(static_cast<int>(std::ceil(minX - 0.5f)), 0);
+		const int x1 = std::min(static_cast<int>(std::floor(maxX - 0.5f)), static_cast<int>(width_) - 1);
+		const int y0 = std::max(static_cast<int>(std::ceil(minY - 0.5f)), 0);
+		const int y1 = std::min(static_cast<int>(std::floor(maxY - 0.5f)), static_cast<int>(height_) - 1);
+		if (x0 > x1 || y0 > y1)
+		{
+			return;
+		}
+
+		// 엣지 함수는 x로 한 칸 갈 때 -(b.y - a.y)씩 변함
+		const float stepX0 = -(v2.y - v1.y);
+		const float stepX1 = -(v0.y - v2.y);
+		const float stepX2 = -(v1.y - v0.y);
+
+		std::vector<float>& target = levels_[0].depth;
+		for (int y = y0; y <= y1; ++y)
+		{
+			const float py = static_cast<float>(y) + 0.5f;
+			const float px = static_cast<float>(x0) + 0.5f;
+			float w0 = edgeFunction(v1, v2, px, py);
+			float w1 = edgeFunction(v2, v0, px, py);
+			float w2 = edgeFunction(v0, v1, px, py);
+
+			float* row = &target[static_cast<size_t>(y) * width_];
+			for (int x = x0; x <= x1; ++x)
+			{
+				if (w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f)
+				{
+					row[x] = std::min(row[x], depth);
+				}
+				w0 += stepX0;
+				w1 += stepX1;
+				w2 += stepX2;
+			}
+		}
+	}
+
+	void RHIOcclusionBuffer::buildHierarchy()
+	{
+		for (size_t l = 1; l < levels_.size(); ++l)
+		{
+			const Level& src = levels_[l - 1];
+			Level& dst = levels_[l];
+
+			for (uint32_t y = 0; y < dst.height; ++y)
+			{
+				const uint32_t sy0 = std::min(y * 2, src.height - 1);
+				const uint32_t sy1 = (y == dst.height - 1) ? src.height - 1 : std::min(y * 2 + 1, src.height - 1);
+
+				for (uint32_t x = 0; x < dst.width; ++x)
+				{
+					const uint32_t sx0 = std::min(x * 2, src.width - 1);
+					const uint32_t sx1 = (x == dst.width - 1) ? src.width - 1 : std::min(x * 2 + 1, src.width - 1);
+
+					float maxDepth = 0.0f;
+					for (uint32_t sy = sy0; sy <= sy1; ++sy)
+					{
+						for (uint32_t sx = sx0; sx <= sx1; ++sx)
+						{
+							maxDepth = std::max(maxDepth, src.depth[static_cast<size_t>(sy) * src.width + sx]);
+						}
+					}
+					dst.depth[static_cast<size_t>(y) * dst.width + x] = maxDepth;
+				}
+			}
+		}
+	}
+
+	bool RHIOcclusionBuffer::isVisible(const glm::vec3& center, const glm::vec3& extent) const
+	{
+		// 모서리 8개를 투영해 화면 사각형과 가장 가까운 깊이 계산
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+		float minZ = std::numeric_limits<float>::max();
+
+		for (uint32_t corner = 0; corner < 8; ++corner)
+		{
+			const glm::vec3 offset(
+				(corner & 1) ? extent.x : -extent.x,
+				(corner & 2) ? extent.y : -extent.y,
+				(corner & 4) ? extent.z : -extent.z);
+			const glm::vec4 clip = viewProjection_ * glm::vec4(center + offset, 1.0f);
+			if (clip.w < kMinClipW || clip.z < 0.0f)
+			{
+				return true;  // near 평면에 걸침
+			}
+
+			const float invW = 1.0f / clip.w;
+			minX = std::min(minX, clip.x * invW);
+			maxX = std::max(maxX, clip.x * invW);
+			minY = std::min(minY, clip.y * invW);
+			maxY = std::max(maxY, clip.y * invW);
+			minZ = std::min(minZ, clip.z * invW);
+		}
+
+		// 화면 밖 판정은 절두체 컬링에 맡김
+		if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f)
+		{
+			return true;
+		}
+
+		auto toPixel = [](float ndc, uint32_t size)
+		{
+			const float pixel = (std::clamp(ndc, -1.0f, 1.0f) * 0.5f + 0.5f) * static_cast<float>(size);
+			return std::min(static_cast<uint32_t>(pixel), size - 1);
+		};
+		const uint32_t px0 = toPixel(minX, width_);
+		const uint32_t px1 = toPixel(maxX, width_);
+		const uint32_t py0 = toPixel(minY, height_);
+		const uint32_t py1 = toPixel(maxY, height_);
+
+		// 사각형이 2x2 텍셀 안에 들어오는 밉 선택
+		uint32_t level = 0;
+		while (level + 1 < levels_.size() &&
+			((px1 >> level) - (px0 >> level) > 1 || (py1 >> level) - (py0 >> level) > 1))
+		{
+			++level;
+		}
+
+		const Level& hiZ = levels_[level];
+		const uint32_t tx0 = std::min(px0 >> level, hiZ.width - 1);
+		const uint32_t tx1 = std::min(px1 >> level, hiZ.width - 1);
+		const uint32_t ty0 = std::min(py0 >> level, hiZ.height - 1);
+		const uint32_t ty1 = std::min(py1 >> level, hiZ.height - 1);
+
+		float maxDepth = 0.0f;
+		for (uint32_t y = ty0; y <= ty1; ++y)
+		{
+			for (uint32_t x = tx0; x <= tx1; ++x)
+			{
+				maxDepth = std::max(maxDepth, hiZ.depth[static_cast<size_t>(y) * hiZ.width + x]);
+			}
+		}
+
+		return minZ <= maxDepth;
+	}
+
+	float RHIOcclusionBuffer::getDepth(uint32_t level, uint32_t x, uint32_t y) const
+	{
+		const Level& hiZ = levels_[std::min<size_t>(level, levels_.size() - 1)];
+		return hiZ.depth[static_cast<size_t>(std::min(y, hiZ.height - 1)) * hiZ.width + std::min(x, hiZ.width - 1)];
+	}
+
+} // namespace BinRenderer
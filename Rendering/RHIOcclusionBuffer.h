@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief CPU 소프트웨어 가림막 깊이 버퍼 + Hi-Z
+	 *
+	 * - 저해상도 깊이 버퍼에 가림막 삼각형을 래스터화 (픽셀 중심 커버리지)
+	 * - 삼각형 깊이는 세 정점 중 가장 먼 값으로 기록해 가림막을 실제보다 가깝게 보지 않음
+	 * - near 평면을 넘는 삼각형은 가림막에서 제외, 그런 AABB는 항상 보이는 것으로 판정
+	 * - buildHierarchy()로 max 밉을 만들고, AABB 화면 사각형이 2x2 텍셀 안에 드는 밉에서 테스트
+	 * - 깊이는 [0, 1] (GLM_FORCE_DEPTH_ZERO_TO_ONE, 가까울수록 작음)
+	 *
+	 * 텍셀보다 작은 틈으로만 보이는 물체는 가려진 것으로 판정될 수 있음
+	 */
+	class RHIOcclusionBuffer
+	{
+	public:
+		RHIOcclusionBuffer(uint32_t width = 256, uint32_t height = 128);
+
+		void resize(uint32_t width, uint32_t height);
+
+		/**
+		 * @brief 깊이를 원거리(1.0)로 지우고 이번 프레임 viewProjection 설정
+		 */
+		void clear(const glm::mat4& viewProjection);
+
+		/**
+		 * @brief 가림막 삼각형 래스터화
+		 * @param model 로컬 → 월드 행렬
+		 * @return 래스터화한 삼각형 수 (near 평면을 넘는 삼각형 제외)
+		 */
+		uint32_t rasterize(const glm::mat4& model, const glm::vec3* positions, uint32_t vertexCount,
+			const uint32_t* indices, uint32_t indexCount);
+
+		// 래스터화 후 테스트 전에 호출
+		void buildHierarchy();
+
+		/**
+		 * @brief World AABB 가시성 테스트 (buildHierarchy() 이후, 여러 스레드에서 동시 호출 가능)
+		 * @return 가려졌으면 false
+		 */
+		bool isVisible(const glm::vec3& center, const glm::vec3& extent) const;
+
+		uint32_t getWidth() const { return width_; }
+		uint32_t getHeight() const { return height_; }
+		uint32_t getLevelCount() const { return static_cast<uint32_t>(levels_.size()); }
+		float getDepth(uint32_t level, uint32_t x, uint32_t y) const;
+
+	private:
+		struct Level
+		{
+			uint32_t width = 0;
+			uint32_t height = 0;
+			std::vector<float> depth;
+		};
+
+		void rasterizeTriangle(const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2);
+
+		uint32_t width_ = 0;
+		uint32_t height_ = 0;
+		glm::mat4 viewProjection_ = glm::mat4(1.0f);
+		std::vector<Level> levels_;              // [0] = 래스터화 대상
+		std::vector<glm::vec3> transformed_;     // 화면 좌표 (x, y 픽셀, z 깊이), w <= 0이면 x에 NaN
+	};
+
+} // namespace BinRenderer
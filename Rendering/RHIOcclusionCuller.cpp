@@ -0,0 +1,154 @@
+﻿#include "RHIOcclusionCuller.h"
+#include "RHIFrustumCuller.h"
+#include "RHIMesh.h"
+#include "../Core/RHIScene.h"
+#include "../Core/RHIModel.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		// 화면의 이 비율 이상을 덮는 메시만 가림막 후보
+		constexpr float kMinOccluderScreenArea = 0.02f;
+
+		// 이 프레임 수 동안 가림막으로 쓰이지 않은 메시의 정점 캐시는 해제
+		constexpr uint64_t kPositionCacheFrames = 120;
+
+		/**
+		 * @brief World AABB의 화면 점유 비율 (카메라 평면에 걸치면 화면 전체)
+		 */
+		float computeScreenArea(const glm::mat4& viewProjection, const AABB& bounds)
+		{
+			float minX = std::numeric_limits<float>::max();
+			float minY = std::numeric_limits<float>::max();
+			float maxX = std::numeric_limits<float>::lowest();
+			float maxY = std::numeric_limits<float>::lowest();
+
+			for (uint32_t corner = 0; corner < 8; ++corner)
+			{
+				const glm::vec3 point(
+					(corner & 1) ? bounds.max.x : bounds.min.x,
+					(corner & 2) ? bounds.max.y : bounds.min.y,
+					(corner & 4) ? bounds.max.z : bounds.min.z);
+				const glm::vec4 clip = viewProjection * glm::vec4(point, 1.0f);
+				if (clip.w <= 0.0f)
+				{
+					return 1.0f;
+				}
+
+				minX = std::min(minX, clip.x / clip.w);
+				maxX = std::max(maxX, clip.x / clip.w);
+				minY = std::min(minY, clip.y / clip.w);
+				maxY = std::max(maxY, clip.y / clip.w);
+			}
+
+			const float width = std::clamp(maxX, -1.0f, 1.0f) - std::clamp(minX, -1.0f, 1.0f);
+			const float height = std::clamp(maxY, -1.0f, 1.0f) - std::clamp(minY, -1.0f, 1.0f);
+			return width * height * 0.25f;
+		}
+	}
+
+	uint32_t RHIOcclusionCuller::cull(const std::vector<RHISceneNode>& nodes, const glm::mat4& viewProjection, RHIFrustumCuller& frustumCuller)
+	{
+		++frameCounter_;
+
+		// 1. 보이는 정적 메시 중 화면을 크게 덮는 것만 후보로
+		candidates_.clear();
+		for (size_t n = 0; n < nodes.size(); ++n)
+		{
+			const RHISceneNode& node = nodes[n];
+			if (!node.model || !node.visible || node.model->hasAnimation())
+			{
+				continue;
+			}
+
+			const auto& meshes = node.model->getMeshes();
+			for (size_t m = 0; m < meshes.size() && m < node.meshWorldBounds.size(); ++m)
+			{
+				if (meshes[m]->getIndexCount() == 0 || !frustumCuller.isMeshVisible(n, m))
+				{
+					continue;
+				}
+
+				const float screenArea = computeScreenArea(viewProjection, node.meshWorldBounds[m]);
+				if (screenArea >= kMinOccluderScreenArea)
+				{
+					candidates_.push_back({ meshes[m].get(), &node.boundsTransform, screenArea });
+				}
+			}
+		}
+
+		// 2. 큰 것부터 삼각형 예산 안에서 래스터화
+		std::sort(candidates_.begin(), candidates_.end(),
+			[](const Candidate& a, const Candidate& b) { return a.screenArea > b.screenArea; });
+
+		buffer_.clear(viewProjection);
+		occluderCount_ = 0;
+		occluderTriangleCount_ = 0;
+
+		for (const Candidate& candidate : candidates_)
+		{
+			const uint32_t triangleCount = candidate.mesh->getIndexCount() / 3;
+			if (occluderTriangleCount_ + triangleCount > triangleBudget_)
+			{
+				continue;  // 더 작은 메시는 예산에 들어갈 수 있음
+			}
+
+			const std::vector<glm::vec3>& positions = getPositions(candidate.mesh);
+			const std::vector<uint32_t>& indices = candidate.mesh->getIndices();
+			buffer_.rasterize(*candidate.world, positions.data(), static_cast<uint32_t>(positions.size()),
+				indices.data(), static_cast<uint32_t>(indices.size()));
+
+			occluderTriangleCount_ += triangleCount;
+			++occluderCount_;
+		}
+
+		evictUnused();
+
+		if (occluderCount_ == 0)
+		{
+			return 0;
+		}
+
+		// 3. Hi-Z를 만들고 절두체 테스트를 통과한 메시를 다시 테스트
+		buffer_.buildHierarchy();
+		return frustumCuller.cullOccluded(buffer_);
+	}
+
+	const std::vector<glm::vec3>& RHIOcclusionCuller::getPositions(const RHIMesh* mesh)
+	{
+		CachedPositions& cached = positionCache_[mesh];
+		cached.lastUsedFrame = frameCounter_;
+
+		// 같은 주소에 다른 메시가 생겼을 수 있으므로 정점 수로 한 번 더 확인
+		const std::vector<RHIVertex>& vertices = mesh->getVertices();
+		if (cached.positions.size() != vertices.size())
+		{
+			cached.positions.resize(vertices.size());
+			for (size_t i = 0; i < vertices.size(); ++i)
+			{
+				cached.positions[i] = vertices[i].getPosition();
+			}
+		}
+		return cached.positions;
+	}
+
+	void RHIOcclusionCuller::evictUnused()
+	{
+		for (auto it = positionCache_.begin(); it != positionCache_.end();)
+		{
+			if (frameCounter_ - it->second.lastUsedFrame > kPositionCacheFrames)
+			{
+				it = positionCache_.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+} // namespace BinRenderer
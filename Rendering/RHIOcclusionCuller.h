@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include "RHIOcclusionBuffer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace BinRenderer
+{
+	struct RHISceneNode;
+	class RHIMesh;
+	class RHIFrustumCuller;
+
+	/**
+	 * @brief CPU 가림막 컬링 (GPU Hi-Z 경로가 없을 때의 대체 경로)
+	 *
+	 * - 절두체 컬링을 통과한 메시 중 화면을 크게 차지하는 메시를 가림막으로 골라 삼각형 예산 안에서 래스터화
+	 * - 애니메이션 모델은 스키닝 전 정점이라 가림막에서 제외
+	 * - 메시 정점 위치는 half → float 변환 결과를 캐시
+	 */
+	class RHIOcclusionCuller
+	{
+	public:
+		/**
+		 * @brief 가림막 래스터화 후 보이는 메시를 다시 테스트 (frustumCuller.cull() 이후)
+		 * @return 가려져서 보이지 않게 된 메시 수
+		 */
+		uint32_t cull(const std::vector<RHISceneNode>& nodes, const glm::mat4& viewProjection, RHIFrustumCuller& frustumCuller);
+
+		void setTriangleBudget(uint32_t triangleBudget) { triangleBudget_ = triangleBudget; }
+		uint32_t getOccluderCount() const { return occluderCount_; }
+		uint32_t getOccluderTriangleCount() const { return occluderTriangleCount_; }
+		const RHIOcclusionBuffer& getBuffer() const { return buffer_; }
+
+	private:
+		struct Candidate
+		{
+			const RHIMesh* mesh = nullptr;
+			const glm::mat4* world = nullptr;
+			float screenArea = 0.0f;  // 화면 대비 비율 (0 ~ 1)
+		};
+
+		struct CachedPositions
+		{
+			std::vector<glm::vec3> positions;
+			uint64_t lastUsedFrame = 0;
+		};
+
+		const std::vector<glm::vec3>& getPositions(const RHIMesh* mesh);
+		void evictUnused();
+
+		RHIOcclusionBuffer buffer_;
+		uint32_t triangleBudget_ = 32 * 1024;
+		uint32_t occluderCount_ = 0;
+		uint32_t occluderTriangleCount_ = 0;
+
+		std::vector<Candidate> candidates_;
+		std::unordered_map<const RHIMesh*, CachedPositions> positionCache_;
+		uint64_t frameCounter_ = 0;
+	};
+
+} // namespace BinRenderer
@@ -0,0 +1,145 @@
+﻿#include "RHIRenderQueue.h"
+
+#include <algorithm>
+#include <cfloat>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kRadixBits = 8;
+		constexpr uint32_t kRadixBuckets = 1u << kRadixBits;
+		constexpr uint32_t kRadixPasses = 64 / kRadixBits;
+		constexpr uint32_t kInsertionSortLimit = 64;  // 이보다 적으면 히스토그램 비용이 더 큼
+
+		constexpr uint64_t mask(uint32_t bits)
+		{
+			return (uint64_t(1) << bits) - 1;
+		}
+	}
+
+	void RHIRenderQueue::clear()
+	{
+		pending_.clear();
+		items_.clear();
+	}
+
+	void RHIRenderQueue::add(uint32_t pass, uint32_t pipeline, uint32_t material, float viewDepth, bool transparent,
+		uint32_t nodeIndex, uint32_t meshIndex)
+	{
+		pending_.push_back({ pass, pipeline, material, viewDepth, transparent, nodeIndex, meshIndex });
+	}
+
+	void RHIRenderQueue::sort()
+	{
+		items_.resize(pending_.size());
+		if (pending_.empty())
+		{
+			return;
+		}
+
+		// 카메라 뒤(음수)는 0으로, 나머지는 이번 큐의 깊이 범위로 정규화
+		float minDepth = FLT_MAX;
+		float maxDepth = 0.0f;
+		for (const auto& draw : pending_)
+		{
+			const float depth = std::max(draw.viewDepth, 0.0f);
+			minDepth = std::min(minDepth, depth);
+			maxDepth = std::max(maxDepth, depth);
+		}
+		const float range = maxDepth - minDepth;
+		const float depthScale = range > 0.0f ? static_cast<float>(mask(kDepthBits)) / range : 0.0f;
+
+		constexpr uint32_t kTransparentShift = 63 - kPassBits;
+		for (size_t i = 0; i < pending_.size(); ++i)
+		{
+			const PendingDraw& draw = pending_[i];
+			const uint64_t depth = static_cast<uint64_t>((std::max(draw.viewDepth, 0.0f) - minDepth) * depthScale) & mask(kDepthBits);
+			const uint64_t pipeline = draw.pipeline & mask(kPipelineBits);
+			const uint64_t material = draw.material & mask(kMaterialBits);
+
+			uint64_t key = (static_cast<uint64_t>(draw.pass) & mask(kPassBits)) << (64 - kPassBits);
+			if (draw.transparent)
+			{
+				const uint64_t backToFront = mask(kDepthBits) - depth;
+				key |= uint64_t(1) << kTransparentShift;
+				key |= backToFront << (kPipelineBits + kMaterialBits);
+				key |= pipeline << kMaterialBits;
+				key |= material;
+			}
+			else
+			{
+				key |= pipeline << (kMaterialBits + kDepthBits);
+				key |= material << kDepthBits;
+				key |= depth;
+			}
+
+			items_[i] = { key, draw.nodeIndex, draw.meshIndex };
+		}
+
+		radixSort();
+	}
+
+	void RHIRenderQueue::radixSort()
+	{
+		const size_t count = items_.size();
+		if (count <= kInsertionSortLimit)
+		{
+			for (size_t i = 1; i < count; ++i)
+			{
+				const RHIRenderQueueItem item = items_[i];
+				size_t j = i;
+				for (; j > 0 && items_[j - 1].key > item.key; --j)
+				{
+					items_[j] = items_[j - 1];
+				}
+				items_[j] = item;
+			}
+			return;
+		}
+
+		// LSD 기수 정렬: 한 번 훑어 8개 자릿수 히스토그램을 모두 만든 뒤,
+		// 모든 항목이 같은 버킷에 들어가는 자릿수 (예: 안 쓰는 패스 비트)는 건너뜀
+		uint32_t histograms[kRadixPasses][kRadixBuckets] = {};
+		for (const auto& item : items_)
+		{
+			for (uint32_t pass = 0; pass < kRadixPasses; ++pass)
+			{
+				histograms[pass][(item.key >> (pass * kRadixBits)) & (kRadixBuckets - 1)]++;
+			}
+		}
+
+		scratch_.resize(count);
+		RHIRenderQueueItem* src = items_.data();
+		RHIRenderQueueItem* dst = scratch_.data();
+		for (uint32_t pass = 0; pass < kRadixPasses; ++pass)
+		{
+			uint32_t* histogram = histograms[pass];
+			const uint32_t shift = pass * kRadixBits;
+			if (histogram[(src[0].key >> shift) & (kRadixBuckets - 1)] == count)
+			{
+				continue;
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < kRadixBuckets; ++bucket)
+			{
+				const uint32_t bucketCount = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				dst[histogram[(src[i].key >> shift) & (kRadixBuckets - 1)]++] = src[i];
+			}
+			std::swap(src, dst);
+		}
+
+		if (src != items_.data())
+		{
+			std::copy(src, src + count, items_.data());
+		}
+	}
+
+} // namespace BinRenderer
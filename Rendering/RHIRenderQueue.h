@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	/**
+	 * @brief 정렬된 드로우 하나 (키 + 어떤 노드의 어떤 메시인지)
+	 */
+	struct RHIRenderQueueItem
+	{
+		uint64_t key = 0;
+		uint32_t nodeIndex = 0;
+		uint32_t meshIndex = 0;
+	};
+
+	/**
+	 * @brief 64비트 정렬 키로 드로우 순서를 정하는 렌더 큐
+	 *
+	 * 키 배치 (상위 비트부터):
+	 * - 불투명:  패스 4 | 0 | 파이프라인 11 | 머티리얼 24 | 깊이 24 (가까운 것부터)
+	 * - 반투명:  패스 4 | 1 | 깊이 24 (먼 것부터) | 파이프라인 11 | 머티리얼 24
+	 *
+	 * 불투명은 상태 변경을 줄이도록 파이프라인/머티리얼로 묶고 그 안에서 앞→뒤 (Early-Z),
+	 * 반투명은 블렌딩 순서가 우선이므로 깊이가 상태보다 앞섬
+	 * 깊이는 이번 큐에 담긴 항목의 최소~최대 범위로 양자화
+	 */
+	class RHIRenderQueue
+	{
+	public:
+		static constexpr uint32_t kPassBits = 4;
+		static constexpr uint32_t kPipelineBits = 11;
+		static constexpr uint32_t kMaterialBits = 24;
+		static constexpr uint32_t kDepthBits = 24;
+
+		void clear();
+
+		/**
+		 * @brief 드로우 추가 (pipeline/material은 하위 비트만 사용, viewDepth는 카메라 전방 거리)
+		 */
+		void add(uint32_t pass, uint32_t pipeline, uint32_t material, float viewDepth, bool transparent,
+			uint32_t nodeIndex, uint32_t meshIndex);
+
+		/**
+		 * @brief 키 생성 후 기수 정렬 (같은 키는 추가한 순서 유지)
+		 */
+		void sort();
+
+		const std::vector<RHIRenderQueueItem>& getItems() const { return items_; }
+		bool empty() const { return pending_.empty(); }
+		uint32_t size() const { return static_cast<uint32_t>(pending_.size()); }
+
+		static bool isTransparentKey(uint64_t key) { return (key >> (63 - kPassBits)) & 1; }
+		static uint32_t getPassFromKey(uint64_t key) { return static_cast<uint32_t>(key >> (64 - kPassBits)); }
+
+	private:
+		struct PendingDraw
+		{
+			uint32_t pass;
+			uint32_t pipeline;
+			uint32_t material;
+			float viewDepth;
+			bool transparent;
+			uint32_t nodeIndex;
+			uint32_t meshIndex;
+		};
+
+		void radixSort();
+
+		std::vector<PendingDraw> pending_;
+		std::vector<RHIRenderQueueItem> items_;
+		std::vector<RHIRenderQueueItem> scratch_;  // 기수 정렬 보조 버퍼 (프레임마다 재사용)
+	};
+
+} // namespace BinRenderer
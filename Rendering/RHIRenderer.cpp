@@ -2,6 +2,8 @@
 #include "../Core/Logger.h"
 #include "../RenderPass/RHIForwardPassRG.h"
 
+#include <algorithm>
+
 namespace BinRenderer
 {
 	// ========================================
@@ -21,16 +23,17 @@ namespace BinRenderer
 		int32_t opacityTextureIndex;      // offset 60
 		int32_t metallicRoughnessTextureIndex; // offset 64
 		int32_t occlusionTextureIndex;    // offset 68
-		// Total size: 72 bytes (aligned to 16 bytes = 80 bytes in std140)
+		int32_t padding[2];               // offset 72 (std430 배열 stride = 80, vec4 멤버 정렬)
 	};
 
+	static_assert(sizeof(MaterialUBO) == 80, "MaterialUBO must match the std430 MaterialUBO array stride");
+
 	RHIRenderer::RHIRenderer(RHI* rhi, uint32_t maxFramesInFlight)
 		: rhi_(rhi)
 		, maxFramesInFlight_(maxFramesInFlight)
 	{
 		sceneUniformBuffers_.resize(maxFramesInFlight);
 		optionsUniformBuffers_.resize(maxFramesInFlight);
-		boneDataUniformBuffers_.resize(maxFramesInFlight);
 	}
 
 	RHIRenderer::~RHIRenderer()
@@ -62,6 +65,50 @@ namespace BinRenderer
 			// 4. Descriptor sets 생성
 			createDescriptorSets();
 
+			// 5. GPU 컬링 (지원하지 않으면 CPU 컬링 + 메시별 드로우)
+			gpuCuller_ = std::make_unique<RHIGpuCuller>(rhi_, maxFramesInFlight_);
+			if (!gpuCuller_->initialize())
+			{
+				gpuCuller_.reset();
+			}
+
+			// 6. Hi-Z 가림막 컬링 (실패하면 절두체 GPU 컬링만 사용)
+			if (gpuCuller_)
+			{
+				hiZPyramid_ = std::make_unique<RHIHiZPyramid>(rhi_);
+				if (!hiZPyramid_->initialize(width, height) || !gpuCuller_->enableOcclusion(*hiZPyramid_))
+				{
+					hiZPyramid_.reset();
+				}
+			}
+
+			// 7. 클러스터(meshlet) 컬링 (실패하면 메시 단위 컬링만 사용)
+			if (gpuCuller_)
+			{
+				gpuCuller_->enableClusterCulling();
+			}
+
+			// 8. 자동 인스턴싱 (CPU 드로우 경로에서 같은 메시를 쓰는 노드를 한 번에 드로우)
+			instanceBatcher_ = std::make_unique<RHIInstanceBatcher>(rhi_, maxFramesInFlight_);
+			if (!instanceBatcher_->initialize())
+			{
+				instanceBatcher_.reset();
+			}
+
+			// 9. 본 팔레트 SSBO (스킨드 인스턴스마다 오프셋, 모델 수/본 수 제한 없음)
+			bonePalettes_ = std::make_unique<RHIBonePaletteArena>(rhi_, maxFramesInFlight_);
+			if (!bonePalettes_->initialize())
+			{
+				bonePalettes_.reset();
+			}
+
+			// 10. 컴퓨트 프리스키닝 (실패하면 정점 셰이더가 팔레트로 직접 스키닝)
+			skinningCache_ = std::make_unique<RHISkinningCache>(rhi_, maxFramesInFlight_);
+			if (!skinningCache_->initialize())
+			{
+				skinningCache_.reset();
+			}
+
 			// RenderGraph는 RHIApplication에서 관리
 			// renderGraph_ = std::make_unique<RenderGraph>(rhi_);
 			// setupRenderPasses();
@@ -102,6 +149,15 @@ namespace BinRenderer
 			printLog("⚠️  Warning: waitIdle failed during shutdown: {}", e.what());
 		}
 
+		// GPU 컬링 리소스 정리
+		gpuDrivenRendering_ = false;
+		gpuCuller_.reset();
+		hiZPyramid_.reset();
+		instanceBatcher_.reset();
+		preSkinning_ = false;
+		skinningCache_.reset();
+		bonePalettes_.reset();
+
 		// Uniform buffers 정리
 		printLog("   Cleaning up uniform buffers...");
 		for (auto& buffer : sceneUniformBuffers_)
@@ -124,16 +180,6 @@ namespace BinRenderer
 		}
 		optionsUniformBuffers_.clear();
 
-		for (auto& buffer : boneDataUniformBuffers_)
-		{
-			if (buffer.isValid())
-			{
-				try { rhi_->destroyBuffer(buffer); }
-				catch (...) { printLog("⚠️  Warning: Failed to destroy bone data uniform buffer"); }
-			}
-		}
-		boneDataUniformBuffers_.clear();
-
 		//  Material buffer 정리
 		if (materialBuffer_.isValid())
 		{
@@ -230,16 +276,16 @@ namespace BinRenderer
 		}
 	}
 
-	void RHIRenderer::updateBoneData(const std::vector<RHIModel*>& models, uint32_t frameIndex)
+	void RHIRenderer::updateBoneData()
 	{
-		// TODO: 애니메이션 bone matrices 업데이트
-		// 현재는 identity matrices
+		if (bonePalettes_ && !bonePalettes_->upload())
+		{
+			printLog("⚠️  Bone palettes not uploaded, skinned meshes use the bind pose this frame");
+		}
 
-		if (boneDataUniformBuffers_[frameIndex].isValid())
+		if (preSkinning_ && !skinningCache_->prepareFrame(*bonePalettes_))
 		{
-			void* data = rhi_->mapBuffer(boneDataUniformBuffers_[frameIndex]);
-			memcpy(data, &boneDataUniform_, sizeof(BoneDataUniform));
-			rhi_->unmapBuffer(boneDataUniformBuffers_[frameIndex]);
+			printLog("⚠️  Skinning cache not prepared, skinned meshes skin in vertex shaders this frame");
 		}
 	}
 
@@ -248,11 +294,8 @@ namespace BinRenderer
 		//  RHIScene에서 모델 가져오기
 		auto visibleModels = scene.getModels();
 		
-		// Frustum culling
-		if (frustumCullingEnabled_)
-		{
-			performFrustumCulling(visibleModels);
-		}
+		// Frustum culling (메시별 결과는 isMeshVisible()로 조회)
+		performFrustumCulling(scene);
 
 		// Shadow map pass (optional)
 		// renderShadowMap(cmd, visibleModels, frameIndex);
@@ -270,24 +313,62 @@ namespace BinRenderer
 	// Frustum Culling
 	// ========================================
 
-	void RHIRenderer::performFrustumCulling(std::vector<RHIModel*>& models)
+	void RHIRenderer::performFrustumCulling(RHIScene& scene)
 	{
-		if (!frustumCullingEnabled_)
+		// 스킨드 노드의 팔레트 오프셋은 드로우 레코드/큐보다 먼저 정해야 함
+		if (bonePalettes_)
 		{
+			bonePalettes_->assign(scene);
+		}
+		if (preSkinning_)
+		{
+			skinningCache_->assign(scene, *bonePalettes_);
+		}
+
+		// GPU-driven: 바뀐 노드의 드로우 레코드만 갱신하고 테스트는 GpuCullingPassRG가 수행
+		if (gpuDrivenRendering_)
+		{
+			gpuCuller_->gather(scene.getNodes(), bonePalettes_.get(), preSkinning_ ? skinningCache_.get() : nullptr);
+
+			// 드로우 수는 프레임 슬롯이 돌아온 뒤에야 읽히므로 아직 없으면 전부 그린 것으로 봄
+			cullingStats_.totalMeshes = gpuCuller_->getRecordCount();
+			cullingStats_.renderedMeshes = gpuCuller_->hasVisibleCount()
+				? std::min(gpuCuller_->getVisibleCount(), cullingStats_.totalMeshes)
+				: cullingStats_.totalMeshes;
+			cullingStats_.culledMeshes = cullingStats_.totalMeshes - cullingStats_.renderedMeshes;
+			cullingStats_.occludedMeshes = 0;
+			cullingStats_.occluderCount = 0;
+			cullingStats_.gpuDriven = true;
 			return;
 		}
+		cullingStats_.gpuDriven = false;
+
+		// transform이 바뀐 노드만 World AABB를 다시 계산해 SoA 배열에 반영
+		frustumCuller_.gather(scene.getNodes());
+
+		uint32_t renderedMeshes = frustumCullingEnabled_
+			? frustumCuller_.cull(viewFrustum_)
+			: frustumCuller_.markAllVisible();
 
-		// TODO: ViewFrustum 클래스 구현 필요
-		// 현재는 모든 모델 렌더링
+		// 절두체 안에 남은 메시를 소프트웨어 가림막 버퍼로 다시 테스트
+		cullingStats_.occludedMeshes = 0;
+		cullingStats_.occluderCount = 0;
+		if (frustumCullingEnabled_ && occlusionCullingEnabled_)
+		{
+			cullingStats_.occludedMeshes = occlusionCuller_.cull(scene.getNodes(), viewProjection_, frustumCuller_);
+			cullingStats_.occluderCount = occlusionCuller_.getOccluderCount();
+			renderedMeshes -= cullingStats_.occludedMeshes;
+		}
 
-		cullingStats_.totalMeshes = static_cast<uint32_t>(models.size());
-		cullingStats_.renderedMeshes = static_cast<uint32_t>(models.size());
-		cullingStats_.culledMeshes = 0;
+		cullingStats_.totalMeshes = frustumCuller_.getMeshCount();
+		cullingStats_.renderedMeshes = renderedMeshes;
+		cullingStats_.culledMeshes = cullingStats_.totalMeshes - renderedMeshes;
 	}
 
 	void RHIRenderer::updateViewFrustum(const glm::mat4& viewProjection)
 	{
-		// TODO: ViewFrustum 업데이트
+		viewFrustum_.extractFromViewProjection(viewProjection);
+		viewProjection_ = viewProjection;
 	}
 
 	// ========================================
@@ -326,19 +407,6 @@ namespace BinRenderer
 				throw std::runtime_error("Failed to create options uniform buffer");
 			}
 
-			// Bone data uniform buffer
-			RHIBufferCreateInfo boneBufferInfo{};
-			boneBufferInfo.size = sizeof(BoneDataUniform);
-			boneBufferInfo.usage = RHI_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-			boneBufferInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-			
-			boneDataUniformBuffers_[i] = rhi_->createBuffer(boneBufferInfo);
-			if (!boneDataUniformBuffers_[i].isValid())
-			{
-				printLog("❌ ERROR: Failed to create bone data uniform buffer {}", i);
-				throw std::runtime_error("Failed to create bone data uniform buffer");
-			}
-
 			printLog("    Frame {} uniform buffers created", i);
 		}
 
@@ -430,54 +498,92 @@ namespace BinRenderer
 			return;
 		}
 
-		auto models = scene.getModels();
-		
+		// 씬 노드 순서 대신 정렬 키 순서로 드로우 (같은 버퍼 재바인딩은 커맨드 버퍼가 생략)
+		buildRenderQueue(scene, pipeline, 0, forwardQueue_);
+
 		if (frameIndex % 60 == 0)
 		{
-			printLog("[RHIRenderer] Rendering {} models", models.size());
+			printLog("[RHIRenderer] Rendering {} sorted meshes", forwardQueue_.size());
 		}
 
-		// 모델 렌더링
-		for (auto* model : models)
+		const auto& nodes = scene.getNodes();
+		for (const auto& item : forwardQueue_.getItems())
 		{
-			if (!model)
+			RHIModel* model = nodes[item.nodeIndex].model.get();
+			const auto& mesh = model->getMeshes()[item.meshIndex];
+
+			// ❌ Simple 셰이더는 Push constants 불필요
+			// TODO: PBR 셰이더로 전환 시 노드가 바뀔 때마다 model 행렬 push
+
+			mesh->bind(rhi);
+			mesh->draw(rhi, model->isInstanced() ? model->getInstanceCount() : 1);
+		}
+	}
+
+	void RHIRenderer::buildRenderQueue(const RHIScene& scene, RHIPipelineHandle pipeline, uint32_t pass, RHIRenderQueue& queue)
+	{
+		queue.clear();
+		queueModelIds_.clear();
+
+		// clip.w = 뷰 공간 전방 거리 (원근 투영)
+		const glm::vec4 depthRow(viewProjection_[0][3], viewProjection_[1][3], viewProjection_[2][3], viewProjection_[3][3]);
+
+		const auto& nodes = scene.getNodes();
+		for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex)
+		{
+			const auto& node = nodes[nodeIndex];
+			if (!node.model || !node.visible)
 				continue;
 
-			// ❌ Simple 셰이더는 Push constants 불필요 - 주석 처리
-			// TODO: PBR 셰이더로 전환 시 다시 활성화
-			/*
-			//  Push constants (Model matrix)
-			PbrPushConstants pushConstants{};
-			pushConstants.model = model->getTransform();
-			pushConstants.materialIndex = 0;  // TODO: Material index 전달
-			
-			//  Push constants 전송 (Pipeline 사용)
-			rhi->cmdPushConstants(
-				pipeline, 
-				RHI_SHADER_STAGE_VERTEX_BIT | RHI_SHADER_STAGE_FRAGMENT_BIT,
-				0, 
-				sizeof(PbrPushConstants), 
-				&pushConstants
-			);
-			*/
-
-			//  Draw
-			model->draw(rhi, 1);
-			
-			if (frameIndex % 60 == 0)
+			// 같은 모델을 쓰는 노드는 머티리얼도 같으므로 모델 단위로 번호를 매김
+			const RHIModel* model = node.model.get();
+			const uint32_t modelId = queueModelIds_.try_emplace(model, static_cast<uint32_t>(queueModelIds_.size())).first->second;
+
+			const auto& meshes = model->getMeshes();
+			const auto& materials = model->getMaterials();
+			for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
 			{
-				const auto& meshes = model->getMeshes();
-				printLog("[RHIRenderer]   - Drew model '{}': {} meshes", 
-					model->getName().empty() ? "<unnamed>" : model->getName(), 
-					meshes.size());
+				const auto& mesh = meshes[meshIndex];
+				if (!mesh || !isMeshVisible(nodeIndex, meshIndex))
+					continue;
+
+				const glm::vec3 center = meshIndex < node.meshWorldBounds.size()
+					? node.meshWorldBounds[meshIndex].getCenter()
+					: glm::vec3(node.transform[3]);
+				const float viewDepth = glm::dot(depthRow, glm::vec4(center, 1.0f));
+
+				const uint32_t materialIndex = mesh->getMaterialIndex();
+				bool transparent = false;
+				if (materialIndex < materials.size())
+				{
+					const MaterialData& data = materials[materialIndex].getData();
+					transparent = (data.flags & MaterialData::Transparent) || data.transparency < 1.0f;
+				}
+
+				// 머티리얼 키 = 모델 번호 16비트 + 모델 내 머티리얼 8비트
+				const uint32_t materialKey = (modelId << 8) | (materialIndex & 0xFF);
+				queue.add(pass, pipeline.getIndex(), materialKey, viewDepth, transparent,
+					static_cast<uint32_t>(nodeIndex), static_cast<uint32_t>(meshIndex));
 			}
 		}
+
+		queue.sort();
 	}
 
 	// ========================================
 	//  Material System
 	// ========================================
 
+	uint32_t RHIRenderer::getMaterialIndex(const RHIModel* model, uint32_t localIndex) const
+	{
+		const auto it = materialBases_.find(model);
+		if (it == materialBases_.end() || localIndex >= model->getMaterials().size())
+		{
+			return 0;
+		}
+		return it->second + localIndex;
+	}
+
 	void RHIRenderer::buildMaterialBuffer(RHIScene& scene)
 	{
 		printLog("[RHIRenderer] Building material buffer from scene...");
@@ -489,15 +595,21 @@ namespace BinRenderer
 			materialBuffer_ = {};
 		}
 		materialTextures_.clear();
+		materialBases_.clear();
 		materialCount_ = 0;
 
-		// Scene에서 모든 모델의 materials 수집
+		// 아직 bindless 배열을 채우지 않으므로 수집된 텍스처 범위 밖 인덱스는 -1 (셰이더가 바인딩 안 된 슬롯을 읽지 않도록)
+		auto textureIndex = [this](int32_t index) {
+			return index >= 0 && static_cast<size_t>(index) < materialTextures_.size() ? index : -1;
+		};
+
+		// Scene에서 모든 모델의 materials 수집 (노드마다가 아니라 모델마다 한 번)
 		std::vector<MaterialUBO> materials;
 		auto models = scene.getModels();
 
 		for (auto* model : models)
 		{
-			if (!model) continue;
+			if (!model || !materialBases_.try_emplace(model, static_cast<uint32_t>(materials.size())).second) continue;
 
 			const auto& modelMaterials = model->getMaterials();
 			for (const auto& mat : modelMaterials)
@@ -514,12 +626,12 @@ namespace BinRenderer
 				materialUBO.metallicFactor = data.metallic;
 
 				// Texture indices
-				materialUBO.baseColorTextureIndex = data.baseColorTextureIndex;
-				materialUBO.emissiveTextureIndex = data.emissiveTextureIndex;
-				materialUBO.normalTextureIndex = data.normalTextureIndex;
-				materialUBO.opacityTextureIndex = data.opacityTextureIndex;
-				materialUBO.metallicRoughnessTextureIndex = data.metallicRoughnessTextureIndex;
-				materialUBO.occlusionTextureIndex = data.occlusionTextureIndex;
+				materialUBO.baseColorTextureIndex = textureIndex(data.baseColorTextureIndex);
+				materialUBO.emissiveTextureIndex = textureIndex(data.emissiveTextureIndex);
+				materialUBO.normalTextureIndex = textureIndex(data.normalTextureIndex);
+				materialUBO.opacityTextureIndex = textureIndex(data.opacityTextureIndex);
+				materialUBO.metallicRoughnessTextureIndex = textureIndex(data.metallicRoughnessTextureIndex);
+				materialUBO.occlusionTextureIndex = textureIndex(data.occlusionTextureIndex);
 
 				materials.push_back(materialUBO);
 			}
@@ -560,6 +672,12 @@ namespace BinRenderer
 		printLog("[RHIRenderer]    Material buffer created: {} materials, {} bytes", 
 			materialCount_, bufferInfo.size);
 
+		// GPU-driven 드로우 레코드도 같은 인덱스를 쓰도록
+		if (gpuCuller_)
+		{
+			gpuCuller_->setMaterialBases(materialBases_);
+		}
+
 		// TODO: Texture 수집 및 bindless array 구성
 		// 현재는 placeholder
 		printLog("[RHIRenderer]   ⏳ Material textures collection - TODO");
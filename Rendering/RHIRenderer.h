@@ -6,6 +6,16 @@
 #include "../Core/RHIScene.h"
 #include "../Scene/RHICamera.h"
 #include "../Scene/Animation.h"
+#include "RHIViewFrustum.h"
+#include "RHIFrustumCuller.h"
+#include "RHIOcclusionCuller.h"
+#include "RHIGpuCuller.h"
+#include "RHIHiZPyramid.h"
+#include "RHIRenderQueue.h"
+#include "RHIInstanceBatcher.h"
+#include "RHIBonePaletteArena.h"
+#include "RHISkinningCache.h"
+#include "../assets/shaders/include/pbrPushConstants.h"
 #include <glm/glm.hpp>
 #include <memory>
 #include <vector>
@@ -51,25 +61,19 @@ namespace BinRenderer
 	};
 
 	/**
-	 * @brief 애니메이션 Bone 데이터
-	 */
-	struct BoneDataUniform
-	{
-		alignas(16) glm::mat4 boneMatrices[65];
-		alignas(16) glm::vec4 animationData; // x = hasAnimation (0.0/1.0)
-	};
-
-	/**
-	 * @brief PBR Push Constants
+	 * @brief PBR Push Constants (필드는 셰이더와 공유하는 assets/shaders/include/pbrPushConstants.h에서 정의)
+	 *
+	 * skinnedVertexBase: 프리스키닝 캐시에서 이 드로우의 정점 시작 (RHISkinningCache::kNoCache면 캐시 안 씀)
+	 * boneOffset: 본 팔레트 SSBO에서 이 드로우의 시작 위치 (RHIBonePaletteArena::kNoPalette면 스키닝 안 함)
 	 */
 	struct PbrPushConstants
 	{
-		alignas(16) glm::mat4 model = glm::mat4(1.0f);
-		alignas(4) uint32_t materialIndex = 0;
-		alignas(4) float coeffs[15] = { 0.0f };
+		PBR_PUSH_CONSTANT_MEMBERS
 	};
 
 	static_assert(sizeof(PbrPushConstants) == 128, "PbrPushConstants must be 128 bytes");
+	static_assert(RHISkinningCache::kNoCache == 0xFFFFFFFFu && RHIBonePaletteArena::kNoPalette == 0xFFFFFFFFu,
+		"pbrPushConstants.h defaults and shader sentinels assume UINT32_MAX");
 
 	/**
 	 * @brief Frustum Culling 통계
@@ -79,6 +83,9 @@ namespace BinRenderer
 		uint32_t totalMeshes = 0;
 		uint32_t culledMeshes = 0;
 		uint32_t renderedMeshes = 0;
+		uint32_t occludedMeshes = 0;  // culledMeshes 중 가림막에 가려진 수 (CPU 경로)
+		uint32_t occluderCount = 0;
+		bool gpuDriven = false;  // true면 컬링은 GPU에서 (rendered/culled는 GPU 드로우 수를 몇 프레임 늦게 읽은 값)
 	};
 
 	/**
@@ -102,25 +109,72 @@ namespace BinRenderer
 		// ========================================
 		void beginFrame(uint32_t frameIndex);
 		void updateUniforms(const RHICamera& camera, RHIScene& scene, uint32_t frameIndex, double time);
-		void updateBoneData(const std::vector<RHIModel*>& models, uint32_t frameIndex);
+		// performFrustumCulling에서 배정한 본 팔레트와 스키닝 작업을 현재 프레임 슬롯에 기록 (RHI::beginFrame 이후)
+		void updateBoneData();
 		void render(RHICommandBuffer* cmd, RHIScene& scene, uint32_t frameIndex, RHIImageView* swapchainImageView);
 		void endFrame(uint32_t frameIndex);
 
 		// ========================================
-		// Frustum Culling
+		// Frustum Culling (메시 단위)
 		// ========================================
-		void performFrustumCulling(std::vector<RHIModel*>& models);
+		void performFrustumCulling(RHIScene& scene);
 		void updateViewFrustum(const glm::mat4& viewProjection);
+		bool isMeshVisible(size_t nodeIndex, size_t meshIndex) const { return gpuDrivenRendering_ || frustumCuller_.isMeshVisible(nodeIndex, meshIndex); }
 		void setFrustumCullingEnabled(bool enabled) { frustumCullingEnabled_ = enabled; }
 		bool isFrustumCullingEnabled() const { return frustumCullingEnabled_; }
 		const CullingStats& getCullingStats() const { return cullingStats_; }
+		const RHIViewFrustum& getViewFrustum() const { return viewFrustum_; }
+		const glm::mat4& getViewProjection() const { return viewProjection_; }
+
+		// CPU 경로의 가림막 컬링 (Frustum Culling이 켜져 있을 때만)
+		void setOcclusionCullingEnabled(bool enabled) { occlusionCullingEnabled_ = enabled; }
+		bool isOcclusionCullingEnabled() const { return occlusionCullingEnabled_; }
+
+		// ========================================
+		// GPU-driven 렌더링 (컴퓨트 컬링 + Indirect 드로우)
+		// ========================================
+		// 디바이스 기능/셰이더가 없으면 nullptr
+		RHIGpuCuller* getGpuCuller() const { return gpuCuller_ ? gpuCuller_.get() : nullptr; }
+
+		// 2단계 가림막 컬링용 깊이/Hi-Z (GPU 컬러가 없거나 셰이더가 없으면 nullptr)
+		RHIHiZPyramid* getHiZPyramid() const { return hiZPyramid_ ? hiZPyramid_.get() : nullptr; }
+
+		/**
+		 * @brief 켜면 CPU 컬링 대신 GPU 컬링용 레코드만 갱신 (GpuCullingPassRG + Indirect 드로우 패스와 함께 사용)
+		 */
+		void setGpuDrivenRendering(bool enabled) { gpuDrivenRendering_ = enabled && getGpuCuller(); }
+		bool isGpuDrivenRendering() const { return gpuDrivenRendering_; }
+
+		// CPU 드로우 경로의 자동 인스턴싱 (초기화에 실패하면 nullptr → 메시별 드로우)
+		RHIInstanceBatcher* getInstanceBatcher() const { return instanceBatcher_ ? instanceBatcher_.get() : nullptr; }
+
+		// 스킨드 인스턴스의 본 팔레트 (초기화에 실패하면 nullptr → 스키닝 없이 바인드 포즈)
+		RHIBonePaletteArena* getBonePaletteArena() const { return bonePalettes_ ? bonePalettes_.get() : nullptr; }
+		uint32_t getBoneOffset(size_t nodeIndex) const
+		{
+			return bonePalettes_ ? bonePalettes_->getNodeOffset(nodeIndex) : RHIBonePaletteArena::kNoPalette;
+		}
+
+		// 컴퓨트 프리스키닝 (셰이더가 없으면 nullptr → 정점 셰이더가 팔레트로 직접 스키닝)
+		RHISkinningCache* getSkinningCache() const { return skinningCache_ ? skinningCache_.get() : nullptr; }
+
+		/**
+		 * @brief 켜면 스킨드 노드를 SkinningPassRG가 미리 스키닝하고 드로우는 캐시된 정점을 읽음
+		 *
+		 * SkinningPassRG를 스킨드 메시를 그리는 패스보다 먼저 추가했을 때만 켬
+		 */
+		void setPreSkinningEnabled(bool enabled) { preSkinning_ = enabled && getSkinningCache() && getBonePaletteArena(); }
+		bool isPreSkinningEnabled() const { return preSkinning_; }
+		uint32_t getSkinnedVertexBase(size_t nodeIndex, size_t meshIndex) const
+		{
+			return preSkinning_ ? skinningCache_->getSkinnedVertexBase(nodeIndex, meshIndex) : RHISkinningCache::kNoCache;
+		}
 
 		// ========================================
 		// Uniform 접근자
 		// ========================================
 		SceneUniform& getSceneUniform() { return sceneUniform_; }
 		OptionsUniform& getOptionsUniform() { return optionsUniform_; }
-		BoneDataUniform& getBoneDataUniform() { return boneDataUniform_; }
 
 		//  Uniform Buffer 접근자 (Descriptor Set 바인딩용)
 		RHIBufferHandle getSceneUniformBuffer(uint32_t frameIndex) const 
@@ -131,16 +185,20 @@ namespace BinRenderer
 		{ 
 			return frameIndex < optionsUniformBuffers_.size() ? optionsUniformBuffers_[frameIndex] : RHIBufferHandle{}; 
 		}
-		RHIBufferHandle getBoneDataUniformBuffer(uint32_t frameIndex) const 
-		{ 
-			return frameIndex < boneDataUniformBuffers_.size() ? boneDataUniformBuffers_[frameIndex] : RHIBufferHandle{}; 
-		}
 
 		// ========================================
 		// Forward Rendering 헬퍼 (ForwardPass에서 사용)
 		// ========================================
 		void renderForwardModels(RHI* rhi, RHIScene& scene, RHIPipelineHandle pipeline, uint32_t frameIndex);
 
+		/**
+		 * @brief 컬링을 통과한 메시를 정렬 키와 함께 큐에 담고 정렬 (performFrustumCulling 이후)
+		 *
+		 * 불투명은 파이프라인 → 머티리얼 → 앞에서 뒤, 반투명은 뒤에서 앞 순서
+		 * (깊이는 updateViewFrustum에 넘긴 viewProjection 기준)
+		 */
+		void buildRenderQueue(const RHIScene& scene, RHIPipelineHandle pipeline, uint32_t pass, RHIRenderQueue& queue);
+
 		// ========================================
 		// Getters
 		// ========================================
@@ -154,9 +212,16 @@ namespace BinRenderer
 		/**
 		 * @brief Scene의 모든 모델에서 material 데이터를 수집하여 GPU 버퍼 생성
 		 * @param scene Scene containing models with materials
+		 * 
+		 * 모델마다 한 번씩 모델 순서대로 이어 붙임 (여러 노드가 같은 모델을 써도 한 번)
 		 */
 		void buildMaterialBuffer(RHIScene& scene);
 
+		/**
+		 * @brief 모델 내 머티리얼 인덱스 → Material buffer 인덱스 (버퍼에 없는 모델이나 범위 밖이면 0)
+		 */
+		uint32_t getMaterialIndex(const RHIModel* model, uint32_t localIndex) const;
+
 		/**
 		 * @brief Material buffer 접근자
 		 */
@@ -202,12 +267,10 @@ namespace BinRenderer
 		// Uniform 데이터
 		SceneUniform sceneUniform_;
 		OptionsUniform optionsUniform_;
-		BoneDataUniform boneDataUniform_;
 
 		// Uniform Buffers (per-frame)
 		std::vector<RHIBufferHandle> sceneUniformBuffers_;      // [maxFramesInFlight]
 		std::vector<RHIBufferHandle> optionsUniformBuffers_;    // [maxFramesInFlight]
-		std::vector<RHIBufferHandle> boneDataUniformBuffers_;   // [maxFramesInFlight]
 
 		// Render Targets
 		RHIImageHandle depthStencilTexture_;
@@ -222,13 +285,33 @@ namespace BinRenderer
 		// Frustum Culling
 		bool frustumCullingEnabled_ = true;
 		CullingStats cullingStats_;
-		// ViewFrustum 클래스는 나중에 추가
+		RHIViewFrustum viewFrustum_;
+		glm::mat4 viewProjection_ = glm::mat4(1.0f);
+		RHIFrustumCuller frustumCuller_;
+		bool occlusionCullingEnabled_ = true;
+		RHIOcclusionCuller occlusionCuller_;
+		std::unique_ptr<RHIHiZPyramid> hiZPyramid_;
+		std::unique_ptr<RHIGpuCuller> gpuCuller_;
+		bool gpuDrivenRendering_ = false;
+
+		// 드로우 정렬 + 자동 인스턴싱
+		std::unique_ptr<RHIInstanceBatcher> instanceBatcher_;
+
+		// 본 팔레트 (노드 오프셋은 performFrustumCulling에서, 행렬은 updateBoneData에서)
+		std::unique_ptr<RHIBonePaletteArena> bonePalettes_;
+
+		// 컴퓨트 프리스키닝 (작업은 performFrustumCulling에서, 작업 테이블은 updateBoneData에서)
+		std::unique_ptr<RHISkinningCache> skinningCache_;
+		bool preSkinning_ = false;
+		RHIRenderQueue forwardQueue_;
+		std::unordered_map<const RHIModel*, uint32_t> queueModelIds_;  // 머티리얼 키용 모델 번호 (큐를 만들 때마다 다시 매김)
 
 		// ========================================
 		//  Material System
 		// ========================================
 		RHIBufferHandle materialBuffer_;
 		uint32_t materialCount_ = 0;
+		std::unordered_map<const RHIModel*, uint32_t> materialBases_;  // 모델별 Material buffer 시작 위치
 		std::vector<RHIImageViewHandle> materialTextures_; // Bindless texture array
 	};
 
@@ -0,0 +1,876 @@
+﻿#include "RHISceneBVH.h"
+#include "../Core/RHIScene.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kBinCount = 16;
+		constexpr uint32_t kMaxLeafSize = 8;        // SAH가 잎을 골라도 이보다 많으면 나눔
+		constexpr float kTraversalCost = 1.0f;      // 아이템 AABB 테스트 1회 대비 노드 방문 비용
+		constexpr float kRebuildCostRatio = 1.5f;   // Refit 후 비용이 빌드 직후의 이 배수를 넘으면 다시 빌드
+		constexpr uint32_t kInvalidNode = UINT32_MAX;
+
+		// 숨긴 노드의 메시: 어떤 합집합에도 영향 없고 어떤 쿼리에도 걸리지 않음
+		const AABB kEmptyBounds(glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX));
+
+		bool isEmpty(const glm::vec3& min, const glm::vec3& max)
+		{
+			return min.x > max.x;
+		}
+
+		float surfaceArea(const glm::vec3& min, const glm::vec3& max)
+		{
+			if (isEmpty(min, max))
+			{
+				return 0.0f;
+			}
+			const glm::vec3 d = max - min;
+			return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+		}
+
+		bool overlaps(const glm::vec3& minA, const glm::vec3& maxA, const glm::vec3& minB, const glm::vec3& maxB)
+		{
+			return minA.x <= maxB.x && maxA.x >= minB.x &&
+				minA.y <= maxB.y && maxA.y >= minB.y &&
+				minA.z <= maxB.z && maxA.z >= minB.z;
+		}
+
+		bool overlapsSphere(const glm::vec3& min, const glm::vec3& max, const glm::vec3& center, float radiusSquared)
+		{
+			if (isEmpty(min, max))
+			{
+				return false;
+			}
+			const glm::vec3 closest = glm::clamp(center, min, max);
+			const glm::vec3 d = closest - center;
+			return glm::dot(d, d) <= radiusSquared;
+		}
+
+		// 슬랩 테스트: [tNear, tFar]가 [0, maxDistance]와 겹치면 tNear 반환
+		bool intersectRay(const glm::vec3& min, const glm::vec3& max, const glm::vec3& origin, const glm::vec3& invDirection,
+			float maxDistance, float& tNear)
+		{
+			if (isEmpty(min, max))
+			{
+				return false;
+			}
+			const glm::vec3 t1 = (min - origin) * invDirection;
+			const glm::vec3 t2 = (max - origin) * invDirection;
+			const glm::vec3 tMin = glm::min(t1, t2);
+			const glm::vec3 tMax = glm::max(t1, t2);
+			const float enter = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+			const float exit = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, maxDistance));
+			tNear = enter;
+			return enter <= exit;
+		}
+
+		struct FrustumPlanes
+		{
+			glm::vec3 normal[6];
+			glm::vec3 absNormal[6];
+			float distance[6];
+		};
+
+		enum class PlaneResult { Outside, Intersect, Inside };
+
+		// mask에 남은 평면만 테스트, 완전히 안쪽인 평면은 mask에서 뺌
+		PlaneResult testPlanes(const FrustumPlanes& planes, const glm::vec3& min, const glm::vec3& max, uint32_t& mask)
+		{
+			if (isEmpty(min, max))
+			{
+				return PlaneResult::Outside;
+			}
+
+			const glm::vec3 center = (min + max) * 0.5f;
+			const glm::vec3 extent = (max - min) * 0.5f;
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				if (!(mask & (1u << p)))
+				{
+					continue;
+				}
+				const float d = glm::dot(planes.normal[p], center) + planes.distance[p];
+				const float r = glm::dot(planes.absNormal[p], extent);
+				if (d + r < 0.0f)
+				{
+					return PlaneResult::Outside;
+				}
+				if (d - r >= 0.0f)
+				{
+					mask &= ~(1u << p);
+				}
+			}
+			return mask == 0 ? PlaneResult::Inside : PlaneResult::Intersect;
+		}
+	}
+
+	// ========================================
+	// 갱신
+	// ========================================
+
+	bool RHISceneBVH::update(std::vector<RHISceneNode>& nodes)
+	{
+		for (auto& node : nodes)
+		{
+			node.updateWorldBounds();
+		}
+
+		// 노드/메시 구성이 그대로인지 확인
+		bool layoutChanged = nodeStates_.size() != nodes.size() || (nodes.empty() && !itemBounds_.empty());
+		for (size_t i = 0; !layoutChanged && i < nodes.size(); ++i)
+		{
+			layoutChanged = nodeStates_[i].model != nodes[i].model.get() ||
+				nodeStates_[i].meshCount != nodes[i].meshWorldBounds.size();
+		}
+
+		if (layoutChanged)
+		{
+			nodeStates_.resize(nodes.size());
+
+			uint32_t firstItem = 0;
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				NodeState& state = nodeStates_[i];
+				state.model = nodes[i].model.get();
+				state.firstItem = firstItem;
+				state.meshCount = static_cast<uint32_t>(nodes[i].meshWorldBounds.size());
+				firstItem += state.meshCount;
+			}
+
+			itemRefs_.resize(firstItem);
+			itemBounds_.resize(firstItem);
+			for (size_t i = 0; i < nodes.size(); ++i)
+			{
+				NodeState& state = nodeStates_[i];
+				state.boundsVersion = nodes[i].boundsVersion;
+				state.visible = nodes[i].visible;
+				for (uint32_t m = 0; m < state.meshCount; ++m)
+				{
+					itemRefs_[state.firstItem + m] = { static_cast<uint32_t>(i), m };
+				}
+				writeItemBounds(state, nodes[i]);
+			}
+
+			rebuild();
+			return true;
+		}
+
+		// transform/가시성이 바뀐 노드의 아이템만 Refit
+		std::vector<uint32_t> dirtySlots;
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			NodeState& state = nodeStates_[i];
+			if (state.boundsVersion == nodes[i].boundsVersion && state.visible == nodes[i].visible)
+			{
+				continue;
+			}
+
+			state.boundsVersion = nodes[i].boundsVersion;
+			state.visible = nodes[i].visible;
+			writeItemBounds(state, nodes[i]);
+			for (uint32_t m = 0; m < state.meshCount; ++m)
+			{
+				dirtySlots.push_back(itemSlots_[state.firstItem + m]);
+			}
+		}
+
+		return refitDirty(dirtySlots);
+	}
+
+	void RHISceneBVH::build(const std::vector<AABB>& bounds)
+	{
+		nodeStates_.clear();
+		itemBounds_ = bounds;
+		itemRefs_.resize(bounds.size());
+		for (uint32_t i = 0; i < itemRefs_.size(); ++i)
+		{
+			itemRefs_[i] = { i, 0 };
+		}
+		rebuild();
+	}
+
+	bool RHISceneBVH::updateBounds(const std::vector<uint32_t>& items, const std::vector<AABB>& bounds)
+	{
+		std::vector<uint32_t> dirtySlots;
+		dirtySlots.reserve(items.size());
+		for (size_t i = 0; i < items.size() && i < bounds.size(); ++i)
+		{
+			if (items[i] < itemBounds_.size())
+			{
+				itemBounds_[items[i]] = bounds[i];
+				dirtySlots.push_back(itemSlots_[items[i]]);
+			}
+		}
+		return refitDirty(dirtySlots);
+	}
+
+	bool RHISceneBVH::refitDirty(const std::vector<uint32_t>& dirtySlots)
+	{
+		if (dirtySlots.empty())
+		{
+			return false;
+		}
+
+		// 많이 움직였으면 경로별 갱신보다 전체를 한 번 훑는 편이 빠름
+		const uint32_t itemCount = getItemCount();
+		if (dirtySlots.size() * 8 > itemCount)
+		{
+			refitAll();
+		}
+		else
+		{
+			refit(dirtySlots);
+		}
+
+		// 비용 계산은 O(노드 수)라 아이템의 1/4 이상이 움직였을 때만 확인
+		movedSinceCheck_ += static_cast<uint32_t>(dirtySlots.size());
+		if (movedSinceCheck_ * 4 >= itemCount)
+		{
+			movedSinceCheck_ = 0;
+			if (computeCost() > buildCost_ * kRebuildCostRatio)
+			{
+				rebuild();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void RHISceneBVH::clear()
+	{
+		nodeStates_.clear();
+		itemRefs_.clear();
+		itemBounds_.clear();
+		itemSlots_.clear();
+		items_.clear();
+		bounds_.clear();
+		slotItems_.clear();
+		slotLeaves_.clear();
+		nodes_.clear();
+		parents_.clear();
+		subtreeFirst_.clear();
+		subtreeCount_.clear();
+		buildCost_ = 0.0f;
+		movedSinceCheck_ = 0;
+	}
+
+	void RHISceneBVH::writeItemBounds(const NodeState& state, const RHISceneNode& node)
+	{
+		for (uint32_t m = 0; m < state.meshCount; ++m)
+		{
+			itemBounds_[state.firstItem + m] = state.visible ? node.meshWorldBounds[m] : kEmptyBounds;
+		}
+	}
+
+	// ========================================
+	// 빌드 (Binned SAH)
+	// ========================================
+
+	void RHISceneBVH::rebuild()
+	{
+		const uint32_t itemCount = static_cast<uint32_t>(itemBounds_.size());
+
+		items_ = itemRefs_;
+		bounds_ = itemBounds_;
+		slotItems_.resize(itemCount);
+		centroids_.resize(itemCount);
+		for (uint32_t id = 0; id < itemCount; ++id)
+		{
+			slotItems_[id] = id;
+			// 빈 AABB는 중심이 정의되지 않으므로 원점에 모음
+			centroids_[id] = isEmpty(bounds_[id].min, bounds_[id].max) ? glm::vec3(0.0f) : bounds_[id].getCenter();
+		}
+
+		// 자식은 항상 부모보다 뒤에 추가 → 역순 순회가 곧 bottom-up
+		nodes_.clear();
+		parents_.clear();
+		subtreeFirst_.clear();
+		subtreeCount_.clear();
+		if (itemCount > 0)
+		{
+			nodes_.reserve(itemCount * 2);
+			parents_.reserve(itemCount * 2);
+			subtreeFirst_.reserve(itemCount * 2);
+			subtreeCount_.reserve(itemCount * 2);
+
+			// 루트만 직접 훑고, 아래 노드의 범위는 부모의 구간 집계에서 얻음
+			BuildTask root;
+			Node rootNode{ glm::vec3(FLT_MAX), 0, glm::vec3(-FLT_MAX), itemCount };
+			root.centroidMin = glm::vec3(FLT_MAX);
+			root.centroidMax = glm::vec3(-FLT_MAX);
+			for (uint32_t i = 0; i < itemCount; ++i)
+			{
+				rootNode.min = glm::min(rootNode.min, bounds_[i].min);
+				rootNode.max = glm::max(rootNode.max, bounds_[i].max);
+				root.centroidMin = glm::min(root.centroidMin, centroids_[i]);
+				root.centroidMax = glm::max(root.centroidMax, centroids_[i]);
+			}
+
+			nodes_.push_back(rootNode);
+			parents_.push_back(kInvalidNode);
+			subtreeFirst_.push_back(0);
+			subtreeCount_.push_back(itemCount);
+
+			std::vector<BuildTask> stack{ root };
+			while (!stack.empty())
+			{
+				const BuildTask task = stack.back();
+				stack.pop_back();
+				subdivide(task, stack);
+			}
+		}
+
+		itemSlots_.resize(itemCount);
+		slotLeaves_.resize(itemCount);
+		for (uint32_t slot = 0; slot < itemCount; ++slot)
+		{
+			itemSlots_[slotItems_[slot]] = slot;
+		}
+		for (uint32_t nodeIndex = 0; nodeIndex < nodes_.size(); ++nodeIndex)
+		{
+			const Node& node = nodes_[nodeIndex];
+			for (uint32_t i = 0; i < node.count; ++i)
+			{
+				slotLeaves_[node.first + i] = nodeIndex;
+			}
+		}
+
+		centroids_.clear();
+		centroids_.shrink_to_fit();
+
+		buildCost_ = computeCost();
+		movedSinceCheck_ = 0;
+		buildCount_++;
+	}
+
+	void RHISceneBVH::subdivide(const BuildTask& task, std::vector<BuildTask>& stack)
+	{
+		const uint32_t nodeIndex = task.node;
+		const uint32_t first = nodes_[nodeIndex].first;
+		const uint32_t count = nodes_[nodeIndex].count;
+		if (count <= 1)
+		{
+			return;
+		}
+
+		// 축마다 중심을 kBinCount개 구간에 나눠 담고 (세 축을 한 번에) 구간 경계마다 SAH 비용 계산
+		// 구간별 AABB/중심 범위를 같이 모아 두면 자식 범위를 다시 훑지 않아도 됨
+		struct Bin
+		{
+			glm::vec3 min = glm::vec3(FLT_MAX);
+			glm::vec3 max = glm::vec3(-FLT_MAX);
+			glm::vec3 centroidMin = glm::vec3(FLT_MAX);
+			glm::vec3 centroidMax = glm::vec3(-FLT_MAX);
+			uint32_t count = 0;
+		};
+
+		Bin bins[3][kBinCount];
+		float scale[3];
+		bool validAxis[3];
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const float extent = task.centroidMax[axis] - task.centroidMin[axis];
+			validAxis[axis] = extent > 1e-6f;
+			scale[axis] = validAxis[axis] ? kBinCount / extent : 0.0f;
+		}
+
+		auto binIndex = [&](const glm::vec3& centroid, int axis)
+		{
+			return std::min(kBinCount - 1, static_cast<uint32_t>((centroid[axis] - task.centroidMin[axis]) * scale[axis]));
+		};
+
+		for (uint32_t i = first; i < first + count; ++i)
+		{
+			const glm::vec3& centroid = centroids_[i];
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				Bin& bin = bins[axis][binIndex(centroid, axis)];
+				bin.min = glm::min(bin.min, bounds_[i].min);
+				bin.max = glm::max(bin.max, bounds_[i].max);
+				bin.centroidMin = glm::min(bin.centroidMin, centroid);
+				bin.centroidMax = glm::max(bin.centroidMax, centroid);
+				bin.count++;
+			}
+		}
+
+		float bestCost = FLT_MAX;
+		int bestAxis = -1;
+		uint32_t bestSplit = 0;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (!validAxis[axis])
+			{
+				continue;
+			}
+
+			// 왼쪽 누적 → 오른쪽 누적하며 비용 합산
+			float leftArea[kBinCount - 1];
+			uint32_t leftCount[kBinCount - 1];
+			glm::vec3 accMin(FLT_MAX), accMax(-FLT_MAX);
+			uint32_t accCount = 0;
+			for (uint32_t b = 0; b < kBinCount - 1; ++b)
+			{
+				accMin = glm::min(accMin, bins[axis][b].min);
+				accMax = glm::max(accMax, bins[axis][b].max);
+				accCount += bins[axis][b].count;
+				leftArea[b] = surfaceArea(accMin, accMax);
+				leftCount[b] = accCount;
+			}
+
+			accMin = glm::vec3(FLT_MAX);
+			accMax = glm::vec3(-FLT_MAX);
+			accCount = 0;
+			for (uint32_t b = kBinCount - 1; b > 0; --b)
+			{
+				accMin = glm::min(accMin, bins[axis][b].min);
+				accMax = glm::max(accMax, bins[axis][b].max);
+				accCount += bins[axis][b].count;
+
+				const uint32_t split = b - 1;  // split 이하 구간이 왼쪽
+				if (leftCount[split] == 0 || accCount == 0)
+				{
+					continue;
+				}
+				const float cost = leftArea[split] * leftCount[split] + surfaceArea(accMin, accMax) * accCount;
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplit = split;
+				}
+			}
+		}
+
+		const Node& node = nodes_[nodeIndex];
+		const float parentArea = surfaceArea(node.min, node.max);
+		const float leafCost = static_cast<float>(count);
+		const bool splitFound = bestAxis >= 0 && parentArea > 0.0f;
+		const float splitCost = splitFound ? kTraversalCost + bestCost / parentArea : FLT_MAX;
+		if (splitCost >= leafCost && count <= kMaxLeafSize)
+		{
+			return;
+		}
+
+		BuildTask leftTask;
+		BuildTask rightTask;
+		Node leftNode{ glm::vec3(FLT_MAX), first, glm::vec3(-FLT_MAX), 0 };
+		Node rightNode{ glm::vec3(FLT_MAX), 0, glm::vec3(-FLT_MAX), 0 };
+		leftTask.centroidMin = rightTask.centroidMin = glm::vec3(FLT_MAX);
+		leftTask.centroidMax = rightTask.centroidMax = glm::vec3(-FLT_MAX);
+
+		if (splitFound)
+		{
+			uint32_t i = first;
+			uint32_t j = first + count;
+			while (i < j)
+			{
+				if (binIndex(centroids_[i], bestAxis) <= bestSplit)
+				{
+					++i;
+				}
+				else
+				{
+					--j;
+					std::swap(items_[i], items_[j]);
+					std::swap(bounds_[i], bounds_[j]);
+					std::swap(slotItems_[i], slotItems_[j]);
+					std::swap(centroids_[i], centroids_[j]);
+				}
+			}
+			leftNode.count = i - first;
+
+			for (uint32_t b = 0; b < kBinCount; ++b)
+			{
+				const Bin& bin = bins[bestAxis][b];
+				Node& child = b <= bestSplit ? leftNode : rightNode;
+				BuildTask& childTask = b <= bestSplit ? leftTask : rightTask;
+				child.min = glm::min(child.min, bin.min);
+				child.max = glm::max(child.max, bin.max);
+				childTask.centroidMin = glm::min(childTask.centroidMin, bin.centroidMin);
+				childTask.centroidMax = glm::max(childTask.centroidMax, bin.centroidMax);
+			}
+		}
+		else
+		{
+			// 중심이 모두 겹치는 등 나눌 축이 없으면 순서대로 반씩
+			leftNode.count = count / 2;
+			for (uint32_t i = first; i < first + count; ++i)
+			{
+				const bool left = i < first + leftNode.count;
+				Node& child = left ? leftNode : rightNode;
+				BuildTask& childTask = left ? leftTask : rightTask;
+				child.min = glm::min(child.min, bounds_[i].min);
+				child.max = glm::max(child.max, bounds_[i].max);
+				childTask.centroidMin = glm::min(childTask.centroidMin, centroids_[i]);
+				childTask.centroidMax = glm::max(childTask.centroidMax, centroids_[i]);
+			}
+		}
+		rightNode.first = first + leftNode.count;
+		rightNode.count = count - leftNode.count;
+
+		const uint32_t left = static_cast<uint32_t>(nodes_.size());
+		nodes_.push_back(leftNode);
+		nodes_.push_back(rightNode);
+		parents_.push_back(nodeIndex);
+		parents_.push_back(nodeIndex);
+		subtreeFirst_.push_back(leftNode.first);
+		subtreeFirst_.push_back(rightNode.first);
+		subtreeCount_.push_back(leftNode.count);
+		subtreeCount_.push_back(rightNode.count);
+
+		nodes_[nodeIndex].first = left;
+		nodes_[nodeIndex].count = 0;
+
+		leftTask.node = left;
+		rightTask.node = left + 1;
+		stack.push_back(leftTask);
+		stack.push_back(rightTask);
+	}
+
+	// ========================================
+	// Refit
+	// ========================================
+
+	void RHISceneBVH::refit(const std::vector<uint32_t>& dirtySlots)
+	{
+		for (uint32_t slot : dirtySlots)
+		{
+			bounds_[slot] = itemBounds_[slotItems_[slot]];
+		}
+
+		for (uint32_t slot : dirtySlots)
+		{
+			// 잎부터 부모 방향으로, 합집합이 그대로인 지점에서 멈춤
+			uint32_t nodeIndex = slotLeaves_[slot];
+			while (nodeIndex != kInvalidNode)
+			{
+				Node& node = nodes_[nodeIndex];
+				glm::vec3 newMin(FLT_MAX), newMax(-FLT_MAX);
+				if (node.count > 0)
+				{
+					for (uint32_t i = node.first; i < node.first + node.count; ++i)
+					{
+						newMin = glm::min(newMin, bounds_[i].min);
+						newMax = glm::max(newMax, bounds_[i].max);
+					}
+				}
+				else
+				{
+					const Node& leftChild = nodes_[node.first];
+					const Node& rightChild = nodes_[node.first + 1];
+					newMin = glm::min(leftChild.min, rightChild.min);
+					newMax = glm::max(leftChild.max, rightChild.max);
+				}
+
+				if (newMin == node.min && newMax == node.max)
+				{
+					break;
+				}
+				node.min = newMin;
+				node.max = newMax;
+				nodeIndex = parents_[nodeIndex];
+			}
+		}
+	}
+
+	void RHISceneBVH::refitAll()
+	{
+		for (uint32_t slot = 0; slot < bounds_.size(); ++slot)
+		{
+			bounds_[slot] = itemBounds_[slotItems_[slot]];
+		}
+
+		for (size_t n = nodes_.size(); n-- > 0;)
+		{
+			Node& node = nodes_[n];
+			if (node.count > 0)
+			{
+				node.min = glm::vec3(FLT_MAX);
+				node.max = glm::vec3(-FLT_MAX);
+				for (uint32_t i = node.first; i < node.first + node.count; ++i)
+				{
+					node.min = glm::min(node.min, bounds_[i].min);
+					node.max = glm::max(node.max, bounds_[i].max);
+				}
+			}
+			else
+			{
+				node.min = glm::min(nodes_[node.first].min, nodes_[node.first + 1].min);
+				node.max = glm::max(nodes_[node.first].max, nodes_[node.first + 1].max);
+			}
+		}
+	}
+
+	float RHISceneBVH::computeCost() const
+	{
+		if (nodes_.empty())
+		{
+			return 0.0f;
+		}
+
+		const float rootArea = surfaceArea(nodes_[0].min, nodes_[0].max);
+		if (rootArea <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		float cost = 0.0f;
+		for (const Node& node : nodes_)
+		{
+			const float area = surfaceArea(node.min, node.max);
+			cost += node.count > 0 ? area * node.count : area * kTraversalCost;
+		}
+		return cost / rootArea;
+	}
+
+	// ========================================
+	// 쿼리
+	// ========================================
+
+	void RHISceneBVH::emitSubtree(uint32_t nodeIndex, std::vector<RHISpatialItem>& out) const
+	{
+		const uint32_t first = subtreeFirst_[nodeIndex];
+		const uint32_t end = first + subtreeCount_[nodeIndex];
+		for (uint32_t slot = first; slot < end; ++slot)
+		{
+			if (!isEmpty(bounds_[slot].min, bounds_[slot].max))
+			{
+				out.push_back(items_[slot]);
+			}
+		}
+	}
+
+	uint32_t RHISceneBVH::queryFrustum(const RHIViewFrustum& frustum, std::vector<RHISpatialItem>& out) const
+	{
+		if (nodes_.empty())
+		{
+			return 0;
+		}
+
+		FrustumPlanes planes;
+		for (uint32_t p = 0; p < 6; ++p)
+		{
+			const Plane& plane = frustum.getPlane(static_cast<RHIViewFrustum::PlaneIndex>(p));
+			planes.normal[p] = plane.normal;
+			planes.absNormal[p] = glm::abs(plane.normal);
+			planes.distance[p] = plane.distance;
+		}
+
+		const size_t startSize = out.size();
+
+		// (노드, 아직 테스트해야 하는 평면 마스크)
+		std::vector<std::pair<uint32_t, uint32_t>> stack;
+		stack.reserve(64);
+		stack.emplace_back(0u, 0x3Fu);
+		while (!stack.empty())
+		{
+			auto [nodeIndex, mask] = stack.back();
+			stack.pop_back();
+
+			const Node& node = nodes_[nodeIndex];
+			const PlaneResult result = testPlanes(planes, node.min, node.max, mask);
+			if (result == PlaneResult::Outside)
+			{
+				continue;
+			}
+			if (result == PlaneResult::Inside)
+			{
+				emitSubtree(nodeIndex, out);
+				continue;
+			}
+
+			if (node.count > 0)
+			{
+				for (uint32_t slot = node.first; slot < node.first + node.count; ++slot)
+				{
+					uint32_t itemMask = mask;
+					if (testPlanes(planes, bounds_[slot].min, bounds_[slot].max, itemMask) != PlaneResult::Outside)
+					{
+						out.push_back(items_[slot]);
+					}
+				}
+			}
+			else
+			{
+				stack.emplace_back(node.first, mask);
+				stack.emplace_back(node.first + 1, mask);
+			}
+		}
+
+		return static_cast<uint32_t>(out.size() - startSize);
+	}
+
+	uint32_t RHISceneBVH::queryBox(const AABB& box, std::vector<RHISpatialItem>& out) const
+	{
+		if (nodes_.empty())
+		{
+			return 0;
+		}
+
+		const size_t startSize = out.size();
+
+		std::vector<uint32_t> stack;
+		stack.reserve(64);
+		stack.push_back(0);
+		while (!stack.empty())
+		{
+			const Node& node = nodes_[stack.back()];
+			stack.pop_back();
+
+			if (!overlaps(node.min, node.max, box.min, box.max))
+			{
+				continue;
+			}
+
+			if (node.count > 0)
+			{
+				for (uint32_t slot = node.first; slot < node.first + node.count; ++slot)
+				{
+					if (overlaps(bounds_[slot].min, bounds_[slot].max, box.min, box.max))
+					{
+						out.push_back(items_[slot]);
+					}
+				}
+			}
+			else
+			{
+				stack.push_back(node.first);
+				stack.push_back(node.first + 1);
+			}
+		}
+
+		return static_cast<uint32_t>(out.size() - startSize);
+	}
+
+	uint32_t RHISceneBVH::querySphere(const glm::vec3& center, float radius, std::vector<RHISpatialItem>& out) const
+	{
+		if (nodes_.empty())
+		{
+			return 0;
+		}
+
+		const size_t startSize = out.size();
+		const float radiusSquared = radius * radius;
+
+		std::vector<uint32_t> stack;
+		stack.reserve(64);
+		stack.push_back(0);
+		while (!stack.empty())
+		{
+			const Node& node = nodes_[stack.back()];
+			stack.pop_back();
+
+			if (!overlapsSphere(node.min, node.max, center, radiusSquared))
+			{
+				continue;
+			}
+
+			if (node.count > 0)
+			{
+				for (uint32_t slot = node.first; slot < node.first + node.count; ++slot)
+				{
+					if (overlapsSphere(bounds_[slot].min, bounds_[slot].max, center, radiusSquared))
+					{
+						out.push_back(items_[slot]);
+					}
+				}
+			}
+			else
+			{
+				stack.push_back(node.first);
+				stack.push_back(node.first + 1);
+			}
+		}
+
+		return static_cast<uint32_t>(out.size() - startSize);
+	}
+
+	bool RHISceneBVH::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RHIRayHit& hit) const
+	{
+		if (nodes_.empty())
+		{
+			return false;
+		}
+
+		// 0 성분은 ±inf가 되어 슬랩 테스트가 그대로 동작
+		const glm::vec3 invDirection = 1.0f / direction;
+
+		float closest = maxDistance;
+		bool found = false;
+
+		float tRoot = 0.0f;
+		if (!intersectRay(nodes_[0].min, nodes_[0].max, origin, invDirection, closest, tRoot))
+		{
+			return false;
+		}
+
+		// (노드, 진입 거리): 이미 찾은 히트보다 먼 노드는 꺼낼 때 버림
+		std::vector<std::pair<uint32_t, float>> stack;
+		stack.reserve(64);
+		stack.emplace_back(0u, tRoot);
+		while (!stack.empty())
+		{
+			auto [nodeIndex, tEnter] = stack.back();
+			stack.pop_back();
+			if (tEnter > closest)
+			{
+				continue;
+			}
+
+			const Node& node = nodes_[nodeIndex];
+			if (node.count > 0)
+			{
+				for (uint32_t slot = node.first; slot < node.first + node.count; ++slot)
+				{
+					float t = 0.0f;
+					if (intersectRay(bounds_[slot].min, bounds_[slot].max, origin, invDirection, closest, t) && (!found || t < closest))
+					{
+						closest = t;
+						hit.item = items_[slot];
+						hit.distance = t;
+						found = true;
+					}
+				}
+				continue;
+			}
+
+			float tLeft = 0.0f;
+			float tRight = 0.0f;
+			const Node& leftChild = nodes_[node.first];
+			const Node& rightChild = nodes_[node.first + 1];
+			const bool hitLeft = intersectRay(leftChild.min, leftChild.max, origin, invDirection, closest, tLeft);
+			const bool hitRight = intersectRay(rightChild.min, rightChild.max, origin, invDirection, closest, tRight);
+
+			// 가까운 자식을 나중에 넣어 먼저 꺼냄
+			if (hitLeft && hitRight)
+			{
+				if (tLeft <= tRight)
+				{
+					stack.emplace_back(node.first + 1, tRight);
+					stack.emplace_back(node.first, tLeft);
+				}
+				else
+				{
+					stack.emplace_back(node.first, tLeft);
+					stack.emplace_back(node.first + 1, tRight);
+				}
+			}
+			else if (hitLeft)
+			{
+				stack.emplace_back(node.first, tLeft);
+			}
+			else if (hitRight)
+			{
+				stack.emplace_back(node.first + 1, tRight);
+			}
+		}
+
+		return found;
+	}
+
+} // namespace BinRenderer
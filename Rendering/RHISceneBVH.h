@@ -0,0 +1,149 @@
+﻿#pragma once
+
+#include "RHIViewFrustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace BinRenderer
+{
+	struct RHISceneNode;
+
+	/**
+	 * @brief 공간 쿼리 결과 (노드 인덱스 + 노드 안 메시 인덱스)
+	 */
+	struct RHISpatialItem
+	{
+		uint32_t nodeIndex = 0;
+		uint32_t meshIndex = 0;
+	};
+
+	/**
+	 * @brief 레이 피킹 결과 (메시 World AABB 기준, 삼각형 테스트는 호출자 몫)
+	 */
+	struct RHIRayHit
+	{
+		RHISpatialItem item;
+		float distance = 0.0f;  // origin에서 AABB 진입점까지 (origin이 안쪽이면 0)
+	};
+
+	/**
+	 * @brief 씬 메시 World AABB의 BVH (Binned SAH)
+	 *
+	 * - 잎은 메시 단위, 노드 구성이 바뀌면 다시 빌드하고 transform/가시성만 바뀌면 Refit
+	 * - Refit으로 SAH 비용이 빌드 직후보다 kRebuildCostRatio배 넘게 나빠지면 다시 빌드
+	 * - 숨긴 노드의 메시는 빈 AABB로 두어 어떤 쿼리에도 걸리지 않음
+	 * - 쿼리는 읽기 전용이라 update() 사이에는 여러 스레드에서 동시에 호출 가능
+	 */
+	class RHISceneBVH
+	{
+	public:
+		/**
+		 * @brief 노드 World AABB 캐시를 갱신하고 트리에 반영
+		 * @return 다시 빌드했으면 true
+		 */
+		bool update(std::vector<RHISceneNode>& nodes);
+
+		/**
+		 * @brief 씬 노드 없이 AABB 목록으로 직접 빌드 (아이템 i = { i, 0 }, 다음 update()는 다시 빌드)
+		 */
+		void build(const std::vector<AABB>& bounds);
+
+		/**
+		 * @brief build()로 만든 아이템 일부의 AABB 교체 후 Refit
+		 * @return 품질이 나빠져 다시 빌드했으면 true
+		 */
+		bool updateBounds(const std::vector<uint32_t>& items, const std::vector<AABB>& bounds);
+
+		void clear();
+
+		// ========================================
+		// 쿼리 (결과는 out 뒤에 추가, 반환값은 추가한 수)
+		// ========================================
+
+		// 절두체와 겹치는 메시 (평면 안쪽에 완전히 들어간 서브트리는 더 테스트하지 않음)
+		uint32_t queryFrustum(const RHIViewFrustum& frustum, std::vector<RHISpatialItem>& out) const;
+
+		// AABB와 겹치는 메시
+		uint32_t queryBox(const AABB& box, std::vector<RHISpatialItem>& out) const;
+
+		// 구와 겹치는 메시 (포인트/스폿 라이트 컬링)
+		uint32_t querySphere(const glm::vec3& center, float radius, std::vector<RHISpatialItem>& out) const;
+
+		/**
+		 * @brief 가장 가까운 메시 AABB 찾기 (가까운 자식부터 순회, 더 먼 노드는 건너뜀)
+		 * @param direction 정규화하지 않아도 됨 (distance는 direction 길이 단위)
+		 */
+		bool raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RHIRayHit& hit) const;
+
+		// ========================================
+		// 통계
+		// ========================================
+		uint32_t getItemCount() const { return static_cast<uint32_t>(items_.size()); }
+		uint32_t getNodeCount() const { return static_cast<uint32_t>(nodes_.size()); }
+		uint32_t getBuildCount() const { return buildCount_; }
+
+		// 루트 표면적 대비 SAH 비용 (트리 품질, 낮을수록 좋음)
+		float computeCost() const;
+
+	private:
+		// 32바이트: count > 0이면 잎 (first = 잎 배열 시작), 아니면 first = 왼쪽 자식 (오른쪽은 first + 1)
+		struct Node
+		{
+			glm::vec3 min;
+			uint32_t first;
+			glm::vec3 max;
+			uint32_t count;
+		};
+
+		// 노드 구성 변경 감지 + 아이템 위치
+		struct NodeState
+		{
+			const void* model = nullptr;
+			uint32_t firstItem = 0;  // 아이템 ID 시작 (노드 순서)
+			uint32_t meshCount = 0;
+			uint32_t boundsVersion = 0;
+			bool visible = true;
+		};
+
+		// 빌드 대기 노드 + 그 노드 아이템들의 중심 범위
+		struct BuildTask
+		{
+			uint32_t node = 0;
+			glm::vec3 centroidMin;
+			glm::vec3 centroidMax;
+		};
+
+		void rebuild();
+		void subdivide(const BuildTask& task, std::vector<BuildTask>& stack);
+		bool refitDirty(const std::vector<uint32_t>& dirtySlots);
+		void refit(const std::vector<uint32_t>& dirtySlots);
+		void refitAll();
+		void writeItemBounds(const NodeState& state, const RHISceneNode& node);
+		void emitSubtree(uint32_t nodeIndex, std::vector<RHISpatialItem>& out) const;
+
+		std::vector<NodeState> nodeStates_;
+
+		// 아이템 ID(노드 순서) 기준
+		std::vector<RHISpatialItem> itemRefs_;
+		std::vector<AABB> itemBounds_;
+		std::vector<uint32_t> itemSlots_;  // 아이템 ID → 잎 배열 위치
+
+		// 잎 배열 (트리 순서, 노드마다 연속 구간)
+		std::vector<RHISpatialItem> items_;
+		std::vector<AABB> bounds_;
+		std::vector<uint32_t> slotItems_;  // 잎 배열 위치 → 아이템 ID
+		std::vector<uint32_t> slotLeaves_; // 잎 배열 위치 → 잎 노드
+
+		std::vector<Node> nodes_;
+		std::vector<uint32_t> parents_;
+		std::vector<uint32_t> subtreeFirst_;  // 서브트리가 덮는 잎 배열 구간 (완전히 안쪽인 서브트리 출력용)
+		std::vector<uint32_t> subtreeCount_;
+		std::vector<glm::vec3> centroids_;    // 빌드 중에만 사용 (잎 배열 순서)
+
+		float buildCost_ = 0.0f;
+		uint32_t movedSinceCheck_ = 0;  // 마지막 비용 확인 이후 Refit한 아이템 수
+		uint32_t buildCount_ = 0;
+	};
+
+} // namespace BinRenderer
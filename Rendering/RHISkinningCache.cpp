@@ -0,0 +1,667 @@
+﻿#include "RHISkinningCache.h"
+#include "RHIBonePaletteArena.h"
+#include "RHIMesh.h"
+#include "../Core/Logger.h"
+#include "../Core/RHIModel.h"
+#include "../Core/RHIScene.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace BinRenderer
+{
+	namespace
+	{
+		constexpr uint32_t kWorkgroupSize = 64;      // skinning.comp local_size_x
+		constexpr uint32_t kMaxDispatchGroups = 65535;
+		constexpr uint32_t kMinJobCapacity = 64;
+		constexpr uint32_t kMinVertexCapacity = 4096;
+
+		/**
+		 * @brief 스키닝 셰이더 Push Constants (skinning.comp와 같은 배치)
+		 */
+		struct SkinningPushConstants
+		{
+			uint32_t jobCount = 0;
+			uint32_t vertexCount = 0;
+			uint32_t rowPitch = 0;  // 디스패치 한 줄의 스레드 수 (그룹 수 제한을 넘으면 Y로 나눔)
+			uint32_t padding = 0;
+		};
+
+		static_assert(sizeof(RHIVertex) % sizeof(uint32_t) == 0, "skinning.comp reads RHIVertex as uint words");
+
+		// packHalf2x16과 같은 배치 (low = 첫 번째 값)
+		uint32_t packHalfPair(float low, float high)
+		{
+			return static_cast<uint32_t>(packHalf(low)) | (static_cast<uint32_t>(packHalf(high)) << 16);
+		}
+
+		glm::vec2 unpackHalfPair(uint32_t bits)
+		{
+			return glm::vec2(unpackHalf(static_cast<half>(bits & 0xFFFFu)), unpackHalf(static_cast<half>(bits >> 16)));
+		}
+
+		std::vector<uint32_t> readShaderFile(const std::string& filename)
+		{
+			std::ifstream file(filename, std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+			{
+				return {};
+			}
+
+			size_t fileSize = static_cast<size_t>(file.tellg());
+			if (fileSize == 0 || fileSize % 4 != 0)
+			{
+				return {};
+			}
+
+			file.seekg(0);
+			std::vector<uint32_t> buffer(fileSize / sizeof(uint32_t));
+			file.read(reinterpret_cast<char*>(buffer.data()), fileSize);
+			return buffer;
+		}
+	}
+
+	glm::vec3 SkinnedVertex::getNormal() const
+	{
+		return glm::vec3(unpackHalfPair(normalXY), unpackHalfPair(normalZTangentX).x);
+	}
+
+	glm::vec3 SkinnedVertex::getTangent() const
+	{
+		return glm::vec3(unpackHalfPair(normalZTangentX).y, unpackHalfPair(tangentYZ));
+	}
+
+	glm::vec3 SkinnedVertex::getBitangent() const
+	{
+		return glm::vec3(unpackHalfPair(bitangentXY), unpackHalfPair(bitangentZ).x);
+	}
+
+	RHISkinningCache::RHISkinningCache(RHI* rhi, uint32_t frameCount)
+		: rhi_(rhi)
+		, frameCount_(std::max(frameCount, 1u))
+	{
+	}
+
+	RHISkinningCache::~RHISkinningCache()
+	{
+		shutdown();
+	}
+
+	bool RHISkinningCache::initialize()
+	{
+		if (!rhi_->getUploadManager())
+		{
+			printLog("[SkinningCache] Upload manager not available, skinning in vertex shaders");
+			return false;
+		}
+
+		auto code = readShaderFile("../../assets/shaders/skinning.comp.spv");
+		if (code.empty())
+		{
+			printLog("[SkinningCache] skinning.comp.spv not found, skinning in vertex shaders");
+			return false;
+		}
+
+		// Set 0: 원본 정점 / 본 팔레트 / 작업 테이블 / 출력 정점
+		RHIDescriptorSetLayoutCreateInfo layoutInfo{};
+		for (uint32_t binding = 0; binding < 4; ++binding)
+		{
+			RHIDescriptorSetLayoutBinding storageBinding{};
+			storageBinding.binding = binding;
+			storageBinding.descriptorType = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			storageBinding.descriptorCount = 1;
+			storageBinding.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+			layoutInfo.bindings.push_back(storageBinding);
+		}
+		descriptorLayout_ = rhi_->createDescriptorSetLayout(layoutInfo);
+		if (!descriptorLayout_.isValid())
+		{
+			printLog("[SkinningCache] ❌ Failed to create descriptor set layout");
+			shutdown();
+			return false;
+		}
+
+		RHIDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.maxSets = frameCount_;
+		RHIDescriptorPoolSize storagePoolSize{};
+		storagePoolSize.type = RHI_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		storagePoolSize.descriptorCount = frameCount_ * 4;
+		poolInfo.poolSizes.push_back(storagePoolSize);
+		descriptorPool_ = rhi_->createDescriptorPool(poolInfo);
+
+		frames_.resize(frameCount_);
+		for (auto& frame : frames_)
+		{
+			frame.descriptorSet = rhi_->allocateDescriptorSet(descriptorPool_, descriptorLayout_);
+			if (!frame.descriptorSet.isValid())
+			{
+				printLog("[SkinningCache] ❌ Failed to allocate descriptor sets");
+				shutdown();
+				return false;
+			}
+		}
+
+		RHIShaderCreateInfo shaderInfo{};
+		shaderInfo.stage = RHI_SHADER_STAGE_COMPUTE_BIT;
+		shaderInfo.name = "skinning.comp";
+		shaderInfo.entryPoint = "main";
+		shaderInfo.code = std::move(code);
+		shader_ = rhi_->createShader(shaderInfo);
+
+		RHIComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.computeShader = shader_;
+		pipelineInfo.descriptorSetLayouts.push_back(descriptorLayout_);
+
+		RHIPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = RHI_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(SkinningPushConstants);
+		pipelineInfo.pushConstantRanges.push_back(pushConstantRange);
+
+		pipeline_ = shader_.isValid() ? rhi_->createComputePipeline(pipelineInfo) : RHIPipelineHandle{};
+		if (!pipeline_.isValid())
+		{
+			printLog("[SkinningCache] ❌ Failed to create skinning pipeline");
+			shutdown();
+			return false;
+		}
+
+		printLog("[SkinningCache] Initialized ({} frame slots)", frameCount_);
+		return true;
+	}
+
+	void RHISkinningCache::shutdown()
+	{
+		for (auto& frame : frames_)
+		{
+			destroyFrameBuffers(frame);
+		}
+		frames_.clear();
+
+		retireSource();
+		releaseRetired(true);
+		sources_.clear();
+		clearAssignment();
+		nodeFirstJobs_.clear();
+
+		if (pipeline_.isValid())
+		{
+			rhi_->destroyPipeline(pipeline_);
+			pipeline_ = {};
+		}
+		if (shader_.isValid())
+		{
+			rhi_->destroyShader(shader_);
+			shader_ = {};
+		}
+
+		// 디스크립터 셋은 풀과 함께 해제
+		if (descriptorPool_.isValid())
+		{
+			rhi_->destroyDescriptorPool(descriptorPool_);
+			descriptorPool_ = {};
+		}
+		if (descriptorLayout_.isValid())
+		{
+			rhi_->destroyDescriptorSetLayout(descriptorLayout_);
+			descriptorLayout_ = {};
+		}
+	}
+
+	// ========================================
+	// CPU: 작업 배정
+	// ========================================
+
+	void RHISkinningCache::assign(const RHIScene& scene, const RHIBonePaletteArena& palettes)
+	{
+		clearAssignment();
+
+		const auto& nodes = scene.getNodes();
+		nodeFirstJobs_.assign(nodes.size(), kNoCache);
+		if (!isReady())
+		{
+			return;
+		}
+
+		// 팔레트를 받은 노드의 모델만 원본 정점에 넣음 (처음 나온 순서)
+		std::vector<const RHIModel*> models;
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			const RHIModel* model = nodes[i].model.get();
+			if (model && !model->getMeshes().empty() && palettes.getNodeOffset(i) != RHIBonePaletteArena::kNoPalette &&
+				std::find(models.begin(), models.end(), model) == models.end())
+			{
+				models.push_back(model);
+			}
+		}
+		if (models.empty())
+		{
+			return;
+		}
+
+		bool sourceChanged = models.size() != sources_.size();
+		for (size_t i = 0; !sourceChanged && i < models.size(); ++i)
+		{
+			sourceChanged = sources_[i].model != models[i] ||
+				sources_[i].meshVertexBases.size() != models[i]->getMeshes().size();
+		}
+		if (sourceChanged && !rebuildSource(models))
+		{
+			return;
+		}
+
+		// 같은 팔레트 + 같은 모델이면 스키닝 결과가 같으므로 출력 구간을 공유
+		for (size_t i = 0; i < nodes.size(); ++i)
+		{
+			const RHIModel* model = nodes[i].model.get();
+			const uint32_t boneOffset = palettes.getNodeOffset(i);
+			if (!model || model->getMeshes().empty() || boneOffset == RHIBonePaletteArena::kNoPalette)
+			{
+				continue;
+			}
+
+			auto [it, inserted] = groups_.try_emplace({ boneOffset, model }, static_cast<uint32_t>(jobs_.size()));
+			if (inserted)
+			{
+				const SourceModel* source = findSource(model);
+				const auto& meshes = model->getMeshes();
+				for (size_t m = 0; m < meshes.size(); ++m)
+				{
+					const uint32_t vertexCount = meshes[m]->getVertexCount();
+					jobs_.push_back({ source->meshVertexBases[m], vertexCount_, vertexCount, boneOffset });
+					jobNodes_.push_back(static_cast<uint32_t>(i));
+					vertexCount_ += vertexCount;
+				}
+			}
+			nodeFirstJobs_[i] = it->second;
+		}
+	}
+
+	void RHISkinningCache::clearAssignment()
+	{
+		jobs_.clear();
+		jobNodes_.clear();
+		groups_.clear();
+		vertexCount_ = 0;
+	}
+
+	uint32_t RHISkinningCache::getNodeVertexBase(size_t nodeIndex) const
+	{
+		return getSkinnedVertexBase(nodeIndex, 0);
+	}
+
+	uint32_t RHISkinningCache::getSkinnedVertexBase(size_t nodeIndex, size_t meshIndex) const
+	{
+		if (nodeIndex >= nodeFirstJobs_.size() || nodeFirstJobs_[nodeIndex] == kNoCache)
+		{
+			return kNoCache;
+		}
+
+		const size_t job = nodeFirstJobs_[nodeIndex] + meshIndex;
+		return job < jobs_.size() ? jobs_[job].dstVertexBase : kNoCache;
+	}
+
+	bool RHISkinningCache::rebuildSource(const std::vector<const RHIModel*>& models)
+	{
+		retireSource();
+		sources_.clear();
+
+		uint64_t vertexCount = 0;
+		for (const RHIModel* model : models)
+		{
+			for (const auto& mesh : model->getMeshes())
+			{
+				vertexCount += mesh->getVertexCount();
+			}
+		}
+
+		if (vertexCount == 0 || vertexCount > UINT32_MAX / 2)
+		{
+			return false;
+		}
+
+		RHIBufferCreateInfo sourceInfo{};
+		sourceInfo.size = vertexCount * sizeof(RHIVertex);
+		sourceInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT | RHI_BUFFER_USAGE_TRANSFER_DST_BIT;
+		sourceInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		sourceBuffer_ = rhi_->createBuffer(sourceInfo);
+		if (!sourceBuffer_.isValid())
+		{
+			printLog("[SkinningCache] ❌ Failed to create source vertex buffer");
+			return false;
+		}
+
+		// 메시 정점을 이어 붙여 업로드 (복사는 다음 beginFrame에서 프레임보다 먼저 실행)
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+		uint32_t baseVertex = 0;
+		for (const RHIModel* model : models)
+		{
+			SourceModel& source = sources_.emplace_back();
+			source.model = model;
+
+			for (const auto& mesh : model->getMeshes())
+			{
+				source.meshVertexBases.push_back(baseVertex);
+
+				const auto& vertices = mesh->getVertices();
+				if (!vertices.empty())
+				{
+					sourceTicket_ = uploadManager->uploadBuffer(sourceBuffer_, vertices.data(),
+						vertices.size() * sizeof(RHIVertex), static_cast<RHIDeviceSize>(baseVertex) * sizeof(RHIVertex));
+				}
+				baseVertex += mesh->getVertexCount();
+			}
+		}
+
+		if (!sourceTicket_.isValid())
+		{
+			printLog("[SkinningCache] ❌ Failed to upload source vertices");
+			sources_.clear();
+			retireSource();
+			return false;
+		}
+
+		sourceSize_ = sourceInfo.size;
+		sourceGeneration_++;
+
+		printLog("[SkinningCache] Source vertices: {} skinned models, {} vertices", models.size(), vertexCount);
+		return true;
+	}
+
+	const RHISkinningCache::SourceModel* RHISkinningCache::findSource(const RHIModel* model) const
+	{
+		for (const auto& source : sources_)
+		{
+			if (source.model == model)
+			{
+				return &source;
+			}
+		}
+		return nullptr;
+	}
+
+	void RHISkinningCache::retireSource()
+	{
+		// 이전 프레임들이 아직 스키닝하고 있을 수 있으므로 frameCount_ 프레임 뒤에 해제
+		if (sourceBuffer_.isValid())
+		{
+			retired_.push_back({ sourceBuffer_, sourceTicket_, frameCounter_ });
+			sourceBuffer_ = {};
+		}
+		sourceTicket_ = {};
+		sourceSize_ = 0;
+	}
+
+	void RHISkinningCache::releaseRetired(bool force)
+	{
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+
+		auto it = retired_.begin();
+		while (it != retired_.end())
+		{
+			if (!force && frameCounter_ < it->retireFrame + frameCount_)
+			{
+				++it;
+				continue;
+			}
+
+			if (uploadManager && it->ticket.isValid())
+			{
+				uploadManager->deferDestroy(it->buffer, it->ticket);
+			}
+			else
+			{
+				rhi_->destroyBuffer(it->buffer);
+			}
+			it = retired_.erase(it);
+		}
+	}
+
+	// ========================================
+	// GPU: 프레임 슬롯 갱신 + 스키닝 기록
+	// ========================================
+
+	bool RHISkinningCache::prepareFrame(const RHIBonePaletteArena& palettes)
+	{
+		if (!isReady())
+		{
+			return true;
+		}
+
+		frameCounter_++;
+		releaseRetired(false);
+
+		FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		frame.ready = false;
+
+		const uint32_t jobCount = getJobCount();
+		if (jobCount == 0 || !sourceBuffer_.isValid())
+		{
+			return true;
+		}
+
+		const RHIBufferHandle paletteBuffer = palettes.getBuffer();
+		if (!paletteBuffer.isValid() || !ensureCapacity(frame, jobCount, vertexCount_))
+		{
+			std::fill(nodeFirstJobs_.begin(), nodeFirstJobs_.end(), kNoCache);
+			return false;
+		}
+
+		// 팔레트 업로드에 실패했으면 오프셋이 kNoPalette로 바뀌어 있으므로 대표 노드에서 다시 읽음
+		for (uint32_t j = 0; j < jobCount; ++j)
+		{
+			frame.mappedJobs[j] = jobs_[j];
+			frame.mappedJobs[j].boneOffset = palettes.getNodeOffset(jobNodes_[j]);
+		}
+		rhi_->flushBuffer(frame.jobBuffer, 0, static_cast<RHIDeviceSize>(jobCount) * sizeof(Job));
+
+		// 원본/팔레트 버퍼는 다시 만들어질 때만 다시 연결 (이 셋을 쓰던 프레임은 이미 끝난 상태)
+		if (frame.sourceGeneration != sourceGeneration_)
+		{
+			rhi_->updateDescriptorSet(frame.descriptorSet, 0, sourceBuffer_, 0, sourceSize_);
+			frame.sourceGeneration = sourceGeneration_;
+		}
+		if (frame.boundPalette != paletteBuffer)
+		{
+			rhi_->updateDescriptorSet(frame.descriptorSet, 1, paletteBuffer, 0, palettes.getBufferSize());
+			frame.boundPalette = paletteBuffer;
+		}
+
+		frame.ready = true;
+		return true;
+	}
+
+	void RHISkinningCache::recordSkinning()
+	{
+		if (!isReady() || vertexCount_ == 0)
+		{
+			return;
+		}
+
+		const FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		if (!frame.ready)
+		{
+			return;
+		}
+
+		const uint32_t groupCount = (vertexCount_ + kWorkgroupSize - 1) / kWorkgroupSize;
+		const uint32_t groupCountX = std::min(groupCount, kMaxDispatchGroups);
+		const uint32_t groupCountY = (groupCount + groupCountX - 1) / groupCountX;
+
+		SkinningPushConstants pushConstants{};
+		pushConstants.jobCount = getJobCount();
+		pushConstants.vertexCount = vertexCount_;
+		pushConstants.rowPitch = groupCountX * kWorkgroupSize;
+
+		rhi_->cmdBindPipeline(pipeline_);
+		rhi_->cmdBindDescriptorSets(pipeline_, 0, &frame.descriptorSet, 1);
+		rhi_->cmdPushConstants(pipeline_, RHI_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants), &pushConstants);
+		rhi_->cmdDispatch(groupCountX, groupCountY);
+	}
+
+	RHIBufferHandle RHISkinningCache::getOutputBuffer() const
+	{
+		return frames_.empty() ? RHIBufferHandle{} : frames_[rhi_->getCurrentFrameIndex() % frames_.size()].outputBuffer;
+	}
+
+	RHIDeviceSize RHISkinningCache::getOutputBufferSize() const
+	{
+		if (frames_.empty())
+		{
+			return 0;
+		}
+		const FrameResources& frame = frames_[rhi_->getCurrentFrameIndex() % frames_.size()];
+		return static_cast<RHIDeviceSize>(frame.vertexCapacity) * sizeof(SkinnedVertex);
+	}
+
+	bool RHISkinningCache::ensureCapacity(FrameResources& frame, uint32_t jobCount, uint32_t vertexCount)
+	{
+		// 이 슬롯의 이전 프레임은 이미 끝났으므로 바로 다시 만들 수 있음
+		// 작업 테이블은 매 프레임 전부 다시 쓰므로 프레임 선형 풀에서 매번 새로 할당 (슬롯이 다시 시작되면 회수)
+		if (frame.jobBuffer.isValid())
+		{
+			if (frame.mappedJobs)
+			{
+				rhi_->unmapBuffer(frame.jobBuffer);
+			}
+			rhi_->destroyBuffer(frame.jobBuffer);
+		}
+		frame.jobBuffer = {};
+		frame.mappedJobs = nullptr;
+
+		uint32_t capacity = std::max(frame.jobCapacity, kMinJobCapacity);
+		while (capacity < jobCount)
+		{
+			capacity *= 2;
+		}
+		frame.jobCapacity = 0;
+
+		// Coherent를 요구하지 않으므로 기록한 구간은 flushBuffer로 명시적으로 반영
+		RHIBufferCreateInfo jobInfo{};
+		jobInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(Job);
+		jobInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		jobInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+		jobInfo.allocationFlags = RHI_ALLOCATION_FRAME_TRANSIENT_BIT;
+		frame.jobBuffer = rhi_->createBuffer(jobInfo);
+		frame.mappedJobs = frame.jobBuffer.isValid() ? static_cast<Job*>(rhi_->mapBuffer(frame.jobBuffer)) : nullptr;
+		if (!frame.mappedJobs)
+		{
+			printLog("[SkinningCache] ❌ Failed to create job buffer ({} jobs)", capacity);
+			destroyFrameBuffers(frame);
+			return false;
+		}
+
+		frame.jobCapacity = capacity;
+		rhi_->updateDescriptorSet(frame.descriptorSet, 2, frame.jobBuffer, 0, jobInfo.size);
+
+		if (frame.vertexCapacity < vertexCount)
+		{
+			if (frame.outputBuffer.isValid())
+			{
+				rhi_->destroyBuffer(frame.outputBuffer);
+			}
+			frame.outputBuffer = {};
+
+			uint32_t capacity = std::max(frame.vertexCapacity, kMinVertexCapacity);
+			while (capacity < vertexCount)
+			{
+				capacity *= 2;
+			}
+			frame.vertexCapacity = 0;
+
+			RHIBufferCreateInfo outputInfo{};
+			outputInfo.size = static_cast<RHIDeviceSize>(capacity) * sizeof(SkinnedVertex);
+			outputInfo.usage = RHI_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+			outputInfo.memoryProperties = RHI_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			frame.outputBuffer = rhi_->createBuffer(outputInfo);
+			if (!frame.outputBuffer.isValid())
+			{
+				printLog("[SkinningCache] ❌ Failed to create output buffer ({} vertices)", capacity);
+				destroyFrameBuffers(frame);
+				return false;
+			}
+
+			frame.vertexCapacity = capacity;
+			rhi_->updateDescriptorSet(frame.descriptorSet, 3, frame.outputBuffer, 0, outputInfo.size);
+		}
+		return true;
+	}
+
+	void RHISkinningCache::destroyFrameBuffers(FrameResources& frame)
+	{
+		if (frame.jobBuffer.isValid())
+		{
+			if (frame.mappedJobs)
+			{
+				rhi_->unmapBuffer(frame.jobBuffer);
+			}
+			rhi_->destroyBuffer(frame.jobBuffer);
+		}
+		if (frame.outputBuffer.isValid())
+		{
+			rhi_->destroyBuffer(frame.outputBuffer);
+		}
+
+		frame.jobBuffer = {};
+		frame.mappedJobs = nullptr;
+		frame.jobCapacity = 0;
+		frame.outputBuffer = {};
+		frame.vertexCapacity = 0;
+		frame.ready = false;
+	}
+
+	// ========================================
+	// CPU 참조 구현
+	// ========================================
+
+	SkinnedVertex RHISkinningCache::skinVertex(const RHIVertex& vertex, const glm::mat4* palette)
+	{
+		glm::vec3 position = vertex.getPosition();
+		glm::vec3 normal = vertex.getNormal();
+		glm::vec3 tangent = vertex.getTangent();
+		glm::vec3 bitangent = vertex.getBitangent();
+
+		// pbrForwardSkinned.vert의 팔레트 스키닝과 같은 계산 (유효한 본이 없으면 원본 그대로)
+		if (palette)
+		{
+			glm::vec4 animatedPosition(0.0f);
+			glm::vec3 animatedNormal(0.0f);
+			glm::vec3 animatedTangent(0.0f);
+			glm::vec3 animatedBitangent(0.0f);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				const int boneIndex = vertex.boneIndices[i];
+				const float weight = vertex.boneWeights[i];
+				if (boneIndex >= 0 && weight > 0.0f)
+				{
+					const glm::mat4& boneMatrix = palette[boneIndex];
+					const glm::mat3 boneNormalMatrix(boneMatrix);
+					animatedPosition += weight * (boneMatrix * glm::vec4(position, 1.0f));
+					animatedNormal += weight * (boneNormalMatrix * normal);
+					animatedTangent += weight * (boneNormalMatrix * tangent);
+					animatedBitangent += weight * (boneNormalMatrix * bitangent);
+				}
+			}
+
+			if (animatedPosition.w > 0.0f)
+			{
+				position = glm::vec3(animatedPosition);
+				normal = glm::normalize(animatedNormal);
+				tangent = glm::normalize(animatedTangent);
+				bitangent = glm::normalize(animatedBitangent);
+			}
+		}
+
+		SkinnedVertex skinned;
+		skinned.position = position;
+		skinned.normalXY = packHalfPair(normal.x, normal.y);
+		skinned.normalZTangentX = packHalfPair(normal.z, tangent.x);
+		skinned.tangentYZ = packHalfPair(tangent.y, tangent.z);
+		skinned.bitangentXY = packHalfPair(bitangent.x, bitangent.y);
+		skinned.bitangentZ = packHalfPair(bitangent.z, 0.0f);
+		return skinned;
+	}
+
+} // namespace BinRenderer
@@ -0,0 +1,179 @@
+﻿#pragma once
+
+#include "../RHI/Core/RHI.h"
+#include "../RHI/Resources/RHIUploadManager.h"
+#include "RHIVertex.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace BinRenderer
+{
+	class RHIScene;
+	class RHIModel;
+	class RHIBonePaletteArena;
+
+	/**
+	 * @brief 프리스키닝된 정점 하나 (std430, skinning.comp / pbrForward*.vert의 SkinnedVertex와 같은 배치)
+	 *
+	 * 위치는 float, 법선/탄젠트/바이탄젠트는 packHalf2x16 쌍 (원본 RHIVertex와 같은 정밀도)
+	 */
+	struct SkinnedVertex
+	{
+		glm::vec3 position = glm::vec3(0.0f);
+		uint32_t normalXY = 0;
+		uint32_t normalZTangentX = 0;
+		uint32_t tangentYZ = 0;
+		uint32_t bitangentXY = 0;
+		uint32_t bitangentZ = 0;  // 상위 16비트는 사용 안 함
+
+		glm::vec3 getNormal() const;
+		glm::vec3 getTangent() const;
+		glm::vec3 getBitangent() const;
+	};
+
+	static_assert(sizeof(SkinnedVertex) == 32, "SkinnedVertex must match the std430 SkinnedVertex layout");
+
+	/**
+	 * @brief 컴퓨트 프리스키닝 + 스킨드 정점 캐시
+	 *
+	 * - 스킨드 노드가 쓰는 모델의 원본 정점을 버퍼 하나로 합쳐 한 번만 업로드 (skinning.comp가 uint 15개씩 읽음)
+	 * - (본 팔레트, 모델) 쌍마다 메시별 작업을 두고 프레임 슬롯의 출력 버퍼에 구간을 배정
+	 *   (같은 Animation을 공유하는 노드는 스키닝 결과도 같으므로 한 번만 스키닝)
+	 * - SkinningPassRG가 프레임마다 디스패치 한 번으로 전체 작업을 스키닝, 이후 패스는 출력 버퍼를
+	 *   skinnedVertices[skinnedVertexBase + 메시 로컬 정점 인덱스]로 읽어 정적 지오메트리처럼 사용
+	 * - 노드의 메시 구간은 메시 순서대로 연속 (메시 m의 시작 = 노드 시작 + 앞 메시들의 정점 수)
+	 */
+	class RHISkinningCache
+	{
+	public:
+		// 캐시를 쓰지 않는 드로우의 정점 시작 (셰이더는 0xFFFFFFFF로 비교)
+		static constexpr uint32_t kNoCache = UINT32_MAX;
+
+		RHISkinningCache(RHI* rhi, uint32_t frameCount);
+		~RHISkinningCache();
+
+		/**
+		 * @brief 컴퓨트 파이프라인/디스크립터 생성
+		 * @return 업로드 관리자나 skinning.comp.spv가 없으면 false (정점 셰이더가 팔레트로 직접 스키닝)
+		 */
+		bool initialize();
+		void shutdown();
+
+		bool isReady() const { return pipeline_.isValid(); }
+
+		/**
+		 * @brief 스킨드 노드에 출력 구간 배정 (본 팔레트 assign 이후, 드로우 데이터를 만들기 전에 호출)
+		 *
+		 * 스킨드 모델 구성이 바뀌면 합친 원본 정점을 다시 업로드 (복사는 다음 beginFrame에서 실행)
+		 */
+		void assign(const RHIScene& scene, const RHIBonePaletteArena& palettes);
+
+		/**
+		 * @brief 현재 프레임 슬롯의 작업 테이블 기록 + 출력 버퍼 확보
+		 *
+		 * RHI::beginFrame 이후, 본 팔레트 upload 다음에 호출 (업로드에 실패한 팔레트는 바인드 포즈로 복사)
+		 * @return 버퍼를 키우지 못하면 false (이번 프레임은 모든 노드가 kNoCache)
+		 */
+		bool prepareFrame(const RHIBonePaletteArena& palettes);
+
+		/**
+		 * @brief 스키닝 디스패치 기록 (prepareFrame 이후, 렌더링 밖에서)
+		 *
+		 * 출력 버퍼 → 정점 셰이더 읽기 배리어는 기록하지 않음 (SkinningPassRG가 쓰기로 선언, RenderGraph가 생성)
+		 */
+		void recordSkinning();
+
+		uint32_t getNodeVertexBase(size_t nodeIndex) const;
+		uint32_t getSkinnedVertexBase(size_t nodeIndex, size_t meshIndex) const;
+
+		uint32_t getJobCount() const { return static_cast<uint32_t>(jobs_.size()); }
+		uint32_t getVertexCount() const { return vertexCount_; }
+
+		// 현재 프레임 슬롯의 출력 버퍼 (용량이 바뀌면 핸들도 바뀌므로 디스크립터는 핸들을 비교해 갱신)
+		RHIBufferHandle getOutputBuffer() const;
+		RHIDeviceSize getOutputBufferSize() const;
+
+		/**
+		 * @brief skinning.comp와 같은 계산의 CPU 참조 구현 (출력 검증용)
+		 * @param palette 이 정점을 그리는 노드의 본 팔레트 시작 (nullptr이면 원본 그대로)
+		 */
+		static SkinnedVertex skinVertex(const RHIVertex& vertex, const glm::mat4* palette);
+
+	private:
+		// 메시 하나의 스키닝 작업 (std430, skinning.comp의 SkinningJob)
+		struct Job
+		{
+			uint32_t srcVertexBase = 0;  // 합친 원본 정점 안에서 위치
+			uint32_t dstVertexBase = 0;  // 출력 버퍼 안에서 위치 (작업 순서대로 증가, 셰이더가 이진 탐색)
+			uint32_t vertexCount = 0;
+			uint32_t boneOffset = 0;
+		};
+
+		struct SourceModel
+		{
+			const RHIModel* model = nullptr;
+			std::vector<uint32_t> meshVertexBases;
+		};
+
+		// 프레임 슬롯별 리소스 (슬롯의 이전 프레임이 끝난 뒤에만 갱신)
+		struct FrameResources
+		{
+			RHIBufferHandle jobBuffer;  // Job[jobCapacity], 프레임 선형 풀 (블록이 영구 매핑)
+			Job* mappedJobs = nullptr;
+			uint32_t jobCapacity = 0;
+			RHIBufferHandle outputBuffer;  // SkinnedVertex[vertexCapacity]
+			uint32_t vertexCapacity = 0;
+
+			RHIDescriptorSetHandle descriptorSet;
+			RHIBufferHandle boundPalette;     // Binding 1에 연결된 본 팔레트 버퍼
+			uint64_t sourceGeneration = 0;    // Binding 0에 연결된 원본 정점
+			bool ready = false;               // 이번 프레임 작업 테이블/출력 버퍼가 준비됨
+		};
+
+		// 드로우하던 프레임이 끝난 뒤 해제할 원본 정점
+		struct RetiredBuffer
+		{
+			RHIBufferHandle buffer;
+			RHIUploadTicket ticket;
+			uint64_t retireFrame = 0;
+		};
+
+		bool rebuildSource(const std::vector<const RHIModel*>& models);
+		const SourceModel* findSource(const RHIModel* model) const;
+		bool ensureCapacity(FrameResources& frame, uint32_t jobCount, uint32_t vertexCount);
+		void destroyFrameBuffers(FrameResources& frame);
+		void retireSource();
+		void releaseRetired(bool force);
+		void clearAssignment();
+
+		RHI* rhi_;
+		uint32_t frameCount_;
+
+		// 합친 원본 정점 (스킨드 모델만)
+		std::vector<SourceModel> sources_;
+		RHIBufferHandle sourceBuffer_;
+		RHIDeviceSize sourceSize_ = 0;
+		RHIUploadTicket sourceTicket_;
+		uint64_t sourceGeneration_ = 0;
+
+		// 프레임마다 다시 배정 (할당은 재사용)
+		std::vector<Job> jobs_;
+		std::vector<uint32_t> jobNodes_;      // 작업별: 팔레트 오프셋을 다시 읽을 대표 노드
+		std::vector<uint32_t> nodeFirstJobs_; // 노드별: 첫 메시의 작업 인덱스 (kNoCache면 캐시 안 씀)
+		std::map<std::pair<uint32_t, const RHIModel*>, uint32_t> groups_;  // (팔레트 오프셋, 모델) → 첫 작업
+		uint32_t vertexCount_ = 0;
+
+		std::vector<FrameResources> frames_;
+		std::vector<RetiredBuffer> retired_;
+		uint64_t frameCounter_ = 0;
+
+		RHIShaderHandle shader_;
+		RHIPipelineHandle pipeline_;
+		RHIDescriptorSetLayoutHandle descriptorLayout_;
+		RHIDescriptorPoolHandle descriptorPool_;
+	};
+
+} // namespace BinRenderer
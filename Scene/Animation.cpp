@@ -1,4 +1,5 @@
 ﻿#include "Animation.h"
+#include "AnimationPoseCache.h"
 #include "../Core/Logger.h"
 
 #include <algorithm>
@@ -9,9 +10,51 @@
 
 namespace BinRenderer {
 
+namespace {
+
+vec3 interpolateValue(const vec3& a, const vec3& b, float factor)
+{
+    return glm::mix(a, b, factor);
+}
+
+quat interpolateValue(const quat& a, const quat& b, float factor)
+{
+    return glm::slerp(a, b, factor);
+}
+
+// 블렌딩용 정규화 선형 보간 (최단 경로)
+quat nlerp(const quat& a, const quat& b, float factor)
+{
+    const float sign = glm::dot(a, b) < 0.0f ? -1.0f : 1.0f;
+    const float w0 = 1.0f - factor;
+    const float w1 = factor * sign;
+    return glm::normalize(quat(a.w * w0 + b.w * w1, a.x * w0 + b.x * w1, a.y * w0 + b.y * w1, a.z * w0 + b.z * w1));
+}
+
+// 노드 변환을 TRS로 분해 (전단 없는 아핀 변환 가정, 음수 스케일은 x축에 반영)
+AnimationTransform decomposeTransform(const mat4& m)
+{
+    AnimationTransform result;
+    result.translation = vec3(m[3]);
+
+    mat3 basis(m);
+    result.scale = vec3(glm::length(basis[0]), glm::length(basis[1]), glm::length(basis[2]));
+    if (glm::determinant(basis) < 0.0f) {
+        result.scale.x = -result.scale.x;
+    }
+    for (int i = 0; i < 3; ++i) {
+        if (result.scale[i] != 0.0f) {
+            basis[i] /= result.scale[i];
+        }
+    }
+    result.rotation = glm::normalize(glm::quat_cast(basis));
+    return result;
+}
+
+} // namespace
+
 Animation::Animation()
-    : currentAnimationIndex_(0), currentTime_(0.0f), playbackSpeed_(1.0f), 
-  isPlaying_(false), isLooping_(true), globalInverseTransform_(1.0f)
+    : shared_(std::make_shared<SharedData>()), layers_(1)
 {
 }
 
@@ -27,9 +70,12 @@ void Animation::loadFromScene(const aiScene* scene)
     printLog("Loading animation data from scene...");
     printLog("  Animations found: {}", scene->mNumAnimations);
 
+    // 이전에 복사된 플레이어는 기존 데이터를 계속 사용하도록 새로 할당
+    shared_ = std::make_shared<SharedData>();
+
     // Store global inverse transform
     if (scene->mRootNode) {
- globalInverseTransform_ = 
+ shared_->globalInverseTransform = 
             glm::inverse(glm::transpose(glm::make_mat4(&scene->mRootNode->mTransformation.a1)));
     }
 
@@ -42,13 +88,24 @@ void Animation::loadFromScene(const aiScene* scene)
         processAnimations(scene);
     }
 
+    // 이름 기반 연결(채널 -> 노드 -> 본)을 인덱스로 한 번만 해석
+    resolveBindings();
+
+    // 기본 레이어에서 첫 클립 재생 준비
+    layers_.assign(1, Layer{});
+    currentAnimationIndex_ = 0;
+    if (!shared_->animations.empty()) {
+        layers_[0].clips.push_back(makePlayback(0, 1.0f, false));
+    }
+    poseDirty_ = true;
+
     // Initialize bone matrices
-    boneMatrices_.resize(bones_.size(), mat4(1.0f));
+    boneMatrices_.assign(shared_->bones.size(), mat4(1.0f));
 
     printLog("Animation loading complete:");
- printLog("  Animation clips: {}", animations_.size());
- printLog("  Bones: {}", bones_.size());
-    printLog("  Scene nodes: {}", nodeMapping_.size());
+ printLog("  Animation clips: {}", shared_->animations.size());
+ printLog("  Bones: {}", shared_->bones.size());
+    printLog("  Scene nodes: {}", shared_->nodeMapping.size());
 }
 
 void Animation::processBones(const aiScene* scene)
@@ -87,8 +144,8 @@ void Animation::processBones(const aiScene* scene)
     }
 
     // Create global bone list
-    bones_.clear();
-    boneMapping_.clear();
+    shared_->bones.clear();
+    shared_->boneMapping.clear();
 
     uint32_t globalBoneIndex = 0;
 for (const auto& [boneName, offsetMatrix] : boneOffsetMatrices) {
@@ -98,13 +155,13 @@ Bone bone;
         bone.offsetMatrix = offsetMatrix;
         bone.weights = boneWeights[boneName];
 
- bones_.push_back(bone);
-        boneMapping_[boneName] = globalBoneIndex;
+ shared_->bones.push_back(bone);
+        shared_->boneMapping[boneName] = globalBoneIndex;
 
    globalBoneIndex++;
     }
 
-    printLog("Created {} global bones", bones_.size());
+    printLog("Created {} global bones", shared_->bones.size());
 }
 
 void Animation::buildBoneHierarchy(const aiScene* scene)
@@ -113,7 +170,7 @@ void Animation::buildBoneHierarchy(const aiScene* scene)
         return;
 
     // Reset parent indices
-    for (auto& bone : bones_) {
+    for (auto& bone : shared_->bones) {
         bone.parentIndex = -1;
     }
 
@@ -123,7 +180,7 @@ void Animation::buildBoneHierarchy(const aiScene* scene)
         if (!node || !node->mParent)
   return nullptr;
 
-        if (boneMapping_.find(node->mParent->mName.C_Str()) != boneMapping_.end()) {
+        if (shared_->boneMapping.find(node->mParent->mName.C_Str()) != shared_->boneMapping.end()) {
             return node->mParent;
         }
 
@@ -138,16 +195,16 @@ return;
       string nodeName = node->mName.C_Str();
 
         // If this node represents a bone
-  if (boneMapping_.find(nodeName) != boneMapping_.end()) {
-   int boneIndex = boneMapping_[nodeName];
+  if (shared_->boneMapping.find(nodeName) != shared_->boneMapping.end()) {
+   int boneIndex = shared_->boneMapping[nodeName];
 
             // Find parent bone
     const aiNode* parentBone = findBoneParent(node);
       if (parentBone) {
      string parentName = parentBone->mName.C_Str();
- if (boneMapping_.find(parentName) != boneMapping_.end()) {
-     int parentIndex = boneMapping_[parentName];
-           bones_[boneIndex].parentIndex = parentIndex;
+ if (shared_->boneMapping.find(parentName) != shared_->boneMapping.end()) {
+     int parentIndex = shared_->boneMapping[parentName];
+           shared_->bones[boneIndex].parentIndex = parentIndex;
          }
    }
         }
@@ -163,23 +220,23 @@ return;
 
 void Animation::assignGlobalBoneIds()
 {
-  printLog("Global bone ID assignment complete: {} bones", bones_.size());
+  printLog("Global bone ID assignment complete: {} bones", shared_->bones.size());
 }
 
 int Animation::getGlobalBoneIndex(const string& boneName) const
 {
-    auto it = boneMapping_.find(boneName);
-    return (it != boneMapping_.end()) ? it->second : -1;
+    auto it = shared_->boneMapping.find(boneName);
+    return (it != shared_->boneMapping.end()) ? it->second : -1;
 }
 
 void Animation::processAnimations(const aiScene* scene)
 {
-    animations_.resize(scene->mNumAnimations);
+    shared_->animations.resize(scene->mNumAnimations);
 
   for (uint32_t i = 0; i < scene->mNumAnimations; ++i) {
         const aiAnimation* aiAnim = scene->mAnimations[i];
 
-        AnimationData& anim = animations_[i];
+        AnimationData& anim = shared_->animations[i];
         anim.name = aiAnim->mName.C_Str();
         anim.duration = aiAnim->mDuration;
         anim.ticksPerSecond = aiAnim->mTicksPerSecond != 0 ? aiAnim->mTicksPerSecond : 25.0;
@@ -218,6 +275,8 @@ void Animation::processAnimations(const aiScene* scene)
 
   anim.channels.push_back(std::move(channel));
         }
+
+        anim.keys.build(anim.channels);
     }
 }
 
@@ -228,71 +287,315 @@ void Animation::buildSceneGraph(const aiScene* scene)
 
     printLog("Building scene graph...");
     
-  sceneNodes_.clear();
-    nodeMapping_.clear();
+  shared_->nodes.clear();
+    shared_->nodeMapping.clear();
 
     // Build flat list of nodes
     std::function<void(const aiNode*, int)> traverseNode = 
       [&](const aiNode* aiNode, int parentIdx) {
-        int currentIdx = static_cast<int>(sceneNodes_.size());
+        int currentIdx = static_cast<int>(shared_->nodes.size());
         
     SceneNode node;
         node.name = aiNode->mName.C_Str();
       node.transformation = glm::transpose(glm::make_mat4(&aiNode->mTransformation.a1));
         node.parentIndex = parentIdx;
 
-        sceneNodes_.push_back(node);
-        nodeMapping_[node.name] = currentIdx;
+        shared_->nodes.push_back(node);
+        shared_->nodeMapping[node.name] = currentIdx;
 
    // Update parent's child list
         if (parentIdx >= 0) {
- sceneNodes_[parentIdx].childIndices.push_back(currentIdx);
+ shared_->nodes[parentIdx].childIndices.push_back(currentIdx);
         }
 
         // Process children
         for (uint32_t i = 0; i < aiNode->mNumChildren; ++i) {
             traverseNode(aiNode->mChildren[i], currentIdx);
         }
+
+        // 전위 순회이므로 자손은 모두 [currentIdx, 현재 크기) 구간에 있음
+        shared_->nodes[currentIdx].subtreeEnd = static_cast<int>(shared_->nodes.size());
     };
 
     traverseNode(scene->mRootNode, -1);
-    printLog("Scene graph built with {} nodes", sceneNodes_.size());
+    printLog("Scene graph built with {} nodes", shared_->nodes.size());
 }
 
-void Animation::updateAnimation(float deltaTime)
+void Animation::resolveBindings()
+{
+    SharedData& shared = *shared_;
+    for (auto& node : shared.nodes) {
+        auto it = shared.boneMapping.find(node.name);
+        node.boneIndex = (it != shared.boneMapping.end()) ? it->second : -1;
+    }
+
+    shared.bindPoses.resize(shared.nodes.size());
+    for (size_t i = 0; i < shared.nodes.size(); ++i) {
+        shared.bindPoses[i] = decomposeTransform(shared.nodes[i].transformation);
+    }
+
+    size_t maxChannels = 0;
+    for (auto& anim : shared.animations) {
+        anim.nodeChannels.assign(shared.nodes.size(), -1);
+        anim.channelNodes.assign(anim.channels.size(), -1);
+        for (size_t i = 0; i < anim.channels.size(); ++i) {
+            auto it = shared.nodeMapping.find(anim.channels[i].nodeName);
+            if (it != shared.nodeMapping.end()) {
+                anim.nodeChannels[it->second] = static_cast<int>(i);
+                anim.channelNodes[i] = it->second;
+            }
+        }
+        maxChannels = std::max(maxChannels, anim.channels.size());
+    }
+
+    channelTransforms_.assign(maxChannels, mat4(1.0f));
+    clipPose_.assign(maxChannels, AnimationTransform{});
+    globalTransforms_.assign(shared.nodes.size(), mat4(1.0f));
+}
+
+Animation::ClipPlayback Animation::makePlayback(uint32_t clipIndex, float weight, bool additive) const
+{
+    const AnimationData& anim = shared_->animations[clipIndex];
+
+    ClipPlayback playback;
+    playback.clip = clipIndex;
+    playback.weight = weight;
+    playback.targetWeight = weight;
+    playback.cursors.assign(anim.channels.size(), AnimationKeyCursor{});
+
+    // 가산 레이어는 첫 프레임 대비 변화량만 더하므로 기준 포즈를 미리 샘플링
+    if (additive) {
+        vector<AnimationKeyCursor> cursors(anim.channels.size());
+        playback.referencePose.resize(anim.channels.size());
+        AnimationKernels::sampleLocalPose(anim.keys, 0.0, cursors.data(), playback.referencePose.data());
+    }
+    return playback;
+}
+
+Animation::ClipPlayback* Animation::findPlayback(uint32_t layer, uint32_t clipIndex)
+{
+    for (auto& playback : layers_[layer].clips) {
+        if (playback.clip == clipIndex)
+            return &playback;
+    }
+    return nullptr;
+}
+
+const Animation::ClipPlayback* Animation::getPrimaryPlayback() const
+{
+    for (const auto& playback : layers_[0].clips) {
+        if (playback.clip == currentAnimationIndex_)
+            return &playback;
+    }
+    return nullptr;
+}
+
+bool Animation::isSingleClip() const
 {
-    if (!isPlaying_ || animations_.empty())
+    // 기본 레이어가 마스크 없이 클립 하나만 완전히 재생 중이고 다른 레이어 기여가 없을 때
+    const Layer& base = layers_[0];
+    if (base.clips.size() != 1 || base.weight != 1.0f || !base.nodeMask.empty())
+        return false;
+    if (base.clips[0].weight != 1.0f || base.clips[0].targetWeight != 1.0f)
+        return false;
+
+    for (size_t i = 1; i < layers_.size(); ++i) {
+        if (layers_[i].weight > 0.0f && !layers_[i].clips.empty())
+            return false;
+    }
+    return true;
+}
+
+uint32_t Animation::addLayer(AnimationBlendMode mode, float weight)
+{
+    Layer layer;
+    layer.mode = mode;
+    layer.weight = weight;
+    layers_.push_back(std::move(layer));
+    poseDirty_ = true;
+    return static_cast<uint32_t>(layers_.size() - 1);
+}
+
+void Animation::setLayerWeight(uint32_t layer, float weight)
+{
+    if (layer >= layers_.size())
         return;
 
-    currentTime_ += deltaTime * playbackSpeed_;
+    layers_[layer].weight = glm::clamp(weight, 0.0f, 1.0f);
+    poseDirty_ = true;
+}
+
+void Animation::setLayerMask(uint32_t layer, const string& rootNodeName, float weight)
+{
+    if (layer >= layers_.size())
+        return;
+
+    const int root = getNodeIndex(rootNodeName);
+    if (root < 0) {
+        printLog("Animation::setLayerMask - Unknown node '{}'", rootNodeName);
+        return;
+    }
+
+    vector<float>& mask = layers_[layer].nodeMask;
+    if (mask.empty()) {
+        mask.assign(shared_->nodes.size(), 0.0f);
+    }
+    std::fill(mask.begin() + root, mask.begin() + shared_->nodes[root].subtreeEnd, glm::clamp(weight, 0.0f, 1.0f));
+    poseDirty_ = true;
+}
+
+void Animation::clearLayerMask(uint32_t layer)
+{
+    if (layer >= layers_.size())
+        return;
+
+    layers_[layer].nodeMask.clear();
+    poseDirty_ = true;
+}
+
+void Animation::clearLayer(uint32_t layer)
+{
+    if (layer >= layers_.size())
+        return;
 
-    const AnimationData& currentAnim = animations_[currentAnimationIndex_];
-    double animationTime = currentTime_ * currentAnim.ticksPerSecond;
+    layers_[layer].clips.clear();
+    poseDirty_ = true;
+}
+
+void Animation::crossFade(uint32_t clipIndex, float fadeSeconds, uint32_t layer)
+{
+    if (clipIndex >= shared_->animations.size() || layer >= layers_.size())
+        return;
+
+    Layer& target = layers_[layer];
+    if (fadeSeconds <= 0.0f) {
+        // 즉시 전환: 이미 재생 중이면 시간을 이어서 사용
+        ClipPlayback* existing = findPlayback(layer, clipIndex);
+        ClipPlayback playback = existing ? std::move(*existing)
+            : makePlayback(clipIndex, 1.0f, target.mode == AnimationBlendMode::Additive);
+        playback.weight = playback.targetWeight = 1.0f;
+        playback.fadeRate = 0.0f;
+        target.clips.clear();
+        target.clips.push_back(std::move(playback));
+    } else {
+        for (auto& playback : target.clips) {
+            playback.targetWeight = 0.0f;
+            playback.fadeRate = 1.0f / fadeSeconds;
+        }
+
+        ClipPlayback* playback = findPlayback(layer, clipIndex);
+        if (!playback) {
+            target.clips.push_back(makePlayback(clipIndex, 0.0f, target.mode == AnimationBlendMode::Additive));
+            playback = &target.clips.back();
+        }
+        playback->targetWeight = 1.0f;
+        playback->fadeRate = 1.0f / fadeSeconds;
+    }
+
+    if (layer == 0) {
+        currentAnimationIndex_ = clipIndex;
+    }
+    poseDirty_ = true;
+}
+
+void Animation::setBlendWeight(uint32_t clipIndex, float weight, uint32_t layer)
+{
+    if (clipIndex >= shared_->animations.size() || layer >= layers_.size())
+        return;
+
+    Layer& target = layers_[layer];
+    ClipPlayback* playback = findPlayback(layer, clipIndex);
+    if (weight <= 0.0f) {
+        if (playback) {
+            target.clips.erase(target.clips.begin() + (playback - target.clips.data()));
+        }
+    } else {
+        if (!playback) {
+            target.clips.push_back(makePlayback(clipIndex, weight, target.mode == AnimationBlendMode::Additive));
+            playback = &target.clips.back();
+        }
+        playback->weight = playback->targetWeight = weight;
+        playback->fadeRate = 0.0f;
+    }
+    poseDirty_ = true;
+}
+
+void Animation::updateAnimation(float deltaTime)
+{
+    if (!isPlaying_ && !poseDirty_)
+        return;
 
-    // Handle looping
-    if (isLooping_ && animationTime > currentAnim.duration) {
-     currentTime_ = 0.0f;
-        animationTime = 0.0;
-  } else if (!isLooping_ && animationTime > currentAnim.duration) {
-        currentTime_ = static_cast<float>(currentAnim.duration / currentAnim.ticksPerSecond);
-        animationTime = currentAnim.duration;
-      isPlaying_ = false;
- }
+    advance(deltaTime);
 
     // Update bone transformations
-    updateBoneMatrices();
+    evaluate();
 }
 
-void Animation::updateBoneMatrices()
+void Animation::advance(float deltaTime)
 {
-    if (animations_.empty() || sceneNodes_.empty())
+    if (!isPlaying_ || shared_->animations.empty())
         return;
 
-    const AnimationData& currentAnim = animations_[currentAnimationIndex_];
-    double animationTime = currentTime_ * currentAnim.ticksPerSecond;
+    const float step = deltaTime * playbackSpeed_;
+    for (auto& layer : layers_) {
+        for (auto& playback : layer.clips) {
+            const float duration = shared_->animations[playback.clip].getDurationSeconds();
+            playback.time += step;
+
+            // Handle looping
+            if (playback.time > duration) {
+                if (isLooping_ && duration > 0.0f) {
+                    playback.time = std::fmod(playback.time, duration);
+                } else {
+                    playback.time = duration;
+                    if (&layer == &layers_[0] && playback.clip == currentAnimationIndex_) {
+                        isPlaying_ = false;
+                    }
+                }
+            }
+
+            // 크로스페이드 진행
+            if (playback.weight != playback.targetWeight) {
+                const float delta = playback.fadeRate * deltaTime;
+                playback.weight = playback.weight < playback.targetWeight
+                    ? std::min(playback.weight + delta, playback.targetWeight)
+                    : std::max(playback.weight - delta, playback.targetWeight);
+            }
+        }
 
-    // Traverse scene graph starting from root
-    calculateBoneTransforms(boneMatrices_, "", mat4(1.0f));
+        // 완전히 빠진 클립 제거
+        layer.clips.erase(std::remove_if(layer.clips.begin(), layer.clips.end(),
+            [](const ClipPlayback& playback) { return playback.targetWeight <= 0.0f && playback.weight <= 0.0f; }),
+            layer.clips.end());
+
+        if (!layer.clips.empty()) {
+            poseDirty_ = true;
+        }
+    }
+}
+
+void Animation::evaluate(AnimationPoseCache* cache)
+{
+    if (!poseDirty_ || shared_->nodes.empty())
+        return;
+
+    boneMatrices_.resize(shared_->bones.size(), mat4(1.0f));
+    poseDirty_ = false;
+
+    if (cache && isSingleClip()) {
+        // 같은 (스켈레톤, 클립, 틱)이면 결과가 같으므로 양자화한 시간으로 평가해 공유
+        ClipPlayback& playback = layers_[0].clips[0];
+        const int64_t tick = cache->quantize(playback.time);
+        if (cache->find(shared_.get(), playback.clip, tick, boneMatrices_))
+            return;
+
+        const double animationTime = cache->getTickTime(tick) * shared_->animations[playback.clip].ticksPerSecond;
+        evaluateNodes(boneMatrices_, 0, mat4(1.0f), playback, animationTime);
+        cache->store(shared_.get(), playback.clip, tick, boneMatrices_);
+        return;
+    }
+
+    evaluatePose(boneMatrices_, 0, mat4(1.0f));
 }
 
 void Animation::calculateBoneTransforms(vector<mat4>& transforms, 
@@ -300,47 +603,194 @@ void Animation::calculateBoneTransforms(vector<mat4>& transforms,
  const mat4& parentTransform)
 {
     // Start from root if nodeName is empty
-    int nodeIdx = nodeName.empty() ? 0 : (nodeMapping_.count(nodeName) ? nodeMapping_[nodeName] : -1);
-    
-    if (nodeIdx < 0)
+    int nodeIdx = nodeName.empty() ? 0 : getNodeIndex(nodeName);
+
+    if (nodeIdx < 0 || nodeIdx >= static_cast<int>(shared_->nodes.size()))
    return;
 
-    const SceneNode& node = sceneNodes_[nodeIdx];
+    if (transforms.size() < shared_->bones.size()) {
+        transforms.resize(shared_->bones.size(), mat4(1.0f));
+    }
+
+    evaluatePose(transforms, nodeIdx, parentTransform);
+}
 
-    // Get animated transformation
-    mat4 nodeTransform = getNodeTransformation(node.name, 
-        currentTime_ * animations_[currentAnimationIndex_].ticksPerSecond);
+void Animation::evaluatePose(vector<mat4>& transforms, int beginNode, const mat4& parentTransform)
+{
+    if (isSingleClip()) {
+        ClipPlayback& playback = layers_[0].clips[0];
+        const double animationTime = playback.time * shared_->animations[playback.clip].ticksPerSecond;
+        evaluateNodes(transforms, beginNode, parentTransform, playback, animationTime);
+    } else {
+        evaluateBlended(transforms, beginNode, parentTransform);
+    }
+}
 
-    // If no animation channel, use original transform
-    if (nodeTransform == mat4(1.0f)) {
-  nodeTransform = node.transformation;
+template <typename LocalTransform>
+void Animation::composeHierarchy(vector<mat4>& transforms, int beginNode, const mat4& parentTransform, LocalTransform localOf)
+{
+    const SharedData& shared = *shared_;
+
+    // globalInverse * global * offset에서 globalInverse를 루트에 미리 곱해 본마다 곱셈 한 번 절약
+    const mat4 rootTransform = shared.globalInverseTransform * parentTransform;
+
+    // 부모가 항상 앞에 있으므로 서브트리 구간을 한 번 순회하면 부모의 전역 변환이 이미 계산되어 있음
+    const int endNode = shared.nodes[beginNode].subtreeEnd;
+    for (int i = beginNode; i < endNode; ++i) {
+        const SceneNode& node = shared.nodes[i];
+
+        const mat4& parent = (i == beginNode) ? rootTransform : globalTransforms_[node.parentIndex];
+        AnimationKernels::multiply(parent, localOf(i), globalTransforms_[i]);
+
+        // If this is a bone, compute final transformation
+        if (node.boneIndex >= 0) {
+            AnimationKernels::multiply(globalTransforms_[i], shared.bones[node.boneIndex].offsetMatrix, transforms[node.boneIndex]);
+        }
+    }
+}
+
+void Animation::evaluateNodes(vector<mat4>& transforms, int beginNode, const mat4& parentTransform, ClipPlayback& playback, double animationTime)
+{
+    const AnimationData& anim = shared_->animations[playback.clip];
+
+    // 모든 채널을 한 번에 샘플링해 로컬 TRS 행렬로 조립
+    if (!anim.channels.empty()) {
+        AnimationKernels::sampleLocalTransforms(anim.keys, animationTime,
+            playback.cursors.data(), channelTransforms_.data());
+    }
+
+    // 채널이 없는 노드는 원래 변환 사용
+    composeHierarchy(transforms, beginNode, parentTransform, [&](int i) -> const mat4& {
+        const int channelIndex = anim.nodeChannels[i];
+        return channelIndex >= 0 ? channelTransforms_[channelIndex] : shared_->nodes[i].transformation;
+    });
+}
+
+void Animation::accumulateLayer(Layer& layer)
+{
+    const bool additive = layer.mode == AnimationBlendMode::Additive;
+    std::fill(accumulators_.begin(), accumulators_.end(), BlendAccumulator{ vec3(0.0f), vec4(0.0f), vec3(0.0f), 0.0f });
+
+    for (auto& playback : layer.clips) {
+        if (playback.weight <= 0.0f)
+            continue;
+
+        const AnimationData& anim = shared_->animations[playback.clip];
+        AnimationKernels::sampleLocalPose(anim.keys, playback.time * anim.ticksPerSecond,
+            playback.cursors.data(), clipPose_.data());
+
+        const float w = playback.weight;
+        for (size_t c = 0; c < anim.channels.size(); ++c) {
+            const int nodeIndex = anim.channelNodes[c];
+            if (nodeIndex < 0)
+                continue;
+
+            AnimationTransform sample = clipPose_[c];
+            if (additive) {
+                // 첫 프레임 대비 변화량 (로컬 공간)
+                const AnimationTransform& reference = playback.referencePose[c];
+                sample.translation -= reference.translation;
+                sample.rotation = glm::inverse(reference.rotation) * sample.rotation;
+                sample.scale = sample.scale / glm::max(reference.scale, vec3(1e-6f));
+            }
+
+            // 쿼터니언은 q와 -q가 같은 회전이므로 누적 방향(가산은 항등)과 같은 반구로 맞춘 뒤 합산
+            BlendAccumulator& acc = accumulators_[nodeIndex];
+            vec4 rotation(sample.rotation.x, sample.rotation.y, sample.rotation.z, sample.rotation.w);
+            const vec4 reference = additive || acc.weight == 0.0f ? vec4(0.0f, 0.0f, 0.0f, 1.0f) : acc.rotation;
+            if (glm::dot(reference, rotation) < 0.0f) {
+                rotation = rotation * -1.0f;
+            }
+
+            acc.translation += sample.translation * w;
+            acc.rotation += rotation * w;
+            acc.scale += sample.scale * w;
+            acc.weight += w;
+        }
     }
+}
 
-    mat4 globalTransform = parentTransform * nodeTransform;
+void Animation::evaluateBlended(vector<mat4>& transforms, int beginNode, const mat4& parentTransform)
+{
+    const SharedData& shared = *shared_;
+    const size_t nodeCount = shared.nodes.size();
+    blendPose_.assign(shared.bindPoses.begin(), shared.bindPoses.end());
+    nodeAnimated_.assign(nodeCount, 0);
+    accumulators_.resize(nodeCount);
+    localTransforms_.resize(nodeCount);
+
+    for (auto& layer : layers_) {
+        if (layer.weight <= 0.0f || layer.clips.empty())
+            continue;
 
-    // If this is a bone, compute final transformation
-    if (boneMapping_.count(node.name)) {
-        int boneIdx = boneMapping_[node.name];
-        if (boneIdx >= 0 && boneIdx < static_cast<int>(bones_.size())) {
-   transforms[boneIdx] = 
-             globalInverseTransform_ * globalTransform * bones_[boneIdx].offsetMatrix;
-     }
+        float totalWeight = 0.0f;
+        for (const auto& playback : layer.clips) {
+            totalWeight += std::max(playback.weight, 0.0f);
+        }
+        if (totalWeight <= 0.0f)
+            continue;
+
+        accumulateLayer(layer);
+
+        const bool additive = layer.mode == AnimationBlendMode::Additive;
+        for (size_t n = 0; n < nodeCount; ++n) {
+            const BlendAccumulator& acc = accumulators_[n];
+            const float beta = layer.weight * (layer.nodeMask.empty() ? 1.0f : layer.nodeMask[n]);
+            if (acc.weight <= 0.0f || beta <= 0.0f)
+                continue;
+
+            // 채널이 없는 클립의 가중치는 기본값(대체: 원래 변환, 가산: 변화 없음)으로 채워 레이어 안에서 정규화
+            const float missing = totalWeight - acc.weight;
+            const AnimationTransform& fill = shared.bindPoses[n];
+            AnimationTransform& pose = blendPose_[n];
+            if (additive) {
+                const vec3 translation = acc.translation / totalWeight;
+                const vec4 q = acc.rotation + vec4(0.0f, 0.0f, 0.0f, missing);
+                const quat delta = glm::normalize(quat(q.w, q.x, q.y, q.z));
+                const vec3 scale = (acc.scale + vec3(missing)) / totalWeight;
+
+                pose.translation += translation * beta;
+                pose.rotation = glm::normalize(pose.rotation * nlerp(quat(1.0f, 0.0f, 0.0f, 0.0f), delta, beta));
+                pose.scale *= glm::mix(vec3(1.0f), scale, beta);
+            } else {
+                vec4 q = acc.rotation;
+                const vec4 bind(fill.rotation.x, fill.rotation.y, fill.rotation.z, fill.rotation.w);
+                q += (glm::dot(q, bind) < 0.0f ? bind * -1.0f : bind) * missing;
+                const quat rotation = glm::normalize(quat(q.w, q.x, q.y, q.z));
+                const vec3 translation = (acc.translation + fill.translation * missing) / totalWeight;
+                const vec3 scale = (acc.scale + fill.scale * missing) / totalWeight;
+
+                pose.translation = glm::mix(pose.translation, translation, beta);
+                pose.rotation = nlerp(pose.rotation, rotation, beta);
+                pose.scale = glm::mix(pose.scale, scale, beta);
+            }
+            nodeAnimated_[n] = 1;
+        }
     }
 
-    // Process children
-    for (int childIdx : node.childIndices) {
-        if (childIdx >= 0 && childIdx < static_cast<int>(sceneNodes_.size())) {
-    calculateBoneTransforms(transforms, sceneNodes_[childIdx].name, globalTransform);
-     }
+    // 어떤 레이어도 건드리지 않은 노드는 원래 행렬을 그대로 사용 (분해/재조립 오차 없음)
+    for (size_t n = 0; n < nodeCount; ++n) {
+        if (nodeAnimated_[n]) {
+            AnimationKernels::compose(blendPose_[n], localTransforms_[n]);
+        }
     }
+
+    composeHierarchy(transforms, beginNode, parentTransform, [&](int i) -> const mat4& {
+        return nodeAnimated_[i] ? localTransforms_[i] : shared.nodes[i].transformation;
+    });
+}
+
+int Animation::getNodeIndex(const string& nodeName) const
+{
+    auto it = shared_->nodeMapping.find(nodeName);
+    return (it != shared_->nodeMapping.end()) ? it->second : -1;
 }
 
 mat4 Animation::getNodeTransformation(const string& nodeName, double time) const
 {
-    if (animations_.empty())
+    if (shared_->animations.empty())
         return mat4(1.0f);
 
-    const AnimationData& currentAnim = animations_[currentAnimationIndex_];
     const AnimationChannel* channel = findChannel(nodeName);
 
     if (!channel)
@@ -359,42 +809,70 @@ mat4 Animation::getNodeTransformation(const string& nodeName, double time) const
 
 const AnimationChannel* Animation::findChannel(const string& nodeName) const
 {
-    if (currentAnimationIndex_ >= animations_.size())
+    if (currentAnimationIndex_ >= shared_->animations.size())
         return nullptr;
 
-    const AnimationData& currentAnim = animations_[currentAnimationIndex_];
-    for (const auto& channel : currentAnim.channels) {
-      if (channel.nodeName == nodeName) {
- return &channel;
-        }
-    }
-    return nullptr;
+    const AnimationData& currentAnim = shared_->animations[currentAnimationIndex_];
+    const int nodeIdx = getNodeIndex(nodeName);
+    if (nodeIdx < 0 || nodeIdx >= static_cast<int>(currentAnim.nodeChannels.size()))
+        return nullptr;
+
+    const int channelIndex = currentAnim.nodeChannels[nodeIdx];
+    return channelIndex >= 0 ? &currentAnim.channels[channelIndex] : nullptr;
 }
 
 float Animation::getDuration() const
 {
-    if (animations_.empty())
+    if (shared_->animations.empty())
    return 0.0f;
-  const auto& currentAnim = animations_[currentAnimationIndex_];
+  const auto& currentAnim = shared_->animations[currentAnimationIndex_];
     return static_cast<float>(currentAnim.duration / currentAnim.ticksPerSecond);
 }
 
+float Animation::getCurrentTime() const
+{
+    const ClipPlayback* playback = getPrimaryPlayback();
+    return playback ? playback->time : 0.0f;
+}
+
 const string& Animation::getCurrentAnimationName() const
 {
     static const string empty = "";
-    if (animations_.empty())
+    if (shared_->animations.empty())
         return empty;
-    return animations_[currentAnimationIndex_].name;
+    return shared_->animations[currentAnimationIndex_].name;
 }
 
 void Animation::setAnimationIndex(uint32_t index)
 {
-    if (index < animations_.size()) {
+    if (index < shared_->animations.size()) {
+        // 기본 레이어를 이 클립 하나로 바꾸고 처음부터 재생
+        layers_[0].clips.clear();
+        layers_[0].clips.push_back(makePlayback(index, 1.0f, layers_[0].mode == AnimationBlendMode::Additive));
         currentAnimationIndex_ = index;
-        currentTime_ = 0.0f;
+        poseDirty_ = true;
     }
 }
 
+void Animation::stop()
+{
+    for (auto& layer : layers_) {
+        for (auto& playback : layer.clips) {
+            playback.time = 0.0f;
+        }
+    }
+    isPlaying_ = false;
+    poseDirty_ = true;
+}
+
+void Animation::setGlobalInverseTransform(const mat4& transform)
+{
+    // 같은 모델의 다른 플레이어와 포즈 캐시 키에 영향이 없도록 복사 후 수정
+    shared_ = std::make_shared<SharedData>(*shared_);
+    shared_->globalInverseTransform = transform;
+    poseDirty_ = true;
+}
+
 void Animation::setPlaybackSpeed(float speed)
 {
     playbackSpeed_ = speed;
@@ -408,71 +886,80 @@ void Animation::setLooping(bool loop)
 // AnimationChannel interpolation methods
 vec3 AnimationChannel::interpolatePosition(double time) const
 {
-    return interpolateKeys(positionKeys, time);
+    uint32_t cursor = 0;
+    return samplePosition(time, cursor);
 }
 
 quat AnimationChannel::interpolateRotation(double time) const
 {
-    if (rotationKeys.empty())
-        return quat(1.0f, 0.0f, 0.0f, 0.0f);
-    if (rotationKeys.size() == 1)
-        return rotationKeys[0].value;
-
-    // Find surrounding keyframes
-    uint32_t index = 0;
-    for (uint32_t i = 0; i < rotationKeys.size() - 1; ++i) {
-    if (time < rotationKeys[i + 1].time) {
-   index = i;
-            break;
-        }
-    }
-
-    if (index >= rotationKeys.size() - 1) {
-        return rotationKeys.back().value;
-    }
+    uint32_t cursor = 0;
+    return sampleRotation(time, cursor);
+}
 
-    const auto& key1 = rotationKeys[index];
-    const auto& key2 = rotationKeys[index + 1];
+vec3 AnimationChannel::interpolateScale(double time) const
+{
+    uint32_t cursor = 0;
+    return sampleScale(time, cursor);
+}
 
-    double deltaTime = key2.time - key1.time;
-    float factor = static_cast<float>((time - key1.time) / deltaTime);
+vec3 AnimationChannel::samplePosition(double time, uint32_t& cursor) const
+{
+    return interpolateKeys(positionKeys, time, cursor, vec3(0.0f));
+}
 
-    return glm::slerp(key1.value, key2.value, factor);
+quat AnimationChannel::sampleRotation(double time, uint32_t& cursor) const
+{
+    return interpolateKeys(rotationKeys, time, cursor, quat(1.0f, 0.0f, 0.0f, 0.0f));
 }
 
-vec3 AnimationChannel::interpolateScale(double time) const
+vec3 AnimationChannel::sampleScale(double time, uint32_t& cursor) const
 {
-    return interpolateKeys(scaleKeys, time);
+    return interpolateKeys(scaleKeys, time, cursor, vec3(1.0f));
 }
 
 template <typename T>
-T AnimationChannel::interpolateKeys(const vector<AnimationKey<T>>& keys, double time) const
+T AnimationChannel::interpolateKeys(const vector<AnimationKey<T>>& keys, double time, uint32_t& cursor, const T& defaultValue) const
 {
     if (keys.empty())
-        return T{};
+        return defaultValue;
     if (keys.size() == 1)
         return keys[0].value;
 
-    // Find surrounding keyframes
-    uint32_t index = 0;
-    for (uint32_t i = 0; i < keys.size() - 1; ++i) {
-        if (time < keys[i + 1].time) {
-        index = i;
-        break;
-        }
+    // 범위 밖은 첫/마지막 키로 고정
+    const uint32_t last = static_cast<uint32_t>(keys.size() - 1);
+    if (time <= keys[0].time) {
+        cursor = 0;
+        return keys[0].value;
+    }
+    if (time >= keys[last].time) {
+        cursor = last;
+        return keys[last].value;
     }
 
-  if (index >= keys.size() - 1) {
-  return keys.back().value;
+    // keys[cursor].time <= time < keys[cursor + 1].time 인 구간 찾기:
+    // 직전 구간이나 바로 다음 구간이면 그대로 사용하고, 되감기(루프)나 큰 건너뛰기만 이진 탐색
+    auto search = [&]() {
+        auto it = std::upper_bound(keys.begin(), keys.end(), time,
+            [](double t, const AnimationKey<T>& key) { return t < key.time; });
+        return static_cast<uint32_t>(it - keys.begin()) - 1;
+    };
+
+    if (cursor >= last || time < keys[cursor].time) {
+        cursor = search();
+    } else if (time >= keys[cursor + 1].time) {
+        ++cursor;
+        if (cursor >= last || time >= keys[cursor + 1].time) {
+            cursor = search();
+        }
     }
 
-    const auto& key1 = keys[index];
-    const auto& key2 = keys[index + 1];
+    const auto& key1 = keys[cursor];
+    const auto& key2 = keys[cursor + 1];
 
     double deltaTime = key2.time - key1.time;
     float factor = static_cast<float>((time - key1.time) / deltaTime);
 
-    return glm::mix(key1.value, key2.value, factor);
+    return interpolateValue(key1.value, key2.value, factor);
 }
 
 } // namespace BinRenderer
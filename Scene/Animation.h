@@ -12,12 +12,16 @@
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "AnimationKernels.h"
+
 // Forward declarations
 struct aiScene;
 struct aiNode;
 
 namespace BinRenderer {
 
+class AnimationPoseCache;
+
 using namespace std;
 using namespace glm;
 
@@ -55,9 +59,14 @@ struct AnimationChannel
     quat interpolateRotation(double time) const;
     vec3 interpolateScale(double time) const;
 
+    // 커서 기반 샘플링: cursor는 직전에 사용한 키 인덱스 (재생 중에는 앞으로만 이동하므로 분할 상환 O(1))
+    vec3 samplePosition(double time, uint32_t& cursor) const;
+    quat sampleRotation(double time, uint32_t& cursor) const;
+    vec3 sampleScale(double time, uint32_t& cursor) const;
+
 private:
     template <typename T>
-    T interpolateKeys(const vector<AnimationKey<T>>& keys, double time) const;
+    T interpolateKeys(const vector<AnimationKey<T>>& keys, double time, uint32_t& cursor, const T& defaultValue) const;
 };
 
 /**
@@ -81,10 +90,23 @@ struct Bone
     Bone() : id(-1), offsetMatrix(1.0f), finalTransformation(1.0f), parentIndex(-1) {}
 };
 
+/**
+ * @brief 레이어 합성 방식
+ */
+enum class AnimationBlendMode
+{
+    Override,  // 아래 레이어 결과를 가중치만큼 대체
+    Additive   // 클립 첫 프레임 대비 변화량을 아래 레이어 결과에 더함
+};
+
 /**
  * @brief Platform-independent Animation system
  * 
  * NO Vulkan dependencies - pure logic class
+ *
+ * 레이어마다 여러 클립을 가중치로 섞고(N-way 블렌드/크로스페이드), 레이어는 본 마스크와 함께
+ * 대체 또는 가산으로 합성. 복사하면 스켈레톤/클립 데이터는 공유하고 재생 상태만 복제되므로
+ * 인스턴스별 플레이어로 사용 가능
  */
 class Animation
 {
@@ -106,32 +128,55 @@ public:
     void setPlaybackSpeed(float speed);
     void setLooping(bool loop);
 
+    // 갱신 단계 분리: advance는 시간/페이드만 진행, evaluate는 포즈가 바뀌었을 때만 본 행렬 계산
+    // (cache가 있고 단일 클립 재생 중이면 (클립, 양자화 시간) 포즈를 인스턴스끼리 재사용)
+    void advance(float deltaTime);
+    void evaluate(AnimationPoseCache* cache = nullptr);
+    bool isPoseDirty() const { return poseDirty_; }
+
+    // 레이어/블렌딩 (레이어 0은 기본 레이어로 항상 존재)
+    uint32_t addLayer(AnimationBlendMode mode, float weight = 1.0f);
+    uint32_t getLayerCount() const { return static_cast<uint32_t>(layers_.size()); }
+    void setLayerWeight(uint32_t layer, float weight);
+    // 노드 서브트리에 마스크 가중치 지정 (처음 지정하면 나머지 노드는 0)
+    void setLayerMask(uint32_t layer, const string& rootNodeName, float weight);
+    void clearLayerMask(uint32_t layer);
+    void clearLayer(uint32_t layer);
+    // 레이어의 다른 클립은 fadeSeconds 동안 빠지고 clipIndex가 1로 올라감 (0이면 즉시 전환)
+    void crossFade(uint32_t clipIndex, float fadeSeconds, uint32_t layer = 0);
+    // N-way 블렌드: 클립 가중치 직접 지정 (레이어 안에서 합으로 정규화)
+    void setBlendWeight(uint32_t clipIndex, float weight, uint32_t layer = 0);
+
     // Bone transformation calculation
     void calculateBoneTransforms(vector<mat4>& transforms, 
            const string& nodeName = "",
         const mat4& parentTransform = mat4(1.0f));
     mat4 getNodeTransformation(const string& nodeName, double time) const;
     int getGlobalBoneIndex(const string& boneName) const;
+    int getNodeIndex(const string& nodeName) const;
+    uint32_t getNodeCount() const { return static_cast<uint32_t>(shared_->nodes.size()); }
 
     // State queries
-    bool hasAnimations() const { return !animations_.empty(); }
-    bool hasBones() const { return !bones_.empty(); }
-    uint32_t getAnimationCount() const { return static_cast<uint32_t>(animations_.size()); }
-    uint32_t getBoneCount() const { return static_cast<uint32_t>(bones_.size()); }
+    bool hasAnimations() const { return !shared_->animations.empty(); }
+    bool hasBones() const { return !shared_->bones.empty(); }
+    uint32_t getAnimationCount() const { return static_cast<uint32_t>(shared_->animations.size()); }
+    uint32_t getBoneCount() const { return static_cast<uint32_t>(shared_->bones.size()); }
     float getDuration() const;
-    float getCurrentTime() const { return currentTime_; }
+    float getCurrentTime() const;
     const string& getCurrentAnimationName() const;
+    uint32_t getCurrentAnimationIndex() const { return currentAnimationIndex_; }
 
  // Bone matrices for GPU upload
   const vector<mat4>& getBoneMatrices() const { return boneMatrices_; }
-    const mat4& getGlobalInverseTransform() const { return globalInverseTransform_; }
-    void setGlobalInverseTransform(const mat4& transform) { globalInverseTransform_ = transform; }
+    const mat4& getGlobalInverseTransform() const { return shared_->globalInverseTransform; }
+    // 공유 데이터는 복사 후 수정하므로 이 플레이어에만 적용됨
+    void setGlobalInverseTransform(const mat4& transform);
 
     // Playback control
     bool isPlaying() const { return isPlaying_; }
     void play() { isPlaying_ = true; }
     void pause() { isPlaying_ = false; }
-    void stop() { currentTime_ = 0.0f; isPlaying_ = false; }
+    void stop();
 
 private:
     struct AnimationData
@@ -140,38 +185,111 @@ private:
         double duration;         // Animation duration in seconds
         double ticksPerSecond;   // Ticks per second
       vector<AnimationChannel> channels;
+        vector<int> nodeChannels;  // scene node index -> channel index (-1: 채널 없음, 로드 시 한 번 해석)
+        vector<int> channelNodes;  // channel index -> scene node index (-1: 대상 노드 없음)
+        AnimationClipKeys keys;    // 커널용 SoA 키프레임 (channels와 같은 순서)
+
+        float getDurationSeconds() const { return static_cast<float>(duration / ticksPerSecond); }
     };
 
+    /**
+     * @brief 노드 배열은 전위 순회 순서라 부모가 항상 자식보다 앞에 있고,
+     *        노드 i의 서브트리는 [i, subtreeEnd) 구간으로 연속
+     */
     struct SceneNode
     {
      string name;
         mat4 transformation;
    int parentIndex;
+        int boneIndex;    // -1이면 본이 아닌 노드
+        int subtreeEnd;
         vector<int> childIndices;
 
-SceneNode() : transformation(1.0f), parentIndex(-1) {}
+SceneNode() : transformation(1.0f), parentIndex(-1), boneIndex(-1), subtreeEnd(0) {}
+    };
+
+    /**
+     * @brief 로드 후 바뀌지 않는 스켈레톤/클립 데이터 (복사본끼리 공유)
+     */
+    struct SharedData
+    {
+        // Animation data
+        vector<AnimationData> animations;
+
+        // Bone data
+        vector<Bone> bones;
+        unordered_map<string, int> boneMapping;  // name -> bone index
+        mat4 globalInverseTransform = mat4(1.0f);
+
+        // Scene graph
+        vector<SceneNode> nodes;
+        unordered_map<string, int> nodeMapping;  // name -> node index
+        vector<AnimationTransform> bindPoses;    // 노드 원래 변환의 TRS 분해 (블렌딩 기준)
+    };
+
+    /**
+     * @brief 레이어 안에서 재생 중인 클립 하나
+     */
+    struct ClipPlayback
+    {
+        uint32_t clip = 0;
+        float time = 0.0f;          // 초
+        float weight = 1.0f;
+        float targetWeight = 1.0f;
+        float fadeRate = 0.0f;      // 초당 가중치 변화량 (0이면 즉시)
+        vector<AnimationKeyCursor> cursors;          // 채널별
+        vector<AnimationTransform> referencePose;    // 가산 레이어 기준 (클립 첫 프레임, 채널별)
+    };
+
+    struct Layer
+    {
+        AnimationBlendMode mode = AnimationBlendMode::Override;
+        float weight = 1.0f;
+        vector<float> nodeMask;   // 노드별 가중치 (비어 있으면 모두 1)
+        vector<ClipPlayback> clips;
     };
 
-    // Animation data
-    vector<AnimationData> animations_;
-    uint32_t currentAnimationIndex_ = 0;
-    float currentTime_ = 0.0f;
+    // 레이어 하나의 노드별 가중 합 (회전은 같은 반구로 맞춘 뒤 합산)
+    struct BlendAccumulator
+    {
+        vec3 translation;
+        vec4 rotation;
+        vec3 scale;
+        float weight;
+    };
+
+    shared_ptr<SharedData> shared_;
+
+    // 재생 상태 (플레이어마다 독립이라 병렬 갱신 시에도 공유되지 않음)
+    vector<Layer> layers_;
+    uint32_t currentAnimationIndex_ = 0;  // 기본 레이어에서 마지막으로 시작한 클립
     float playbackSpeed_ = 1.0f;
     bool isPlaying_ = false;
     bool isLooping_ = true;
-
-    // Bone data
-    vector<Bone> bones_;
-    unordered_map<string, int> boneMapping_;  // name -> bone index
+    bool poseDirty_ = true;
  vector<mat4> boneMatrices_;
-    mat4 globalInverseTransform_;
 
-    // Scene graph
-    vector<SceneNode> sceneNodes_;
-    unordered_map<string, int> nodeMapping_;  // name -> node index
+    // 평가용 작업 버퍼
+    vector<mat4> channelTransforms_;         // 단일 클립 경로: 채널별 로컬 변환
+    vector<AnimationTransform> clipPose_;    // 블렌딩 경로: 클립 하나의 채널별 TRS
+    vector<AnimationTransform> blendPose_;   // 블렌딩 경로: 노드별 합성 결과
+    vector<BlendAccumulator> accumulators_;
+    vector<uint8_t> nodeAnimated_;
+    vector<mat4> localTransforms_;           // 블렌딩 경로: 노드별 로컬 변환
+    vector<mat4> globalTransforms_;          // globalInverse가 곱해진 노드별 전역 변환
 
     // Helper methods
-    void updateBoneMatrices();
+    void resolveBindings();
+    ClipPlayback makePlayback(uint32_t clipIndex, float weight, bool additive) const;
+    ClipPlayback* findPlayback(uint32_t layer, uint32_t clipIndex);
+    const ClipPlayback* getPrimaryPlayback() const;
+    bool isSingleClip() const;
+    void evaluatePose(vector<mat4>& transforms, int beginNode, const mat4& parentTransform);
+    void evaluateNodes(vector<mat4>& transforms, int beginNode, const mat4& parentTransform, ClipPlayback& playback, double animationTime);
+    void evaluateBlended(vector<mat4>& transforms, int beginNode, const mat4& parentTransform);
+    void accumulateLayer(Layer& layer);
+    template <typename LocalTransform>
+    void composeHierarchy(vector<mat4>& transforms, int beginNode, const mat4& parentTransform, LocalTransform localOf);
     const AnimationChannel* findChannel(const string& nodeName) const;
 };
 
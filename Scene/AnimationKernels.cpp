@@ -0,0 +1,428 @@
+﻿#include "AnimationKernels.h"
+#include "Animation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define BIN_ANIMATION_KERNELS_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace BinRenderer {
+
+namespace {
+
+// Eberly, "A Fast and Accurate Estimate for SLERP": sin(tθ) / sinθ를 cosθ의 다항식으로 근사 (8항)
+constexpr uint32_t kSlerpTerms = 8;
+constexpr float kSlerpMu = 1.85298109240830f;
+constexpr float kSlerpU[kSlerpTerms] = {
+    1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f), 1.0f / (3.0f * 7.0f), 1.0f / (4.0f * 9.0f),
+    1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f), kSlerpMu / (8.0f * 17.0f),
+};
+constexpr float kSlerpV[kSlerpTerms] = {
+    1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+    5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, kSlerpMu * 8.0f / 17.0f,
+};
+
+// 두 키 사이 회전이 90도를 넘으면 (쿼터니언 내적 < 0.7) 근사 오차가 1e-6을 넘으므로 glm::slerp로 계산
+constexpr float kPolynomialSlerpMinDot = 0.7f;
+
+struct KeySpan
+{
+    uint32_t key0;
+    uint32_t key1;
+    float factor;
+};
+
+/**
+ * @brief keys[cursor] <= time < keys[cursor + 1] 구간 찾기 (AnimationChannel::interpolateKeys와 같은 규칙)
+ */
+KeySpan locateKey(const AnimationClipKeys::Track& track, const double* times, double time, uint32_t& cursor)
+{
+    const double* keys = times + track.first;
+    const uint32_t last = track.count - 1;
+
+    // 범위 밖은 첫/마지막 키로 고정
+    if (last == 0 || time <= keys[0]) {
+        cursor = 0;
+        return { track.first, track.first, 0.0f };
+    }
+    if (time >= keys[last]) {
+        cursor = last;
+        return { track.first + last, track.first + last, 0.0f };
+    }
+
+    auto search = [&]() {
+        const double* it = std::upper_bound(keys, keys + track.count, time);
+        return static_cast<uint32_t>(it - keys) - 1;
+    };
+
+    if (cursor >= last || time < keys[cursor]) {
+        cursor = search();
+    } else if (time >= keys[cursor + 1]) {
+        ++cursor;
+        if (cursor >= last || time >= keys[cursor + 1]) {
+            cursor = search();
+        }
+    }
+
+    const float factor = static_cast<float>((time - keys[cursor]) / (keys[cursor + 1] - keys[cursor]));
+    return { track.first + cursor, track.first + cursor + 1, factor };
+}
+
+float slerpWeight(float t, float cosThetaMinusOne)
+{
+    const float t2 = t * t;
+    float b = 1.0f;
+    for (int i = kSlerpTerms - 1; i >= 0; --i) {
+        b = 1.0f + (kSlerpU[i] * t2 - kSlerpV[i]) * cosThetaMinusOne * b;
+    }
+    return t * b;
+}
+
+quat interpolateRotation(const quat& q0, const quat& q1, float factor)
+{
+    float cosTheta = q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
+    if (cosTheta < kPolynomialSlerpMinDot && -cosTheta < kPolynomialSlerpMinDot) {
+        return glm::slerp(q0, q1, factor);
+    }
+
+    // 최단 경로: 내적이 음수면 q1 반전
+    const float sign = cosTheta < 0.0f ? -1.0f : 1.0f;
+    cosTheta *= sign;
+    const float w0 = slerpWeight(1.0f - factor, cosTheta - 1.0f);
+    const float w1 = slerpWeight(factor, cosTheta - 1.0f) * sign;
+    return quat(q0.w * w0 + q1.w * w1, q0.x * w0 + q1.x * w1, q0.y * w0 + q1.y * w1, q0.z * w0 + q1.z * w1);
+}
+
+/**
+ * @brief translate(p) * mat4_cast(q) * scale(s)를 행렬 곱 없이 조립 (glm::mat4_cast와 같은 식)
+ */
+void composeTransform(const vec3& p, const quat& q, const vec3& s, mat4& out)
+{
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    out[0] = vec4((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x, 0.0f);
+    out[1] = vec4(2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y, 0.0f);
+    out[2] = vec4(2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z, 0.0f);
+    out[3] = vec4(p, 1.0f);
+}
+
+vec3 loadVec3(const AnimationClipKeys& clip, uint32_t key)
+{
+    return vec3(clip.values[key]);
+}
+
+quat loadQuat(const AnimationClipKeys& clip, uint32_t key)
+{
+    const vec4& v = clip.values[key];
+    return quat(v.w, v.x, v.y, v.z);
+}
+
+#ifdef BIN_ANIMATION_KERNELS_SSE
+/**
+ * @brief 채널 4개의 같은 트랙 키 쌍을 읽어 성분별 레지스터로 전치
+ */
+struct LaneKeys
+{
+    __m128 v0[4];  // key0의 x, y, z, w (lane = 채널)
+    __m128 v1[4];  // key1의 x, y, z, w
+    __m128 factor;
+};
+
+void loadLaneKeys(const AnimationClipKeys& clip, const KeySpan* spans, LaneKeys& out)
+{
+    const float* values = &clip.values.data()->x;
+    for (uint32_t lane = 0; lane < AnimationKernels::kLaneCount; ++lane) {
+        out.v0[lane] = _mm_loadu_ps(values + spans[lane].key0 * 4);
+        out.v1[lane] = _mm_loadu_ps(values + spans[lane].key1 * 4);
+    }
+    _MM_TRANSPOSE4_PS(out.v0[0], out.v0[1], out.v0[2], out.v0[3]);
+    _MM_TRANSPOSE4_PS(out.v1[0], out.v1[1], out.v1[2], out.v1[3]);
+    out.factor = _mm_setr_ps(spans[0].factor, spans[1].factor, spans[2].factor, spans[3].factor);
+}
+
+__m128 slerpWeight(__m128 t, __m128 cosThetaMinusOne)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 b = one;
+    for (int i = kSlerpTerms - 1; i >= 0; --i) {
+        const __m128 term = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(kSlerpU[i]), t2), _mm_set1_ps(kSlerpV[i]));
+        b = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(term, cosThetaMinusOne), b));
+    }
+    return _mm_mul_ps(t, b);
+}
+
+__m128 lerp(__m128 a, __m128 b, __m128 factor, __m128 oneMinusFactor)
+{
+    // glm::mix와 같은 a * (1 - t) + b * t
+    return _mm_add_ps(_mm_mul_ps(a, oneMinusFactor), _mm_mul_ps(b, factor));
+}
+
+void storeColumns(__m128 x, __m128 y, __m128 z, __m128 w, glm::mat4* outputs, uint32_t column, uint32_t laneCount)
+{
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    const __m128 lanes[4] = { x, y, z, w };
+    for (uint32_t lane = 0; lane < laneCount; ++lane) {
+        _mm_storeu_ps(glm::value_ptr(outputs[lane]) + column * 4, lanes[lane]);
+    }
+}
+
+void computeLanes(const LaneKeys& position, const LaneKeys& rotation, const LaneKeys& scale,
+    glm::mat4* outputs, uint32_t laneCount)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    // 위치/스케일 선형 보간
+    const __m128 pfc = _mm_sub_ps(one, position.factor);
+    const __m128 px = lerp(position.v0[0], position.v1[0], position.factor, pfc);
+    const __m128 py = lerp(position.v0[1], position.v1[1], position.factor, pfc);
+    const __m128 pz = lerp(position.v0[2], position.v1[2], position.factor, pfc);
+
+    const __m128 sfc = _mm_sub_ps(one, scale.factor);
+    const __m128 sx = lerp(scale.v0[0], scale.v1[0], scale.factor, sfc);
+    const __m128 sy = lerp(scale.v0[1], scale.v1[1], scale.factor, sfc);
+    const __m128 sz = lerp(scale.v0[2], scale.v1[2], scale.factor, sfc);
+
+    // 회전: 최단 경로로 맞춘 뒤 다항식 slerp
+    const __m128* a = rotation.v0;
+    const __m128* b = rotation.v1;
+    __m128 cosTheta = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])),
+        _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+    const __m128 flip = _mm_and_ps(_mm_cmplt_ps(cosTheta, zero), signBit);
+    cosTheta = _mm_xor_ps(cosTheta, flip);
+
+    const __m128 cosMinusOne = _mm_sub_ps(cosTheta, one);
+    const __m128 w0 = slerpWeight(_mm_sub_ps(one, rotation.factor), cosMinusOne);
+    const __m128 w1 = _mm_xor_ps(slerpWeight(rotation.factor, cosMinusOne), flip);
+    __m128 q[4];
+    for (int c = 0; c < 4; ++c) {
+        q[c] = _mm_add_ps(_mm_mul_ps(a[c], w0), _mm_mul_ps(b[c], w1));
+    }
+
+    // 큰 각은 드물므로 해당 lane만 glm::slerp로 다시 계산
+    const int wideMask = _mm_movemask_ps(_mm_cmplt_ps(cosTheta, _mm_set1_ps(kPolynomialSlerpMinDot)));
+    if (wideMask != 0) {
+        alignas(16) float lanes[4][4];
+        alignas(16) float keys0[4][4];
+        alignas(16) float keys1[4][4];
+        alignas(16) float factors[4];
+        for (int c = 0; c < 4; ++c) {
+            _mm_store_ps(lanes[c], q[c]);
+            _mm_store_ps(keys0[c], a[c]);
+            _mm_store_ps(keys1[c], b[c]);
+        }
+        _mm_store_ps(factors, rotation.factor);
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+            if ((wideMask >> lane) & 1) {
+                const quat q0(keys0[3][lane], keys0[0][lane], keys0[1][lane], keys0[2][lane]);
+                const quat q1(keys1[3][lane], keys1[0][lane], keys1[1][lane], keys1[2][lane]);
+                const quat result = glm::slerp(q0, q1, factors[lane]);
+                lanes[0][lane] = result.x;
+                lanes[1][lane] = result.y;
+                lanes[2][lane] = result.z;
+                lanes[3][lane] = result.w;
+            }
+        }
+        for (int c = 0; c < 4; ++c) {
+            q[c] = _mm_load_ps(lanes[c]);
+        }
+    }
+
+    // TRS 조립 (composeTransform과 같은 식)
+    const __m128 xx = _mm_mul_ps(q[0], q[0]), yy = _mm_mul_ps(q[1], q[1]), zz = _mm_mul_ps(q[2], q[2]);
+    const __m128 xy = _mm_mul_ps(q[0], q[1]), xz = _mm_mul_ps(q[0], q[2]), yz = _mm_mul_ps(q[1], q[2]);
+    const __m128 wx = _mm_mul_ps(q[3], q[0]), wy = _mm_mul_ps(q[3], q[1]), wz = _mm_mul_ps(q[3], q[2]);
+
+    storeColumns(
+        _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx),
+        _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+        _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx),
+        zero, outputs, 0, laneCount);
+    storeColumns(
+        _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy),
+        _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+        _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy),
+        zero, outputs, 1, laneCount);
+    storeColumns(
+        _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz),
+        _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+        _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz),
+        zero, outputs, 2, laneCount);
+    storeColumns(px, py, pz, one, outputs, 3, laneCount);
+}
+#endif
+
+template <typename T, typename Convert>
+void appendTrack(AnimationClipKeys& clip, AnimationClipKeys::Track& track,
+    const vector<AnimationKey<T>>& keys, const vec4& defaultValue, Convert convert)
+{
+    track.first = static_cast<uint32_t>(clip.times.size());
+    track.count = static_cast<uint32_t>(std::max<size_t>(keys.size(), 1));
+    if (keys.empty()) {
+        clip.times.push_back(0.0);
+        clip.values.push_back(defaultValue);
+        return;
+    }
+    for (const auto& key : keys) {
+        clip.times.push_back(key.time);
+        clip.values.push_back(convert(key.value));
+    }
+}
+
+} // namespace
+
+void AnimationClipKeys::build(const vector<AnimationChannel>& source)
+{
+    size_t keyCount = 0;
+    for (const auto& channel : source) {
+        keyCount += std::max<size_t>(channel.positionKeys.size(), 1)
+            + std::max<size_t>(channel.rotationKeys.size(), 1)
+            + std::max<size_t>(channel.scaleKeys.size(), 1);
+    }
+
+    channels.assign(source.size(), ChannelTracks{});
+    times.clear();
+    values.clear();
+    times.reserve(keyCount);
+    values.reserve(keyCount);
+
+    auto fromVec3 = [](const vec3& v) { return vec4(v, 0.0f); };
+    auto fromQuat = [](const quat& q) { return vec4(q.x, q.y, q.z, q.w); };
+    for (size_t c = 0; c < source.size(); ++c) {
+        const AnimationChannel& channel = source[c];
+        appendTrack(*this, channels[c].position, channel.positionKeys, vec4(0.0f), fromVec3);
+        appendTrack(*this, channels[c].rotation, channel.rotationKeys, vec4(0.0f, 0.0f, 0.0f, 1.0f), fromQuat);
+        appendTrack(*this, channels[c].scale, channel.scaleKeys, vec4(1.0f, 1.0f, 1.0f, 0.0f), fromVec3);
+    }
+}
+
+void AnimationKernels::sampleLocalTransformsScalar(const AnimationClipKeys& clip, double time,
+    AnimationKeyCursor* cursors, glm::mat4* localTransforms)
+{
+    const double* times = clip.times.data();
+    for (uint32_t c = 0; c < clip.getChannelCount(); ++c) {
+        const AnimationClipKeys::ChannelTracks& tracks = clip.channels[c];
+
+        const KeySpan p = locateKey(tracks.position, times, time, cursors[c].position);
+        const KeySpan r = locateKey(tracks.rotation, times, time, cursors[c].rotation);
+        const KeySpan s = locateKey(tracks.scale, times, time, cursors[c].scale);
+
+        const vec3 position = glm::mix(loadVec3(clip, p.key0), loadVec3(clip, p.key1), p.factor);
+        const quat rotation = interpolateRotation(loadQuat(clip, r.key0), loadQuat(clip, r.key1), r.factor);
+        const vec3 scale = glm::mix(loadVec3(clip, s.key0), loadVec3(clip, s.key1), s.factor);
+
+        composeTransform(position, rotation, scale, localTransforms[c]);
+    }
+}
+
+void AnimationKernels::sampleLocalPose(const AnimationClipKeys& clip, double time,
+    AnimationKeyCursor* cursors, AnimationTransform* localPose)
+{
+    const double* times = clip.times.data();
+    for (uint32_t c = 0; c < clip.getChannelCount(); ++c) {
+        const AnimationClipKeys::ChannelTracks& tracks = clip.channels[c];
+
+        const KeySpan p = locateKey(tracks.position, times, time, cursors[c].position);
+        const KeySpan r = locateKey(tracks.rotation, times, time, cursors[c].rotation);
+        const KeySpan s = locateKey(tracks.scale, times, time, cursors[c].scale);
+
+        localPose[c].translation = glm::mix(loadVec3(clip, p.key0), loadVec3(clip, p.key1), p.factor);
+        localPose[c].rotation = interpolateRotation(loadQuat(clip, r.key0), loadQuat(clip, r.key1), r.factor);
+        localPose[c].scale = glm::mix(loadVec3(clip, s.key0), loadVec3(clip, s.key1), s.factor);
+    }
+}
+
+void AnimationKernels::compose(const AnimationTransform& transform, glm::mat4& out)
+{
+    composeTransform(transform.translation, transform.rotation, transform.scale, out);
+}
+
+void AnimationKernels::sampleLocalTransforms(const AnimationClipKeys& clip, double time,
+    AnimationKeyCursor* cursors, glm::mat4* localTransforms)
+{
+#ifdef BIN_ANIMATION_KERNELS_SSE
+    const uint32_t channelCount = clip.getChannelCount();
+    const double* times = clip.times.data();
+    KeySpan positions[kLaneCount];
+    KeySpan rotations[kLaneCount];
+    KeySpan scales[kLaneCount];
+    LaneKeys position;
+    LaneKeys rotation;
+    LaneKeys scale;
+
+    for (uint32_t base = 0; base < channelCount; base += kLaneCount) {
+        // 키 검색은 채널마다 분기가 달라 스칼라로, 보간과 조립은 4채널 묶음으로
+        const uint32_t laneCount = std::min(kLaneCount, channelCount - base);
+        for (uint32_t lane = 0; lane < laneCount; ++lane) {
+            const AnimationClipKeys::ChannelTracks& tracks = clip.channels[base + lane];
+            AnimationKeyCursor& cursor = cursors[base + lane];
+            positions[lane] = locateKey(tracks.position, times, time, cursor.position);
+            rotations[lane] = locateKey(tracks.rotation, times, time, cursor.rotation);
+            scales[lane] = locateKey(tracks.scale, times, time, cursor.scale);
+        }
+        // 남는 lane은 첫 lane 복제 (결과는 저장하지 않음)
+        for (uint32_t lane = laneCount; lane < kLaneCount; ++lane) {
+            positions[lane] = positions[0];
+            rotations[lane] = rotations[0];
+            scales[lane] = scales[0];
+        }
+
+        loadLaneKeys(clip, positions, position);
+        loadLaneKeys(clip, rotations, rotation);
+        loadLaneKeys(clip, scales, scale);
+        computeLanes(position, rotation, scale, localTransforms + base, laneCount);
+    }
+#else
+    sampleLocalTransformsScalar(clip, time, cursors, localTransforms);
+#endif
+}
+
+void AnimationKernels::multiply(const glm::mat4& a, const glm::mat4& b, glm::mat4& out)
+{
+#ifdef BIN_ANIMATION_KERNELS_SSE
+    const float* pa = glm::value_ptr(a);
+    const float* pb = glm::value_ptr(b);
+    const __m128 a0 = _mm_loadu_ps(pa);
+    const __m128 a1 = _mm_loadu_ps(pa + 4);
+    const __m128 a2 = _mm_loadu_ps(pa + 8);
+    const __m128 a3 = _mm_loadu_ps(pa + 12);
+
+    // glm::operator*와 같은 순서로 누적 (열 j = a0 * b[j].x + a1 * b[j].y + a2 * b[j].z + a3 * b[j].w)
+    __m128 columns[4];
+    for (int j = 0; j < 4; ++j) {
+        columns[j] = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(a0, _mm_set1_ps(pb[j * 4 + 0])),
+            _mm_mul_ps(a1, _mm_set1_ps(pb[j * 4 + 1]))),
+            _mm_mul_ps(a2, _mm_set1_ps(pb[j * 4 + 2]))),
+            _mm_mul_ps(a3, _mm_set1_ps(pb[j * 4 + 3])));
+    }
+    float* po = glm::value_ptr(out);
+    for (int j = 0; j < 4; ++j) {
+        _mm_storeu_ps(po + j * 4, columns[j]);
+    }
+#else
+    out = a * b;
+#endif
+}
+
+bool AnimationKernels::isSimdEnabled()
+{
+#ifdef BIN_ANIMATION_KERNELS_SSE
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace BinRenderer
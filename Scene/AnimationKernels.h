@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace BinRenderer {
+
+struct AnimationChannel;
+
+/**
+ * @brief 채널별 마지막 키 인덱스 (트랙 시작 기준, 재생 중에는 앞으로만 이동)
+ */
+struct AnimationKeyCursor
+{
+    uint32_t position = 0;
+    uint32_t rotation = 0;
+    uint32_t scale = 0;
+};
+
+/**
+ * @brief 블렌딩용 로컬 변환 (행렬로 조립하기 전의 TRS)
+ */
+struct AnimationTransform
+{
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+};
+
+/**
+ * @brief 클립 하나의 키프레임 저장소 (시간과 값을 분리한 SoA)
+ *
+ * 모든 채널/트랙의 키를 한 배열에 이어 붙이고, 키 검색에 쓰는 시간과 보간에 쓰는 값을 따로 저장.
+ * 값은 키마다 vec4 하나(위치/스케일은 w = 0, 회전은 x, y, z, w)라 인접 키 두 개가 같은 캐시 라인에
+ * 있고 SSE 로드 한 번으로 읽힘. 빈 트랙은 기본값 키 하나로 채움
+ */
+struct AnimationClipKeys
+{
+    struct Track
+    {
+        uint32_t first = 0;
+        uint32_t count = 0;
+    };
+
+    struct ChannelTracks
+    {
+        Track position;
+        Track rotation;
+        Track scale;
+    };
+
+    std::vector<ChannelTracks> channels;
+    std::vector<double> times;
+    std::vector<glm::vec4> values;
+
+    void build(const std::vector<AnimationChannel>& source);
+    uint32_t getChannelCount() const { return static_cast<uint32_t>(channels.size()); }
+};
+
+/**
+ * @brief 스켈레톤 전체를 한 번에 처리하는 애니메이션 커널
+ *
+ * 채널 4개를 SSE 한 묶음으로 샘플링(lerp/slerp)하고 TRS를 아핀 행렬로 바로 조립.
+ * SSE2가 없는 플랫폼은 같은 식의 스칼라 경로 사용
+ */
+class AnimationKernels
+{
+public:
+    static constexpr uint32_t kLaneCount = 4;
+
+    // 채널별 로컬 변환 (translate * rotate * scale, 마지막 행 0 0 0 1)
+    static void sampleLocalTransforms(const AnimationClipKeys& clip, double time,
+        AnimationKeyCursor* cursors, glm::mat4* localTransforms);
+    static void sampleLocalTransformsScalar(const AnimationClipKeys& clip, double time,
+        AnimationKeyCursor* cursors, glm::mat4* localTransforms);
+
+    // 채널별 TRS (블렌딩 경로용, 보간 규칙은 sampleLocalTransforms와 같음)
+    static void sampleLocalPose(const AnimationClipKeys& clip, double time,
+        AnimationKeyCursor* cursors, AnimationTransform* localPose);
+
+    // translate * rotate * scale을 행렬 곱 없이 조립
+    static void compose(const AnimationTransform& transform, glm::mat4& out);
+
+    // out = a * b (out이 a나 b와 같아도 됨)
+    static void multiply(const glm::mat4& a, const glm::mat4& b, glm::mat4& out);
+
+    static bool isSimdEnabled();
+};
+
+} // namespace BinRenderer
@@ -0,0 +1,87 @@
+﻿#include "AnimationPoseCache.h"
+
+#include <cmath>
+#include <functional>
+
+namespace BinRenderer {
+
+size_t AnimationPoseCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = std::hash<const void*>()(key.skeleton);
+    hash ^= std::hash<uint32_t>()(key.clip) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<int64_t>()(key.tick) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+AnimationPoseCache::AnimationPoseCache(float timeStep)
+    : timeStep_(timeStep > 0.0f ? timeStep : 1.0f / 60.0f)
+{
+}
+
+void AnimationPoseCache::setTimeStep(float timeStep)
+{
+    if (timeStep <= 0.0f || timeStep == timeStep_)
+        return;
+
+    // 틱 간격이 바뀌면 기존 키는 의미가 없어짐
+    std::lock_guard<std::mutex> lock(mutex_);
+    timeStep_ = timeStep;
+    entries_.clear();
+}
+
+int64_t AnimationPoseCache::quantize(float timeInSeconds) const
+{
+    return static_cast<int64_t>(std::floor(timeInSeconds / timeStep_));
+}
+
+bool AnimationPoseCache::find(const void* skeleton, uint32_t clip, int64_t tick, std::vector<glm::mat4>& palette)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(Key{ skeleton, clip, tick });
+    if (it == entries_.end()) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    it->second.lastUsedFrame = frame_;
+    palette = it->second.palette;
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void AnimationPoseCache::store(const void* skeleton, uint32_t clip, int64_t tick, const std::vector<glm::mat4>& palette)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[Key{ skeleton, clip, tick }];
+    entry.palette = palette;
+    entry.lastUsedFrame = frame_;
+}
+
+void AnimationPoseCache::beginFrame()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++frame_;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (frame_ - it->second.lastUsedFrame > kMaxIdleFrames) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void AnimationPoseCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+}
+
+uint32_t AnimationPoseCache::getEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<uint32_t>(entries_.size());
+}
+
+} // namespace BinRenderer
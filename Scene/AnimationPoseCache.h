@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace BinRenderer {
+
+/**
+ * @brief (스켈레톤, 클립, 양자화 시간) 단위로 본 팔레트를 공유하는 포즈 캐시
+ *
+ * 같은 모델을 같은 클립으로 재생하는 군중은 시간을 timeStep으로 양자화하면 같은 포즈가 많아지므로
+ * 한 번 계산한 팔레트를 복사해 재사용. 여러 스레드에서 동시에 조회/저장 가능하며,
+ * beginFrame에서 최근 프레임에 쓰이지 않은 항목을 제거해 크기를 제한
+ */
+class AnimationPoseCache
+{
+public:
+    explicit AnimationPoseCache(float timeStep = 1.0f / 60.0f);
+
+    void setTimeStep(float timeStep);
+    float getTimeStep() const { return timeStep_; }
+
+    // 초 단위 시간 -> 틱 (내림, 틱 시간은 항상 원래 시간 이하)
+    int64_t quantize(float timeInSeconds) const;
+    float getTickTime(int64_t tick) const { return static_cast<float>(tick) * timeStep_; }
+
+    // skeleton은 같은 스켈레톤/클립 데이터를 가리키는 식별자 (Animation 공유 데이터 주소)
+    bool find(const void* skeleton, uint32_t clip, int64_t tick, std::vector<glm::mat4>& palette);
+    void store(const void* skeleton, uint32_t clip, int64_t tick, const std::vector<glm::mat4>& palette);
+
+    void beginFrame();
+    void clear();
+
+    uint32_t getEntryCount() const;
+    uint64_t getHitCount() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    struct Key
+    {
+        const void* skeleton;
+        uint32_t clip;
+        int64_t tick;
+
+        bool operator==(const Key& other) const
+        {
+            return skeleton == other.skeleton && clip == other.clip && tick == other.tick;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        std::vector<glm::mat4> palette;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    // 이 프레임 수 동안 쓰이지 않은 포즈는 제거
+    static constexpr uint64_t kMaxIdleFrames = 2;
+
+    float timeStep_;
+    uint64_t frame_ = 0;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    std::atomic<uint64_t> hits_{ 0 };
+    std::atomic<uint64_t> misses_{ 0 };
+};
+
+} // namespace BinRenderer
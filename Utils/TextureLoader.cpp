@@ -1,5 +1,6 @@
 ﻿#include "TextureLoader.h"
 #include "../Core/Logger.h"
+#include "../RHI/Resources/RHIUploadManager.h"
 
 //  API 독립적인 라이브러리만 사용
 #include <ktx.h>
@@ -54,6 +55,22 @@ namespace BinRenderer
 		return RHI_FORMAT_R8G8B8A8_UNORM;
 	}
 
+	//  텍스처 데이터 안의 한 밉/레이어 복사 영역
+	static RHIBufferImageCopy makeCopyRegion(size_t offset, uint32_t mipLevel, uint32_t layer, uint32_t width, uint32_t height)
+	{
+		RHIBufferImageCopy region{};
+		region.bufferOffset = offset;
+		region.bufferRowLength = 0;
+		region.bufferImageHeight = 0;
+		region.imageSubresource.aspectMask = RHI_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = mipLevel;
+		region.imageSubresource.baseArrayLayer = layer;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = { 0, 0, 0 };
+		region.imageExtent = { width, height, 1 };
+		return region;
+	}
+
 	// ========================================
 	// TextureLoader Implementation
 	// ========================================
@@ -196,60 +213,21 @@ namespace BinRenderer
 		// 5. 텍스처 데이터 업로드
 		// ========================================
 		{
-			// 스테이징 버퍼 생성
-			RHIBufferCreateInfo stagingInfo{};
-			stagingInfo.size = textureData.size();
-			stagingInfo.usage = RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;
-			stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-			RHIBufferHandle stagingBuffer = rhi_->createBuffer(stagingInfo);
-			if (!stagingBuffer.isValid())
+			std::vector<RHIBufferImageCopy> regions;
+			for (uint32_t layer = 0; layer < arrayLayers; ++layer)
 			{
-				printLog("[TextureLoader] ❌ Failed to create staging buffer");
-				rhi_->destroyImage(image);
-				return nullptr;
+				for (uint32_t level = 0; level < mipInfos[layer].size(); ++level)
+				{
+					const MipInfo& mip = mipInfos[layer][level];
+					regions.push_back(makeCopyRegion(mip.offset, level, layer, mip.width, mip.height));
+				}
 			}
 
-			// 데이터 복사
-			void* mappedData = rhi_->mapBuffer(stagingBuffer);
-			if (mappedData)
+			if (!uploadImageData(image, textureData.data(), textureData.size(), regions))
 			{
-				std::memcpy(mappedData, textureData.data(), textureData.size());
-				rhi_->unmapBuffer(stagingBuffer);
+				rhi_->destroyImage(image);
+				return nullptr;
 			}
-
-			// 커맨드 버퍼 기록
-			rhi_->beginCommandRecording();
-
-			// 레이아웃 전환: UNDEFINED -> TRANSFER_DST
-			rhi_->cmdTransitionImageLayout(
-				image,
-				RHI_IMAGE_LAYOUT_UNDEFINED,
-				RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				RHI_IMAGE_ASPECT_COLOR_BIT,
-				0, mipLevels,
-				0, arrayLayers
-			);
-
-			// ⚠️ TODO: RHI에 cmdCopyBufferToImage 추가 필요
-			// 지금은 레이아웃 전환만 수행하고 데이터는 복사하지 않음
-			printLog("[TextureLoader] ⚠️  Data copy skipped - need RHI::cmdCopyBufferToImage()");
-
-			// 레이아웃 전환: TRANSFER_DST -> SHADER_READ_ONLY
-			rhi_->cmdTransitionImageLayout(
-				image,
-				RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-				RHI_IMAGE_ASPECT_COLOR_BIT,
-				0, mipLevels,
-				0, arrayLayers
-			);
-
-			rhi_->endCommandRecording();
-			rhi_->submitCommands();
-			rhi_->waitIdle();
-
-			rhi_->destroyBuffer(stagingBuffer);
 		}
 
 		// ========================================
@@ -333,6 +311,19 @@ namespace BinRenderer
 		ktx_size_t ktxSize = ktxTexture_GetDataSize(baseTexture);
 		std::vector<uint8_t> textureData(ktxSize);
 		std::memcpy(textureData.data(), ktxData, ktxSize);
+
+		// 레이어(큐브맵 면)/밉별 복사 영역
+		std::vector<RHIBufferImageCopy> regions;
+		for (uint32_t layer = 0; layer < arrayLayers; ++layer)
+		{
+			for (uint32_t level = 0; level < mipLevels; ++level)
+			{
+				ktx_size_t offset = 0;
+				ktxTexture_GetImageOffset(baseTexture, level, isCubemap ? 0 : layer, isCubemap ? layer : 0, &offset);
+				regions.push_back(makeCopyRegion(offset, level, layer,
+					std::max(1u, width >> level), std::max(1u, height >> level)));
+			}
+		}
 		
 		ktxTexture_Destroy(ktxTexture(ktxTexture2));
 
@@ -361,50 +352,10 @@ namespace BinRenderer
 		// ========================================
 		// 3. 데이터 업로드 (Handle 사용)
 		// ========================================
+		if (!uploadImageData(imageHandle, textureData.data(), textureData.size(), regions))
 		{
-			RHIBufferCreateInfo stagingInfo{};
-			stagingInfo.size = textureData.size();
-			stagingInfo.usage = RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;
-			stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-			RHIBufferHandle stagingBuffer = rhi_->createBuffer(stagingInfo);
-			
-			if (stagingBuffer.isValid())
-			{
-				void* mappedData = rhi_->mapBuffer(stagingBuffer);
-				if (mappedData)
-				{
-					std::memcpy(mappedData, textureData.data(), textureData.size());
-					rhi_->unmapBuffer(stagingBuffer);
-				}
-
-				rhi_->beginCommandRecording();
-
-				rhi_->cmdTransitionImageLayout(
-					imageHandle,
-					RHI_IMAGE_LAYOUT_UNDEFINED,
-					RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-					RHI_IMAGE_ASPECT_COLOR_BIT,
-					0, mipLevels, 0, arrayLayers
-				);
-
-				// TODO: Copy Buffer To Image 구현 필요 (현재는 생략, 실제로는 필요함)
-				// rhi_->cmdCopyBufferToImage(stagingBuffer, imageHandle, ...);
-				
-				rhi_->cmdTransitionImageLayout(
-					imageHandle,
-					RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-					RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-					RHI_IMAGE_ASPECT_COLOR_BIT,
-					0, mipLevels, 0, arrayLayers
-				);
-
-				rhi_->endCommandRecording();
-				rhi_->submitCommands();
-				rhi_->waitIdle();
-
-				rhi_->destroyBuffer(stagingBuffer);
-			}
+			rhi_->destroyImage(imageHandle);
+			return {};
 		}
 
 		// ========================================
@@ -486,55 +437,17 @@ namespace BinRenderer
 		// 3. 텍스처 데이터 업로드
 		// ========================================
 		{
-			RHIBufferCreateInfo stagingInfo{};
-			stagingInfo.size = dataSize;
-			stagingInfo.usage = RHI_BUFFER_USAGE_TRANSFER_SRC_BIT;
-			stagingInfo.memoryProperties = RHI_MEMORY_PROPERTY_HOST_VISIBLE_BIT | RHI_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			std::vector<RHIBufferImageCopy> regions{ makeCopyRegion(0, 0, 0, imageInfo.width, imageInfo.height) };
+			const bool uploaded = uploadImageData(image, pixels, dataSize, regions);
+
+			// 픽셀은 스테이징 링으로 복사됐으므로 바로 해제
+			stbi_image_free(pixels);
 
-			RHIBufferHandle stagingBuffer = rhi_->createBuffer(stagingInfo);
-			if (!stagingBuffer.isValid())
+			if (!uploaded)
 			{
-				printLog("[TextureLoader] ❌ Failed to create staging buffer");
 				rhi_->destroyImage(image);
-				stbi_image_free(pixels);
 				return nullptr;
 			}
-
-			void* mappedData = rhi_->mapBuffer(stagingBuffer);
-			if (mappedData)
-			{
-				std::memcpy(mappedData, pixels, dataSize);
-				rhi_->unmapBuffer(stagingBuffer);
-			}
-
-			stbi_image_free(pixels);
-
-			rhi_->beginCommandRecording();
-
-			rhi_->cmdTransitionImageLayout(
-				image,
-				RHI_IMAGE_LAYOUT_UNDEFINED,
-				RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				RHI_IMAGE_ASPECT_COLOR_BIT,
-				0, 1, 0, 1
-			);
-
-			// ⚠️ TODO: RHI::cmdCopyBufferToImage 필요
-			printLog("[TextureLoader] ⚠️  Data copy skipped - need RHI::cmdCopyBufferToImage()");
-
-			rhi_->cmdTransitionImageLayout(
-				image,
-				RHI_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				RHI_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-				RHI_IMAGE_ASPECT_COLOR_BIT,
-				0, 1, 0, 1
-			);
-
-			rhi_->endCommandRecording();
-			rhi_->submitCommands();
-			rhi_->waitIdle();
-
-			rhi_->destroyBuffer(stagingBuffer);
 		}
 
 		// ========================================
@@ -572,6 +485,24 @@ namespace BinRenderer
 		return nullptr;
 	}
 
+	bool TextureLoader::uploadImageData(RHIImageHandle image, const void* data, size_t size, const std::vector<RHIBufferImageCopy>& regions)
+	{
+		RHIUploadManager* uploadManager = rhi_->getUploadManager();
+		if (!uploadManager)
+		{
+			printLog("[TextureLoader] ❌ Upload manager is not available");
+			return false;
+		}
+
+		// 스테이징 링에 복사해 두고 다음 프레임 시작 시 다른 업로드와 한 배치로 제출 (GPU 대기 없음)
+		if (!uploadManager->uploadImage(image, data, size, regions).isValid())
+		{
+			printLog("[TextureLoader] ❌ Failed to queue texture upload");
+			return false;
+		}
+
+		return true;
+	}
 
 	RHITexture* TextureLoader::createTextureFromData(const LoadedTextureData& loadedData)
 	{
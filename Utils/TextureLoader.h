@@ -62,6 +62,9 @@ namespace BinRenderer
 	private:
 		RHI* rhi_;
 
+		// 업로드 관리자에 이미지 데이터 업로드 예약 (다음 프레임부터 사용 가능)
+		bool uploadImageData(RHIImageHandle image, const void* data, size_t size, const std::vector<RHIBufferImageCopy>& regions);
+
 		// ⚠️ 아래 함수들은 더 이상 사용하지 않음 (레거시)
 		struct LoadedTextureData; // Forward declaration for compatibility
 		RHITexture* createTextureFromData(const LoadedTextureData& loadedData);
@@ -0,0 +1,33 @@
+#version 450
+
+// 가림막 컬링용 Depth 프리패스 (DepthPrepassRG)
+// GpuCullingPassRG(Early)의 Indirect 커맨드로 그림, firstInstance = 레코드 인덱스
+
+layout(location = 0) in vec3 inPosition;
+
+// 드로우 레코드 (gpuCull.comp / gpuOcclusionCull.comp와 같은 배치)
+struct DrawRecord {
+    mat4 model;
+    vec4 boundsCenter;
+    vec4 boundsExtent;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint materialIndex;
+    uint boneOffset;
+    uint skinnedVertexBase;
+    uint padding0;
+    uint padding1;
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer DrawRecords {
+    DrawRecord records[];
+};
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+} pushConstants;
+
+void main() {
+    gl_Position = pushConstants.viewProjection * records[gl_InstanceIndex].model * vec4(inPosition, 1.0);
+}
@@ -0,0 +1,33 @@
+// PBR 드로우 push constant 블록 (C++ PbrPushConstants와 GLSL PushConstants가 함께 include)
+//
+// 128바이트 고정: model(64) + materialIndex(4) + coeffs(4 * PBR_PUSH_COEFF_COUNT) + skinnedVertexBase(4) + boneOffset(4)
+// 필드를 추가하면 coeffs를 줄여 크기를 유지 (fragment 셰이더는 앞쪽 계수만 읽음)
+// - skinnedVertexBase: 프리스키닝 캐시에서 이 드로우의 정점 시작 (0xFFFFFFFF면 캐시 안 씀)
+// - boneOffset: 본 팔레트 SSBO에서 이 드로우의 시작 위치 (0xFFFFFFFF면 스키닝 안 함)
+
+#ifndef PBR_PUSH_CONSTANTS_H
+#define PBR_PUSH_CONSTANTS_H
+
+#define PBR_PUSH_COEFF_COUNT 13
+
+#ifdef __cplusplus
+
+#define PBR_PUSH_CONSTANT_MEMBERS \
+	alignas(16) glm::mat4 model = glm::mat4(1.0f); \
+	alignas(4) uint32_t materialIndex = 0; \
+	alignas(4) float coeffs[PBR_PUSH_COEFF_COUNT] = { 0.0f }; \
+	alignas(4) uint32_t skinnedVertexBase = 0xFFFFFFFFu; \
+	alignas(4) uint32_t boneOffset = 0xFFFFFFFFu;
+
+#else
+
+#define PBR_PUSH_CONSTANT_MEMBERS \
+	mat4 model; \
+	uint materialIndex; \
+	float coeffs[PBR_PUSH_COEFF_COUNT]; \
+	uint skinnedVertexBase; \
+	uint boneOffset;
+
+#endif
+
+#endif // PBR_PUSH_CONSTANTS_H
@@ -1,5 +1,8 @@
 #version 450
 #extension GL_EXT_nonuniform_qualifier : require
+#extension GL_GOOGLE_include_directive : require
+
+#include "include/pbrPushConstants.h"
 
 layout(location = 0) in vec3 fragPos;
 layout(location = 1) in vec3 fragNormal;
@@ -10,9 +13,7 @@ layout(location = 5) in vec3 fragCameraPos;
 layout(location = 6) in vec4 fragPosLightSpace;
 
 layout(push_constant) uniform PushConstants {
-    mat4 model;
-    uint materialIndex;
-    float coeffs[15];    
+    PBR_PUSH_CONSTANT_MEMBERS  // include/pbrPushConstants.h (C++ PbrPushConstants와 공유)
 } pushConstants;
 
 layout(set = 0, binding = 0) uniform SceneDataUBO {
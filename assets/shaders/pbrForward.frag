@@ -1,5 +1,8 @@
 #version 450
 #extension GL_EXT_nonuniform_qualifier : require
+#extension GL_GOOGLE_include_directive : require
+
+#include "include/pbrPushConstants.h"
 
 layout(location = 0) in vec3 fragPos;
 layout(location = 1) in vec3 fragNormal;
@@ -8,11 +11,10 @@ layout(location = 3) in vec3 fragTangent;
 layout(location = 4) in vec3 fragBitangent;
 layout(location = 5) in vec3 fragCameraPos;
 layout(location = 6) in vec4 fragPosLightSpace;
+layout(location = 7) flat in uint fragMaterialIndex;  // Material buffer 인덱스 (정점 셰이더가 push constant/드로우 레코드에서 전달)
 
 layout(push_constant) uniform PushConstants {
-    mat4 model;
-    uint materialIndex;
-    float coeffs[15];    
+    PBR_PUSH_CONSTANT_MEMBERS  // include/pbrPushConstants.h (C++ PbrPushConstants와 공유)
 } pushConstants;
 
 layout(set = 0, binding = 0) uniform SceneDataUBO {
@@ -252,7 +254,7 @@ void main() {
     float shadowOffset = pushConstants.coeffs[3];
 
     // Access material using push constant index
-    MaterialUBO material = materialBuffer.materials[pushConstants.materialIndex];
+    MaterialUBO material = materialBuffer.materials[fragMaterialIndex];
 
     // Sample material properties using bindless access
     vec4 baseColorRGBA = material.baseColorTextureIndex >= 0 ? texture(materialTextures[nonuniformEXT(material.baseColorTextureIndex)], fragTexCoord) : vec4(1.0) ;
@@ -1,4 +1,7 @@
 #version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "include/pbrPushConstants.h"
 
 // ========================================
 // Vertex Input (Half-precision optimized on CPU side)
@@ -46,9 +49,7 @@ layout(set = 0, binding = 2) uniform BoneDataUBO {
 } boneData;
 
 layout(push_constant) uniform PushConstants {
-    mat4 model;
-    uint materialIndex;
-    float coeffs[15];    
+    PBR_PUSH_CONSTANT_MEMBERS  // include/pbrPushConstants.h (C++ PbrPushConstants와 공유)
 } pushConstants;
 
 // Output to fragment shader
@@ -59,6 +60,7 @@ layout(location = 3) out vec3 fragTangent;
 layout(location = 4) out vec3 fragBitangent;
 layout(location = 5) out vec3 fragCameraPos;
 layout(location = 6) out vec4 fragPosLightSpace;
+layout(location = 7) flat out uint fragMaterialIndex;
 
 void main() {
     vec3 position = inPosition;
@@ -137,6 +139,7 @@ void main() {
     // Pass through
     fragTexCoord = inTexCoord;
     fragCameraPos = sceneData.cameraPos;
+    fragMaterialIndex = pushConstants.materialIndex;
     
     // Final transform to clip space
     gl_Position = sceneData.projection * sceneData.view * worldPos;
@@ -0,0 +1,182 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "include/pbrPushConstants.h"
+
+// ========================================
+// Vertex Input (Half-precision optimized on CPU side)
+// ========================================
+
+// Per-vertex attributes
+// ? NOTE: CPU side uses half-precision (f16) for memory optimization
+// GPU automatically unpacks to full precision (f32) for shader computation
+layout(location = 0) in vec3 inPosition;      // hvec3 on CPU -> vec3 in shader
+layout(location = 1) in vec3 inNormal;        // hvec3 on CPU -> vec3 in shader
+layout(location = 2) in vec2 inTexCoord;      // hvec2 on CPU -> vec2 in shader
+layout(location = 3) in vec3 inTangent;       // hvec3 on CPU -> vec3 in shader
+layout(location = 4) in vec3 inBitangent;     // hvec3 on CPU -> vec3 in shader
+layout(location = 5) in vec4 inBoneWeights;   // vec4 (full precision for accuracy)
+layout(location = 6) in ivec4 inBoneIndices;  // ivec4 (full precision for indexing)
+
+// Uniform buffers
+layout(set = 0, binding = 0) uniform SceneDataUBO {
+    mat4 projection;
+    mat4 view;
+    vec3 cameraPos;
+    float padding1;
+    vec3 directionalLightDir;
+    float padding2;
+    vec3 directionalLightColor;
+    float padding3;
+    mat4 lightSpaceMatrix;
+} sceneData;
+
+layout(set = 0, binding = 1) uniform OptionsUBO {
+    bool textureOn;
+    bool shadowOn;
+    bool discardOn;
+    bool animationOn;
+    float ssaoRadius;
+    float ssaoBias;
+    int ssaoSampleCount;
+    float ssaoPower;
+    bool isInstanced;  // Reserved for future GPU Instancing
+} options;
+
+// 본 팔레트 (RHIBonePaletteArena): 스킨드 인스턴스마다 boneOffset부터 본 수만큼, 모델 수/본 수 제한 없음
+layout(std430, set = 0, binding = 2) readonly buffer BonePalettes {
+    mat4 boneMatrices[];
+};
+
+// 프리스키닝 캐시 (RHISkinningCache, skinning.comp와 같은 배치): SkinningPassRG가 이번 프레임에 스키닝한 정점
+struct SkinnedVertex {
+    vec3 position;
+    uint normalXY;
+    uint normalZTangentX;
+    uint tangentYZ;
+    uint bitangentXY;
+    uint bitangentZ;
+};
+
+layout(std430, set = 0, binding = 3) readonly buffer SkinnedVertices {
+    SkinnedVertex skinnedVertices[];
+};
+
+// GPU-driven 경로: 드로우 레코드 (gpuCull.comp와 같은 배치, firstInstance = 레코드 인덱스)
+struct DrawRecord {
+    mat4 model;
+    vec4 boundsCenter;
+    vec4 boundsExtent;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint materialIndex;
+    uint boneOffset;         // 0xFFFFFFFF면 스키닝 안 함
+    uint skinnedVertexBase;  // 0xFFFFFFFF면 프리스키닝 캐시 안 씀
+    uint padding0;
+    uint padding1;
+};
+
+layout(std430, set = 4, binding = 0) readonly buffer DrawRecords {
+    DrawRecord records[];
+};
+
+layout(push_constant) uniform PushConstants {
+    PBR_PUSH_CONSTANT_MEMBERS  // include/pbrPushConstants.h (C++ PbrPushConstants와 공유)
+} pushConstants;
+
+// Output to fragment shader
+layout(location = 0) out vec3 fragPos;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec2 fragTexCoord;
+layout(location = 3) out vec3 fragTangent;
+layout(location = 4) out vec3 fragBitangent;
+layout(location = 5) out vec3 fragCameraPos;
+layout(location = 6) out vec4 fragPosLightSpace;
+layout(location = 7) flat out uint fragMaterialIndex;
+
+void main() {
+    vec3 position = inPosition;
+    vec3 normal = inNormal;
+    vec3 tangent = inTangent;
+    vec3 bitangent = inBitangent;
+    
+    // 레코드의 본 팔레트 시작 위치 (0xFFFFFFFF면 스키닝 안 함)
+    uint boneOffset = records[gl_InstanceIndex].boneOffset;
+    bool hasAnimationEnabled = options.animationOn && boneOffset != 0xFFFFFFFFu;
+    
+    // 합친 정점 버퍼의 인덱스에서 레코드의 vertexOffset을 빼면 메시 로컬 정점 인덱스
+    uint skinnedVertexBase = records[gl_InstanceIndex].skinnedVertexBase;
+    bool preSkinned = options.animationOn && skinnedVertexBase != 0xFFFFFFFFu;
+    if (preSkinned) {
+        SkinnedVertex skinned = skinnedVertices[skinnedVertexBase + uint(gl_VertexIndex - records[gl_InstanceIndex].vertexOffset)];
+        position = skinned.position;
+        normal = vec3(unpackHalf2x16(skinned.normalXY), unpackHalf2x16(skinned.normalZTangentX).x);
+        tangent = vec3(unpackHalf2x16(skinned.normalZTangentX).y, unpackHalf2x16(skinned.tangentYZ));
+        bitangent = vec3(unpackHalf2x16(skinned.bitangentXY), unpackHalf2x16(skinned.bitangentZ).x);
+    }
+
+    // Apply skeletal animation if enabled (캐시가 없을 때만 팔레트로 직접 스키닝)
+    if (!preSkinned && hasAnimationEnabled && (inBoneIndices.x >= 0 || inBoneIndices.y >= 0 || 
+       inBoneIndices.z >= 0 || inBoneIndices.w >= 0)) {
+  
+        vec4 animatedPosition = vec4(0.0);
+        vec3 animatedNormal = vec3(0.0);
+        vec3 animatedTangent = vec3(0.0);
+        vec3 animatedBitangent = vec3(0.0);
+        
+        for (int i = 0; i < 4; i++) {
+            int boneIndex = inBoneIndices[i];
+            float weight = inBoneWeights[i];
+  
+            if (boneIndex >= 0 && weight > 0.0) {
+                mat4 boneMatrix = boneMatrices[boneOffset + uint(boneIndex)];
+     
+                animatedPosition += weight * (boneMatrix * vec4(inPosition, 1.0));
+     
+                mat3 boneNormalMatrix = mat3(boneMatrix);
+                animatedNormal += weight * (boneNormalMatrix * inNormal);
+                animatedTangent += weight * (boneNormalMatrix * inTangent);
+                animatedBitangent += weight * (boneNormalMatrix * inBitangent);
+            }
+        }
+     
+        if (animatedPosition.w > 0.0) {
+            position = animatedPosition.xyz;
+            normal = normalize(animatedNormal);
+            tangent = normalize(animatedTangent);
+            bitangent = normalize(animatedBitangent);
+        }
+    }
+  
+    // Indirect 드로우는 레코드의 model 행렬 사용
+    mat4 modelMatrix = records[gl_InstanceIndex].model;
+
+    // Transform to world space
+    vec4 worldPos = modelMatrix * vec4(position, 1.0);
+    fragPos = worldPos.xyz;
+    
+    const mat4 scaleBias = mat4(
+        0.5, 0.0, 0.0, 0.0, 
+        0.0, 0.5, 0.0, 0.0, 
+        0.0, 0.0, 1.0, 0.0, 
+        0.5, 0.5, 0.0, 1.0
+    );
+
+    // Shadow mapping
+    fragPosLightSpace = scaleBias * sceneData.lightSpaceMatrix * worldPos;
+
+    // Transform normals to world space
+    mat3 normalMatrix = transpose(inverse(mat3(modelMatrix)));
+    fragNormal = normalMatrix * normal;
+    fragTangent = normalMatrix * tangent;
+    fragBitangent = normalMatrix * bitangent;
+    
+    // Pass through
+    fragTexCoord = inTexCoord;
+    fragCameraPos = sceneData.cameraPos;
+    fragMaterialIndex = records[gl_InstanceIndex].materialIndex;
+    
+    // Final transform to clip space
+    gl_Position = sceneData.projection * sceneData.view * worldPos;
+}
\ No newline at end of file